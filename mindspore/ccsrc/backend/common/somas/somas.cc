@@ -147,6 +147,9 @@ bool Somas::LoadSomasCache(const session::KernelGraph *graph) {
 bool Somas::CalcSomasModelHash(const session::KernelGraph *graph) {
   MS_EXCEPTION_IF_NULL(graph);
   auto model_str = SomasInfo(true);
+  if (dataflow_order_) {
+    model_str += "dataflow_order\n";
+  }
   hash_id_ = std::to_string(std::hash<std::string>()(model_str));
   MS_LOG(INFO) << "Graph " << graph->graph_id() << "'s SOMAS Model hash id is " << hash_id_;
   std::string filename = Common::GetCompilerCachePath() + "/somas_meta/somas_graph_" +
@@ -503,7 +506,8 @@ void Somas::InitSomasOutputAndWorkspaceTensors(const session::KernelGraph *graph
 void Somas::InitSomasInputTensors(const session::KernelGraph *graph) {
   MS_LOG(DEBUG) << "Somas InitSomasInputTensors start...";
   MS_EXCEPTION_IF_NULL(graph);
-  bool is_all_nop_node = opt::IsAllNopNode(graph);
+  // The actors launch the nop nodes as real kernels, so the inputs are not linked across them.
+  bool is_all_nop_node = dataflow_order_ || opt::IsAllNopNode(graph);
   static const auto enable_fusion_clear = (common::GetEnv("ENV_FUSION_CLEAR") == "1");
   auto kernel_cnodes = graph->execution_order();
   for (const auto &kernel : kernel_cnodes) {
@@ -1161,6 +1165,9 @@ void Somas::UpdateTensorDestinations() {
     MS_EXCEPTION_IF_NULL(stream);
     auto &nodes = stream->nodes_;
     std::sort(nodes.begin(), nodes.end(), NodeSort);
+    if (dataflow_order_) {
+      continue;
+    }
     for (size_t i = 1; i < nodes.size(); i++) {
       const auto &previous_node = nodes[i - 1];
       const auto &current_node = nodes[i];
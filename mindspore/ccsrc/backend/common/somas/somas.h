@@ -64,6 +64,8 @@ class Somas {
   void set_mem_base_addr(uint8_t *mem_base_addr) { mem_base_addr_ = mem_base_addr; }
   uint8_t *GetNodeOutputPtr(const AnfNodePtr &node, size_t index) const;
   uint8_t *GetNodeWorkSpacePtr(const AnfNodePtr &node, size_t index) const;
+  // The kernels launched by actors only wait for their inputs, so the reuse can't rely on the execution order.
+  void set_dataflow_order(bool dataflow_order) { dataflow_order_ = dataflow_order; }
 
   std::string SomasInfo(bool calc_hash = false) const;
   std::string SomasMemory() const;
@@ -114,6 +116,9 @@ class Somas {
   // Memory base addr
   uint8_t *mem_base_addr_{nullptr};
 
+  // Order the nodes by the data dependency only
+  bool dataflow_order_{false};
+
   // Save debug info
   bool save_graphs_{false};
   std::string save_graphs_path_;
@@ -48,9 +48,43 @@ DynamicMemPoolBestFit::~DynamicMemPoolBestFit() {
   common_mem_->clear();
 }
 
+void DynamicMemPoolBestFit::EnableSizeClassCache() {
+  if (size_class_cache_ != nullptr) {
+    return;
+  }
+  size_class_cache_ = std::make_unique<DynamicMemSizeClassCache>(
+    [this](size_t segment_size) { return AllocTensorMemByBestFit(segment_size, false); });
+  MS_LOG(INFO) << "Enable the size class cache of memory pool, the max class size:"
+               << DynamicMemSizeClassCache::kMaxSizeClassSize << "B.";
+}
+
+std::unique_lock<std::mutex> DynamicMemPoolBestFit::LockPool() {
+  (void)lock_count_.fetch_add(1, std::memory_order_relaxed);
+  std::unique_lock<std::mutex> locker(mutex_, std::try_to_lock);
+  if (!locker.owns_lock()) {
+    (void)contended_count_.fetch_add(1, std::memory_order_relaxed);
+    locker.lock();
+  }
+  return locker;
+}
+
 DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persistent_mem) {
   size_t align_size = AlignMemorySize(size);
-  std::lock_guard<std::mutex> locker(mutex_);
+  if ((size_class_cache_ != nullptr) && !from_persistent_mem && DynamicMemSizeClassCache::IsSizeClass(align_size)) {
+    auto device_addr = size_class_cache_->AllocTensorMem(align_size);
+    if (device_addr != nullptr) {
+      MS_LOG(DEBUG) << "Alloc memory details from size class cache, name:"
+                    << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_ << ", address:" << device_addr
+                    << ", size:" << size << "B.";
+      return device_addr;
+    }
+  }
+  return AllocTensorMemByBestFit(size, from_persistent_mem);
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMemByBestFit(size_t size, bool from_persistent_mem) {
+  size_t align_size = AlignMemorySize(size);
+  auto locker = LockPool();
   // Find the idle memory buf by tensor size, if not find, then add new memory block and memory buf.
   DeviceMemPtr device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
   if (!device_addr) {
@@ -74,7 +108,7 @@ std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const
   std::vector<DeviceMemPtr> device_addr_list;
   size_t total_size = std::accumulate(size_list.begin(), size_list.end(), 0);
   // Pre-alloc the one whole piece memory.
-  auto device_addr = AllocTensorMem(total_size, false);
+  auto device_addr = AllocTensorMemByBestFit(total_size, false);
   if (!device_addr) {
     return device_addr_list;
   }
@@ -314,7 +348,12 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
 
 void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
   MS_EXCEPTION_IF_NULL(device_addr);
-  std::lock_guard<std::mutex> locker(mutex_);
+  if ((size_class_cache_ != nullptr) && size_class_cache_->FreeTensorMem(device_addr)) {
+    MS_LOG(DEBUG) << "Free memory details to size class cache, name:"
+                  << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_ << ", address:" << device_addr;
+    return;
+  }
+  auto locker = LockPool();
   auto fn = [this](const MemStatusManagerPtr &mem_mng, const DeviceMemPtr &device_addr) -> DynamicMemBlockPtr {
     auto mem_block = FindMemBlock(device_addr, mem_mng);
     if (mem_block != nullptr) {
@@ -417,6 +456,12 @@ void DynamicMemPoolBestFit::EraseIdleMemBuf(size_t size, const DeviceMemPtr &dev
 }
 
 void DynamicMemPoolBestFit::ReleaseDeviceRes() {
+  // The segments of size class cache are released with the memory blocks of pool, and the cache locks are taken
+  // before the pool lock, so clear the cache out of the pool lock.
+  if (size_class_cache_ != nullptr) {
+    MS_LOG(INFO) << size_class_cache_->StateInfo();
+    size_class_cache_->Clear();
+  }
   std::lock_guard<std::mutex> locker(mutex_);
   DumpDynamicMemPoolStateInfo();
 
@@ -481,7 +526,11 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
                << "M, kernel output used size:"
                << total_used_size_list[static_cast<int>(AllocatorType::kKernelOutput)] / kMBToByte
                << "M, other used size:" << total_used_size_list[static_cast<int>(AllocatorType::kOther)] / kMBToByte
-               << "M.";
+               << "M. Pool lock count:" << lock_count_.load(std::memory_order_relaxed)
+               << ", contended count:" << contended_count_.load(std::memory_order_relaxed) << ".";
+  if (size_class_cache_ != nullptr) {
+    MS_LOG(INFO) << size_class_cache_->StateInfo();
+  }
 }
 
 void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_DYNAMIC_ALLOCATOR_H_
 #define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_DYNAMIC_ALLOCATOR_H_
 
+#include <atomic>
 #include <memory>
 #include <map>
 #include <vector>
@@ -26,6 +27,7 @@
 #include <mutex>
 #include <string>
 #include "utils/ms_utils.h"
+#include "common/mem_reuse/mem_size_class_cache.h"
 
 namespace mindspore {
 namespace device {
@@ -196,8 +198,14 @@ class DynamicMemPoolBestFit {
   virtual size_t AlignMemorySize(size_t size) const;
   // Calculate memory block required alloc size when adding the memory block.
   virtual size_t CalMemBlockAllocSize(size_t size, bool from_persistent_mem);
+  // Serve the small memory by the thread cached size classes, which is taken from the pool in segments.
+  void EnableSizeClassCache();
 
  private:
+  // Alloc the memory by searching the best fit idle memory buf.
+  DeviceMemPtr AllocTensorMemByBestFit(size_t size, bool from_persistent_mem);
+  // Lock the memory pool and record the lock contention.
+  std::unique_lock<std::mutex> LockPool();
   // Find the idle memory buf by aligned size when memory alloc.
   DeviceMemPtr FindIdleMemBuf(size_t size, bool from_persistent_mem);
   // Add the memory block and memory buf when memory alloc not find the idle memory buf.
@@ -223,6 +231,12 @@ class DynamicMemPoolBestFit {
   // In the graph mode, the unit size set in the context will be modified through the FetchMemUnitSize function, so it
   // needs to be changed back after that
   size_t config_unit_size_{DYNAMIC_MEM_ALLOC_UNIT_SIZE};
+
+  // The front end of the small memory alloc and free, nullptr if it is not enabled.
+  std::unique_ptr<DynamicMemSizeClassCache> size_class_cache_{nullptr};
+  // The statistics of the pool lock contention.
+  std::atomic<uint64_t> lock_count_{0};
+  std::atomic<uint64_t> contended_count_{0};
 };
 }  // namespace device
 }  // namespace mindspore
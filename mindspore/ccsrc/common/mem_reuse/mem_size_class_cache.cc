@@ -0,0 +1,351 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/mem_reuse/mem_size_class_cache.h"
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <utility>
+#include "utils/convert_utils_base.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace device {
+// The free lists and counters are only written by the owner thread, the counters are atomic so that the statistics
+// can read them from other threads.
+struct alignas(64) DynamicMemThreadCache {
+  std::array<std::vector<DeviceMemPtr>, DynamicMemSizeClassCache::kSizeClassNum> free_lists_;
+  std::array<std::atomic<uint64_t>, DynamicMemSizeClassCache::kSizeClassNum> alloc_count_{};
+  std::array<std::atomic<uint64_t>, DynamicMemSizeClassCache::kSizeClassNum> free_count_{};
+  std::atomic<uint64_t> hit_count_{0};
+  std::atomic<uint64_t> miss_count_{0};
+  std::atomic<uint64_t> request_size_{0};
+};
+
+namespace {
+constexpr size_t kBatchSize = 256 << 10;
+constexpr size_t kMaxBatchNum = 64;
+constexpr size_t kPercent = 100;
+
+// Only the owner thread writes the counter, so no atomic read-modify-write is needed.
+void IncreaseCounter(std::atomic<uint64_t> *counter, uint64_t value = 1) {
+  counter->store(counter->load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// The alive caches by id, used to check whether the cache still exists when a thread exits.
+std::mutex &CacheRegistryMutex() {
+  static std::mutex registry_mutex;
+  return registry_mutex;
+}
+
+std::map<uint64_t, DynamicMemSizeClassCache *> &CacheRegistry() {
+  static std::map<uint64_t, DynamicMemSizeClassCache *> registry;
+  return registry;
+}
+
+// The thread caches of the current thread by cache id, returned to the caches when the thread exits.
+class ThreadCacheHolder {
+ public:
+  ThreadCacheHolder() = default;
+  ~ThreadCacheHolder() {
+    for (const auto &item : thread_caches_) {
+      DynamicMemSizeClassCache::ReleaseThreadCache(item.first, item.second);
+    }
+  }
+
+  DynamicMemThreadCache *Get(uint64_t cache_id) const {
+    for (const auto &item : thread_caches_) {
+      if (item.first == cache_id) {
+        return item.second;
+      }
+    }
+    return nullptr;
+  }
+  void Add(uint64_t cache_id, DynamicMemThreadCache *thread_cache) {
+    (void)thread_caches_.emplace_back(cache_id, thread_cache);
+  }
+
+ private:
+  std::vector<std::pair<uint64_t, DynamicMemThreadCache *>> thread_caches_;
+};
+
+thread_local ThreadCacheHolder thread_cache_holder;
+std::atomic<uint64_t> cache_id_generator{0};
+}  // namespace
+
+DynamicMemSizeClassCache::DynamicMemSizeClassCache(SegmentAllocator segment_allocator)
+    : id_(cache_id_generator.fetch_add(1)), segment_allocator_(std::move(segment_allocator)) {
+  std::lock_guard<std::mutex> locker(CacheRegistryMutex());
+  CacheRegistry()[id_] = this;
+}
+
+DynamicMemSizeClassCache::~DynamicMemSizeClassCache() {
+  std::lock_guard<std::mutex> locker(CacheRegistryMutex());
+  (void)CacheRegistry().erase(id_);
+}
+
+size_t DynamicMemSizeClassCache::SizeClassIndex(size_t size) {
+  size_t index = 0;
+  while (SizeClassSize(index) < size) {
+    ++index;
+  }
+  return index;
+}
+
+size_t DynamicMemSizeClassCache::BatchNum(size_t index) {
+  return std::min(std::max(kBatchSize / SizeClassSize(index), static_cast<size_t>(1)), kMaxBatchNum);
+}
+
+DynamicMemThreadCache *DynamicMemSizeClassCache::GetThreadCache() {
+  auto thread_cache = thread_cache_holder.Get(id_);
+  if (thread_cache != nullptr) {
+    return thread_cache;
+  }
+
+  std::lock_guard<std::mutex> locker(thread_cache_mutex_);
+  if (!idle_thread_caches_.empty()) {
+    thread_cache = idle_thread_caches_.back();
+    idle_thread_caches_.pop_back();
+  } else {
+    (void)thread_caches_.emplace_back(std::make_unique<DynamicMemThreadCache>());
+    thread_cache = thread_caches_.back().get();
+  }
+  thread_cache_holder.Add(id_, thread_cache);
+  return thread_cache;
+}
+
+void DynamicMemSizeClassCache::ReleaseThreadCache(uint64_t cache_id, DynamicMemThreadCache *thread_cache) {
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  // Hold the registry lock, so the cache can't be destroyed during the release.
+  std::lock_guard<std::mutex> registry_locker(CacheRegistryMutex());
+  const auto &iter = CacheRegistry().find(cache_id);
+  if (iter == CacheRegistry().end()) {
+    return;
+  }
+  auto cache = iter->second;
+  MS_EXCEPTION_IF_NULL(cache);
+  for (size_t index = 0; index < kSizeClassNum; ++index) {
+    auto &free_objs = thread_cache->free_lists_[index];
+    if (free_objs.empty()) {
+      continue;
+    }
+    auto &central = cache->central_free_lists_[index];
+    auto locker = cache->LockCentral(&central);
+    (void)central.free_objs_.insert(central.free_objs_.end(), free_objs.begin(), free_objs.end());
+    free_objs.clear();
+  }
+  std::lock_guard<std::mutex> locker(cache->thread_cache_mutex_);
+  cache->idle_thread_caches_.push_back(thread_cache);
+}
+
+std::unique_lock<std::mutex> DynamicMemSizeClassCache::LockCentral(CentralFreeList *central) const {
+  MS_EXCEPTION_IF_NULL(central);
+  (void)central->lock_count_.fetch_add(1, std::memory_order_relaxed);
+  std::unique_lock<std::mutex> locker(central->mutex_, std::try_to_lock);
+  if (!locker.owns_lock()) {
+    (void)central->contended_count_.fetch_add(1, std::memory_order_relaxed);
+    locker.lock();
+  }
+  return locker;
+}
+
+DeviceMemPtr DynamicMemSizeClassCache::AllocTensorMem(size_t size) {
+  if (!IsSizeClass(size)) {
+    return nullptr;
+  }
+  auto index = SizeClassIndex(size);
+  auto thread_cache = GetThreadCache();
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  auto &free_objs = thread_cache->free_lists_[index];
+  if (free_objs.empty()) {
+    IncreaseCounter(&thread_cache->miss_count_);
+    if (!FetchFromCentral(index, &free_objs)) {
+      return nullptr;
+    }
+  } else {
+    IncreaseCounter(&thread_cache->hit_count_);
+  }
+
+  auto device_addr = free_objs.back();
+  free_objs.pop_back();
+  IncreaseCounter(&thread_cache->alloc_count_[index]);
+  IncreaseCounter(&thread_cache->request_size_, size);
+  return device_addr;
+}
+
+bool DynamicMemSizeClassCache::FreeTensorMem(const DeviceMemPtr &device_addr) {
+  auto index = FindSizeClass(device_addr);
+  if (index >= kSizeClassNum) {
+    return false;
+  }
+  // The object goes to the cache of the freeing thread, which may be different from the allocating thread.
+  auto thread_cache = GetThreadCache();
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  auto &free_objs = thread_cache->free_lists_[index];
+  free_objs.push_back(device_addr);
+  IncreaseCounter(&thread_cache->free_count_[index]);
+  if (free_objs.size() > BatchNum(index) * 2) {
+    ReleaseToCentral(index, &free_objs);
+  }
+  return true;
+}
+
+size_t DynamicMemSizeClassCache::FindSizeClass(const DeviceMemPtr &device_addr) const {
+  auto addr = reinterpret_cast<uintptr_t>(device_addr);
+  auto segment_num = segment_num_.load(std::memory_order_acquire);
+  for (size_t i = 0; i < segment_num; ++i) {
+    const auto &segment = segments_[i];
+    auto base = reinterpret_cast<uintptr_t>(segment->base_);
+    if ((addr >= base) && (addr - base < kSegmentSize)) {
+      return segment->span_class_[(addr - base) / kSpanSize];
+    }
+  }
+  return kSizeClassNum;
+}
+
+bool DynamicMemSizeClassCache::FetchFromCentral(size_t index, std::vector<DeviceMemPtr> *free_objs) {
+  MS_EXCEPTION_IF_NULL(free_objs);
+  auto &central = central_free_lists_[index];
+  auto locker = LockCentral(&central);
+  if (central.free_objs_.empty() && !CutSpan(index, &central.free_objs_)) {
+    return false;
+  }
+  auto fetch_num = std::min(BatchNum(index), central.free_objs_.size());
+  (void)free_objs->insert(free_objs->end(), central.free_objs_.end() - fetch_num, central.free_objs_.end());
+  central.free_objs_.resize(central.free_objs_.size() - fetch_num);
+  return true;
+}
+
+void DynamicMemSizeClassCache::ReleaseToCentral(size_t index, std::vector<DeviceMemPtr> *free_objs) {
+  MS_EXCEPTION_IF_NULL(free_objs);
+  auto release_num = std::min(BatchNum(index), free_objs->size());
+  auto &central = central_free_lists_[index];
+  auto locker = LockCentral(&central);
+  (void)central.free_objs_.insert(central.free_objs_.end(), free_objs->end() - release_num, free_objs->end());
+  free_objs->resize(free_objs->size() - release_num);
+}
+
+bool DynamicMemSizeClassCache::CutSpan(size_t index, std::vector<DeviceMemPtr> *free_objs) {
+  MS_EXCEPTION_IF_NULL(free_objs);
+  std::lock_guard<std::mutex> locker(segment_mutex_);
+  auto segment_num = segment_num_.load(std::memory_order_relaxed);
+  if ((segment_num == 0) || (segments_[segment_num - 1]->span_num_ == kSpanNumPerSegment)) {
+    if (segment_num == kMaxSegmentNum) {
+      MS_LOG(WARNING) << "The size class cache reaches the maximum segment number " << kMaxSegmentNum;
+      return false;
+    }
+    auto base = segment_allocator_(kSegmentSize);
+    if (base == nullptr) {
+      return false;
+    }
+    auto segment = std::make_unique<Segment>();
+    segment->base_ = base;
+    segments_[segment_num] = std::move(segment);
+    // Publish the segment after it is initialized, the address lookup reads the segments without lock.
+    segment_num_.store(++segment_num, std::memory_order_release);
+  }
+
+  auto &segment = segments_[segment_num - 1];
+  auto span_index = segment->span_num_++;
+  segment->span_class_[span_index] = static_cast<uint8_t>(index);
+  auto span_base = AddressOffset(segment->base_, span_index * kSpanSize);
+  auto obj_size = SizeClassSize(index);
+  for (size_t offset = kSpanSize; offset >= obj_size; offset -= obj_size) {
+    free_objs->push_back(AddressOffset(span_base, offset - obj_size));
+  }
+  (void)central_free_lists_[index].span_num_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void DynamicMemSizeClassCache::Clear() {
+  for (auto &central : central_free_lists_) {
+    std::lock_guard<std::mutex> locker(central.mutex_);
+    central.free_objs_.clear();
+    central.span_num_ = 0;
+  }
+  {
+    std::lock_guard<std::mutex> locker(thread_cache_mutex_);
+    for (auto &thread_cache : thread_caches_) {
+      for (size_t index = 0; index < kSizeClassNum; ++index) {
+        thread_cache->free_lists_[index].clear();
+        thread_cache->alloc_count_[index] = 0;
+        thread_cache->free_count_[index] = 0;
+      }
+    }
+  }
+  std::lock_guard<std::mutex> locker(segment_mutex_);
+  segment_num_ = 0;
+  for (auto &segment : segments_) {
+    segment = nullptr;
+  }
+}
+
+std::string DynamicMemSizeClassCache::StateInfo() const {
+  std::array<uint64_t, kSizeClassNum> used_num{};
+  uint64_t hit_count = 0;
+  uint64_t miss_count = 0;
+  uint64_t request_size = 0;
+  uint64_t alloc_size = 0;
+  size_t thread_num = 0;
+  {
+    std::lock_guard<std::mutex> locker(thread_cache_mutex_);
+    thread_num = thread_caches_.size() - idle_thread_caches_.size();
+    for (const auto &thread_cache : thread_caches_) {
+      for (size_t index = 0; index < kSizeClassNum; ++index) {
+        auto alloc_count = thread_cache->alloc_count_[index].load(std::memory_order_relaxed);
+        used_num[index] += alloc_count;
+        used_num[index] -= thread_cache->free_count_[index].load(std::memory_order_relaxed);
+        alloc_size += alloc_count * SizeClassSize(index);
+      }
+      hit_count += thread_cache->hit_count_.load(std::memory_order_relaxed);
+      miss_count += thread_cache->miss_count_.load(std::memory_order_relaxed);
+      request_size += thread_cache->request_size_.load(std::memory_order_relaxed);
+    }
+  }
+
+  std::ostringstream class_buf;
+  size_t span_size = 0;
+  size_t used_size = 0;
+  uint64_t lock_count = 0;
+  uint64_t contended_count = 0;
+  for (size_t index = 0; index < kSizeClassNum; ++index) {
+    const auto &central = central_free_lists_[index];
+    auto span_num = central.span_num_.load(std::memory_order_relaxed);
+    if (span_num == 0) {
+      continue;
+    }
+    span_size += span_num * kSpanSize;
+    used_size += used_num[index] * SizeClassSize(index);
+    lock_count += central.lock_count_.load(std::memory_order_relaxed);
+    contended_count += central.contended_count_.load(std::memory_order_relaxed);
+    class_buf << ", class[" << SizeClassSize(index) << "B] spans:" << span_num << " used objects:" << used_num[index];
+  }
+
+  auto segment_size = segment_num_.load(std::memory_order_acquire) * kSegmentSize;
+  // The internal fragmentation is the rounding waste of size classes, the external fragmentation is the memory of the
+  // segments which is cached in the free lists or not cut yet.
+  auto internal_fragmentation = alloc_size == 0 ? 0 : (alloc_size - request_size) * kPercent / alloc_size;
+  auto external_fragmentation = segment_size == 0 ? 0 : (segment_size - used_size) * kPercent / segment_size;
+  std::ostringstream buf;
+  buf << "Size class cache info: segment size:" << segment_size << "B, span size:" << span_size
+      << "B, used size:" << used_size << "B, internal fragmentation:" << internal_fragmentation
+      << "%, external fragmentation:" << external_fragmentation << "%, threads:" << thread_num
+      << ", thread cache hits:" << hit_count << ", misses:" << miss_count << ", central lock count:" << lock_count
+      << ", contended count:" << contended_count << class_buf.str();
+  return buf.str();
+}
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,122 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_COMMON_MEM_REUSE_MEM_SIZE_CLASS_CACHE_H_
+#define MINDSPORE_CCSRC_COMMON_MEM_REUSE_MEM_SIZE_CLASS_CACHE_H_
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace device {
+using DeviceMemPtr = void(*);
+
+// The free lists of one thread, defined in the source file.
+struct DynamicMemThreadCache;
+
+// The size class cache serves the small memory of the dynamic memory pool without taking the pool lock. The size is
+// rounded up to a power of two class, and the segments taken from the pool are cut into spans, each span holds the
+// objects of one class. Every thread keeps its own free lists, so the alloc and free are lock-free in the common case,
+// and the objects move between the thread caches and the central free lists of classes in batches.
+class DynamicMemSizeClassCache {
+ public:
+  // Take a segment memory from the memory pool, return nullptr if the memory pool is exhausted.
+  using SegmentAllocator = std::function<DeviceMemPtr(size_t)>;
+
+  static constexpr size_t kMinSizeClassSize = 512;
+  static constexpr size_t kMaxSizeClassSize = 1 << 20;
+  static constexpr size_t kSizeClassNum = 12;
+  static constexpr size_t kSpanSize = 2 << 20;
+  static constexpr size_t kSegmentSize = 64 << 20;
+  static constexpr size_t kSpanNumPerSegment = kSegmentSize / kSpanSize;
+  static constexpr size_t kMaxSegmentNum = 1024;
+
+  explicit DynamicMemSizeClassCache(SegmentAllocator segment_allocator);
+  ~DynamicMemSizeClassCache();
+
+  // Whether the aligned size is served by the size classes.
+  static bool IsSizeClass(size_t size) { return size <= kMaxSizeClassSize; }
+  static size_t SizeClassIndex(size_t size);
+  static size_t SizeClassSize(size_t index) { return kMinSizeClassSize << index; }
+
+  // Return nullptr when no segment can be taken from the memory pool.
+  DeviceMemPtr AllocTensorMem(size_t size);
+  // Return false when the device address doesn't belong to the cache.
+  bool FreeTensorMem(const DeviceMemPtr &device_addr);
+  // Drop all the segments when the memory pool releases the device memory, no memory of the cache can be in use.
+  void Clear();
+  // The fragmentation and contention statistics information.
+  std::string StateInfo() const;
+
+  // Give the free objects of the exiting thread back to the central free lists, if the cache is still alive.
+  static void ReleaseThreadCache(uint64_t cache_id, DynamicMemThreadCache *thread_cache);
+
+ private:
+  struct Segment {
+    DeviceMemPtr base_{nullptr};
+    size_t span_num_{0};
+    // The size class index of every cut span.
+    std::array<uint8_t, kSpanNumPerSegment> span_class_{};
+  };
+
+  struct alignas(64) CentralFreeList {
+    std::mutex mutex_;
+    std::vector<DeviceMemPtr> free_objs_;
+    std::atomic<size_t> span_num_{0};
+    std::atomic<uint64_t> lock_count_{0};
+    std::atomic<uint64_t> contended_count_{0};
+  };
+
+  // The number of objects moved between the thread cache and the central free list at one time.
+  static size_t BatchNum(size_t index);
+
+  DynamicMemThreadCache *GetThreadCache();
+  // Size class index of the device address, kSizeClassNum if the address doesn't belong to the cache.
+  size_t FindSizeClass(const DeviceMemPtr &device_addr) const;
+  // Move a batch of objects from the central free list to the thread free list, cut a new span if necessary.
+  bool FetchFromCentral(size_t index, std::vector<DeviceMemPtr> *free_objs);
+  // Move a batch of objects from the thread free list back to the central free list.
+  void ReleaseToCentral(size_t index, std::vector<DeviceMemPtr> *free_objs);
+  // Cut a new span into the objects of the size class, the lock of central free list must be held.
+  bool CutSpan(size_t index, std::vector<DeviceMemPtr> *free_objs);
+  std::unique_lock<std::mutex> LockCentral(CentralFreeList *central) const;
+
+  uint64_t id_;
+  SegmentAllocator segment_allocator_;
+  std::array<CentralFreeList, kSizeClassNum> central_free_lists_;
+
+  // The segments are only appended, so the address lookup reads them without lock.
+  std::mutex segment_mutex_;
+  std::array<std::unique_ptr<Segment>, kMaxSegmentNum> segments_;
+  std::atomic<size_t> segment_num_{0};
+
+  // All the thread caches created by the cache, the caches of exited threads are reused by new threads.
+  mutable std::mutex thread_cache_mutex_;
+  std::vector<std::unique_ptr<DynamicMemThreadCache>> thread_caches_;
+  std::vector<DynamicMemThreadCache *> idle_thread_caches_;
+
+  DISABLE_COPY_AND_ASSIGN(DynamicMemSizeClassCache);
+};
+}  // namespace device
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_COMMON_MEM_REUSE_MEM_SIZE_CLASS_CACHE_H_
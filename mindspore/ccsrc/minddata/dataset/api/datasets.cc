@@ -910,8 +910,9 @@ std::shared_ptr<DatasetCache> CreateDatasetCacheCharIF(session_id_type id, uint6
                                                        const std::optional<std::vector<char>> &hostname,
                                                        const std::optional<int32_t> &port,
                                                        const std::optional<int32_t> &num_connections,
-                                                       const std::optional<int32_t> &prefetch_sz) {
-  auto cache = std::make_shared<DatasetCacheImpl>(id, mem_sz, spill, hostname, port, num_connections, prefetch_sz);
+                                                       const std::optional<int32_t> &prefetch_sz, bool compress) {
+  auto cache =
+    std::make_shared<DatasetCacheImpl>(id, mem_sz, spill, hostname, port, num_connections, prefetch_sz, compress);
   return cache;
 }
 
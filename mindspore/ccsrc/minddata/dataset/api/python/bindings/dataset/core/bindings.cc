@@ -75,6 +75,33 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_multiprocessing_timeout_interval", &ConfigManager::multiprocessing_timeout_interval)
                     .def("set_dynamic_shape", &ConfigManager::set_dynamic_shape)
                     .def("get_dynamic_shape", &ConfigManager::dynamic_shape)
+                    .def("set_enable_mmap_read", &ConfigManager::set_enable_mmap_read)
+                    .def("get_enable_mmap_read", &ConfigManager::enable_mmap_read)
+                    .def("set_enable_lock_free_queue", &ConfigManager::set_enable_lock_free_queue)
+                    .def("get_enable_lock_free_queue", &ConfigManager::enable_lock_free_queue)
+                    .def("set_op_connector_chunk_size", &ConfigManager::set_op_connector_chunk_size)
+                    .def("get_op_connector_chunk_size", &ConfigManager::op_connector_chunk_size)
+                    .def("set_enable_tensor_mem_pool", &ConfigManager::set_enable_tensor_mem_pool)
+                    .def("get_enable_tensor_mem_pool", &ConfigManager::enable_tensor_mem_pool)
+                    .def("set_tensor_mem_pool_limit", &ConfigManager::set_tensor_mem_pool_limit)
+                    .def("get_tensor_mem_pool_limit", &ConfigManager::tensor_mem_pool_limit)
+                    .def("set_enable_inplace_batch", &ConfigManager::set_enable_inplace_batch)
+                    .def("get_enable_inplace_batch", &ConfigManager::enable_inplace_batch)
+                    .def("set_numa_policy",
+                         [](ConfigManager &c, int32_t policy) { THROW_IF_ERROR(c.set_numa_policy(policy)); })
+                    .def("get_numa_policy",
+                         [](ConfigManager &c) { return static_cast<int32_t>(c.numa_policy()); })
+                    .def("set_enable_tfrecord_record_split", &ConfigManager::set_enable_tfrecord_record_split)
+                    .def("get_enable_tfrecord_record_split", &ConfigManager::enable_tfrecord_record_split)
+                    .def("set_enable_tfrecord_record_shuffle", &ConfigManager::set_enable_tfrecord_record_shuffle)
+                    .def("get_enable_tfrecord_record_shuffle", &ConfigManager::enable_tfrecord_record_shuffle)
+                    .def("set_async_read_depth", &ConfigManager::set_async_read_depth)
+                    .def("get_async_read_depth", &ConfigManager::async_read_depth)
+                    .def("set_read_ahead_window", &ConfigManager::set_read_ahead_window)
+                    .def("get_read_ahead_window", &ConfigManager::read_ahead_window)
+                    .def("set_read_ahead_memory_limit",
+                         [](ConfigManager &c, int32_t limit) { THROW_IF_ERROR(c.set_read_ahead_memory_limit(limit)); })
+                    .def("get_read_ahead_memory_limit", &ConfigManager::read_ahead_memory_limit)
                     .def("load", [](ConfigManager &c, const std::string &s) { THROW_IF_ERROR(c.LoadFile(s)); });
                 }));
 
@@ -25,10 +25,11 @@ PYBIND_REGISTER(CacheClient, 0, ([](const py::module *m) {
                   (void)py::class_<CacheClient, std::shared_ptr<CacheClient>>(*m, "CacheClient")
                     .def(py::init([](session_id_type id, uint64_t mem_sz, bool spill,
                                      std::optional<std::string> hostname, std::optional<int32_t> port,
-                                     std::optional<int32_t> num_connections, std::optional<int32_t> prefetch_sz) {
+                                     std::optional<int32_t> num_connections, std::optional<int32_t> prefetch_sz,
+                                     bool compress) {
                       std::shared_ptr<CacheClient> cc;
                       CacheClient::Builder builder;
-                      builder.SetSessionId(id).SetCacheMemSz(mem_sz).SetSpill(spill);
+                      builder.SetSessionId(id).SetCacheMemSz(mem_sz).SetSpill(spill).SetCompress(compress);
                       if (hostname) builder.SetHostname(hostname.value());
                       if (port) builder.SetPort(port.value());
                       if (num_connections) builder.SetNumConnections(num_connections.value());
@@ -45,7 +46,15 @@ PYBIND_REGISTER(CacheClient, 0, ([](const py::module *m) {
                     .def(py::init<>())
                     .def_readwrite("avg_cache_sz", &CacheServiceStat::avg_cache_sz)
                     .def_readwrite("num_mem_cached", &CacheServiceStat::num_mem_cached)
-                    .def_readwrite("num_disk_cached", &CacheServiceStat::num_disk_cached);
+                    .def_readwrite("num_disk_cached", &CacheServiceStat::num_disk_cached)
+                    .def_readwrite("num_hit", &CacheServiceStat::num_hit)
+                    .def_readwrite("num_miss", &CacheServiceStat::num_miss)
+                    .def_readwrite("num_evicted", &CacheServiceStat::num_evicted)
+                    .def_readwrite("num_promoted", &CacheServiceStat::num_promoted)
+                    .def_readwrite("raw_bytes", &CacheServiceStat::raw_bytes)
+                    .def_readwrite("compressed_bytes", &CacheServiceStat::compressed_bytes)
+                    .def_readwrite("compress_us", &CacheServiceStat::compress_us)
+                    .def_readwrite("decompress_us", &CacheServiceStat::decompress_us);
                 }));
 
 }  // namespace dataset
@@ -25,7 +25,16 @@ namespace mindspore {
 namespace dataset {
 PYBIND_REGISTER(TreeConsumer, 0, ([](const py::module *m) {
                   (void)py::class_<TreeConsumer, std::shared_ptr<TreeConsumer>>(*m, "TreeConsumer")
-                    .def("Reset", [](TreeConsumer &self, int64_t step) { THROW_IF_ERROR(self.Reset(step)); });
+                    .def("Reset", [](TreeConsumer &self, int64_t step) { THROW_IF_ERROR(self.Reset(step)); })
+                    .def("SaveState",
+                         [](TreeConsumer &self, int64_t step) {
+                           std::string state;
+                           THROW_IF_ERROR(self.SaveState(step, &state));
+                           return state;
+                         })
+                    .def("Restore", [](TreeConsumer &self, const std::string &state) {
+                      THROW_IF_ERROR(self.Restore(state));
+                    });
                 }));
 PYBIND_REGISTER(PythonIteratorConsumer, 1, ([](const py::module *m) {
                   (void)py::class_<PythonIteratorConsumer, TreeConsumer, std::shared_ptr<PythonIteratorConsumer>>(
@@ -31,6 +31,7 @@
 #include "minddata/dataset/kernels/ir/vision/cutout_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
 #include "minddata/dataset/kernels/ir/vision/equalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/gaussian_blur_ir.h"
 #include "minddata/dataset/kernels/ir/vision/horizontal_flip_ir.h"
 #include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
@@ -205,6 +206,19 @@ PYBIND_REGISTER(EqualizeOperation, 1, ([](const py::module *m) {
                       }));
                 }));
 
+PYBIND_REGISTER(
+  FusedNormalizeOperation, 1, ([](const py::module *m) {
+    (void)py::class_<vision::FusedNormalizeOperation, TensorOperation,
+                     std::shared_ptr<vision::FusedNormalizeOperation>>(*m, "FusedNormalizeOperation")
+      .def(py::init([](const std::vector<float> &mean, const std::vector<float> &std, float rescale, float shift,
+                       const std::string &dtype, bool hwc_to_chw) {
+        auto fused_normalize = std::make_shared<vision::FusedNormalizeOperation>(
+          std::vector<int32_t>(), mean, std, rescale, shift, DataType(dtype), hwc_to_chw);
+        THROW_IF_ERROR(fused_normalize->ValidateParams());
+        return fused_normalize;
+      }));
+  }));
+
 PYBIND_REGISTER(
   GaussianBlurOperation, 1, ([](const py::module *m) {
     (void)py::class_<vision::GaussianBlurOperation, TensorOperation, std::shared_ptr<vision::GaussianBlurOperation>>(
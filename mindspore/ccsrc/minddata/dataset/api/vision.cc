@@ -32,6 +32,7 @@
 #include "minddata/dataset/kernels/ir/vision/cutout_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
 #include "minddata/dataset/kernels/ir/vision/equalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/gaussian_blur_ir.h"
 #include "minddata/dataset/kernels/ir/vision/horizontal_flip_ir.h"
 #include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
@@ -391,6 +392,28 @@ std::shared_ptr<TensorOperation> DvppDecodePng::Parse(const MapTargetDevice &env
 Equalize::Equalize() = default;
 
 std::shared_ptr<TensorOperation> Equalize::Parse() { return std::make_shared<EqualizeOperation>(); }
+
+// FusedNormalize Transform Operation.
+struct FusedNormalize::Data {
+  Data(const std::vector<float> &mean, const std::vector<float> &std, float rescale, float shift,
+       const std::string &dtype, bool hwc_to_chw)
+      : mean_(mean), std_(std), rescale_(rescale), shift_(shift), dtype_(dtype), hwc_to_chw_(hwc_to_chw) {}
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  float rescale_;
+  float shift_;
+  std::string dtype_;
+  bool hwc_to_chw_;
+};
+
+FusedNormalize::FusedNormalize(const std::vector<float> &mean, const std::vector<float> &std, float rescale,
+                               float shift, const std::vector<char> &dtype, bool hwc_to_chw)
+    : data_(std::make_shared<Data>(mean, std, rescale, shift, CharToString(dtype), hwc_to_chw)) {}
+
+std::shared_ptr<TensorOperation> FusedNormalize::Parse() {
+  return std::make_shared<FusedNormalizeOperation>(std::vector<int32_t>(), data_->mean_, data_->std_, data_->rescale_,
+                                                   data_->shift_, DataType(data_->dtype_), data_->hwc_to_chw_);
+}
 #endif  // not ENABLE_ANDROID
 
 // GaussianBlur Transform Operation.
@@ -164,6 +164,28 @@ void ConfigManager::set_num_connections(int32_t num_connections) { num_connectio
 
 void ConfigManager::set_cache_prefetch_size(int32_t cache_prefetch_size) { cache_prefetch_size_ = cache_prefetch_size; }
 
+Status ConfigManager::set_numa_policy(int32_t policy) {
+  if (policy < static_cast<int32_t>(NumaPolicy::kNone) || policy > static_cast<int32_t>(NumaPolicy::kBalanced)) {
+    std::string err_msg = "Invalid Parameter, numa_policy should be between " +
+                          std::to_string(static_cast<int32_t>(NumaPolicy::kNone)) + " and " +
+                          std::to_string(static_cast<int32_t>(NumaPolicy::kBalanced)) + ", but got " +
+                          std::to_string(policy) + ".";
+    LOG_AND_RETURN_STATUS_SYNTAX_ERROR(err_msg);
+  }
+  numa_policy_ = static_cast<NumaPolicy>(policy);
+  return Status::OK();
+}
+
+Status ConfigManager::set_read_ahead_memory_limit(int32_t limit) {
+  if (limit <= 0) {
+    std::string err_msg =
+      "Invalid Parameter, read_ahead_memory_limit should be larger than 0, but got " + std::to_string(limit) + ".";
+    LOG_AND_RETURN_STATUS_SYNTAX_ERROR(err_msg);
+  }
+  read_ahead_memory_limit_ = limit;
+  return Status::OK();
+}
+
 Status ConfigManager::set_enable_autotune(bool enable, bool save_autoconfig, const std::string &json_filepath) {
   enable_autotune_ = enable;
   save_autoconfig_ = save_autoconfig;
@@ -283,6 +283,105 @@ class ConfigManager {
   // @return - Flag to indicate whether the dataset is dynamic-shape
   bool dynamic_shape() const { return dynamic_shape_; }
 
+  // setter function
+  // @param enable - To read dataset files through memory mapping where supported (MindRecord)
+  void set_enable_mmap_read(bool enable) { enable_mmap_read_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether dataset files are read through memory mapping
+  bool enable_mmap_read() const { return enable_mmap_read_; }
+
+  // setter function
+  // @param enable - To pass rows between operators and their workers through lock free single-producer single-consumer
+  //     queues instead of queues guarded by a mutex
+  void set_enable_lock_free_queue(bool enable) { enable_lock_free_queue_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether the connectors between operators and workers are lock free
+  bool enable_lock_free_queue() const { return enable_lock_free_queue_; }
+
+  // setter function
+  // @param chunk_size - The maximum number of rows an operator moves from its child connector in one pop
+  void set_op_connector_chunk_size(int32_t chunk_size) { op_connector_chunk_size_ = chunk_size; }
+
+  // getter function
+  // @return - The maximum number of rows an operator moves from its child connector in one pop
+  int32_t op_connector_chunk_size() const { return op_connector_chunk_size_; }
+
+  // setter function
+  // @param enable - To let each pipeline recycle the data buffers of its tensors through a pool of its own
+  void set_enable_tensor_mem_pool(bool enable) { enable_tensor_mem_pool_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether each pipeline recycles the data buffers of its tensors
+  bool enable_tensor_mem_pool() const { return enable_tensor_mem_pool_; }
+
+  // setter function
+  // @param limit - The maximum memory in MB the tensor pool of a pipeline holds, including the cached buffers
+  void set_tensor_mem_pool_limit(int32_t limit) { tensor_mem_pool_limit_ = limit; }
+
+  // getter function
+  // @return - The maximum memory in MB the tensor pool of a pipeline holds
+  int32_t tensor_mem_pool_limit() const { return tensor_mem_pool_limit_; }
+
+  // setter function
+  // @param enable - To let the map workers move their output rows straight into the batch buffers of the batch above
+  void set_enable_inplace_batch(bool enable) { enable_inplace_batch_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether batches right above a map are built in place
+  bool enable_inplace_batch() const { return enable_inplace_batch_; }
+
+  // setter function
+  // @param policy - The NumaPolicy used to place the threads of the operators of a pipeline on the NUMA nodes
+  // @return Status error code, if the policy is not a NumaPolicy
+  Status set_numa_policy(int32_t policy);
+
+  // getter function
+  // @return - The NumaPolicy used to place the threads of the operators of a pipeline
+  NumaPolicy numa_policy() const { return numa_policy_; }
+
+  // setter function
+  // @param enable - Whether TFRecord files are split into blocks of records read by different workers
+  void set_enable_tfrecord_record_split(bool enable) { enable_tfrecord_record_split_ = enable; }
+
+  // getter function
+  // @return - Whether TFRecord files are split into blocks of records read by different workers
+  bool enable_tfrecord_record_split() const { return enable_tfrecord_record_split_; }
+
+  // setter function
+  // @param enable - Whether a global shuffle of TFRecord files permutes blocks of records instead of using a buffer
+  void set_enable_tfrecord_record_shuffle(bool enable) { enable_tfrecord_record_shuffle_ = enable; }
+
+  // getter function
+  // @return - Whether a global shuffle of TFRecord files permutes blocks of records instead of using a buffer
+  bool enable_tfrecord_record_shuffle() const { return enable_tfrecord_record_shuffle_; }
+
+  // setter function
+  // @param depth - The number of file reads a leaf operator keeps in flight ahead of its workers, 0 to disable it
+  void set_async_read_depth(int32_t depth) { async_read_depth_ = depth; }
+
+  // getter function
+  // @return - The number of file reads a leaf operator keeps in flight ahead of its workers
+  int32_t async_read_depth() const { return async_read_depth_; }
+
+  // setter function
+  // @param window - The number of rows past the one sent to the workers whose files a leaf operator reads ahead
+  void set_read_ahead_window(int32_t window) { read_ahead_window_ = window; }
+
+  // getter function
+  // @return - The number of rows past the one sent to the workers whose files a leaf operator reads ahead
+  int32_t read_ahead_window() const { return read_ahead_window_; }
+
+  // setter function
+  // @param limit - The memory in MB a leaf operator holds in files read ahead of its workers
+  // @return Status error code, if the limit is not larger than 0
+  Status set_read_ahead_memory_limit(int32_t limit);
+
+  // getter function
+  // @return - The memory in MB a leaf operator holds in files read ahead of its workers
+  int32_t read_ahead_memory_limit() const { return read_ahead_memory_limit_; }
+
  private:
   // Private helper function that takes a nlohmann json format and populates the settings
   // @param j - The json nlohmann json info
@@ -317,6 +416,20 @@ class ConfigManager {
   uint32_t multiprocessing_timeout_interval_;  // Multiprocessing timeout interval in seconds
   std::string autotune_json_filepath_;         // Filepath name of the final AutoTune Configuration JSON file
   bool dynamic_shape_{false};
+  bool enable_mmap_read_{false};        // Read dataset files through memory mapping instead of file streams
+  bool enable_lock_free_queue_{false};  // Use lock free queues for the connectors between operators and workers
+  // Initial number of rows an operator moves from its child connector in one pop, AutoTune may change it
+  int32_t op_connector_chunk_size_{kCfgOpConnectorChunkSize};
+  bool enable_tensor_mem_pool_{false};                     // Recycle tensor buffers through a pool per pipeline
+  int32_t tensor_mem_pool_limit_{kCfgTensorMemPoolLimit};  // Memory in MB held by the tensor pool of a pipeline
+  bool enable_inplace_batch_{false};                       // Build batches in place with the map below them
+  NumaPolicy numa_policy_{NumaPolicy::kNone};              // How the operators are placed on the NUMA nodes
+  bool enable_tfrecord_record_split_{false};               // Let several workers read one TFRecord file
+  bool enable_tfrecord_record_shuffle_{false};             // Shuffle TFRecord files globally by blocks of records
+  int32_t async_read_depth_{0};                            // Initial read depth of leaf ops, AutoTune may change it
+  int32_t read_ahead_window_{0};                           // Rows read ahead past the one sent to the workers
+  // Memory in MB a leaf operator holds in files read ahead of its workers
+  int32_t read_ahead_memory_limit_{kCfgReadAheadMemoryLimit};
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -29,6 +29,7 @@
 #endif
 #include "minddata/dataset/util/allocator.h"
 #include "minddata/dataset/util/system_pool.h"
+#include "minddata/dataset/util/task_manager.h"
 
 namespace mindspore {
 namespace dataset {
@@ -72,6 +73,17 @@ Status GlobalContext::Init() {
   return Status::OK();
 }
 
+std::shared_ptr<MemoryPool> GlobalContext::tensor_mem_pool() const {
+  Task *my_task = TaskManager::FindMe();
+  if (my_task != nullptr) {
+    auto pool = my_task->GetMemoryPool();
+    if (pool != nullptr) {
+      return pool;
+    }
+  }
+  return mem_pool_;
+}
+
 // A print method typically used for debugging
 void GlobalContext::Print(std::ostream &out) const {
   out << "GlobalContext contains the following default config: " << *config_manager_ << "\n";
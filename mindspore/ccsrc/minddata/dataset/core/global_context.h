@@ -86,6 +86,11 @@ class GlobalContext {
   // @return the mem pool
   std::shared_ptr<MemoryPool> mem_pool() const { return mem_pool_; }
 
+  // Getter method
+  // @return the mem pool for the data of tensors created by the calling thread, which is the pool of the pipeline
+  //     when the thread is a task of a pipeline with a tensor pool, or the global mem pool otherwise
+  std::shared_ptr<MemoryPool> tensor_mem_pool() const;
+
   // Getter method
   // @return the tensor allocator as raw pointer
   const TensorAlloc *tensor_allocator() const { return tensor_allocator_.get(); }
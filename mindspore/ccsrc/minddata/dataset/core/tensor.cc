@@ -63,9 +63,14 @@ namespace dataset {
     break;                                                                                      \
   }
 
+namespace {
+// Placement of the numeric tensors allocated by this thread, see Tensor::SetPlacement
+thread_local TensorPlacement *gTensorPlacement = nullptr;
+}  // namespace
+
 Tensor::Tensor(const TensorShape &shape, const DataType &type) : shape_(shape), type_(type), data_(nullptr) {
   // grab the mem pool from global context and create the allocator for char data area
-  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->mem_pool();
+  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->tensor_mem_pool();
   data_allocator_ = std::make_unique<Allocator<unsigned char>>(global_pool);
 }
 
@@ -171,6 +176,22 @@ Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type,
   return Status::OK();
 }
 
+Status Tensor::CreateFromMemoryView(const TensorShape &shape, const DataType &type, uchar *src, const dsize_t &length,
+                                    const std::shared_ptr<MemoryPool> &pool, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(src);
+  RETURN_UNEXPECTED_IF_NULL(pool);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric(), "Only numeric tensor can be created from a memory view.");
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, shape, type);
+  CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Allocate memory failed.");
+  CHECK_FAIL_RETURN_UNEXPECTED((*out)->SizeInBytes() == length, "Length of source data does not match the shape.");
+  (*out)->data_allocator_ = std::make_unique<Allocator<unsigned char>>(pool);
+  (*out)->data_ = src;
+  (*out)->data_end_ = src + length;
+  return Status::OK();
+}
+
 #ifdef ENABLE_PYTHON
 Status Tensor::CreateFromNpString(py::array arr, std::shared_ptr<Tensor> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -481,9 +502,26 @@ void Tensor::PrintData(std::ostream &out) const {
   }
 }
 
+TensorPlacement *Tensor::SetPlacement(TensorPlacement *placement) {
+  TensorPlacement *previous = gTensorPlacement;
+  gTensorPlacement = placement;
+  return previous;
+}
+
+TensorPlacement *Tensor::GetPlacement() { return gTensorPlacement; }
+
 Status Tensor::AllocateBuffer(const dsize_t &length) {
   RETURN_UNEXPECTED_IF_NULL(data_allocator_);
   if (data_ == nullptr) {
+    uchar *buffer = nullptr;
+    std::shared_ptr<MemoryPool> pool;
+    if (gTensorPlacement != nullptr && type_.IsNumeric() && length == SizeInBytes() &&
+        gTensorPlacement->Claim(shape_, type_, &buffer, &pool) && buffer != nullptr && pool != nullptr) {
+      data_allocator_ = std::make_unique<Allocator<unsigned char>>(pool);
+      data_ = buffer;
+      data_end_ = data_ + length;
+      return Status::OK();
+    }
     data_ = data_allocator_->allocate(length);
     CHECK_FAIL_RETURN_UNEXPECTED(data_ != nullptr, "Failed to allocate memory for tensor.");
     data_end_ = data_ + length;
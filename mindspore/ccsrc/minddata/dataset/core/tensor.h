@@ -50,6 +50,7 @@ namespace py = pybind11;
 namespace mindspore {
 namespace dataset {
 class Tensor;
+class MemoryPool;
 template <typename T>
 class Allocator;
 
@@ -58,6 +59,22 @@ using TensorAllocPtr = std::shared_ptr<Allocator<Tensor>>;  // An allocator shar
 using offset_t = uint32_t;                                  // type of offset values to store strings locations
 using TensorPtr = std::shared_ptr<Tensor>;
 
+/// Hands out the memory a numeric tensor is allocated in, so that it is written directly where it is finally needed,
+/// e.g. the slot of its row in a batch. See Tensor::SetPlacement.
+class TensorPlacement {
+ public:
+  virtual ~TensorPlacement() = default;
+
+  /// Claim the memory of a tensor.
+  /// \param[in] shape shape of the tensor
+  /// \param[in] type type of the tensor
+  /// \param[out] buffer memory of SizeInBytes() of the tensor
+  /// \param[out] pool memory pool which keeps the buffer alive, its Deallocate() is called on buffer
+  /// \return false if the tensor has to be allocated as usual
+  virtual bool Claim(const TensorShape &shape, const DataType &type, uchar **buffer,
+                     std::shared_ptr<MemoryPool> *pool) = 0;
+};
+
 class Tensor {
  public:
   Tensor() = delete;
@@ -105,6 +122,29 @@ class Tensor {
   static Status CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src,
                                  const dsize_t &length, TensorPtr *out);
 
+  /// Create a numeric tensor which refers to the given memory instead of owning a copy of it.
+  /// \note The memory must stay valid until the tensor is destroyed, at which point Deallocate() of the given pool is
+  ///     called on src. If the memory is read-only, the caller has to make sure that no one modifies the tensor.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor
+  /// \param[in] src pointer to the source data
+  /// \param[in] length length of the src data
+  /// \param[in] pool memory pool which keeps the source data alive
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateFromMemoryView(const TensorShape &shape, const DataType &type, uchar *src, const dsize_t &length,
+                                     const std::shared_ptr<MemoryPool> &pool, TensorPtr *out);
+
+  /// Set the placement asked for the memory of the numeric tensors allocated by the calling thread from now on.
+  /// \note The tensors created from a memory view don't ask for it, they already have their memory.
+  /// \param[in] placement the placement, nullptr to allocate from the memory pool of the tensors again
+  /// \return the placement set before
+  static TensorPlacement *SetPlacement(TensorPlacement *placement);
+
+  /// Get the placement of the calling thread.
+  /// \return the placement, nullptr if none is set
+  static TensorPlacement *GetPlacement();
+
   /// Create a copy of the input tensor
   /// \param[in] in original tensor to be copied
   /// \param[out] out output tensor to be generated
@@ -788,13 +828,15 @@ inline Tensor::TensorIterator<std::string_view> Tensor::end<std::string_view>()
 /// | bytes 0-3 | bytes 3-6 | bytes 7-10 | bytes 11-14 | bytes 15-17 |
 /// |     11    |    15     |     18     |     abc\0   |      de\0   |
 /// |----------------------------------------------------------------|
+/// The strings may be views into a larger buffer, e.g. the tokens of a sentence, they are copied once into the
+/// Tensor without building a std::string for each of them.
 /// \param[in] items elements of the tensor
 /// \param[in] shape shape of the output tensor
 /// \param[out] out output argument to hold the created Tensor
 /// \return Status Code
 template <>
-inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::string> &items, const TensorShape &shape,
-                                                    TensorPtr *out) {
+inline Status Tensor::CreateFromVector<std::string_view>(const std::vector<std::string_view> &items,
+                                                         const TensorShape &shape, TensorPtr *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   CHECK_FAIL_RETURN_UNEXPECTED(
     static_cast<dsize_t>(items.size()) == shape.NumOfElements(),
@@ -808,7 +850,7 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
       return (*out)->Reshape(shape);
     }
   }
-  auto length_sum = [](size_t sum, const std::string &s) { return s.length() + sum; };
+  auto length_sum = [](size_t sum, const std::string_view &s) { return s.length() + sum; };
   dsize_t total_length = std::accumulate(items.begin(), items.end(), 0, length_sum);
 
   // total bytes needed = offset array + strings
@@ -827,9 +869,12 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
     offset_arr[i++] = offset;
     // total bytes are reduced by kOffsetSize
     num_bytes -= kOffsetSize;
-    // insert actual string
-    int ret_code = memcpy_s((*out)->data_ + offset, num_bytes, common::SafeCStr(str), str.length() + 1);
-    if (ret_code != 0) MS_LOG(ERROR) << "Cannot copy string into Tensor";
+    // insert actual string, a view is not null-terminated
+    if (!str.empty()) {
+      int ret_code = memcpy_s((*out)->data_ + offset, num_bytes, str.data(), str.length());
+      if (ret_code != 0) MS_LOG(ERROR) << "Cannot copy string into Tensor";
+    }
+    (*out)->data_[offset + str.length()] = '\0';
     //  next string will be stored right after the current one.
     offset = offset + str.length() + 1;
     // total bytes are reduced by the length of the string
@@ -846,6 +891,18 @@ inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::strin
   }
   return Status::OK();
 }
+
+/// Create a Tensor from a given list of strings, see the layout above.
+/// \param[in] items elements of the tensor
+/// \param[in] shape shape of the output tensor
+/// \param[out] out output argument to hold the created Tensor
+/// \return Status Code
+template <>
+inline Status Tensor::CreateFromVector<std::string>(const std::vector<std::string> &items, const TensorShape &shape,
+                                                    TensorPtr *out) {
+  std::vector<std::string_view> views(items.begin(), items.end());
+  return CreateFromVector<std::string_view>(views, shape, out);
+}
 /// Create a string scalar Tensor from the given value.
 /// \param[in] item value
 /// \param[out] out Created tensor
@@ -43,7 +43,8 @@ CacheAdminArgHandler::CacheAdminArgHandler()
       memory_cap_ratio_(kDefaultMemoryCapRatio),
       hostname_(kCfgDefaultCacheHost),
       port_(kCfgDefaultCachePort),
-      spill_dir_("") {
+      spill_dir_(""),
+      eviction_policy_(kEvictionPolicyNone) {
   std::string env_cache_host = common::GetEnv("MS_CACHE_HOST");
   std::string env_cache_port = common::GetEnv("MS_CACHE_PORT");
   if (!env_cache_host.empty()) {
@@ -90,6 +91,8 @@ CacheAdminArgHandler::CacheAdminArgHandler()
   arg_map_["--memory_cap_ratio"] = ArgValue::kArgMemoryCapRatio;
   arg_map_["--list_sessions"] = ArgValue::kArgListSessions;
   arg_map_["--server_info"] = ArgValue::kArgServerInfo;
+  arg_map_["-e"] = ArgValue::kArgEvictionPolicy;
+  arg_map_["--eviction_policy"] = ArgValue::kArgEvictionPolicy;
   // Initialize argument tracker with false values
   for (int16_t i = 0; i < static_cast<int16_t>(ArgValue::kArgNumArgs); ++i) {
     ArgValue currAV = static_cast<ArgValue>(i);
@@ -334,6 +337,10 @@ Status CacheAdminArgHandler::ParseArgStream(std::stringstream *arg_stream) {
         RETURN_IF_NOT_OK(AssignArg(tok, &memory_cap_ratio_, arg_stream));
         break;
       }
+      case ArgValue::kArgEvictionPolicy: {
+        RETURN_IF_NOT_OK(AssignArg(tok, &eviction_policy_, arg_stream));
+        break;
+      }
       case ArgValue::kArgListSessions: {
         RETURN_IF_NOT_OK(AssignArg(tok, static_cast<std::string *>(nullptr), arg_stream, CommandId::kCmdListSessions));
         break;
@@ -388,6 +395,13 @@ Status CacheAdminArgHandler::Validate() {
     return Status(StatusCode::kMDSyntaxError, "Memory cap ratio should be positive and no greater than 1");
   }
 
+  CacheEvictionPolicy eviction_policy;
+  RETURN_IF_NOT_OK(StringToEvictionPolicy(eviction_policy_, &eviction_policy));
+  if (eviction_policy != CacheEvictionPolicy::kNone && spill_dir_.empty()) {
+    return Status(StatusCode::kMDSyntaxError,
+                  "Eviction policy " + eviction_policy_ + " requires a spilling directory.");
+  }
+
   if (port_ < kMinLegalPort || port_ > kMaxLegalPort) {
     return Status(StatusCode::kMDSyntaxError, "Port must be in range (1025..65535).");
   }
@@ -443,13 +457,18 @@ Status CacheAdminArgHandler::RunCommand() {
       if (!session_info.empty()) {
         std::cout << std::setw(12) << "Session" << std::setw(12) << "Cache Id" << std::setw(12) << "Mem cached"
                   << std::setw(12) << "Disk cached" << std::setw(16) << "Avg cache size" << std::setw(10) << "Numa hit"
-                  << std::endl;
+                  << std::setw(12) << "Hit" << std::setw(12) << "Miss" << std::setw(12) << "Evicted" << std::setw(12)
+                  << "Promoted" << std::endl;
         for (auto curr_session : session_info) {
           std::string cache_id;
           std::string stat_mem_cached;
           std::string stat_disk_cached;
           std::string stat_avg_cached;
           std::string stat_numa_hit;
+          std::string stat_hit;
+          std::string stat_miss;
+          std::string stat_evicted;
+          std::string stat_promoted;
           uint32_t crc = (curr_session.connection_id & 0x00000000FFFFFFFF);
           cache_id = (curr_session.connection_id == 0) ? "n/a" : std::to_string(crc);
           stat_mem_cached =
@@ -460,10 +479,17 @@ Status CacheAdminArgHandler::RunCommand() {
             (curr_session.stats.avg_cache_sz == 0) ? "n/a" : std::to_string(curr_session.stats.avg_cache_sz);
           stat_numa_hit =
             (curr_session.stats.num_numa_hit == 0) ? "n/a" : std::to_string(curr_session.stats.num_numa_hit);
+          stat_hit = (curr_session.stats.num_hit == 0) ? "n/a" : std::to_string(curr_session.stats.num_hit);
+          stat_miss = (curr_session.stats.num_miss == 0) ? "n/a" : std::to_string(curr_session.stats.num_miss);
+          stat_evicted =
+            (curr_session.stats.num_evicted == 0) ? "n/a" : std::to_string(curr_session.stats.num_evicted);
+          stat_promoted =
+            (curr_session.stats.num_promoted == 0) ? "n/a" : std::to_string(curr_session.stats.num_promoted);
 
           std::cout << std::setw(12) << curr_session.session_id << std::setw(12) << cache_id << std::setw(12)
                     << stat_mem_cached << std::setw(12) << stat_disk_cached << std::setw(16) << stat_avg_cached
-                    << std::setw(10) << stat_numa_hit << std::endl;
+                    << std::setw(10) << stat_numa_hit << std::setw(12) << stat_hit << std::setw(12) << stat_miss
+                    << std::setw(12) << stat_evicted << std::setw(12) << stat_promoted << std::endl;
         }
       } else {
         std::cout << "No active sessions." << std::endl;
@@ -496,6 +522,8 @@ Status CacheAdminArgHandler::ShowServerInfo() {
   int8_t log_level = server_cfg_info.log_level;
   std::string spill_dir = server_cfg_info.spill_dir;
   if (spill_dir.empty()) spill_dir = "None";
+  std::string eviction_policy = server_cfg_info.eviction_policy;
+  if (eviction_policy.empty()) eviction_policy = kEvictionPolicyNone;
 
   int name_w = 20;
   int value_w = 50;
@@ -510,6 +538,8 @@ Status CacheAdminArgHandler::ShowServerInfo() {
   std::cout << std::left << std::setw(name_w) << "log level" << std::setw(value_w) << std::to_string(log_level)
             << std::endl;
   std::cout << std::left << std::setw(name_w) << "spill dir" << std::setw(value_w) << spill_dir << std::endl;
+  std::cout << std::left << std::setw(name_w) << "eviction policy" << std::setw(value_w) << eviction_policy
+            << std::endl;
   std::cout << std::string(name_w + value_w, '-') << std::endl;
 
   std::cout << "Active sessions: " << std::endl;
@@ -642,7 +672,7 @@ Status CacheAdminArgHandler::StartServer() {
     std::string daemonize_string = "true";
     std::string memory_cap_ratio_string = std::to_string(memory_cap_ratio_);
 
-    char *argv[9];
+    char *argv[10];
     argv[0] = cache_server_binary.data();
     argv[1] = spill_dir_.data();
     argv[2] = workers_string.data();
@@ -651,7 +681,8 @@ Status CacheAdminArgHandler::StartServer() {
     argv[5] = minloglevel_string.data();
     argv[6] = daemonize_string.data();
     argv[7] = memory_cap_ratio_string.data();
-    argv[8] = nullptr;
+    argv[8] = eviction_policy_.data();
+    argv[9] = nullptr;
 
     // Now exec the binary
     execv(cache_server_binary.data(), argv);
@@ -671,6 +702,7 @@ void CacheAdminArgHandler::Help() {
   std::cerr << "                [[-w | --workers] <number of workers>]    Default is " << kDefaultNumWorkers << ".\n";
   std::cerr << "                [[-s | --spilldir] <spilling directory>]  Default is no spilling.\n";
   std::cerr << "                [[-l | --loglevel] <log level>]           Default is 1 (INFO level).\n";
+  std::cerr << "                [[-e | --eviction_policy] <policy>]       Default is none (or clock).\n";
   std::cerr << "            [--destroy_session  | -d] <session id>\n";
   std::cerr << "                [[-p | --port] <port number>]\n";
   std::cerr << "            [--generate_session | -g]\n";
@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <iomanip>
+#include <numeric>
 #include "minddata/dataset/engine/cache/cache_client.h"
 #include "minddata/dataset/engine/cache/cache_request.h"
+#include "minddata/dataset/engine/cache/cache_codec.h"
 #include "minddata/dataset/engine/cache/cache_fbb.h"
 #include "minddata/dataset/util/bit.h"
 #include "minddata/dataset/util/task_manager.h"
@@ -24,7 +27,14 @@
 namespace mindspore {
 namespace dataset {
 CacheClient::Builder::Builder()
-    : session_id_(0), cache_mem_sz_(0), spill_(false), hostname_(""), port_(0), num_connections_(0), prefetch_size_(0) {
+    : session_id_(0),
+      cache_mem_sz_(0),
+      spill_(false),
+      hostname_(""),
+      port_(0),
+      num_connections_(0),
+      prefetch_size_(0),
+      compress_(false) {
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
   hostname_ = cfg->cache_host();
   port_ = cfg->cache_port();
@@ -36,7 +46,7 @@ Status CacheClient::Builder::Build(std::shared_ptr<CacheClient> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   RETURN_IF_NOT_OK(SanityCheck());
   *out = std::make_shared<CacheClient>(session_id_, cache_mem_sz_, spill_, hostname_, port_, num_connections_,
-                                       prefetch_size_);
+                                       prefetch_size_, compress_);
   return Status::OK();
 }
 
@@ -55,7 +65,7 @@ Status CacheClient::Builder::SanityCheck() {
 
 // Constructor
 CacheClient::CacheClient(session_id_type session_id, uint64_t cache_mem_sz, bool spill, std::string hostname,
-                         int32_t port, int32_t num_connections, int32_t prefetch_size)
+                         int32_t port, int32_t num_connections, int32_t prefetch_size, bool compress)
     : cache_mem_sz_(cache_mem_sz),
       spill_(spill),
       server_connection_id_(0),
@@ -63,6 +73,11 @@ CacheClient::CacheClient(session_id_type session_id, uint64_t cache_mem_sz, bool
       local_bypass_(false),
       num_connections_(num_connections),
       prefetch_size_(prefetch_size),
+      compress_(compress),
+      raw_bytes_(0),
+      compressed_bytes_(0),
+      compress_us_(0),
+      decompress_us_(0),
       fetch_all_keys_(true) {
   cinfo_.set_session_id(session_id);
   comm_ = std::make_shared<CacheClientGreeter>(hostname, port, num_connections_);
@@ -99,14 +114,14 @@ void CacheClient::Print(std::ostream &out) const {
   out << "  Session id: " << session_id() << "\n  Cache crc: " << cinfo_.crc()
       << "\n  Server cache id: " << server_connection_id_ << "\n  Cache mem size: " << GetCacheMemSz()
       << "\n  Spilling: " << std::boolalpha << isSpill() << "\n  Number of rpc workers: " << GetNumConnections()
-      << "\n  Prefetch size: " << GetPrefetchSize() << "\n  Local client support: " << std::boolalpha
-      << SupportLocalClient();
+      << "\n  Prefetch size: " << GetPrefetchSize() << "\n  Compression: " << std::boolalpha << isCompress()
+      << "\n  Local client support: " << std::boolalpha << SupportLocalClient();
 }
 
 std::string CacheClient::GetHostname() const { return comm_->GetHostname(); }
 int32_t CacheClient::GetPort() const { return comm_->GetPort(); }
 
-Status CacheClient::WriteRow(const TensorRow &row, row_id_type *row_id_from_server) const {
+Status CacheClient::WriteRow(const TensorRow &row, row_id_type *row_id_from_server) {
   auto rq = std::make_shared<CacheRowRequest>(this);
   RETURN_IF_NOT_OK(rq->SerializeCacheRowRequest(this, row));
   RETURN_IF_NOT_OK(PushRequest(rq));
@@ -117,6 +132,46 @@ Status CacheClient::WriteRow(const TensorRow &row, row_id_type *row_id_from_serv
   return Status::OK();
 }
 
+Status CacheClient::SerializeRow(const TensorRow &row, std::shared_ptr<flatbuffers::FlatBufferBuilder> *fbb,
+                                 std::vector<ReadableSlice> *data,
+                                 std::vector<std::vector<uint8_t>> *compressed) {
+  RETURN_UNEXPECTED_IF_NULL(data);
+  RETURN_UNEXPECTED_IF_NULL(compressed);
+  data->clear();
+  data->reserve(row.size());
+  if (!compress_) {
+    RETURN_IF_NOT_OK(::mindspore::dataset::SerializeTensorRowHeader(row, fbb));
+    for (const auto &ts : row) {
+      data->emplace_back(ts->GetBuffer(), ts->SizeInBytes());
+    }
+    return Status::OK();
+  }
+  auto start = std::chrono::steady_clock::now();
+  compressed->resize(row.size());
+  std::vector<int64_t> stored_sz;
+  stored_sz.reserve(row.size());
+  int64_t raw_bytes = 0;
+  for (size_t i = 0; i < row.size(); ++i) {
+    const auto &ts = row[i];
+    auto &buf = compressed->at(i);
+    RETURN_IF_NOT_OK(CompressBlock(ts->GetBuffer(), ts->SizeInBytes(), &buf));
+    // A tensor which does not shrink is sent as it is.
+    if (buf.empty()) {
+      data->emplace_back(ts->GetBuffer(), ts->SizeInBytes());
+    } else {
+      data->emplace_back(buf.data(), buf.size());
+    }
+    stored_sz.push_back(data->back().GetSize());
+    raw_bytes += ts->SizeInBytes();
+  }
+  RETURN_IF_NOT_OK(::mindspore::dataset::SerializeTensorRowHeader(row, fbb, &stored_sz));
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  raw_bytes_ += raw_bytes;
+  compressed_bytes_ += std::accumulate(stored_sz.begin(), stored_sz.end(), int64_t(0));
+  compress_us_ += elapsed.count();
+  return Status::OK();
+}
+
 Status CacheClient::AsyncWriteRow(const TensorRow &row) {
   if (async_buffer_stream_ == nullptr) {
     return Status(StatusCode::kMDNotImplementedYet);
@@ -240,6 +295,10 @@ Status CacheClient::GetStat(CacheServiceStat *stat) {
   RETURN_IF_NOT_OK(PushRequest(rq));
   RETURN_IF_NOT_OK(rq->Wait());
   rq->GetStat(stat);
+  stat->raw_bytes = raw_bytes_;
+  stat->compressed_bytes = compressed_bytes_;
+  stat->compress_us = compress_us_;
+  stat->decompress_us = decompress_us_;
   return Status::OK();
 }
 
@@ -389,15 +448,17 @@ Status CacheClient::AsyncBufferStream::Init(CacheClient *cc) {
 }
 
 Status CacheClient::AsyncBufferStream::AsyncWrite(const TensorRow &row) {
+  std::shared_ptr<flatbuffers::FlatBufferBuilder> fbb;
+  std::vector<ReadableSlice> data;
+  std::vector<std::vector<uint8_t>> compressed;
+  RETURN_IF_NOT_OK(cc_->SerializeRow(row, &fbb, &data, &compressed));
   std::vector<ReadableSlice> v;
   v.reserve(row.size() + 1);
-  std::shared_ptr<flatbuffers::FlatBufferBuilder> fbb;
-  RETURN_IF_NOT_OK(::mindspore::dataset::SerializeTensorRowHeader(row, &fbb));
   int64_t sz = fbb->GetSize();
   v.emplace_back(fbb->GetBufferPointer(), sz);
-  for (const auto &ts : row) {
-    sz += ts->SizeInBytes();
-    v.emplace_back(ts->GetBuffer(), ts->SizeInBytes());
+  for (const auto &slice : data) {
+    sz += slice.GetSize();
+    v.push_back(slice);
   }
   // If the size is too big, tell the user to send it directly.
   if (sz > kAsyncBufferSize) {
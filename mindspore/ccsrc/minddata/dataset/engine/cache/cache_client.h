@@ -38,6 +38,7 @@
 #include "minddata/dataset/util/lock.h"
 #include "minddata/dataset/util/cond_var.h"
 #include "minddata/dataset/util/queue_map.h"
+#include "minddata/dataset/util/slice.h"
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/util/wait_post.h"
 
@@ -117,6 +118,14 @@ class CacheClient {
       return *this;
     }
 
+    /// Setter function to compress the rows sent to the cache server
+    /// \param compress
+    /// \return Builder object itself
+    Builder &SetCompress(bool compress) {
+      compress_ = compress;
+      return *this;
+    }
+
     /// Getter functions
     session_id_type GetSessionId() const { return session_id_; }
     uint64_t GetCacheMemSz() const { return cache_mem_sz_; }
@@ -125,6 +134,7 @@ class CacheClient {
     int32_t GetPort() const { return port_; }
     int32_t GetNumConnections() const { return num_connections_; }
     int32_t GetPrefetchSize() const { return prefetch_size_; }
+    bool isCompress() const { return compress_; }
 
     Status SanityCheck();
 
@@ -138,14 +148,16 @@ class CacheClient {
     int32_t port_;
     int32_t num_connections_;
     int32_t prefetch_size_;
+    bool compress_;
   };
 
   /// \brief Constructor
   /// \param session_id A user assigned session id for the current pipeline
   /// \param cache_mem_sz Size of the memory set aside for the row caching. 0 for unlimited
   /// \param spill Spill to disk if out of memory
+  /// \param compress Compress the rows sent to the server, and decompress them when they are fetched back
   CacheClient(session_id_type session_id, uint64_t cache_mem_sz, bool spill, std::string hostname, int32_t port,
-              int32_t num_connections, int32_t prefetch_size);
+              int32_t num_connections, int32_t prefetch_size, bool compress = false);
 
   /// \brief Destructor
   ~CacheClient();
@@ -154,7 +166,7 @@ class CacheClient {
   /// \param[in] row
   /// \param[out] row_id_from_server Optional. The row id assigned by the server for non-mappable dataset
   /// \return return code
-  Status WriteRow(const TensorRow &row, row_id_type *row_id_from_server = nullptr) const;
+  Status WriteRow(const TensorRow &row, row_id_type *row_id_from_server = nullptr);
 
   /// \brief Fetch a list of rows from the cache server. An empty TensorRow will be returned if there is
   /// any cache miss
@@ -173,7 +185,7 @@ class CacheClient {
   /// \return Status object
   Status DestroyCache();
 
-  /// \brief Get the statistics from a cache.
+  /// \brief Get the statistics from a cache. The compression statistics are the ones of this client.
   /// \param[in/out] Pointer to a pre-allocated ServiceStat object
   /// \return Status object
   Status GetStat(CacheServiceStat *);
@@ -231,6 +243,7 @@ class CacheClient {
   bool isSpill() const { return spill_; }
   int32_t GetNumConnections() const { return num_connections_; }
   int32_t GetPrefetchSize() const { return prefetch_size_; }
+  bool isCompress() const { return compress_; }
   int32_t GetClientId() const { return client_id_; }
   std::string GetHostname() const;
   int32_t GetPort() const;
@@ -257,6 +270,16 @@ class CacheClient {
   /// \brief Serialize a Tensor into the async buffer.
   Status AsyncWriteRow(const TensorRow &row);
 
+  /// \brief Serialize the header of a row and pick the bytes to send for each of its tensors, which are
+  /// compressed if the client is asked to.
+  /// \param[in] row The row to cache
+  /// \param[out] fbb The serialized header of the row
+  /// \param[out] data The bytes to send for each tensor
+  /// \param[out] compressed Storage of the compressed tensors that data points to
+  /// \return Status object
+  Status SerializeRow(const TensorRow &row, std::shared_ptr<flatbuffers::FlatBufferBuilder> *fbb,
+                      std::vector<ReadableSlice> *data, std::vector<std::vector<uint8_t>> *compressed);
+
   // Default size of the async write buffer
   constexpr static int64_t kAsyncBufferSize = 16 * 1048576L;  // 16M
   constexpr static int32_t kNumAsyncBuffer = 3;
@@ -286,6 +309,13 @@ class CacheClient {
   bool local_bypass_;
   int32_t num_connections_;
   int32_t prefetch_size_;
+  bool compress_;
+  // Compression statistics of the rows written and fetched by this client. The rows are fetched through const
+  // requests, which only add up the time spent decompressing.
+  std::atomic<int64_t> raw_bytes_;
+  std::atomic<int64_t> compressed_bytes_;
+  std::atomic<int64_t> compress_us_;
+  mutable std::atomic<int64_t> decompress_us_;
   mutable std::shared_ptr<CacheClientGreeter> comm_;
   std::atomic<bool> fetch_all_keys_;
   WaitPost cache_miss_keys_wp_;
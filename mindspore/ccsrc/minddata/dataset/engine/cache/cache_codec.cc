@@ -0,0 +1,197 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/cache/cache_codec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int64_t kMinMatch = 4;
+constexpr int64_t kLastLiterals = 5;
+constexpr int64_t kMaxOffset = 65535;
+constexpr int32_t kHashBits = 12;
+constexpr uint32_t kHashPrime = 2654435761U;
+constexpr int32_t kRunBits = 4;
+constexpr int64_t kRunMask = 15;
+constexpr int64_t kMaxByte = 255;
+constexpr int32_t kByteBits = 8;
+// The search moves on faster and faster on data it can't find any match in, which is typical of
+// jpeg images or other data that is already compressed.
+constexpr int32_t kSkipBits = 6;
+const char kCorrupted[] = "Compressed cache data is corrupted.";
+
+inline uint32_t Read32(const uint8_t *p) {
+  uint32_t v;
+  (void)memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint32_t Hash(uint32_t v) { return (v * kHashPrime) >> (sizeof(uint32_t) * kByteBits - kHashBits); }
+
+// Upper bound of the bytes taken by a length which does not fit in the token.
+inline int64_t LengthBound(int64_t len) { return len / kMaxByte + 1; }
+
+inline uint8_t *PutLength(int64_t len, uint8_t *op) {
+  while (len >= kMaxByte) {
+    *op++ = static_cast<uint8_t>(kMaxByte);
+    len -= kMaxByte;
+  }
+  *op++ = static_cast<uint8_t>(len);
+  return op;
+}
+
+// Write a sequence of literals followed by a match, or only literals if match_len is 0.
+// Returns nullptr if it does not fit before oend.
+uint8_t *PutSequence(const uint8_t *literals, int64_t num_literals, int64_t offset, int64_t match_len, uint8_t *op,
+                     const uint8_t *oend) {
+  const int64_t run = match_len > 0 ? match_len - kMinMatch : 0;
+  const int64_t need = 1 + LengthBound(num_literals) + num_literals + sizeof(uint16_t) + LengthBound(run);
+  if (need > oend - op) {
+    return nullptr;
+  }
+  uint8_t *token = op++;
+  *token = static_cast<uint8_t>(std::min(num_literals, kRunMask) << kRunBits);
+  if (num_literals >= kRunMask) {
+    op = PutLength(num_literals - kRunMask, op);
+  }
+  (void)memcpy(op, literals, num_literals);
+  op += num_literals;
+  if (match_len > 0) {
+    *token |= static_cast<uint8_t>(std::min(run, kRunMask));
+    *op++ = static_cast<uint8_t>(offset & kMaxByte);
+    *op++ = static_cast<uint8_t>(offset >> kByteBits);
+    if (run >= kRunMask) {
+      op = PutLength(run - kRunMask, op);
+    }
+  }
+  return op;
+}
+
+inline Status GetLength(const uint8_t **ip, const uint8_t *iend, int64_t *len) {
+  uint8_t b;
+  do {
+    CHECK_FAIL_RETURN_UNEXPECTED(*ip < iend, kCorrupted);
+    b = *(*ip)++;
+    *len += b;
+  } while (b == kMaxByte);
+  return Status::OK();
+}
+}  // namespace
+
+Status CompressBlock(const void *src, int64_t src_sz, std::vector<uint8_t> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  out->clear();
+  if (src_sz <= kMinMatch + kLastLiterals) {
+    return Status::OK();
+  }
+  RETURN_UNEXPECTED_IF_NULL(src);
+  const auto *base = static_cast<const uint8_t *>(src);
+  // Anything not smaller than the source is useless, so it is also the size of the output buffer.
+  out->resize(src_sz);
+  uint8_t *op = out->data();
+  const uint8_t *oend = op + src_sz;
+  // Last position where each hash of 4 bytes is seen, reused by all the blocks a thread compresses. Every block
+  // stores its positions above the ones of the blocks before it, so the entries they left are seen as empty
+  // without clearing the table.
+  thread_local std::vector<int64_t> table(1u << kHashBits, 0);
+  thread_local int64_t next_table_base = 0;
+  const int64_t table_base = next_table_base;
+  next_table_base += src_sz + 1;
+  const int64_t match_limit = src_sz - kLastLiterals;
+  int64_t anchor = 0;
+  int64_t pos = 0;
+  int64_t num_misses = 0;
+  while (pos + kMinMatch <= match_limit) {
+    uint32_t seq = Read32(base + pos);
+    int64_t &slot = table[Hash(seq)];
+    int64_t ref = slot > table_base ? slot - table_base - 1 : -1;
+    slot = table_base + pos + 1;
+    if (ref < 0 || pos - ref > kMaxOffset || Read32(base + ref) != seq) {
+      pos += 1 + (num_misses++ >> kSkipBits);
+      continue;
+    }
+    int64_t len = kMinMatch;
+    while (pos + len < match_limit && base[ref + len] == base[pos + len]) {
+      ++len;
+    }
+    op = PutSequence(base + anchor, pos - anchor, pos - ref, len, op, oend);
+    if (op == nullptr) {
+      out->clear();
+      return Status::OK();
+    }
+    pos += len;
+    anchor = pos;
+    num_misses = 0;
+  }
+  op = PutSequence(base + anchor, src_sz - anchor, 0, 0, op, oend);
+  if (op == nullptr || op == oend) {
+    out->clear();
+    return Status::OK();
+  }
+  out->resize(op - out->data());
+  return Status::OK();
+}
+
+Status DecompressBlock(const void *src, int64_t src_sz, void *dest, int64_t dest_sz) {
+  RETURN_UNEXPECTED_IF_NULL(src);
+  RETURN_UNEXPECTED_IF_NULL(dest);
+  const auto *ip = static_cast<const uint8_t *>(src);
+  const uint8_t *iend = ip + src_sz;
+  auto *obegin = static_cast<uint8_t *>(dest);
+  uint8_t *op = obegin;
+  uint8_t *oend = op + dest_sz;
+  while (ip < iend) {
+    const uint8_t token = *ip++;
+    int64_t len = token >> kRunBits;
+    if (len == kRunMask) {
+      RETURN_IF_NOT_OK(GetLength(&ip, iend, &len));
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(len <= iend - ip && len <= oend - op, kCorrupted);
+    (void)memcpy(op, ip, len);
+    ip += len;
+    op += len;
+    // The last sequence has no match.
+    if (ip == iend) {
+      break;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(iend - ip >= static_cast<int64_t>(sizeof(uint16_t)), kCorrupted);
+    const int64_t offset = ip[0] | (ip[1] << kByteBits);
+    ip += sizeof(uint16_t);
+    CHECK_FAIL_RETURN_UNEXPECTED(offset > 0 && offset <= op - obegin, kCorrupted);
+    len = token & kRunMask;
+    if (len == kRunMask) {
+      RETURN_IF_NOT_OK(GetLength(&ip, iend, &len));
+    }
+    len += kMinMatch;
+    CHECK_FAIL_RETURN_UNEXPECTED(len <= oend - op, kCorrupted);
+    const uint8_t *ref = op - offset;
+    if (offset >= len) {
+      (void)memcpy(op, ref, len);
+      op += len;
+    } else {
+      // The match overlaps the bytes it produces, e.g. a run of the same byte.
+      for (int64_t i = 0; i < len; ++i) {
+        *op++ = *ref++;
+      }
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(op == oend, kCorrupted);
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
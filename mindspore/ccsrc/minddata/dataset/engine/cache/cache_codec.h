@@ -0,0 +1,51 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_CODEC_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_CODEC_H_
+
+/// This header contains a fast LZ77 block codec used by the cache client to compress the tensors
+/// it sends to the cache server. It trades compression ratio for speed, so that compressing a row
+/// costs less than moving it.
+///
+/// A compressed block is a list of sequences. Each sequence starts with a token byte. The high 4 bits
+/// of the token are the number of literals and the low 4 bits are the match length minus 4. A value of
+/// 15 in either field is followed by more bytes of the length, each added to it, until a byte that
+/// is not 255. The literals come next, then the offset of the match as 2 bytes in little endian, then
+/// the rest of the match length. The last sequence has only literals.
+
+#include <cstdint>
+#include <vector>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief Compress a block of memory
+/// \param[in] src The block to compress
+/// \param[in] src_sz Size of the block
+/// \param[out] out The compressed block. It is empty if compressing does not shrink the block
+/// \return Status object
+Status CompressBlock(const void *src, int64_t src_sz, std::vector<uint8_t> *out);
+
+/// \brief Decompress a block of memory made by CompressBlock
+/// \param[in] src The compressed block
+/// \param[in] src_sz Size of the compressed block
+/// \param[out] dest Pre-allocated memory to hold the decompressed block
+/// \param[in] dest_sz Size of the decompressed block
+/// \return Status object, an error if the block is corrupted
+Status DecompressBlock(const void *src, int64_t src_sz, void *dest, int64_t dest_sz);
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_CODEC_H_
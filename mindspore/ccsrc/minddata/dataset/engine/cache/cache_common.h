@@ -69,6 +69,36 @@ enum class CacheServiceState : int8_t {
   kError = 127
 };
 
+/// \brief Replacement policy of the rows cached in memory. It only applies when a spilling directory is given.
+/// kNone keeps the rows where they are first cached, so once the memory is full all new rows go to disk.
+/// kClock evicts the rows not read recently (second chance) to disk to make room, and brings a spilled row back
+/// to memory when it is read.
+enum class CacheEvictionPolicy : int8_t { kNone = 0, kClock = 1 };
+
+/// \brief Names of the eviction policies as given to cache_admin
+const char kEvictionPolicyNone[] = "none";
+const char kEvictionPolicyClock[] = "clock";
+
+/// \brief Convert the name of an eviction policy
+/// \param name[in] Name of the policy
+/// \param policy[out] The eviction policy
+/// \return Status object, a syntax error if the name is unknown
+inline Status StringToEvictionPolicy(const std::string &name, CacheEvictionPolicy *policy) {
+  if (name == kEvictionPolicyNone) {
+    *policy = CacheEvictionPolicy::kNone;
+  } else if (name == kEvictionPolicyClock) {
+    *policy = CacheEvictionPolicy::kClock;
+  } else {
+    return Status(StatusCode::kMDSyntaxError, "Invalid eviction policy: " + name + ". Expect none or clock.");
+  }
+  return Status::OK();
+}
+
+/// \brief Return the name of an eviction policy
+inline std::string EvictionPolicyToString(CacheEvictionPolicy policy) {
+  return policy == CacheEvictionPolicy::kClock ? kEvictionPolicyClock : kEvictionPolicyNone;
+}
+
 /// \brief Convert a Status object into a protobuf
 /// \param rc[in] Status object
 /// \param reply[in/out] pointer to pre-allocated protobuf object
@@ -63,8 +63,10 @@ Status SerializeOneTensorMeta(const std::shared_ptr<flatbuffers::FlatBufferBuild
   return Status::OK();
 }
 
-Status SerializeTensorRowHeader(const TensorRow &row, std::shared_ptr<flatbuffers::FlatBufferBuilder> *out_fbb) {
+Status SerializeTensorRowHeader(const TensorRow &row, std::shared_ptr<flatbuffers::FlatBufferBuilder> *out_fbb,
+                                const std::vector<int64_t> *stored_sz) {
   RETURN_UNEXPECTED_IF_NULL(out_fbb);
+  CHECK_FAIL_RETURN_UNEXPECTED(stored_sz == nullptr || stored_sz->size() == row.size(), "Size mismatch");
   auto fbb = std::make_shared<flatbuffers::FlatBufferBuilder>();
   try {
     fbb = std::make_shared<flatbuffers::FlatBufferBuilder>();
@@ -80,10 +82,20 @@ Status SerializeTensorRowHeader(const TensorRow &row, std::shared_ptr<flatbuffer
       tensor_sz.push_back(ts_ptr->SizeInBytes());
     }
     auto column_off = fbb->CreateVector(v);
-    auto data_sz_off = fbb->CreateVector(tensor_sz);
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> data_sz_off;
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> raw_sz_off;
+    if (stored_sz != nullptr) {
+      data_sz_off = fbb->CreateVector(*stored_sz);
+      raw_sz_off = fbb->CreateVector(tensor_sz);
+    } else {
+      data_sz_off = fbb->CreateVector(tensor_sz);
+    }
     TensorRowHeaderMsgBuilder row_builder(*fbb);
     row_builder.add_column(column_off);
     row_builder.add_data_sz(data_sz_off);
+    if (stored_sz != nullptr) {
+      row_builder.add_raw_sz(raw_sz_off);
+    }
     // Pass the row_id even if it may not be known.
     row_builder.add_row_id(row.getId());
     row_builder.add_size_of_this(-1);  // fill in later after we call Finish.
@@ -32,8 +32,11 @@ namespace dataset {
 /// \brief Function to serialize TensorRow header used by CacheRowRequest
 /// \param row TensorRow
 /// \param fbb [in/out] fbb that contains the serialized data
+/// \param stored_sz [in] Optional. Size of each tensor as sent to the server if the row is compressed. The size of
+///     each tensor in the row is then recorded as its raw size.
 /// \return Status object
-Status SerializeTensorRowHeader(const TensorRow &row, std::shared_ptr<flatbuffers::FlatBufferBuilder> *fbb);
+Status SerializeTensorRowHeader(const TensorRow &row, std::shared_ptr<flatbuffers::FlatBufferBuilder> *fbb,
+                                const std::vector<int64_t> *stored_sz = nullptr);
 
 /// \brief A function used by BatchFetchRequest to deserialize a flat buffer back to a tensor row.
 /// \param col_ts A serialized version of Tensor meta data
@@ -31,7 +31,7 @@ namespace ms = mindspore;
 namespace ds = mindspore::dataset;
 
 namespace {
-const int32_t kTotalArgs = 8;
+const int32_t kTotalArgs = 9;
 enum ArgIndex : uint8_t {
   kProcessName = 0,
   kRootDir = 1,
@@ -40,7 +40,8 @@ enum ArgIndex : uint8_t {
   kSharedMemorySize = 4,
   kLogLevel = 5,
   kDemonize = 6,
-  kMemoryCapRatio = 7
+  kMemoryCapRatio = 7,
+  kEvictionPolicy = 8
 };
 
 ms::Status BuildServer(ds::CacheServer::Builder *builder, ds::SharedMessage *msg, int32_t port, bool daemonize) {
@@ -141,6 +142,9 @@ ms::Status StartServer(int argc, char **argv) {
     .SetSharedMemorySizeInGB(static_cast<int32_t>(strtol(argv[ArgIndex::kSharedMemorySize], nullptr, ds::kDecimal)))
     .SetLogLevel(static_cast<int8_t>((strtol(argv[ArgIndex::kLogLevel], nullptr, ds::kDecimal))))
     .SetMemoryCapRatio(strtof(argv[ArgIndex::kMemoryCapRatio], nullptr));
+  ds::CacheEvictionPolicy eviction_policy;
+  RETURN_IF_NOT_OK(ds::StringToEvictionPolicy(argv[ArgIndex::kEvictionPolicy], &eviction_policy));
+  (void)builder.SetEvictionPolicy(eviction_policy);
 
   auto daemonize_string = argv[ArgIndex::kDemonize];
   bool daemonize = strcmp(daemonize_string, "true") == 0 || strcmp(daemonize_string, "TRUE") == 0 ||
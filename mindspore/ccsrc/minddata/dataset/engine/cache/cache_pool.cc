@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <limits>
 #include "utils/ms_utils.h"
 #include "minddata/dataset/engine/cache/cache_pool.h"
 #include "minddata/dataset/engine/cache/cache_server.h"
@@ -21,8 +22,22 @@
 
 namespace mindspore {
 namespace dataset {
-CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root)
-    : mp_(std::move(mp)), root_(root), subfolder_(Services::GetUniqueID()), sm_(nullptr), tree_(nullptr) {
+CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root, CacheEvictionPolicy policy)
+    : mp_(std::move(mp)),
+      root_(root),
+      subfolder_(Services::GetUniqueID()),
+      sm_(nullptr),
+      tree_(nullptr),
+      mem_usage_(0),
+      mem_peak_(0),
+      mem_limit_(std::numeric_limits<uint64_t>::max()),
+      policy_(policy),
+      clock_hand_(0),
+      clock_mem_(0),
+      num_hit_(0),
+      num_miss_(0),
+      num_evicted_(0),
+      num_promoted_(0) {
   // Initialize soft memory cap to the current available memory on the machine.
   soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
   temp_mem_usage_ = 0;
@@ -79,6 +94,178 @@ Status CachePool::DoServiceStop() {
 
 CachePool::~CachePool() noexcept { (void)ServiceStop(); }
 
+Status CachePool::AllocateMemory(size_t sz, pointer *p) {
+  {
+    std::unique_lock<std::mutex> lck(mem_mux_);
+    uint64_t usage = mem_usage_ + sz;
+    if (usage > mem_limit_) {
+      return STATUS_ERROR(StatusCode::kMDOutOfMemory, "Out of memory.");
+    }
+    // The memory given back by the evicted buffers is reused first, only the usage above the peak takes more memory
+    // from the machine.
+    uint64_t growth = usage > mem_peak_ ? usage - mem_peak_ : 0;
+    // If required memory size exceeds the available size, it gives OOM status. To avoid cache server process got
+    // killed or crashing the machine, set lower bound memory, which means stopping cache once the rest available
+    // memory is less than the lower bound. (The default is 20% of physical RAM)
+    if (growth > 0 && soft_mem_limit_ < temp_mem_usage_ + growth + min_avail_mem_) {
+      if (EvictionEnabled()) {
+        MS_LOG(DEBUG) << "Memory usage will exceed the upper bound limit of: " << min_avail_mem_
+                      << ". Rows will be evicted to disk.";
+      } else {
+        MS_LOG(WARNING) << "Memory usage will exceed the upper bound limit of: " << min_avail_mem_
+                        << ". The cache server will not cache any more data.";
+      }
+      return STATUS_ERROR(StatusCode::kMDOutOfMemory, "Out of memory.");
+    }
+    mem_usage_ = usage;
+    mem_peak_ += growth;
+    temp_mem_usage_ += growth;
+    // Adjust the soft limit and usage counting when every 100M memory are used.
+    if (temp_mem_usage_ >= kMemoryCapAdjustInterval) {
+      soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
+      temp_mem_usage_ = 0;
+    }
+  }
+  Status rc = mp_->Allocate(sz, reinterpret_cast<void **>(p));
+  if (rc.IsError()) {
+    std::unique_lock<std::mutex> lck(mem_mux_);
+    mem_usage_ -= sz;
+  }
+  return rc;
+}
+
+Status CachePool::AllocateMemoryOrEvict(size_t sz, pointer *p) {
+  Status rc = AllocateMemory(sz, p);
+  if (rc == StatusCode::kMDOutOfMemory && EvictionEnabled()) {
+    size_t freed = 0;
+    RETURN_IF_NOT_OK(Evict(sz, &freed));
+    if (freed >= sz) {
+      rc = AllocateMemory(sz, p);
+    }
+  }
+  return rc;
+}
+
+void CachePool::DeallocateMemory(pointer p, size_t sz) {
+  mp_->Deallocate(p);
+  std::unique_lock<std::mutex> lck(mem_mux_);
+  mem_usage_ -= sz;
+}
+
+Status CachePool::SetNumaNode(DataLocator *bl) const {
+  // Write down which numa node where we allocate from. It only make sense if the policy is kOnNode.
+  if (CacheServerHW::numa_enabled()) {
+    auto &cs = CacheServer::GetInstance();
+    auto node_id = cs.GetHWControl()->GetMyNode();
+    bl->node_id = mp_->FindNode(bl->ptr);
+    CHECK_FAIL_RETURN_UNEXPECTED(bl->node_id != -1, "Allocator is not from numa memory pool");
+    bl->node_hit = (bl->node_id == node_id);
+  }
+  return Status::OK();
+}
+
+CachePool::ClockSlot *CachePool::AcquireSlotLocked(key_type key, size_t sz) {
+  ClockSlot *slot = nullptr;
+  if (free_slots_.empty()) {
+    slot = &clock_.emplace_back();
+  } else {
+    slot = free_slots_.back();
+    free_slots_.pop_back();
+  }
+  slot->key = key;
+  slot->sz = sz;
+  slot->in_use = true;
+  slot->referenced = true;
+  clock_mem_ += sz;
+  return slot;
+}
+
+void CachePool::ReleaseSlotLocked(ClockSlot *slot) {
+  slot->in_use = false;
+  slot->evicting = false;
+  slot->referenced = false;
+  free_slots_.push_back(slot);
+  clock_mem_ -= slot->sz;
+}
+
+void CachePool::PickVictimsLocked(size_t sz, std::vector<ClockSlot *> *victims) {
+  if (clock_.empty() || clock_mem_ < sz) {
+    // Evicting all the buffers in memory would still not make enough room.
+    return;
+  }
+  // A buffer read since the hand last passed it gets a second chance. Two passes without picking anything means the
+  // buffers left in memory are not in the tree yet or picked by another eviction.
+  size_t picked = 0;
+  size_t num_passed = 0;
+  const size_t max_passed = 2 * clock_.size();
+  while (picked < sz && num_passed < max_passed) {
+    ClockSlot &slot = clock_[clock_hand_];
+    clock_hand_ = (clock_hand_ + 1) % clock_.size();
+    ++num_passed;
+    if (!slot.in_use || slot.evicting || slot.referenced.exchange(false)) {
+      continue;
+    }
+    auto r = tree_->Search(slot.key);
+    if (!r.second || r.first->slot != &slot) {
+      continue;
+    }
+    slot.evicting = true;
+    victims->push_back(&slot);
+    picked += slot.sz;
+    num_passed = 0;
+  }
+}
+
+Status CachePool::Evict(size_t sz, size_t *freed) {
+  *freed = 0;
+  std::vector<ClockSlot *> victims;
+  {
+    std::unique_lock<std::mutex> lck(clock_mux_);
+    PickVictimsLocked(sz, &victims);
+  }
+  // The slots picked stay in the clock until the buffers are on disk, so that no other eviction picks them.
+  Status rc;
+  size_t num_evicted = 0;
+  for (; num_evicted < victims.size(); ++num_evicted) {
+    ClockSlot *slot = victims[num_evicted];
+    DataLocator bl;
+    {
+      auto r = tree_->Search(slot->key);
+      if (!r.second) {
+        rc = STATUS_ERROR(StatusCode::kMDUnexpectedError, "Key not found");
+        break;
+      }
+      bl = *r.first;
+    }
+    // A buffer brought back from disk still has its copy there, only the others need to be written.
+    if (!bl.on_disk) {
+      rc = sm_->Write(&bl.storage_key, {ReadableSlice(bl.ptr, bl.sz)});
+      if (rc.IsError()) {
+        break;
+      }
+      bl.on_disk = true;
+    }
+    pointer ptr = bl.ptr;
+    bl.ptr = nullptr;
+    bl.slot = nullptr;
+    bl.node_hit = false;
+    // The update waits for the readers of the buffer in memory to be done, so it can be freed afterwards.
+    (void)tree_->DoUpdate(slot->key, bl);
+    DeallocateMemory(ptr, bl.sz);
+    *freed += bl.sz;
+    ++num_evicted_;
+  }
+  std::unique_lock<std::mutex> lck(clock_mux_);
+  for (size_t i = 0; i < victims.size(); ++i) {
+    if (i < num_evicted) {
+      ReleaseSlotLocked(victims[i]);
+    } else {
+      victims[i]->evicting = false;
+    }
+  }
+  return rc;
+}
+
 Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlice> &buf) {
   DataLocator bl;
   Status rc;
@@ -88,31 +275,13 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
     sz += v.GetSize();
   }
   bl.sz = sz;
-  // If required memory size exceeds the available size, it gives OOM status. To avoid cache server process got killed
-  // or crashing the machine, set lower bound memory, which means stopping cache once the rest available memory is less
-  // than the lower bound. (The default is 20% of physical RAM)
-  if (soft_mem_limit_ - temp_mem_usage_ - static_cast<uint64_t>(sz) < min_avail_mem_) {
-    MS_LOG(WARNING) << "Memory usage will exceed the upper bound limit of: " << min_avail_mem_
-                    << ". The cache server will not cache any more data.";
-    rc = STATUS_ERROR(StatusCode::kMDOutOfMemory, "Out of memory.");
-  } else {
-    rc = mp_->Allocate(sz, reinterpret_cast<void **>(&bl.ptr));
-    // Adjust the soft limit and usage counting when every 100M memory are used.
-    if (temp_mem_usage_ + sz >= kMemoryCapAdjustInterval) {
-      soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
-      temp_mem_usage_ = 0;
-    }
+  // Make room for the new buffer by evicting the ones not read recently.
+  rc = AllocateMemoryOrEvict(sz, &bl.ptr);
+  if (rc.IsOk() && EvictionEnabled()) {
+    std::unique_lock<std::mutex> lck(clock_mux_);
+    bl.slot = AcquireSlotLocked(key, sz);
   }
   if (rc.IsOk()) {
-    temp_mem_usage_ += sz;
-    // Write down which numa node where we allocate from. It only make sense if the policy is kOnNode.
-    if (CacheServerHW::numa_enabled()) {
-      auto &cs = CacheServer::GetInstance();
-      auto node_id = cs.GetHWControl()->GetMyNode();
-      bl.node_id = mp_->FindNode(bl.ptr);
-      CHECK_FAIL_RETURN_UNEXPECTED(bl.node_id != -1, "Allocator is not from numa memory pool");
-      bl.node_hit = (bl.node_id == node_id);
-    }
     // We will do a piecewise copy.
     WritableSlice dest(bl.ptr, bl.sz);
     size_t pos = 0;
@@ -124,9 +293,11 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
       }
       pos += v.GetSize();
     }
+    if (rc.IsOk()) {
+      rc = SetNumaNode(&bl);
+    }
     if (rc.IsError()) {
-      mp_->Deallocate(bl.ptr);
-      bl.ptr = nullptr;
+      FreeMemory(&bl);
       return rc;
     }
   } else if (rc == StatusCode::kMDOutOfMemory) {
@@ -134,6 +305,7 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
     if (sm_ != nullptr) {
       MS_LOG(DEBUG) << "Spill to disk directly ... " << bl.sz << " bytes.";
       RETURN_IF_NOT_OK(sm_->Write(&bl.storage_key, buf));
+      bl.on_disk = true;
     } else {
       // If asked to spill to disk instead but there is no storage set up, simply return no memory
       // instead.
@@ -150,21 +322,78 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
   }
   // Duplicate key is treated as error and we will also free the memory.
   if (rc.IsError() && bl.ptr != nullptr) {
-    mp_->Deallocate(bl.ptr);
-    bl.ptr = nullptr;
+    FreeMemory(&bl);
     return rc;
   }
   return rc;
 }
 
-Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *bytesRead) const {
+void CachePool::FreeMemory(DataLocator *bl) {
+  if (bl->slot != nullptr) {
+    std::unique_lock<std::mutex> lck(clock_mux_);
+    ReleaseSlotLocked(bl->slot);
+    bl->slot = nullptr;
+  }
+  DeallocateMemory(bl->ptr, bl->sz);
+  bl->ptr = nullptr;
+}
+
+Status CachePool::Promote(key_type key, const ReadableSlice &src) {
+  DataLocator bl;
+  {
+    auto r = tree_->Search(key);
+    // Another reader may have brought it back already.
+    if (!r.second || r.first->ptr != nullptr) {
+      return Status::OK();
+    }
+    bl = *r.first;
+  }
+  Status rc = AllocateMemoryOrEvict(bl.sz, &bl.ptr);
+  if (rc == StatusCode::kMDOutOfMemory) {
+    // No buffer in memory is colder than this one, leave it on disk.
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(rc);
+  WritableSlice dest(bl.ptr, bl.sz);
+  rc = WritableSlice::Copy(&dest, src);
+  if (rc.IsOk()) {
+    rc = SetNumaNode(&bl);
+  }
+  if (rc.IsError()) {
+    DeallocateMemory(bl.ptr, bl.sz);
+    return rc;
+  }
+  {
+    std::unique_lock<std::mutex> lck(clock_mux_);
+    // Promotions of the same buffer are serialized here, only the first one is kept.
+    auto r = tree_->Search(key);
+    if (r.second && r.first->ptr == nullptr) {
+      bl.slot = AcquireSlotLocked(key, bl.sz);
+      (void)tree_->DoUpdate(key, bl);
+      ++num_promoted_;
+      return Status::OK();
+    }
+  }
+  DeallocateMemory(bl.ptr, bl.sz);
+  return Status::OK();
+}
+
+Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *bytesRead) {
   RETURN_UNEXPECTED_IF_NULL(dest);
-  auto r = tree_->Search(key);
-  if (r.second) {
+  bool promote = false;
+  size_t sz = 0;
+  {
+    auto r = tree_->Search(key);
+    if (!r.second) {
+      RETURN_STATUS_UNEXPECTED("Key not found");
+    }
     auto &it = r.first;
     if (it->ptr != nullptr) {
       ReadableSlice src(it->ptr, it->sz);
       RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
+      if (it->slot != nullptr) {
+        it->slot->referenced = true;
+      }
     } else if (sm_ != nullptr) {
       size_t expectedLength = 0;
       RETURN_IF_NOT_OK(sm_->Read(it->storage_key, dest, &expectedLength));
@@ -173,12 +402,16 @@ Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *byt
                       << " Internal key: " << key << "\n";
         RETURN_STATUS_UNEXPECTED("Length mismatch. See log file for details.");
       }
+      promote = EvictionEnabled();
     }
-    if (bytesRead != nullptr) {
-      *bytesRead = it->sz;
-    }
-  } else {
-    RETURN_STATUS_UNEXPECTED("Key not found");
+    sz = it->sz;
+  }
+  if (bytesRead != nullptr) {
+    *bytesRead = sz;
+  }
+  // The leaf of the tree is no longer locked, bring the buffer back to memory now that it is read.
+  if (promote) {
+    RETURN_IF_NOT_OK(Promote(key, ReadableSlice(dest->GetPointer(), sz)));
   }
   return Status::OK();
 }
@@ -190,7 +423,7 @@ Path CachePool::GetSpillPath() const {
 
 CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
   tree_->LockShared();  // Prevent any node split while we search.
-  CacheStat cs{-1, -1, 0, 0, 0, 0};
+  CacheStat cs{-1, -1, 0, 0, 0, 0, num_hit_, num_miss_, num_evicted_, num_promoted_};
   int64_t total_sz = 0;
   if (tree_->begin() != tree_->end()) {
     cs.min_key = tree_->begin().key();
@@ -228,20 +461,27 @@ CachePool::CacheStat CachePool::GetStat(bool GetMissingKeys) const {
 }
 
 Status CachePool::GetDataLocator(key_type key, const std::shared_ptr<flatbuffers::FlatBufferBuilder> &fbb,
-                                 flatbuffers::Offset<DataLocatorMsg> *out) const {
+                                 flatbuffers::Offset<DataLocatorMsg> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   auto r = tree_->Search(key);
   if (r.second) {
     auto &it = r.first;
+    ++num_hit_;
     DataLocatorMsgBuilder bld(*fbb);
     bld.add_key(key);
     bld.add_size(it->sz);
     bld.add_node_id(it->node_id);
-    bld.add_addr(reinterpret_cast<int64_t>(it->ptr));
+    // A buffer which can be evicted must be read under the lock of the tree, i.e. through Read.
+    if (!EvictionEnabled()) {
+      bld.add_addr(reinterpret_cast<int64_t>(it->ptr));
+    } else if (it->slot != nullptr) {
+      it->slot->referenced = true;
+    }
     auto offset = bld.Finish();
     *out = offset;
   } else {
     // Key not in the cache.
+    ++num_miss_;
     auto offset = CreateDataLocatorMsg(*fbb, key, 0, 0, 0);
     *out = offset;
   }
@@ -16,6 +16,8 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_CACHE_POOL_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_CACHE_POOL_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -45,10 +47,19 @@ class CachePool : public Service {
   using const_reference = const base_type &;
   using value_allocator = Allocator<base_type>;
 
+  // A slot of the clock of the rows cached in memory. The reference bit is set each time the row is read.
+  struct ClockSlot {
+    int64_t key = 0;
+    size_t sz = 0;
+    bool in_use = false;
+    bool evicting = false;  // picked by an eviction which is writing the row to disk
+    std::atomic<bool> referenced{false};
+  };
+
   // An internal class to locate the whereabouts of a backed up buffer which can be either in
   class DataLocator {
    public:
-    DataLocator() : ptr(nullptr), sz(0), node_id(0), node_hit(false), storage_key(0) {}
+    DataLocator() : ptr(nullptr), sz(0), node_id(0), node_hit(false), storage_key(0), on_disk(false), slot(nullptr) {}
     ~DataLocator() = default;
     DataLocator(const DataLocator &other) = default;
     DataLocator &operator=(const DataLocator &other) = default;
@@ -58,9 +69,13 @@ class CachePool : public Service {
       node_id = other.node_id;
       node_hit = other.node_hit;
       storage_key = other.storage_key;
+      on_disk = other.on_disk;
+      slot = other.slot;
       other.ptr = nullptr;
       other.sz = 0;
       other.storage_key = 0;
+      other.on_disk = false;
+      other.slot = nullptr;
     }
     DataLocator &operator=(DataLocator &&other) noexcept {
       if (&other != this) {
@@ -69,9 +84,13 @@ class CachePool : public Service {
         node_id = other.node_id;
         node_hit = other.node_hit;
         storage_key = other.storage_key;
+        on_disk = other.on_disk;
+        slot = other.slot;
         other.ptr = nullptr;
         other.sz = 0;
         other.storage_key = 0;
+        other.on_disk = false;
+        other.slot = nullptr;
       }
       return *this;
     }
@@ -80,6 +99,8 @@ class CachePool : public Service {
     numa_id_t node_id;  // where the numa node the memory is allocated to
     bool node_hit;      // we can allocate to the preferred node
     StorageManager::key_type storage_key;
+    bool on_disk;     // storage_key is valid, the row has a copy on disk
+    ClockSlot *slot;  // where the row is in the clock if it is in memory and eviction is on
   };
 
   using data_index = BPlusTree<int64_t, DataLocator>;
@@ -95,13 +116,19 @@ class CachePool : public Service {
     int64_t num_disk_cached;
     int64_t average_cache_sz;
     int64_t num_numa_hit;
+    int64_t num_hit;
+    int64_t num_miss;
+    int64_t num_evicted;
+    int64_t num_promoted;
     std::vector<key_type> gap;
   };
 
   /// \brief Constructor
   /// \param alloc Allocator to allocate memory from
   /// \param root Optional disk folder to spill
-  explicit CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root = "");
+  /// \param policy How to replace the rows in memory once it is full. It needs a disk folder to spill
+  explicit CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root = "",
+                     CacheEvictionPolicy policy = CacheEvictionPolicy::kNone);
 
   CachePool(const CachePool &) = delete;
   CachePool(CachePool &&) = delete;
@@ -123,15 +150,17 @@ class CachePool : public Service {
   Status Insert(CachePool::key_type key, const std::vector<ReadableSlice> &buf);
 
   /// \brief Restore a cached buffer (from memory or disk)
+  /// \note With eviction on, a buffer read from disk is brought back to memory
   /// \param[in] key A previous key returned from Insert
   /// \param[out] dest The cached buffer will be copied to this destination represented by a WritableSlice
   /// \param[out] bytesRead Optional. Number of bytes read.
   /// \return Error code
-  Status Read(key_type key, WritableSlice *dest, size_t *bytesRead = nullptr) const;
+  Status Read(key_type key, WritableSlice *dest, size_t *bytesRead = nullptr);
 
-  /// \brief Serialize a DataLocator
+  /// \brief Serialize a DataLocator, and count the key as a cache hit or miss
+  /// \note The address is left 0 if the buffer may be evicted before it is read, so that it is read through Read
   Status GetDataLocator(key_type, const std::shared_ptr<flatbuffers::FlatBufferBuilder> &,
-                        flatbuffers::Offset<DataLocatorMsg> *) const;
+                        flatbuffers::Offset<DataLocatorMsg> *);
 
   /// \brief Get statistics.
   /// \return CacheStat object
@@ -143,17 +172,80 @@ class CachePool : public Service {
   /// \note Once locking is off. It is user's responsibility to ensure concurrency
   void SetLocking(bool on_off) { tree_->SetLocking(on_off); }
 
+  /// \brief Check if buffers can move between memory and disk after they are inserted
+  /// \note The buffers are then read under locking only, so the locking must be kept on
+  bool EvictionEnabled() const { return policy_ == CacheEvictionPolicy::kClock && sm_ != nullptr; }
+
+  /// \brief Cap the memory taken by the buffers cached in memory. By default only the memory left in the machine caps
+  /// it.
+  /// \note Call it before any buffer is inserted
+  void SetMemoryLimit(uint64_t limit) { mem_limit_ = limit; }
+
  private:
+  /// \brief Allocate memory for a buffer within the memory cap
+  Status AllocateMemory(size_t sz, pointer *p);
+
+  /// \brief Same as AllocateMemory but evict some buffers to disk first if the memory is full
+  Status AllocateMemoryOrEvict(size_t sz, pointer *p);
+
+  /// \brief Give the memory of a buffer back to the pool
+  void DeallocateMemory(pointer p, size_t sz);
+
+  /// \brief Move the buffers in memory not read since the clock hand last passed them to disk
+  /// \param[in] sz The amount of memory to free
+  /// \param[out] freed The amount of memory freed, which is less than sz if too few buffers are in memory
+  Status Evict(size_t sz, size_t *freed);
+
+  /// \brief Pick the buffers to evict and mark their slots
+  /// \note The buffers are written to disk after clock_mux_ is released
+  /// \note clock_mux_ must be held
+  void PickVictimsLocked(size_t sz, std::vector<ClockSlot *> *victims);
+
+  /// \brief Bring a buffer read from disk back to memory
+  Status Promote(key_type key, const ReadableSlice &src);
+
+  /// \brief Free the memory of a buffer not in the tree and take it out of the clock
+  void FreeMemory(DataLocator *bl);
+
+  /// \brief Write down which numa node a buffer is allocated from
+  Status SetNumaNode(DataLocator *bl) const;
+
+  /// \brief Put a buffer in memory in the clock and return its slot
+  /// \note clock_mux_ must be held
+  ClockSlot *AcquireSlotLocked(key_type key, size_t sz);
+
+  /// \brief Take a buffer out of the clock
+  /// \note clock_mux_ must be held
+  void ReleaseSlotLocked(ClockSlot *slot);
+
   std::shared_ptr<NumaMemoryPool> mp_;
   Path root_;
   const std::string subfolder_;
   std::shared_ptr<StorageManager> sm_;
   std::shared_ptr<data_index> tree_;
-  std::atomic<uint64_t> soft_mem_limit_;  // the available memory in the machine
-  std::atomic<uint64_t> temp_mem_usage_;  // temporary count on the amount of memory usage by cache every 100Mb (because
-                                          // we will adjust soft_mem_limit_ every 100Mb based on this parameter)
-  uint64_t min_avail_mem_;                // lower bound of the available memory
+  // mem_mux_ guards the memory accounting below. The memory of the pool is counted by mem_usage_ only, the memory
+  // given back by the evicted buffers stays in the pool and only the usage above mem_peak_ is new to the machine.
+  std::mutex mem_mux_;
+  uint64_t soft_mem_limit_;  // the available memory in the machine
+  uint64_t temp_mem_usage_;  // temporary count on the amount of memory usage by cache every 100Mb (because
+                             // we will adjust soft_mem_limit_ every 100Mb based on this parameter)
+  uint64_t min_avail_mem_;   // lower bound of the available memory
+  uint64_t mem_usage_;       // memory taken by the buffers in memory
+  uint64_t mem_peak_;        // the highest mem_usage_ so far
+  uint64_t mem_limit_;
   const int kMemoryCapAdjustInterval = 104857600;
+  CacheEvictionPolicy policy_;
+  // The clock of the buffers in memory. Slots are never removed from the deque so that the DataLocator can point
+  // to them. clock_mux_ guards the clock only, the buffers are written to disk and freed without holding it.
+  std::mutex clock_mux_;
+  std::deque<ClockSlot> clock_;
+  std::vector<ClockSlot *> free_slots_;
+  size_t clock_hand_;
+  size_t clock_mem_;  // total size of the buffers in the clock
+  std::atomic<int64_t> num_hit_;
+  std::atomic<int64_t> num_miss_;
+  std::atomic<int64_t> num_evicted_;
+  std::atomic<int64_t> num_promoted_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -19,11 +19,13 @@
 #include <sys/types.h>
 #include <unistd.h>
 #endif
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <thread>
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/engine/cache/cache_client.h"
+#include "minddata/dataset/engine/cache/cache_codec.h"
 #include "minddata/dataset/engine/cache/cache_fbb.h"
 namespace mindspore {
 namespace dataset {
@@ -35,16 +37,18 @@ Status BaseRequest::Wait() {
   RETURN_IF_NOT_OK(PostReply());
   return Status::OK();
 }
-Status CacheRowRequest::SerializeCacheRowRequest(const CacheClient *cc, const TensorRow &row) {
+Status CacheRowRequest::SerializeCacheRowRequest(CacheClient *cc, const TensorRow &row) {
   CHECK_FAIL_RETURN_UNEXPECTED(row.size() > 0, "Empty tensor row");
   CHECK_FAIL_RETURN_UNEXPECTED(cc->SupportLocalClient() == support_local_bypass_, "Local bypass mismatch");
   // Calculate how many bytes (not counting the cookie) we are sending to the server. We only
   // use shared memory (if supported) if we exceed certain amount
   std::shared_ptr<flatbuffers::FlatBufferBuilder> fbb;
-  RETURN_IF_NOT_OK(::mindspore::dataset::SerializeTensorRowHeader(row, &fbb));
+  std::vector<ReadableSlice> data;
+  std::vector<std::vector<uint8_t>> compressed;
+  RETURN_IF_NOT_OK(cc->SerializeRow(row, &fbb, &data, &compressed));
   sz_ += fbb->GetSize();
-  for (const auto &ts : row) {
-    sz_ += ts->SizeInBytes();
+  for (const auto &src : data) {
+    sz_ += src.GetSize();
   }
   bool sent_using_local_bypass = support_local_bypass_ ? (sz_ >= kLocalByPassThreshold) : false;
   uint32_t flag = 0;
@@ -71,14 +75,13 @@ Status CacheRowRequest::SerializeCacheRowRequest(const CacheClient *cc, const Te
     ReadableSlice header(fbb->GetBufferPointer(), fbb->GetSize());
     Status copy_rc = WritableSlice::Copy(&all, header);
     if (copy_rc.IsOk()) {
-      for (const auto &ts : row) {
-        WritableSlice row_data(all, offset, ts->SizeInBytes());
-        ReadableSlice src(ts->GetBuffer(), ts->SizeInBytes());
+      for (const auto &src : data) {
+        WritableSlice row_data(all, offset, src.GetSize());
         copy_rc = WritableSlice::Copy(&row_data, src);
         if (copy_rc.IsError()) {
           break;
         }
-        offset += ts->SizeInBytes();
+        offset += src.GetSize();
       }
       // Fill in where to find the data
       AddDataLocation();
@@ -97,8 +100,8 @@ Status CacheRowRequest::SerializeCacheRowRequest(const CacheClient *cc, const Te
     // We have already filled the first buffer which is the cookie.
     sz_ += rq_.buf_data(0).size();
     rq_.add_buf_data(fbb->GetBufferPointer(), fbb->GetSize());
-    for (const auto &ts : row) {
-      rq_.add_buf_data(ts->GetBuffer(), ts->SizeInBytes());
+    for (const auto &src : data) {
+      rq_.add_buf_data(src.GetPointer(), src.GetSize());
     }
     MS_LOG(DEBUG) << "Sending " << sz_ << " bytes of tensor data in " << rq_.buf_data_size() << " segments";
   }
@@ -138,7 +141,7 @@ CacheRowRequest::CacheRowRequest(const CacheClient *cc)
 }
 
 BatchFetchRequest::BatchFetchRequest(const CacheClient *cc, const std::vector<row_id_type> &row_id)
-    : BaseRequest(RequestType::kBatchFetchRows), support_local_bypass_(cc->local_bypass_), row_id_(row_id) {
+    : BaseRequest(RequestType::kBatchFetchRows), cc_(cc), support_local_bypass_(cc->local_bypass_), row_id_(row_id) {
   rq_.set_connection_id(cc->server_connection_id_);
   rq_.set_client_id(cc->client_id_);
   rq_.set_flag(support_local_bypass_ ? kLocalClientSupport : 0);
@@ -176,6 +179,8 @@ Status BatchFetchRequest::RestoreRows(TensorTable *out, const void *baseAddr, in
   TensorTable tbl;
   tbl.reserve(num_elements);
   ReadableSlice all(ptr, sz);
+  std::vector<uint8_t> raw_data;
+  std::chrono::microseconds decompress_time(0);
   for (auto i = 0; i < num_elements; ++i) {
     auto len = offset_array[i + 1] - offset_array[i];
     TensorRow row;
@@ -187,12 +192,24 @@ Status BatchFetchRequest::RestoreRows(TensorTable *out, const void *baseAddr, in
       auto msg_sz = msg->size_of_this();
       // Start of the tensor data
       auto ts_offset = msg_sz;
+      // Only rows cached by a client with compression on have the raw size.
+      auto raw_sz = msg->raw_sz();
       row.reserve(msg->column()->size());
       for (auto k = 0; k < msg->column()->size(); ++k) {
         auto col_ts = msg->column()->Get(k);
         std::shared_ptr<Tensor> ts;
         ReadableSlice data(row_data, ts_offset, msg->data_sz()->Get(k));
-        RETURN_IF_NOT_OK(mindspore::dataset::RestoreOneTensor(col_ts, data, &ts));
+        if (raw_sz != nullptr && raw_sz->Get(k) != msg->data_sz()->Get(k)) {
+          auto start = std::chrono::steady_clock::now();
+          raw_data.resize(raw_sz->Get(k));
+          RETURN_IF_NOT_OK(DecompressBlock(data.GetPointer(), data.GetSize(), raw_data.data(), raw_data.size()));
+          decompress_time +=
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+          RETURN_IF_NOT_OK(
+            mindspore::dataset::RestoreOneTensor(col_ts, ReadableSlice(raw_data.data(), raw_data.size()), &ts));
+        } else {
+          RETURN_IF_NOT_OK(mindspore::dataset::RestoreOneTensor(col_ts, data, &ts));
+        }
         row.push_back(ts);
         ts_offset += data.GetSize();
       }
@@ -201,6 +218,7 @@ Status BatchFetchRequest::RestoreRows(TensorTable *out, const void *baseAddr, in
     }
     tbl.push_back(std::move(row));
   }
+  cc_->decompress_us_ += decompress_time.count();
   *out = std::move(tbl);
   return Status::OK();
 }
@@ -303,6 +321,10 @@ Status GetStatRequest::PostReply() {
   stat_.max_row_id = msg->max_row_id();
   stat_.min_row_id = msg->min_row_id();
   stat_.cache_service_state = msg->state();
+  stat_.num_hit = msg->num_hit();
+  stat_.num_miss = msg->num_miss();
+  stat_.num_evicted = msg->num_evicted();
+  stat_.num_promoted = msg->num_promoted();
   return Status::OK();
 }
 
@@ -331,12 +353,17 @@ Status ListSessionsRequest::PostReply() {
     stats.min_row_id = current_session_info->stats()->min_row_id();
     stats.max_row_id = current_session_info->stats()->max_row_id();
     stats.cache_service_state = current_session_info->stats()->state();
+    stats.num_hit = current_session_info->stats()->num_hit();
+    stats.num_miss = current_session_info->stats()->num_miss();
+    stats.num_evicted = current_session_info->stats()->num_evicted();
+    stats.num_promoted = current_session_info->stats()->num_promoted();
     current_info.stats = stats;  // fixed length struct.  = operator is safe
     session_info_list_.push_back(current_info);
   }
   server_cfg_.num_workers = msg->num_workers();
   server_cfg_.log_level = msg->log_level();
   server_cfg_.spill_dir = msg->spill_dir()->str();
+  server_cfg_.eviction_policy = msg->eviction_policy() == nullptr ? "" : msg->eviction_policy()->str();
   return Status::OK();
 }
 
@@ -45,12 +45,22 @@ struct CacheServiceStat {
   row_id_type min_row_id;
   row_id_type max_row_id;
   int8_t cache_service_state;
+  int64_t num_hit;
+  int64_t num_miss;
+  int64_t num_evicted;
+  int64_t num_promoted;
+  // Compression statistics of the client, which compresses and decompresses the rows
+  int64_t raw_bytes;
+  int64_t compressed_bytes;
+  int64_t compress_us;
+  int64_t decompress_us;
 };
 
 struct CacheServerCfgInfo {
   int32_t num_workers;
   int8_t log_level;
   std::string spill_dir;
+  std::string eviction_policy;
 };
 
 /// \brief Info structure ListSessionsRequest
@@ -190,7 +200,7 @@ class CacheRowRequest : public BaseRequest {
   /// \brief Serialize a TensorRow for streaming to the cache server
   /// \param row TensorRow
   /// \return Status object
-  Status SerializeCacheRowRequest(const CacheClient *cc, const TensorRow &row);
+  Status SerializeCacheRowRequest(CacheClient *cc, const TensorRow &row);
 
   /// \brief Sanity check before we send the row.
   /// \return Status object
@@ -236,6 +246,7 @@ class BatchFetchRequest : public BaseRequest {
   Status RestoreRows(TensorTable *out, const void *baseAddr, int64_t *out_addr);
 
  private:
+  const CacheClient *cc_;
   bool support_local_bypass_;
   std::vector<row_id_type> row_id_;
 };
@@ -577,6 +577,10 @@ Status CacheServer::GetStat(CacheRequest *rq, CacheReply *reply) {
     bld.add_max_row_id(svc_stat.stat_.max_key);
     bld.add_min_row_id(svc_stat.stat_.min_key);
     bld.add_state(svc_stat.state_);
+    bld.add_num_hit(svc_stat.stat_.num_hit);
+    bld.add_num_miss(svc_stat.stat_.num_miss);
+    bld.add_num_evicted(svc_stat.stat_.num_evicted);
+    bld.add_num_promoted(svc_stat.stat_.num_promoted);
     auto offset = bld.Finish();
     fbb.Finish(offset);
     reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
@@ -708,9 +712,10 @@ Status CacheServer::ListSessions(CacheReply *reply) {
         auto &cs = it.second;
         CacheService::ServiceStat svc_stat;
         RETURN_IF_NOT_OK(cs->GetStat(&svc_stat));
-        auto current_stats = CreateServiceStatMsg(fbb, svc_stat.stat_.num_mem_cached, svc_stat.stat_.num_disk_cached,
-                                                  svc_stat.stat_.average_cache_sz, svc_stat.stat_.num_numa_hit,
-                                                  svc_stat.stat_.min_key, svc_stat.stat_.max_key, svc_stat.state_);
+        auto current_stats = CreateServiceStatMsg(
+          fbb, svc_stat.stat_.num_mem_cached, svc_stat.stat_.num_disk_cached, svc_stat.stat_.average_cache_sz,
+          svc_stat.stat_.num_numa_hit, svc_stat.stat_.min_key, svc_stat.stat_.max_key, svc_stat.state_,
+          svc_stat.stat_.num_hit, svc_stat.stat_.num_miss, svc_stat.stat_.num_evicted, svc_stat.stat_.num_promoted);
         auto current_session_info = CreateListSessionMsg(fbb, current_session_id, current_conn_id, current_stats);
         session_msgs_vector.push_back(current_session_info);
       }
@@ -724,12 +729,14 @@ Status CacheServer::ListSessions(CacheReply *reply) {
   }
   flatbuffers::Offset<flatbuffers::String> spill_dir;
   spill_dir = fbb.CreateString(top_);
+  auto eviction_policy = fbb.CreateString(EvictionPolicyToString(eviction_policy_));
   auto session_msgs = fbb.CreateVector(session_msgs_vector);
   ListSessionsMsgBuilder s_builder(fbb);
   s_builder.add_sessions(session_msgs);
   s_builder.add_num_workers(num_workers_);
   s_builder.add_log_level(log_level_);
   s_builder.add_spill_dir(spill_dir);
+  s_builder.add_eviction_policy(eviction_policy);
   auto offset = s_builder.Finish();
   fbb.Finish(offset);
   reply->set_result(fbb.GetBufferPointer(), fbb.GetSize());
@@ -993,7 +1000,7 @@ session_id_type CacheServer::GetSessionID(connection_id_type connection_id) cons
 
 CacheServer::CacheServer(const std::string &spill_path, int32_t num_workers, int32_t port,
                          int32_t shared_meory_sz_in_gb, float memory_cap_ratio, int8_t log_level,
-                         std::shared_ptr<CacheServerHW> hw_info)
+                         CacheEvictionPolicy eviction_policy, std::shared_ptr<CacheServerHW> hw_info)
     : top_(spill_path),
       num_workers_(num_workers),
       num_grpc_workers_(num_workers_),
@@ -1001,6 +1008,7 @@ CacheServer::CacheServer(const std::string &spill_path, int32_t num_workers, int
       shared_memory_sz_in_gb_(shared_meory_sz_in_gb),
       global_shutdown_(false),
       memory_cap_ratio_(memory_cap_ratio),
+      eviction_policy_(eviction_policy),
       numa_affinity_(true),
       log_level_(log_level),
       hw_info_(std::move(hw_info)) {
@@ -1304,7 +1312,8 @@ CacheServer::Builder::Builder()
       port_(kCfgDefaultCachePort),
       shared_memory_sz_in_gb_(kDefaultSharedMemorySize),
       memory_cap_ratio_(kDefaultMemoryCapRatio),
-      log_level_(kDefaultLogLevel) {
+      log_level_(kDefaultLogLevel),
+      eviction_policy_(CacheEvictionPolicy::kNone) {
   if (num_workers_ == 0) {
     num_workers_ = 1;
   }
@@ -73,6 +73,7 @@ class CacheServer : public Service {
     int32_t GetSharedMemorySzInGb() const { return shared_memory_sz_in_gb_; }
     float GetMemoryCapRatio() const { return memory_cap_ratio_; }
     int8_t GetLogLevel() const { return log_level_; }
+    CacheEvictionPolicy GetEvictionPolicy() const { return eviction_policy_; }
 
     Builder &SetRootDirectory(std::string root) {
       top_ = std::move(root);
@@ -98,6 +99,10 @@ class CacheServer : public Service {
       log_level_ = log_level;
       return *this;
     }
+    Builder &SetEvictionPolicy(CacheEvictionPolicy policy) {
+      eviction_policy_ = policy;
+      return *this;
+    }
 
     Status SanityCheck();
 
@@ -108,6 +113,7 @@ class CacheServer : public Service {
           << "Tcp/ip port: " << GetPort() << "\n"
           << "Shared memory size (in GB): " << GetSharedMemorySzInGb() << "\n"
           << "Memory cap ratio: " << GetMemoryCapRatio() << "\n"
+          << "Eviction policy: " << EvictionPolicyToString(GetEvictionPolicy()) << "\n"
           << "Log level: " << std::to_string(GetLogLevel());
     }
 
@@ -143,7 +149,8 @@ class CacheServer : public Service {
       // We need to bring up the Task Manager by bringing up the Services singleton.
       RETURN_IF_NOT_OK(Services::CreateInstance());
       RETURN_IF_NOT_OK(CacheServer::CreateInstance(top_, num_workers_, port_, shared_memory_sz_in_gb_,
-                                                   memory_cap_ratio_, log_level_, std::move(hw_info_)));
+                                                   memory_cap_ratio_, log_level_, eviction_policy_,
+                                                   std::move(hw_info_)));
       return Status(StatusCode::kSuccess, warning_string);
     }
 
@@ -154,6 +161,7 @@ class CacheServer : public Service {
     int32_t shared_memory_sz_in_gb_;
     float memory_cap_ratio_;
     int8_t log_level_;
+    CacheEvictionPolicy eviction_policy_;
     std::shared_ptr<CacheServerHW> hw_info_;
 
     /// \brief Sanity checks on the shared memory.
@@ -174,11 +182,11 @@ class CacheServer : public Service {
 
   static Status CreateInstance(const std::string &spill_path, int32_t num_workers, int32_t port,
                                int32_t shared_memory_sz, float memory_cap_ratio, int8_t log_level,
-                               std::shared_ptr<CacheServerHW> hw_info) {
+                               CacheEvictionPolicy eviction_policy, std::shared_ptr<CacheServerHW> hw_info) {
     std::call_once(init_instance_flag_, [&]() -> Status {
       auto &SvcManager = Services::GetInstance();
       RETURN_IF_NOT_OK(SvcManager.AddHook(&instance_, spill_path, num_workers, port, shared_memory_sz, memory_cap_ratio,
-                                          log_level, hw_info));
+                                          log_level, eviction_policy, hw_info));
       return Status::OK();
     });
     return Status::OK();
@@ -237,6 +245,9 @@ class CacheServer : public Service {
   /// \brief Return the memory cap ratio
   float GetMemoryCapRatio() const { return memory_cap_ratio_; }
 
+  /// \brief Return the replacement policy of the rows cached in memory
+  CacheEvictionPolicy GetEvictionPolicy() const { return eviction_policy_; }
+
   /// \brief Function to handle a row request
   /// \param[in] cache_req A row request to handle
   /// \param[out] internal_request Indicator if the request is an internal request
@@ -293,6 +304,7 @@ class CacheServer : public Service {
   int8_t log_level_;  // log_level is saved here for informational purpose only. It's not a functional field.
   std::atomic<bool> global_shutdown_;
   float memory_cap_ratio_;
+  CacheEvictionPolicy eviction_policy_;
   std::shared_ptr<CacheServerHW> hw_info_;
   std::map<worker_id_t, Task *> numa_tasks_;
   bool numa_affinity_;
@@ -303,7 +315,8 @@ class CacheServer : public Service {
   /// \param spill_path Top directory for spilling buffers to.
   /// \param num_workers Number of threads for handling requests.
   explicit CacheServer(const std::string &spill_path, int32_t num_workers, int32_t port, int32_t share_memory_sz_in_gb,
-                       float memory_cap_ratio, int8_t log_level, std::shared_ptr<CacheServerHW> hw_info);
+                       float memory_cap_ratio, int8_t log_level, CacheEvictionPolicy eviction_policy,
+                       std::shared_ptr<CacheServerHW> hw_info);
 
   /// \brief Locate a cache service from connection id.
   /// \return Pointer to cache service. Null if not found
@@ -53,7 +53,7 @@ Status CacheService::DoServiceStart() {
     RETURN_STATUS_UNEXPECTED("Unable to bring up numa memory pool");
   }
   // Put together a CachePool for backing up the Tensor.
-  cp_ = std::make_shared<CachePool>(numa_pool_, root_);
+  cp_ = std::make_shared<CachePool>(numa_pool_, root_, cs.GetEvictionPolicy());
   RETURN_IF_NOT_OK(cp_->ServiceStart());
   // Assign a name to this cache. Used for exclusive connection. But we can just use CachePool's name.
   cookie_ = cp_->MyName();
@@ -317,8 +317,11 @@ Status CacheService::BuildPhaseDone() {
     // Exclusive lock to switch phase
     UniqueLock rw(&rw_lock_);
     st_ = CacheServiceState::kFetchPhase;
-    cp_->SetLocking(false);
-    MS_LOG(WARNING) << "Locking mode is switched off.";
+    // With eviction on, the rows read from disk are still brought back to memory, which needs the locking.
+    if (!cp_->EvictionEnabled()) {
+      cp_->SetLocking(false);
+      MS_LOG(WARNING) << "Locking mode is switched off.";
+    }
     return Status::OK();
   } else {
     RETURN_STATUS_UNEXPECTED("Not a cache that has a build phase");
@@ -334,8 +337,10 @@ Status CacheService::ToggleWriteMode(bool on_off) {
     // underlying B+ tree. All future write request we will return kOutOfMemory.
     if (st_ == CacheServiceState::kNone && !on_off) {
       st_ = CacheServiceState::kNoLocking;
-      cp_->SetLocking(on_off);
-      MS_LOG(WARNING) << "Locking mode is switched off.";
+      if (!cp_->EvictionEnabled()) {
+        cp_->SetLocking(on_off);
+        MS_LOG(WARNING) << "Locking mode is switched off.";
+      }
     } else if (st_ == CacheServiceState::kNoLocking && on_off) {
       st_ = CacheServiceState::kNone;
       cp_->SetLocking(on_off);
@@ -44,7 +44,7 @@ using ProfilingRegistrationState = ProfilingManager::ProfilingRegistrationState;
 // TreeConsumer
 TreeConsumer::TreeConsumer() : TreeConsumer(1) {}
 
-TreeConsumer::TreeConsumer(int32_t num_epochs) : num_epochs_(num_epochs) {
+TreeConsumer::TreeConsumer(int32_t num_epochs) : num_epochs_(num_epochs), base_epoch_(0) {
   tree_adapter_ = std::make_unique<TreeAdapter>();
 }
 
@@ -343,7 +343,42 @@ Status ToDevice::Terminate() {
   return TreeConsumer::Terminate();
 }
 
-Status TreeConsumer::Reset(int64_t step) {
+Status TreeConsumer::Reset(int64_t step) { return ResetTree(step, nlohmann::json()); }
+
+Status TreeConsumer::GetEpochSize(int64_t *epoch_size) {
+  RETURN_UNEXPECTED_IF_NULL(epoch_size);
+  RETURN_UNEXPECTED_IF_NULL(tree_adapter_->input_ir_);
+  RETURN_IF_NOT_OK(tree_adapter_->input_ir_->GetDatasetSize(nullptr, false, epoch_size));
+  CHECK_FAIL_RETURN_UNEXPECTED(*epoch_size > 0, "Cannot get the state of the pipeline, dataset size is undefined");
+  return Status::OK();
+}
+
+Status TreeConsumer::SaveState(int64_t step, std::string *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  RETURN_UNEXPECTED_IF_NULL(tree_adapter_->tree_);
+  CHECK_FAIL_RETURN_UNEXPECTED(step >= 0, "Cannot save the state of the pipeline, step must be >= 0. step: " +
+                                            std::to_string(step));
+  int64_t epoch_size = 0;
+  RETURN_IF_NOT_OK(GetEpochSize(&epoch_size));
+  int32_t epoch = static_cast<int32_t>(step / epoch_size) - base_epoch_;
+  CHECK_FAIL_RETURN_UNEXPECTED(epoch >= 0, "Cannot save the state of the pipeline, step " + std::to_string(step) +
+                                             " is before the step the pipeline was reset to.");
+  nlohmann::json snapshot;
+  snapshot["step"] = step;
+  RETURN_IF_NOT_OK(tree_adapter_->tree_->GetEpochState(epoch, &snapshot["ops"]));
+  *state = snapshot.dump();
+  return Status::OK();
+}
+
+Status TreeConsumer::Restore(const std::string &state) {
+  nlohmann::json snapshot = nlohmann::json::parse(state, nullptr, false);
+  CHECK_FAIL_RETURN_UNEXPECTED(!snapshot.is_discarded() && snapshot.contains("step") && snapshot["step"].is_number() &&
+                                 snapshot.contains("ops") && snapshot["ops"].is_object(),
+                               "Invalid state of the pipeline, it should be one returned by SaveState.");
+  return ResetTree(snapshot["step"].get<int64_t>(), snapshot["ops"]);
+}
+
+Status TreeConsumer::ResetTree(int64_t step, const nlohmann::json &states) {
   MS_LOG(INFO) << "Resetting TreeConsumer";
 
   MS_LOG(INFO) << "Terminating pipeline with UUID:" << tree_adapter_->tree_->GetUniqueId();
@@ -369,6 +404,12 @@ Status TreeConsumer::Reset(int64_t step) {
 
   tree_adapter_ = std::make_unique<TreeAdapter>(TreeAdapter::UsageFlag::kDeReset);
   RETURN_IF_NOT_OK(tree_adapter_->Compile(old_root, num_epochs_, step));
+  int64_t epoch_size = 0;
+  RETURN_IF_NOT_OK(GetEpochSize(&epoch_size));
+  base_epoch_ = static_cast<int32_t>(step / epoch_size);
+  if (!states.is_null()) {
+    RETURN_IF_NOT_OK(tree_adapter_->tree_->RestoreEpochState(states));
+  }
   RETURN_IF_NOT_OK(tree_adapter_->Launch());
   MS_LOG(INFO) << "Launched a new pipeline after reset. UUID: " << tree_adapter_->tree_->GetUniqueId();
   std::shared_ptr<DatasetOp> root2 = std::shared_ptr<DatasetOp>(tree_adapter_->GetRoot());
@@ -63,6 +63,25 @@ class TreeConsumer {
   /// \return Status error code
   Status Reset(int64_t step);
 
+  /// Function to save a snapshot of the state of the pipeline after the given step, for Restore to resume from it.
+  /// The snapshot holds the state each operator had at the start of the epoch of the step, like its seeds.
+  /// \note The rows in flight, like the ones in the shuffle buffer or in the connectors, are not saved. Restore skips
+  ///     the rows of the epoch before the step like Reset does: where the skip is pushed down into the leaf, they are
+  ///     not read again. The skip is never pushed below a shuffle op, so a pipeline with a shuffle op still replays
+  ///     the epoch of the step: its rows before the step are read and processed again, then dropped.
+  /// \param step the number of rows taken from the pipeline.
+  /// \param[out] state the snapshot as a JSON string.
+  /// \return Status error code
+  Status SaveState(int64_t step, std::string *state);
+
+  /// Function to reset the current consumer to a snapshot returned by SaveState.
+  /// The pipeline is created again like with Reset, then its operators restore their state so that the epoch of the
+  /// step is read in the same order, and the rows before the step are skipped. See SaveState for when they are read
+  /// again.
+  /// \param state the snapshot as a JSON string.
+  /// \return Status error code
+  Status Restore(const std::string &state);
+
   /// Function to stop the consumer.
   /// \return Status error code
   virtual Status Stop() { return Status::OK(); }
@@ -94,6 +113,19 @@ class TreeConsumer {
   virtual std::string Name() = 0;
 
   int32_t num_epochs_;
+  int32_t base_epoch_;  // The epoch the current tree started at, after a reset
+
+ private:
+  /// Terminate the pipeline and create a new one starting at the given step
+  /// \param step the step to reset the pipeline to.
+  /// \param states the states of the operators to restore, null to keep the ones the new operators start with.
+  /// \return Status error code
+  Status ResetTree(int64_t step, const nlohmann::json &states);
+
+  /// Get the number of rows of one epoch of the pipeline
+  /// \param[out] epoch_size the number of rows.
+  /// \return Status error code
+  Status GetEpochSize(int64_t *epoch_size);
 };
 
 /// Consumer that iterates over the dataset and returns the rows one by one as a vector or a map
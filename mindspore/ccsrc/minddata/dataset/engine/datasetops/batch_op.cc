@@ -22,6 +22,7 @@
 #include "minddata/dataset/core/pybind_support.h"
 #endif
 
+#include "minddata/dataset/engine/datasetops/map_op/map_op.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
 #include "minddata/dataset/util/status.h"
 
@@ -121,6 +122,8 @@ Status BatchOp::operator()() {
       RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->EmplaceBack(
         std::make_pair(std::move(table), CBatchInfo(epoch_num, batch_num++, cnt + 1 - epoch_num))));
       cnt++;
+    } else if (batch_slots_ != nullptr && table->empty() == false) {
+      batch_slots_->Discard(epoch_num, batch_num);
     }
     table = std::make_unique<TensorQTable>();  // this drops when drop == true
     // end of the current epoch, batch_num should start from 0 again
@@ -147,6 +150,32 @@ Status BatchOp::operator()() {
   for (int32_t ind = 0; ind < num_workers_; ind++) {
     RETURN_IF_NOT_OK(SendQuitFlagToWorker(NextWorkerID()));
   }
+  if (batch_slots_ != nullptr) {
+    MS_LOG(INFO) << "BatchOp built " << batch_slots_->num_assembled() << " batches in place and copied "
+                 << batch_slots_->num_copied() << " batches.";
+  }
+  return Status::OK();
+}
+
+Status BatchOp::PrepareOperator() {
+  RETURN_IF_NOT_OK(DatasetOp::PrepareOperator());
+  if (!GlobalContext::config_manager()->enable_inplace_batch()) {
+    return Status::OK();
+  }
+  // Rows can only be placed ahead when every batch has the same size and is not changed before it is assembled.
+  bool fixed_batch = start_batch_size_ > 1 && !pad_;
+#ifdef ENABLE_PYTHON
+  fixed_batch = fixed_batch && !batch_size_func_ && !batch_map_func_;
+#endif
+  if (!fixed_batch || child_.size() != 1) {
+    return Status::OK();
+  }
+  auto map_op = std::dynamic_pointer_cast<MapOp>(child_[0]);
+  if (map_op != nullptr) {
+    batch_slots_ = std::make_shared<BatchSlots>(start_batch_size_);
+    map_op->SetBatchSlots(batch_slots_);
+    MS_LOG(INFO) << "BatchOp builds the batches in place with the MapOp below.";
+  }
   return Status::OK();
 }
 
@@ -256,6 +285,14 @@ Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchIn
   if (pad_) {
     RETURN_IF_NOT_OK(PadColumns(&table_pair.first, pad_info_, column_name_id_map_));
   }  // do padding if needed
+  if (batch_slots_ != nullptr) {
+    bool done = false;
+    RETURN_IF_NOT_OK(batch_slots_->Assemble(table_pair.second.epoch_num_, table_pair.second.batch_num_,
+                                            *table_pair.first, new_row, &done));
+    if (done) {
+      return Status::OK();
+    }
+  }
   RETURN_IF_NOT_OK(BatchRows(&table_pair.first, new_row, table_pair.first->size()));
   return Status::OK();
 }
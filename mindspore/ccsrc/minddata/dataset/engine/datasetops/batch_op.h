@@ -30,6 +30,7 @@
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/util/status.h"
 
@@ -189,6 +190,10 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @return Status The status code returned
   Status operator()() override;
 
+  // Sets up the in place batch assembly with the MapOp below when it is enabled, on top of the usual preparation
+  // @return Status The status code returned
+  Status PrepareOperator() override;
+
   // Op name getter
   // @return Name of the current Op
   std::string Name() const override { return kBatchOp; }
@@ -294,6 +299,7 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   py::function batch_map_func_;   // Function pointer of per batch map function
 #endif
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
+  std::shared_ptr<BatchSlots> batch_slots_;                  // batch buffers filled by the MapOp below, or nullptr
 
  protected:
   Status Launch() override;
@@ -0,0 +1,264 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
+
+#include <limits>
+
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Memory pool owning the buffer of one column of a batch. The buffer is freed when the last tensor referring to it is
+// destroyed. Memory reallocated by the tensors themselves comes from the system.
+class BatchBufferPool : public MemoryPool {
+ public:
+  BatchBufferPool() = default;
+
+  ~BatchBufferPool() override { free(base_); }
+
+  // The buffer is taken from the system and not touched here, rather than from the pool of the pipeline which recycles
+  // buffers already written, so that the pages of a batch are only committed as its rows are placed.
+  Status Init(size_t size) {
+    void *p = nullptr;
+    RETURN_IF_NOT_OK(DeMalloc(size, &p, false));
+    base_ = reinterpret_cast<uchar *>(p);
+    size_ = size;
+    return Status::OK();
+  }
+
+  uchar *base() const { return base_; }
+
+  Status Allocate(size_t n, void **pp) override { return DeMalloc(n, pp, false); }
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override {
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] Reallocate is not supported for the tensors of a batch buffer.");
+  }
+
+  void Deallocate(void *p) override {
+    auto addr = reinterpret_cast<uchar *>(p);
+    if (p != nullptr && (addr < base_ || addr >= base_ + size_)) {
+      free(p);
+    }
+  }
+
+  uint64_t get_max_size() const override { return std::numeric_limits<uint64_t>::max(); }
+
+  int PercentFree() const override { return 100; }
+
+ private:
+  uchar *base_ = nullptr;
+  size_t size_ = 0;
+};
+}  // namespace
+
+BatchSlots::BatchSlots(int32_t batch_size) : batch_size_(batch_size) {}
+
+std::shared_ptr<BatchSlots::Batch> BatchSlots::GetBatch(int64_t epoch_num, int64_t batch_num) {
+  std::unique_lock<std::mutex> lock(mux_);
+  auto &batch = batches_[std::make_pair(epoch_num, batch_num)];
+  if (batch == nullptr) {
+    batch = std::make_shared<Batch>();
+    batch->columns = layout_;
+  }
+  return batch;
+}
+
+std::shared_ptr<BatchSlots::Batch> BatchSlots::TakeBatch(int64_t epoch_num, int64_t batch_num) {
+  std::unique_lock<std::mutex> lock(mux_);
+  auto it = batches_.find(std::make_pair(epoch_num, batch_num));
+  if (it == batches_.end()) {
+    return nullptr;
+  }
+  auto batch = std::move(it->second);
+  (void)batches_.erase(it);
+  return batch;
+}
+
+Status BatchSlots::AllocateColumn(size_t index, Column *col) {
+  auto pool = std::make_shared<BatchBufferPool>();
+  RETURN_IF_NOT_OK(pool->Init(static_cast<size_t>(col->row_bytes) * batch_size_));
+  col->base = pool->base();
+  col->pool = std::move(pool);
+  std::unique_lock<std::mutex> lock(mux_);
+  if (layout_.size() <= index) {
+    layout_.resize(index + 1);
+  }
+  layout_[index].shape = col->shape;
+  layout_[index].type = col->type;
+  layout_[index].row_bytes = col->row_bytes;
+  return Status::OK();
+}
+
+bool BatchSlots::RowPlacement::Claim(const TensorShape &shape, const DataType &type, uchar **buffer,
+                                     std::shared_ptr<MemoryPool> *pool) {
+  if (slots_ == nullptr || buffer == nullptr || pool == nullptr || slot_.index < 0 ||
+      slot_.index >= slots_->batch_size_) {
+    return false;
+  }
+  auto batch = slots_->GetBatch(slot_.epoch_num, slot_.batch_num);
+  std::unique_lock<std::mutex> lock(batch->mux);
+  // The column is only known for sure if no other column has the same shape and type.
+  size_t index = batch->columns.size();
+  for (size_t i = 0; i < batch->columns.size(); i++) {
+    const Column &col = batch->columns[i];
+    if (col.row_bytes > 0 && col.shape == shape && col.type == type) {
+      if (index < batch->columns.size()) {
+        return false;
+      }
+      index = i;
+    }
+  }
+  if (index == batch->columns.size() || (index < claimed_.size() && claimed_[index])) {
+    return false;
+  }
+  Column &col = batch->columns[index];
+  if (col.pool == nullptr && slots_->AllocateColumn(index, &col).IsError()) {
+    return false;
+  }
+  if (claimed_.size() <= index) {
+    claimed_.resize(index + 1, false);
+  }
+  claimed_[index] = true;
+  *buffer = col.base + col.row_bytes * slot_.index;
+  *pool = col.pool;
+  return true;
+}
+
+Status BatchSlots::Place(const BatchSlot &slot, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  if (slot.index < 0) {
+    return Status::OK();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(slot.index < batch_size_, "[Internal ERROR] Slot index " +
+                                                           std::to_string(slot.index) +
+                                                           " is out of the batch size: " + std::to_string(batch_size_));
+  auto batch = GetBatch(slot.epoch_num, slot.batch_num);
+  std::vector<Column> columns;
+  {
+    std::unique_lock<std::mutex> lock(batch->mux);
+    if (batch->columns.size() < row->size()) {
+      batch->columns.resize(row->size());
+    }
+    for (size_t i = 0; i < row->size(); i++) {
+      const std::shared_ptr<Tensor> &tensor = (*row)[i];
+      Column &col = batch->columns[i];
+      if (tensor != nullptr && tensor->type().IsNumeric() && tensor->SizeInBytes() > 0 && col.pool == nullptr) {
+        // Nothing is written into the column yet, the first row placed decides its shape.
+        col.shape = tensor->shape();
+        col.type = tensor->type();
+        col.row_bytes = tensor->SizeInBytes();
+        RETURN_IF_NOT_OK(AllocateColumn(i, &col));
+      }
+    }
+    columns = batch->columns;
+  }
+  // A tensor allocated in the slot of a column may have ended up in another one. It is moved out before that slot is
+  // written.
+  auto in_slot = [&columns, &slot](const std::shared_ptr<Tensor> &tensor, size_t i) {
+    const Column &col = columns[i];
+    const uchar *dst = col.base + col.row_bytes * slot.index;
+    return col.pool != nullptr && tensor->GetBuffer() >= dst && tensor->GetBuffer() < dst + col.row_bytes;
+  };
+  std::vector<bool> placed(row->size(), false);
+  for (size_t i = 0; i < row->size(); i++) {
+    std::shared_ptr<Tensor> &tensor = (*row)[i];
+    if (tensor == nullptr || tensor->GetBuffer() == nullptr) {
+      continue;
+    }
+    const Column &column = columns[i];
+    placed[i] = column.pool != nullptr && tensor->GetBuffer() == column.base + column.row_bytes * slot.index &&
+                tensor->shape() == column.shape && tensor->type() == column.type;
+    if (placed[i]) {
+      continue;
+    }
+    for (size_t j = 0; j < columns.size(); j++) {
+      if (in_slot(tensor, j)) {
+        std::shared_ptr<Tensor> moved;
+        RETURN_IF_NOT_OK(Tensor::CreateFromTensor(tensor, &moved));
+        tensor = std::move(moved);
+        break;
+      }
+    }
+  }
+  for (size_t i = 0; i < row->size(); i++) {
+    std::shared_ptr<Tensor> &tensor = (*row)[i];
+    const Column &column = columns[i];
+    if (placed[i] || tensor == nullptr || column.pool == nullptr || tensor->shape() != column.shape ||
+        tensor->type() != column.type) {
+      continue;
+    }
+    uchar *dst = column.base + column.row_bytes * slot.index;
+    int ret_code = memcpy_s(dst, column.row_bytes, tensor->GetBuffer(), column.row_bytes);
+    CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "Failed to copy the tensor into its batch slot, ret code: " +
+                                                    std::to_string(ret_code));
+    std::shared_ptr<Tensor> moved;
+    RETURN_IF_NOT_OK(
+      Tensor::CreateFromMemoryView(column.shape, column.type, dst, column.row_bytes, column.pool, &moved));
+    tensor = std::move(moved);
+  }
+  return Status::OK();
+}
+
+Status BatchSlots::Assemble(int64_t epoch_num, int64_t batch_num, const TensorQTable &rows, TensorRow *dest,
+                            bool *done) {
+  RETURN_UNEXPECTED_IF_NULL(dest);
+  RETURN_UNEXPECTED_IF_NULL(done);
+  *done = false;
+  auto batch = TakeBatch(epoch_num, batch_num);
+  if (batch == nullptr || rows.empty() || rows.size() > static_cast<size_t>(batch_size_)) {
+    ++num_copied_;
+    return Status::OK();
+  }
+  // No map worker touches the batch any more, all its rows have arrived.
+  const size_t num_columns = rows.front().size();
+  if (batch->columns.size() != num_columns) {
+    ++num_copied_;
+    return Status::OK();
+  }
+  for (size_t i = 0; i < num_columns; i++) {
+    const Column &col = batch->columns[i];
+    if (col.pool == nullptr) {
+      ++num_copied_;
+      return Status::OK();
+    }
+    for (size_t j = 0; j < rows.size(); j++) {
+      if (rows[j].size() != num_columns || rows[j][i]->GetBuffer() != col.base + col.row_bytes * j ||
+          rows[j][i]->shape() != col.shape || rows[j][i]->type() != col.type) {
+        ++num_copied_;
+        return Status::OK();
+      }
+    }
+  }
+  TensorRow batched;
+  for (size_t i = 0; i < num_columns; i++) {
+    const Column &col = batch->columns[i];
+    auto num_rows = static_cast<dsize_t>(rows.size());
+    std::shared_ptr<Tensor> tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateFromMemoryView(col.shape.PrependDim(num_rows), col.type, col.base,
+                                                  col.row_bytes * num_rows, col.pool, &tensor));
+    batched.emplace_back(std::move(tensor));
+  }
+  *dest = std::move(batched);
+  *done = true;
+  ++num_assembled_;
+  return Status::OK();
+}
+
+void BatchSlots::Discard(int64_t epoch_num, int64_t batch_num) { (void)TakeBatch(epoch_num, batch_num); }
+}  // namespace dataset
+}  // namespace mindspore
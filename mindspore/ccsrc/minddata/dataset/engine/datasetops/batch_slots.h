@@ -0,0 +1,137 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLOTS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLOTS_H_
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// Position of a row in the batches of a BatchOp. index is -1 for the rows which are not batched in place.
+struct BatchSlot {
+  int64_t epoch_num = 0;
+  int64_t batch_num = 0;
+  int32_t index = -1;
+};
+
+// Batch buffers shared by a BatchOp and the MapOp right below it, used to build the batches in place.
+// Every batch gets one buffer per column, large enough for batch_size rows of the shape of the column. A column takes
+// the shape and type of the same column in the batch before, or of the first row placed if it differs, and its buffer
+// is allocated when the first row is written into it. The pages of a buffer are only committed by the system as rows
+// are written into it.
+// While the last map kernel of a row runs, the map worker hands the slot of the row out through a RowPlacement: a
+// numeric tensor the kernel allocates with the shape and type of exactly one column is allocated in the slot of that
+// column, so the kernel writes its output straight into the batch. The tensors of the row which were not allocated in
+// their slot are copied into it when the row is placed, in parallel by the map workers. Once all the rows of a batch
+// have arrived, the BatchOp wraps the buffers into the batched tensors instead of copying every row once more.
+// Tensors which are not numeric, are empty, or don't match the shape and type of their column are left where they are;
+// the BatchOp then falls back to copying the rows of that batch.
+class BatchSlots {
+ public:
+  // @param batch_size - The number of rows of every batch
+  explicit BatchSlots(int32_t batch_size);
+
+  ~BatchSlots() = default;
+
+  // Hands the slot of one row out to the tensors allocated by the calling thread, see Tensor::SetPlacement.
+  class RowPlacement : public TensorPlacement {
+   public:
+    // @param slots - The batch buffers
+    // @param slot - The position of the row
+    RowPlacement(BatchSlots *slots, const BatchSlot &slot) : slots_(slots), slot_(slot) {}
+
+    ~RowPlacement() override = default;
+
+    bool Claim(const TensorShape &shape, const DataType &type, uchar **buffer,
+               std::shared_ptr<MemoryPool> *pool) override;
+
+   private:
+    BatchSlots *slots_;
+    BatchSlot slot_;
+    std::vector<bool> claimed_;  // the columns whose slot is already handed out for this row
+  };
+
+  int32_t batch_size() const { return batch_size_; }
+
+  // Move the tensors of a row into its slot, the ones already allocated in it stay as they are.
+  // @param slot - The position of the row, nothing is done if its index is -1
+  // @param row - The row, its tensors are replaced by the ones referring to the slot
+  // @return Status The status code returned
+  Status Place(const BatchSlot &slot, TensorRow *row);
+
+  // Build the batched row from the buffers of a batch and release the buffers of the batch.
+  // @param epoch_num - The epoch of the batch
+  // @param batch_num - The index of the batch in its epoch
+  // @param rows - The rows of the batch
+  // @param dest - The batched row
+  // @param done - Set to false if the rows were not all placed, dest is not touched then
+  // @return Status The status code returned
+  Status Assemble(int64_t epoch_num, int64_t batch_num, const TensorQTable &rows, TensorRow *dest, bool *done);
+
+  // Release the buffers of a batch which is dropped
+  void Discard(int64_t epoch_num, int64_t batch_num);
+
+  // @return The number of batches built in place so far
+  int64_t num_assembled() const { return num_assembled_; }
+
+  // @return The number of batches which had to be copied so far
+  int64_t num_copied() const { return num_copied_; }
+
+ private:
+  struct Column {
+    std::shared_ptr<MemoryPool> pool;  // keeps the buffer alive while any tensor refers to it
+    uchar *base = nullptr;
+    TensorShape shape = TensorShape::CreateUnknownRankShape();
+    DataType type;
+    dsize_t row_bytes = 0;
+  };
+
+  struct Batch {
+    std::mutex mux;
+    std::vector<Column> columns;
+  };
+
+  // Find the buffers of a batch, create them with the layout of the last batch if needed
+  std::shared_ptr<Batch> GetBatch(int64_t epoch_num, int64_t batch_num);
+
+  // Allocate the buffer of a column and keep its layout for the next batches, the lock of its batch is held
+  // @param index - The index of the column
+  // @param col - The column
+  // @return Status The status code returned
+  Status AllocateColumn(size_t index, Column *col);
+
+  // Remove the buffers of a batch from the table, nullptr if the batch has no buffer
+  std::shared_ptr<Batch> TakeBatch(int64_t epoch_num, int64_t batch_num);
+
+  const int32_t batch_size_;
+  std::mutex mux_;
+  std::map<std::pair<int64_t, int64_t>, std::shared_ptr<Batch>> batches_;
+  std::vector<Column> layout_;  // shape and type of the columns of the last batch, without buffer
+  std::atomic<int64_t> num_assembled_{0};
+  std::atomic<int64_t> num_copied_{0};
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_BATCH_SLOTS_H_
@@ -166,6 +166,10 @@ Status CacheOp::WaitForCachingAllRows() {
   MS_LOG(INFO) << "Number of rows cached in memory : " << stat.num_mem_cached;
   MS_LOG(INFO) << "Number of rows spilled to disk : " << stat.num_disk_cached;
   MS_LOG(INFO) << "Average cache size : " << stat.avg_cache_sz;
+  if (stat.compressed_bytes > 0) {
+    MS_LOG(INFO) << "Compression ratio : " << static_cast<double>(stat.raw_bytes) / stat.compressed_bytes
+                 << ", compression time (us) : " << stat.compress_us;
+  }
   // Now all rows are cached and we have done a sync point check up. Next phase is
   // is pick up fetch input from sampler and pass up to the caller.
   RETURN_IF_NOT_OK(sampler_->HandshakeRandomAccessOp(this));
@@ -23,6 +23,8 @@
 #include <string>
 #include <algorithm>
 
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/device_queue_op.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 
@@ -215,7 +217,9 @@ std::vector<DatasetOp *> DatasetOp::parents() const { return parent_; }
 void DatasetOp::CreateConnector() {
   MS_LOG(DEBUG) << "Creating connector in tree operator: " << operator_id_ << ".";
   if (oc_queue_size_ > 0) {
-    out_connector_ = std::make_unique<OperatorConnector>(oc_queue_size_);
+    auto cfg = GlobalContext::config_manager();
+    out_connector_ = std::make_unique<OperatorConnector>(oc_queue_size_, cfg->enable_lock_free_queue());
+    out_connector_->SetChunkSize(cfg->op_connector_chunk_size());
   } else {
     // Some op's may choose not to have an output connector
     MS_LOG(DEBUG) << "Bypassed connector creation for tree operator: " << operator_id_ << ".";
@@ -433,6 +437,39 @@ void DatasetOp::UpdateRepeatAndEpochCounter() {
   MS_LOG(DEBUG) << Name() << " current repeats: " << op_current_repeats_ << ", current epochs: " << op_current_epochs_;
 }
 
+void DatasetOp::RecordRepeatState(int32_t repeat, nlohmann::json state) {
+  // An operator gets ahead of the root of the tree by the rows in the connectors, so a few epochs are kept.
+  constexpr size_t kMaxEpochStates = 8;
+  int32_t epoch = 0;
+  if (op_num_repeats_per_epoch_ > 0) {
+    if (repeat % op_num_repeats_per_epoch_ != 0) {
+      return;
+    }
+    epoch = repeat / op_num_repeats_per_epoch_;
+  } else if (repeat != 0) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(epoch_states_mutex_);
+  epoch_states_[epoch] = std::move(state);
+  while (epoch_states_.size() > kMaxEpochStates) {
+    (void)epoch_states_.erase(epoch_states_.begin());
+  }
+}
+
+Status DatasetOp::GetEpochState(int32_t epoch, nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  std::unique_lock<std::mutex> lock(epoch_states_mutex_);
+  *state = nullptr;
+  if (epoch_states_.empty()) {
+    return Status::OK();
+  }
+  auto it = epoch_states_.find(epoch);
+  CHECK_FAIL_RETURN_UNEXPECTED(it != epoch_states_.end(), "The state of " + Name() + " at the start of epoch " +
+                                                             std::to_string(epoch) + " is no longer kept.");
+  *state = it->second;
+  return Status::OK();
+}
+
 int64_t DatasetOp::GetTreeBatchSize() {
   if (child_.size() == 1) {
     return child_[0]->GetTreeBatchSize();
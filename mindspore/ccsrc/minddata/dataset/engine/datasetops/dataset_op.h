@@ -16,12 +16,14 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_DATASET_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_DATASET_OP_H_
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include <utility>
+#include <nlohmann/json.hpp>
 
 #include "minddata/dataset/callback/callback_manager.h"
 #include "minddata/dataset/include/dataset/constants.h"
@@ -249,7 +251,7 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   // \return connector size of current op
   int32_t ConnectorSize() const {
     if (!inlined()) {
-      return out_connector_->size();
+      return out_connector_->num_rows();
     }
     // Return child connector size for inlined op
     return ChildOpConnectorSize();
@@ -350,6 +352,18 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
 
   virtual std::vector<int32_t> GetMPWorkerPIDs() const;
 
+  // \brief Get the state the operator recorded at the start of an epoch, to resume the pipeline from this epoch
+  // \param[in] epoch The epoch, counted from the start of this tree
+  // \param[out] state The state, null if the operator keeps no state across epochs
+  // \return Status error code, an error if the state of the epoch is no longer kept
+  Status GetEpochState(int32_t epoch, nlohmann::json *state);
+
+  // \brief Restore a state returned by GetEpochState, so that the first epoch of this tree replays that epoch.
+  //     It is called before the tree is launched.
+  // \param[in] state The state
+  // \return Status error code
+  virtual Status RestoreEpochState(const nlohmann::json &state) { return Status::OK(); }
+
  protected:
   // \brief Removes a parent operator from this operator
   // \notes External callers do not have access to this function
@@ -372,6 +386,11 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   // If this repeat happen to be the last repeat in the current epoch, also increase op_current_epochs_ by 1.
   void UpdateRepeatAndEpochCounter();
 
+  // Record the state of the operator at the start of a repeat, only kept when the repeat starts an epoch.
+  // \param repeat - the number of repeats the operator has done
+  // \param state - the state needed to replay the repeat
+  void RecordRepeatState(int32_t repeat, nlohmann::json state);
+
   // Launch the Op
   virtual Status Launch() { return Status::OK(); }
 
@@ -392,6 +411,8 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   CallbackManager callback_manager_;                             // Manages callbacks associated with a DatasetOp
   int64_t dataset_size_;                                         // Size of the dataset
   int64_t num_classes_;                                          // Number of classes
+  std::mutex epoch_states_mutex_;                                // For protecting shared access to the epoch states
+  std::map<int32_t, nlohmann::json> epoch_states_;               // States at the start of the last epochs, by epoch
 
  private:
   // Sets the operator id.
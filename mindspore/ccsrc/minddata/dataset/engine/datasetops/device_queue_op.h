@@ -114,6 +114,14 @@ class DeviceQueueOp : public PipelineOp {
   // @return Name of the current Op
   std::string Name() const override { return kDeviceQueueOp; }
 
+  // Device type getter
+  // @return The type of the device the data is sent to
+  DeviceType device_type() const { return device_type_; }
+
+  // Device id getter
+  // @return The id of the device the data is sent to
+  int32_t device_id() const { return device_id_; }
+
  private:
   // Name: FilterMetadata(TensorRow *);
   // Description: Auto filter metadata column before sending to device.
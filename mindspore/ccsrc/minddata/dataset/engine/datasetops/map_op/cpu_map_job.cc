@@ -35,12 +35,16 @@ CpuMapJob::~CpuMapJob() = default;
 Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   int32_t num_rows = in.size();
+  // Only the outputs of the last TensorOp are placed, the intermediate ones are allocated as usual.
+  TensorPlacement *placement = Tensor::SetPlacement(nullptr);
   for (int32_t row = 0; row < num_rows; row++) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
+      (void)Tensor::SetPlacement(i + 1 == ops_.size() ? placement : nullptr);
       // Call compute function for cpu
       Status rc = ops_[i]->Compute(input_row, &result_row);
+      (void)Tensor::SetPlacement(nullptr);
       if (rc.IsError()) {
         RETURN_IF_NOT_OK(RebuildMapErrorMsg(input_row, i, &rc));
       }
@@ -52,6 +56,7 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
     }
     out->push_back(std::move(result_row));
   }
+  (void)Tensor::SetPlacement(placement);
   return Status::OK();
 }
 
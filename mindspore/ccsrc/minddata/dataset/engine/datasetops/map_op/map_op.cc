@@ -70,13 +70,15 @@ void MapOp::Print(std::ostream &out, bool show_all) const {
 }
 
 // A helper function that fetch worker map job from local queues and extract the data and map job list
-Status MapOp::FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list) {
+Status MapOp::FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list,
+                            BatchSlot *batch_slot) {
   std::unique_ptr<MapWorkerJob> worker_job;
   // Fetch the next worker job and TensorRow
   RETURN_IF_NOT_OK(worker_in_queues_[worker_id]->PopFront(&worker_job));
   // Extract the TensorRow and job list from the map worker job.
   *row = std::move(worker_job->tensor_row);
   *job_list = std::move(worker_job->jobs);
+  *batch_slot = worker_job->batch_slot;
 
   return Status::OK();
 }
@@ -126,6 +128,9 @@ Status MapOp::operator()() {
   child_iterator_ = std::make_unique<ChildIterator>(this, 0, 0);
   TensorRow new_row;
   RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+  // Position of the next row in the batches of the BatchOp above, only used when the batches are built in place.
+  int64_t epoch_num = 0;
+  int64_t row_num = 0;
 
   while (!new_row.eof()) {
     if (op_current_repeats_ % GetOpNumRepeatsPerEpoch() == 0) {
@@ -143,6 +148,12 @@ Status MapOp::operator()() {
 
       // Populate map worker job for a worker to execute
       RETURN_IF_NOT_OK(GenerateWorkerJob(&worker_job));
+      if (batch_slots_ != nullptr) {
+        worker_job->batch_slot.epoch_num = epoch_num;
+        worker_job->batch_slot.batch_num = row_num / batch_slots_->batch_size();
+        worker_job->batch_slot.index = static_cast<int32_t>(row_num % batch_slots_->batch_size());
+        row_num++;
+      }
 
       // Push map worker job to the corresponding worker's queue
       RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->Add(std::move(worker_job)));
@@ -153,6 +164,8 @@ Status MapOp::operator()() {
     // Propagate the eoe row to worker
     std::unique_ptr<MapWorkerJob> worker_job = std::make_unique<MapWorkerJob>(std::move(new_row));
     RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->Add(std::move(worker_job)));
+    epoch_num++;
+    row_num = 0;
     UpdateRepeatAndEpochCounter();
     RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
   }
@@ -179,8 +192,9 @@ Status MapOp::WorkerEntry(int32_t worker_id) {
 
   TensorRow in_row;
   std::vector<std::shared_ptr<MapJob>> job_list;
+  BatchSlot batch_slot;
   // Fetch next data row and map job list
-  RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list));
+  RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list, &batch_slot));
 
   // Now that init work is done, drop into the main fetching loop.
   // Map op does not use child iterator, and it needs to manually handle eoe and eof's itself
@@ -195,19 +209,27 @@ Status MapOp::WorkerEntry(int32_t worker_id) {
     } else {
       CHECK_FAIL_RETURN_UNEXPECTED(in_row.size() != 0, "[Internal ERROR] MapOp got an empty TensorRow.");
       TensorRow out_row;
-      // Perform the compute function of TensorOp(s) and store the result in new_tensor_table.
-      RETURN_IF_NOT_OK(WorkerCompute(in_row, &out_row, job_list));
+      if (batch_slots_ != nullptr) {
+        // The last map kernels write their outputs straight into the slot of the row, and the rest of the row is
+        // moved into its batch while it is still hot in the cache of this worker.
+        BatchSlots::RowPlacement placement(batch_slots_.get(), batch_slot);
+        RETURN_IF_NOT_OK(WorkerCompute(in_row, &out_row, job_list, &placement));
+        RETURN_IF_NOT_OK(batch_slots_->Place(batch_slot, &out_row));
+      } else {
+        // Perform the compute function of TensorOp(s) and store the result in new_tensor_table.
+        RETURN_IF_NOT_OK(WorkerCompute(in_row, &out_row, job_list));
+      }
       // Push the row onto the connector for next operator to consume.
       RETURN_IF_NOT_OK(worker_out_queues_[worker_id]->EmplaceBack(std::move(out_row)));
     }
     // Fetch next data row and map job list
-    RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list));
+    RETURN_IF_NOT_OK(FetchNextWork(worker_id, &in_row, &job_list, &batch_slot));
   }
   return Status::OK();
 }
 
 Status MapOp::WorkerCompute(const TensorRow &in_row, TensorRow *out_row,
-                            const std::vector<std::shared_ptr<MapJob>> &job_list) {
+                            const std::vector<std::shared_ptr<MapJob>> &job_list, TensorPlacement *placement) {
   int32_t num_cols = in_row.size();
 
   std::vector<TensorRow> job_input_table;
@@ -235,8 +257,14 @@ Status MapOp::WorkerCompute(const TensorRow &in_row, TensorRow *out_row,
   // Executing the list of jobs.
   for (size_t i = 0; i < job_list.size(); i++) {
     RETURN_IF_INTERRUPTED();
-    // Execute MapWorkerJob.
-    RETURN_IF_NOT_OK(job_list[i]->Run(job_input_table, &result_table));
+    // Execute MapWorkerJob. Only the outputs of the last job on the cpu may be placed, the placement is reset as soon
+    // as the job is done.
+    bool place = placement != nullptr && i + 1 == job_list.size() &&
+                 dynamic_cast<CpuMapJob *>(job_list[i].get()) != nullptr;
+    TensorPlacement *previous = Tensor::SetPlacement(place ? placement : nullptr);
+    Status rc = job_list[i]->Run(job_input_table, &result_table);
+    (void)Tensor::SetPlacement(previous);
+    RETURN_IF_NOT_OK(rc);
     // Assign the processed data as an input for the next job processing, except for the last TensorOp in the list.
     if (i + 1 < job_list.size()) {
       job_input_table = std::move(result_table);
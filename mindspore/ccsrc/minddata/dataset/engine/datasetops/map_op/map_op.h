@@ -26,6 +26,7 @@
 #include "minddata/dataset/api/python/python_mp.h"
 #include "minddata/dataset/callback/ds_callback.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
 #include "minddata/dataset/engine/datasetops/map_op/map_job.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -43,6 +44,7 @@ struct MapWorkerJob {
   explicit MapWorkerJob(TensorRow tr) : tensor_row(std::move(tr)) {}
   std::vector<std::shared_ptr<MapJob>> jobs;
   TensorRow tensor_row;
+  BatchSlot batch_slot;  // where the output row goes when the batches are built in place
 };
 
 // MapOp class implements the Map operator. It will apply a list of operations to each record specified by column names.
@@ -136,12 +138,18 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
   /// \return vector of int
   std::vector<int32_t> GetMPWorkerPIDs() const override;
 
+  /// Build the batches of the BatchOp right above in place: every output row is moved into its slot of the batch
+  /// buffers by the worker which computed it.
+  /// \param batch_slots the batch buffers shared with the BatchOp
+  void SetBatchSlots(std::shared_ptr<BatchSlots> batch_slots) { batch_slots_ = std::move(batch_slots); }
+
  private:
   // A helper function to create jobs for workers.
   Status GenerateWorkerJob(const std::unique_ptr<MapWorkerJob> *worker_job);
 
   // A helper function that fetch worker map job from local queues and extract the data and map job list
-  Status FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list);
+  Status FetchNextWork(uint32_t worker_id, TensorRow *row, std::vector<std::shared_ptr<MapJob>> *job_list,
+                       BatchSlot *batch_slot);
 
   //  Tensorops to be read and applied by worker threads
   std::vector<std::shared_ptr<TensorOp>> tfuncs_;
@@ -162,6 +170,8 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
 
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
 
+  std::shared_ptr<BatchSlots> batch_slots_;  // batch buffers of the BatchOp above, nullptr if not batched in place
+
   // Private function for worker/thread to loop continuously. It comprises the main
   // logic of MapOp: getting the data from previous Op, validating user specified column names,
   // applying a list of TensorOps to each of the data, process the results and then
@@ -173,8 +183,9 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
   // Private function for worker thread to perform TensorOp's compute function and get the result.
   // @param in_row Input TensorRow
   // @param[out] out_row Generated TensorRow
+  // @param placement Placement of the outputs of the last job, nullptr to allocate them as usual
   Status WorkerCompute(const TensorRow &in_row, TensorRow *out_row,
-                       const std::vector<std::shared_ptr<MapJob>> &job_list);
+                       const std::vector<std::shared_ptr<MapJob>> &job_list, TensorPlacement *placement = nullptr);
 
   // Private function that create the final column name to index mapping and
   // get indices of the columns this mapop does not use.
@@ -23,6 +23,8 @@
 #include <utility>
 #include <vector>
 #include "minddata/dataset/include/dataset/constants.h"
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/engine/datasetops/source/io_block.h"
@@ -89,8 +91,11 @@ class ParallelOp : public DatasetOp {
   /// \return Status The status code returned
   virtual Status RegisterAndLaunchThreads() {
     RETURN_UNEXPECTED_IF_NULL(tree_);
-    worker_in_queues_.Init(num_workers_, worker_connector_size_);
-    worker_out_queues_.Init(num_workers_, worker_connector_size_);
+    // Each worker queue is fed by a single thread (the main thread or a worker) and drained by a single thread (a
+    // worker or the collector), so it may go lock free.
+    bool lock_free = GlobalContext::config_manager()->enable_lock_free_queue();
+    worker_in_queues_.Init(num_workers_, worker_connector_size_, lock_free);
+    worker_out_queues_.Init(num_workers_, worker_connector_size_, lock_free);
 
     // Registers QueueList and individual Queues for interrupt services
     RETURN_IF_NOT_OK(worker_in_queues_.Register(tree_->AllTasks()));
@@ -111,9 +116,17 @@ class ParallelOp : public DatasetOp {
     int64_t num_rows = 0, ep_step = 0, total_step = 0;
     int32_t current_repeats = 0, current_epochs = 0;
     TensorRow row;
+    // Rows collected but not sent yet. They are pushed to the out connector as a chunk, and never held back while the
+    // collector waits for a worker, so the parent is not starved.
+    std::vector<TensorRow> pending_rows;
     do {
-      RETURN_IF_NOT_OK(worker_out_queues_[num_rows++ % num_workers_]->PopFront(&row));
+      auto &worker_out_queue = worker_out_queues_[num_rows++ % num_workers_];
+      if (!pending_rows.empty() && worker_out_queue->empty()) {
+        RETURN_IF_NOT_OK(out_connector_->AddRows(&pending_rows));
+      }
+      RETURN_IF_NOT_OK(worker_out_queue->PopFront(&row));
       if (row.wait()) {
+        RETURN_IF_NOT_OK(out_connector_->AddRows(&pending_rows));
         // When collector receives the signal from workere thread, it increments a atomic int
         // If num_worker signals are received, wakes up the main thread
         if (++num_workers_paused_ == num_workers_) {
@@ -138,8 +151,17 @@ class ParallelOp : public DatasetOp {
         ++total_step;
         RETURN_IF_NOT_OK(callback_manager_.StepEnd(CallbackParam(current_epochs + 1, ep_step, total_step)));
       }
-      RETURN_IF_NOT_OK(out_connector_->Add(std::move(row)));
-    } while (!row.eof());
+      bool is_data = row.Flags() == TensorRow::TensorRowFlags::kFlagNone;
+      bool eof = row.eof();
+      pending_rows.push_back(std::move(row));
+      // Control rows are sent right away
+      if (!is_data || pending_rows.size() >= static_cast<size_t>(out_connector_->chunk_size())) {
+        RETURN_IF_NOT_OK(out_connector_->AddRows(&pending_rows));
+      }
+      if (eof) {
+        break;
+      }
+    } while (true);
     return Status::OK();
   }
 
@@ -20,6 +20,7 @@
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <sstream>
 #include <utility>
 
 #include "minddata/dataset/core/config_manager.h"
@@ -118,6 +119,13 @@ Status ShuffleOp::operator()() {
 
   // Main operator loop
   while (true) {
+    // Keep the state of the random generator, for a snapshot of the pipeline to replay this epoch. The rows in the
+    // buffer are not kept: a restored pipeline reads the epoch again from its start, and the skip above this op drops
+    // the rows before the step.
+    std::ostringstream rng_state;
+    rng_state << rng_;
+    RecordRepeatState(op_current_repeats_, {{"rng", rng_state.str()}, {"seed", shuffle_seed_}});
+
     // Do an initial populate of the shuffle buffer
     RETURN_IF_NOT_OK(InitShuffleBuffer());
 
@@ -186,6 +194,7 @@ Status ShuffleOp::operator()() {
     // Instead, manually update ourselves and then go reloop to start fetching from child operator
     // right away.  Any Reset() from the parent will still perform common reset actions.
     RETURN_IF_NOT_OK(this->SelfReset());
+    UpdateRepeatAndEpochCounter();
   }
 
   return Status::OK();
@@ -246,6 +255,18 @@ Status ShuffleOp::InitShuffleBuffer() {
   return Status::OK();
 }
 
+Status ShuffleOp::RestoreEpochState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.contains("rng") && state["rng"].is_string() && state.contains("seed") &&
+                                 state["seed"].is_number_unsigned(),
+                               "Invalid state of ShuffleOp.");
+  // The seed is used again every epoch when the rows are not reshuffled each epoch.
+  shuffle_seed_ = state["seed"].get<uint32_t>();
+  std::istringstream rng_state(state["rng"].get<std::string>());
+  rng_state >> rng_;
+  CHECK_FAIL_RETURN_UNEXPECTED(!rng_state.fail(), "Invalid state of ShuffleOp, bad random generator state.");
+  return Status::OK();
+}
+
 Status ShuffleOp::EoeReceived(int32_t worker_id) {
   state_ = OpState::kDeOpIdle;
   return Status::OK();
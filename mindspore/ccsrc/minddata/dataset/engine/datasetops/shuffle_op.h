@@ -87,6 +87,12 @@ class ShuffleOp : public PipelineOp {
   // @return Name of the current Op
   std::string Name() const override { return kShuffleOp; }
 
+  // Restore the seed and the state of the random generator at the start of an epoch. The rows of the epoch are read
+  // again from its start, since the shuffle buffer is not part of the state.
+  // @param state - the state recorded by the op at the start of the epoch
+  // @return Status The status code returned
+  Status RestoreEpochState(const nlohmann::json &state) override;
+
  private:
   // Private function to add a new row to the shuffle buffer.
   // @return Status The status code returned
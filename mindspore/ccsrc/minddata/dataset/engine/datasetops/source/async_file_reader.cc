@@ -0,0 +1,185 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/async_file_reader.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+AsyncFileReader::AsyncFileReader(int32_t depth, int64_t memory_limit)
+    : depth_(depth), num_reading_(0), memory_limit_(memory_limit), bytes_ready_(0), stop_(false) {}
+
+Status AsyncFileReader::Register(TaskGroup *vg) {
+  RETURN_UNEXPECTED_IF_NULL(vg);
+  RETURN_IF_NOT_OK(io_cv_.Register(vg->GetIntrpService()));
+  return done_cv_.Register(vg->GetIntrpService());
+}
+
+Status AsyncFileReader::IoThread() {
+  TaskManager::FindMe()->Post();
+  std::unique_lock<std::mutex> lock(mux_);
+  while (true) {
+    RETURN_IF_NOT_OK(io_cv_.Wait(&lock, [this]() {
+      return stop_ || (!queued_.empty() && num_reading_ < depth_ && bytes_ready_ < memory_limit_);
+    }));
+    if (stop_) {
+      return Status::OK();
+    }
+    auto req = queued_.front();
+    queued_.pop_front();
+    // The worker of the row got there first and read the file itself.
+    if (req->state == State::kCancelled) {
+      continue;
+    }
+    req->state = State::kReading;
+    ++num_reading_;
+    lock.unlock();
+    std::shared_ptr<Tensor> data;
+    Status rc = Tensor::CreateFromFile(req->path, &data);
+    lock.lock();
+    --num_reading_;
+    if (data != nullptr) {
+      ++stats_.num_read;
+      stats_.bytes_read += data->SizeInBytes();
+    }
+    // The row was dropped while its file was read, nobody will take it.
+    if (req->state == State::kCancelled) {
+      done_cv_.NotifyAll();
+      io_cv_.NotifyOne();
+      continue;
+    }
+    req->rc = rc;
+    req->data = std::move(data);
+    req->state = State::kDone;
+    if (req->data != nullptr) {
+      bytes_ready_ += req->data->SizeInBytes();
+      stats_.peak_bytes = std::max(stats_.peak_bytes, bytes_ready_);
+    }
+    done_cv_.NotifyAll();
+    io_cv_.NotifyOne();
+  }
+}
+
+void AsyncFileReader::Submit(int64_t row_id, const std::string &path) {
+  auto req = std::make_shared<Request>();
+  req->path = path;
+  std::unique_lock<std::mutex> lock(mux_);
+  requests_[row_id].push_back(req);
+  queued_.push_back(std::move(req));
+  io_cv_.NotifyOne();
+}
+
+Status AsyncFileReader::Take(int64_t row_id, std::shared_ptr<Tensor> *out, bool *found) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  RETURN_UNEXPECTED_IF_NULL(found);
+  std::unique_lock<std::mutex> lock(mux_);
+  *found = false;
+  auto it = requests_.find(row_id);
+  if (it == requests_.end()) {
+    ++stats_.num_missed;
+    return Status::OK();
+  }
+  auto req = it->second.front();
+  it->second.pop_front();
+  if (it->second.empty()) {
+    requests_.erase(it);
+  }
+  if (req->state == State::kQueued) {
+    // Reading the file here is faster than waiting for the reads queued before it.
+    req->state = State::kCancelled;
+    ++stats_.num_missed;
+    return Status::OK();
+  }
+  if (req->state == State::kReading) {
+    ++stats_.num_waited;
+    RETURN_IF_NOT_OK(done_cv_.Wait(&lock, [&req]() { return req->state != State::kReading; }));
+    // Dropped by Reset or Stop while it was waited for.
+    if (req->state == State::kCancelled) {
+      return Status::OK();
+    }
+  } else {
+    ++stats_.num_ready;
+  }
+  if (req->data != nullptr) {
+    bytes_ready_ -= req->data->SizeInBytes();
+    io_cv_.NotifyOne();
+  }
+  RETURN_IF_NOT_OK(req->rc);
+  *out = std::move(req->data);
+  *found = true;
+  return Status::OK();
+}
+
+Status AsyncFileReader::WaitForReads(int64_t num_read) {
+  std::unique_lock<std::mutex> lock(mux_);
+  return done_cv_.Wait(&lock, [this, num_read]() { return stats_.num_read >= num_read || stop_; });
+}
+
+void AsyncFileReader::SetDepth(int32_t depth) {
+  std::unique_lock<std::mutex> lock(mux_);
+  depth_ = depth;
+  io_cv_.NotifyAll();
+}
+
+int32_t AsyncFileReader::depth() const {
+  std::unique_lock<std::mutex> lock(mux_);
+  return depth_;
+}
+
+int32_t AsyncFileReader::MaxDepthInMemory(int32_t max_depth) const {
+  std::unique_lock<std::mutex> lock(mux_);
+  if (stats_.num_read == 0 || stats_.bytes_read == 0) {
+    return max_depth;
+  }
+  int64_t mean_size = stats_.bytes_read / stats_.num_read;
+  return static_cast<int32_t>(std::max<int64_t>(1, std::min<int64_t>(max_depth, memory_limit_ / mean_size)));
+}
+
+void AsyncFileReader::DropRequests() {
+  for (auto &row : requests_) {
+    for (auto &req : row.second) {
+      if (req->state == State::kDone && req->data != nullptr) {
+        bytes_ready_ -= req->data->SizeInBytes();
+      }
+      req->state = State::kCancelled;
+      req->data = nullptr;
+      ++stats_.num_dropped;
+    }
+  }
+  requests_.clear();
+  queued_.clear();
+  done_cv_.NotifyAll();
+  io_cv_.NotifyAll();
+}
+
+void AsyncFileReader::Reset() {
+  std::unique_lock<std::mutex> lock(mux_);
+  DropRequests();
+}
+
+void AsyncFileReader::Stop() {
+  std::unique_lock<std::mutex> lock(mux_);
+  stop_ = true;
+  DropRequests();
+}
+
+AsyncFileReader::Stats AsyncFileReader::GetStats() const {
+  std::unique_lock<std::mutex> lock(mux_);
+  return stats_;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,130 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_ASYNC_FILE_READER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_ASYNC_FILE_READER_H_
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/cond_var.h"
+#include "minddata/dataset/util/status.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+// Reads the files of the rows of a leaf operator ahead of its workers.
+// The rows are submitted in the order the workers will load them. A pool of IO threads reads their files in that
+// order, with at most depth reads in flight, so that the latency of the storage is hidden by the depth of the queue
+// rather than by the number of workers. When a worker gets to a row, it takes the content of its file: it waits for
+// a read in flight, and reads the file itself if the read has not started yet, so that it never waits behind the reads
+// queued for other rows. The files read but not taken yet are bounded by a memory limit, the IO threads pause while it
+// is reached.
+class AsyncFileReader {
+ public:
+  struct Stats {
+    int64_t num_ready = 0;   // Files read before their worker asked for them
+    int64_t num_waited = 0;  // Files their worker had to wait for
+    int64_t num_missed = 0;  // Files their worker read itself
+    int64_t peak_bytes = 0;  // Largest size of the files read but not taken yet
+    int64_t num_dropped = 0;  // Rows submitted and dropped by Reset or Stop before they were taken
+    int64_t num_read = 0;     // Files read by the IO threads
+    int64_t bytes_read = 0;   // Size of the files read by the IO threads
+  };
+
+  // @param depth - The maximum number of reads in flight
+  // @param memory_limit - The size in bytes of the files read but not taken yet above which no read is started
+  AsyncFileReader(int32_t depth, int64_t memory_limit);
+
+  ~AsyncFileReader() = default;
+
+  // Register the condition variables for the interrupt service of the tree
+  // @param vg - The task group of the tree
+  // @return Status The status code returned
+  Status Register(TaskGroup *vg);
+
+  // The loop of an IO thread, which returns after Stop
+  // @return Status The status code returned
+  Status IoThread();
+
+  // Queue the read of the file of a row
+  // @param row_id - The row, a row may be submitted several times, e.g. once per epoch
+  // @param path - The file of the row
+  void Submit(int64_t row_id, const std::string &path);
+
+  // Take the content of the file of a row, in the order the row was submitted
+  // @param row_id - The row
+  // @param out - The content of the file, as a 1-D uint8 tensor
+  // @param found - Set to false if the row was not submitted or its read had not started yet. The row is then
+  //     forgotten, and out is not touched
+  // @return Status The status code returned, the error of the read if it failed
+  Status Take(int64_t row_id, std::shared_ptr<Tensor> *out, bool *found);
+
+  // Wait until the IO threads have read a number of files since the reader was created
+  // @param num_read - The number of files
+  // @return Status The status code returned
+  Status WaitForReads(int64_t num_read);
+
+  // @param depth - The maximum number of reads in flight
+  void SetDepth(int32_t depth);
+
+  int32_t depth() const;
+
+  // The depth above which the files read ahead, of the mean size read so far, would not fit in the memory limit
+  // @param max_depth - Returned as is before any file is read
+  // @return The depth, between 1 and max_depth
+  int32_t MaxDepthInMemory(int32_t max_depth) const;
+
+  // Drop the rows submitted and not taken yet, e.g. at the end of an epoch. Their reads in flight are discarded once
+  // done, and a worker which takes one of them later reads the file itself
+  void Reset();
+
+  // Let the IO threads return once they are done with their reads in flight, the rows not taken yet are dropped
+  void Stop();
+
+  Stats GetStats() const;
+
+ private:
+  enum class State { kQueued, kReading, kDone, kCancelled };
+
+  struct Request {
+    std::string path;
+    State state = State::kQueued;
+    Status rc;
+    std::shared_ptr<Tensor> data;
+  };
+
+  // Drop the rows submitted and not taken yet, the lock must be held
+  void DropRequests();
+
+  mutable std::mutex mux_;
+  CondVar io_cv_;    // The IO threads wait for requests, or for a free slot
+  CondVar done_cv_;  // The workers wait for their reads in flight
+  std::deque<std::shared_ptr<Request>> queued_;
+  std::map<int64_t, std::deque<std::shared_ptr<Request>>> requests_;
+  int32_t depth_;
+  int32_t num_reading_;
+  int64_t memory_limit_;
+  int64_t bytes_ready_;  // Size of the files read but not taken yet
+  bool stop_;
+  Stats stats_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_ASYNC_FILE_READER_H_
@@ -97,7 +97,13 @@ Status CocoOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   }
   Path image_folder(real_path.value());
   Path kImageFile = image_folder / image_id;
-  RETURN_IF_NOT_OK(ReadImageToTensor(kImageFile.ToString(), data_schema_->Column(0), &image));
+  bool read_ahead = false;
+  RETURN_IF_NOT_OK(TakeRowFile(row_id, &image, &read_ahead));
+  if (read_ahead) {
+    RETURN_IF_NOT_OK(DecodeImage(kImageFile.ToString(), &image));
+  } else {
+    RETURN_IF_NOT_OK(ReadImageToTensor(kImageFile.ToString(), data_schema_->Column(0), &image));
+  }
   if (task_type_ == TaskType::Captioning) {
     std::shared_ptr<Tensor> captions;
     auto itr = captions_map_.find(image_id);
@@ -575,7 +581,10 @@ Status CocoOp::ReadImageToTensor(const std::string &path, const ColDescriptor &c
 #else
   RETURN_IF_NOT_OK(Tensor::CreateFromFile(path, tensor));
 #endif
+  return DecodeImage(path, tensor);
+}
 
+Status CocoOp::DecodeImage(const std::string &path, std::shared_ptr<Tensor> *tensor) const {
   if (decode_) {
     Status rc = Decode(*tensor, tensor);
     CHECK_FAIL_RETURN_UNEXPECTED(
@@ -584,6 +593,22 @@ Status CocoOp::ReadImageToTensor(const std::string &path, const ColDescriptor &c
   return Status::OK();
 }
 
+bool CocoOp::SupportsReadAhead() const {
+#ifdef ENABLE_PYTHON
+  return decrypt_ == nullptr || py::isinstance<py::none>(decrypt_);
+#else
+  return true;
+#endif
+}
+
+Status CocoOp::GetRowFilePath(row_id_type row_id, std::string *path) {
+  RETURN_UNEXPECTED_IF_NULL(path);
+  CHECK_FAIL_RETURN_UNEXPECTED(row_id >= 0 && row_id < static_cast<row_id_type>(image_ids_.size()),
+                               "[Internal ERROR] Invalid row id: " + std::to_string(row_id));
+  *path = (Path(image_folder_path_) / image_ids_[row_id]).ToString();
+  return Status::OK();
+}
+
 Status CocoOp::CountTotalRows(int64_t *count) {
   RETURN_UNEXPECTED_IF_NULL(count);
   RETURN_IF_NOT_OK(PrepareData());
@@ -250,6 +250,22 @@ class CocoOp : public MappableLeafOp {
   /// \return Status The status code returned.
   Status ReadImageToTensor(const std::string &path, const ColDescriptor &col, std::shared_ptr<Tensor> *tensor) const;
 
+  /// \brief Decode an image read from its file, if decode is enabled.
+  /// \param[in] path Path to the image file.
+  /// \param[in,out] tensor Image tensor.
+  /// \return Status The status code returned.
+  Status DecodeImage(const std::string &path, std::shared_ptr<Tensor> *tensor) const;
+
+  /// \brief The images are read ahead unless they have to be decrypted.
+  /// \return true if the images can be read ahead.
+  bool SupportsReadAhead() const override;
+
+  /// \brief Get the image file of a row.
+  /// \param[in] row_id Id for this tensor row.
+  /// \param[out] path Path to the image file.
+  /// \return Status The status code returned.
+  Status GetRowFilePath(row_id_type row_id, std::string *path) override;
+
   /// \brief Read annotation from Annotation folder.
   /// \return Status The status code returned.
   Status PrepareData() override;
@@ -108,11 +108,15 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   ImageLabelPair pair_ptr = image_label_pairs_[row_id];
   std::shared_ptr<Tensor> image, label;
   RETURN_IF_NOT_OK(Tensor::CreateScalar(pair_ptr->second, &label));
+  bool read_ahead = false;
+  RETURN_IF_NOT_OK(TakeRowFile(row_id, &image, &read_ahead));
+  if (!read_ahead) {
 #ifdef ENABLE_PYTHON
-  RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(folder_path_ + (pair_ptr->first), &image, decrypt_));
+    RETURN_IF_NOT_OK(MappableLeafOp::ImageDecrypt(folder_path_ + (pair_ptr->first), &image, decrypt_));
 #else
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
+    RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
 #endif
+  }
 
   if (decode_ == true) {
     Status rc = Decode(image, &image);
@@ -127,6 +131,22 @@ Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   return Status::OK();
 }
 
+bool ImageFolderOp::SupportsReadAhead() const {
+#ifdef ENABLE_PYTHON
+  return decrypt_ == nullptr || py::isinstance<py::none>(decrypt_);
+#else
+  return true;
+#endif
+}
+
+Status ImageFolderOp::GetRowFilePath(row_id_type row_id, std::string *path) {
+  RETURN_UNEXPECTED_IF_NULL(path);
+  CHECK_FAIL_RETURN_UNEXPECTED(row_id >= 0 && row_id < static_cast<row_id_type>(image_label_pairs_.size()),
+                               "[Internal ERROR] Invalid row id: " + std::to_string(row_id));
+  *path = folder_path_ + image_label_pairs_[row_id]->first;
+  return Status::OK();
+}
+
 void ImageFolderOp::Print(std::ostream &out, bool show_all) const {
   if (!show_all) {
     // Call the super class for displaying any common 1-liner info
@@ -134,6 +134,16 @@ class ImageFolderOp : public MappableLeafOp {
   // @return Status The status code returned
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override;
 
+  // The images are read ahead unless they have to be decrypted
+  // @return true if the images can be read ahead
+  bool SupportsReadAhead() const override;
+
+  // Get the image file of a row
+  // @param row_id_type row_id - id for this tensor row
+  // @param std::string path - the image file
+  // @return Status The status code returned
+  Status GetRowFilePath(row_id_type row_id, std::string *path) override;
+
   /// @param std::string & dir - dir to walk all images
   /// @param int64_t * cnt - number of non folder files under the current dir
   /// @return
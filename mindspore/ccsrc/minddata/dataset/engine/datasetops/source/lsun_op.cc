@@ -137,7 +137,11 @@ Status LSUNOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   std::shared_ptr<Tensor> image, label;
   uint32_t label_num = static_cast<uint32_t>(pair_ptr->second);
   RETURN_IF_NOT_OK(Tensor::CreateScalar(label_num, &label));
-  RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
+  bool read_ahead = false;
+  RETURN_IF_NOT_OK(TakeRowFile(row_id, &image, &read_ahead));
+  if (!read_ahead) {
+    RETURN_IF_NOT_OK(Tensor::CreateFromFile(folder_path_ + (pair_ptr->first), &image));
+  }
 
   if (decode_ == true) {
     Status rc = Decode(image, &image);
@@ -63,19 +63,26 @@ Status MappableLeafOp::operator()() {
   // Synchronize with TaskManager
   TaskManager::FindMe()->Post();
   RETURN_IF_NOT_OK(InitOp());
+  RETURN_IF_NOT_OK(LaunchAsyncReader());
 
   int64_t ep_step = 0, total_step = 0;
   RETURN_IF_NOT_OK(callback_manager_.Begin(CallbackParam(0, ep_step, total_step)));
   TensorRow sample_row;
   RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
   while (true) {  // each iteration is 1 epoch, breaks when IsLastIteration() is true
+    nlohmann::json sampler_state;
+    RETURN_IF_NOT_OK(sampler_->GetState(&sampler_state));
+    if (!sampler_state.is_null()) {
+      RecordRepeatState(op_current_repeats_, {{"sampler", sampler_state}});
+    }
     if (op_current_repeats_ % GetOpNumRepeatsPerEpoch() == 0) {
       ep_step = 0;
       RETURN_IF_NOT_OK(callback_manager_.EpochBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
     }
     while (sample_row.eoe() == false) {
       std::shared_ptr<Tensor> sample_ids = sample_row[0];
-      for (auto itr = sample_ids->begin<int64_t>(); itr != sample_ids->end<int64_t>(); ++itr) {
+      int64_t pos = 0, read_ahead_pos = 0;
+      for (auto itr = sample_ids->begin<int64_t>(); itr != sample_ids->end<int64_t>(); ++itr, ++pos) {
         if ((*itr) >= num_rows_) {
           MS_LOG(WARNING) << "Skipping sample with ID: " << *itr << " since it is out of bound: " << num_rows_;
           continue;  // index out of bound, skipping
@@ -83,6 +90,7 @@ Status MappableLeafOp::operator()() {
         ep_step++;
         total_step++;
         RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
+        RETURN_IF_NOT_OK(ReadAhead(sample_ids, pos, &read_ahead_pos));
         RETURN_IF_NOT_OK(
           worker_in_queues_[NextWorkerID()]->Add(std::make_unique<IOBlock>(*itr, IOBlock::kDeIoBlockNone)));
       }
@@ -102,12 +110,104 @@ Status MappableLeafOp::operator()() {
   for (int32_t i = 0; i < num_workers_; ++i) {
     RETURN_IF_NOT_OK(SendQuitFlagToWorker(NextWorkerID()));
   }
+  if (async_reader_ != nullptr) {
+    // The rows not taken by now are dropped and read by the workers.
+    async_reader_->Stop();
+    auto stats = async_reader_->GetStats();
+    MS_LOG(INFO) << Name() << " read ahead with depth " << read_depth_ << ": " << stats.num_ready << " files ready, "
+                 << stats.num_waited << " waited for, " << stats.num_missed << " read by the workers, peak memory "
+                 << stats.peak_bytes << " bytes.";
+  }
+  return Status::OK();
+}
+
+Status MappableLeafOp::LaunchAsyncReader() {
+  int32_t depth = GlobalContext::config_manager()->async_read_depth();
+  if (depth <= 0 || !SupportsReadAhead()) {
+    return Status::OK();
+  }
+  auto cfg = GlobalContext::config_manager();
+  const int64_t kMBToBytes = 1024 * 1024;
+  auto reader = std::make_shared<AsyncFileReader>(depth, cfg->read_ahead_memory_limit() * kMBToBytes);
+  RETURN_IF_NOT_OK(reader->Register(tree_->AllTasks()));
+  std::atomic_store(&async_reader_, reader);
+  read_ahead_window_ = cfg->read_ahead_window();
+  read_depth_ = depth;
+  return LaunchIoThreads();
+}
+
+Status MappableLeafOp::LaunchIoThreads() {
+  // An IO thread is blocked for the whole of a read, the depth can't be larger than the number of threads.
+  while (num_io_threads_ < read_depth_) {
+    RETURN_IF_NOT_OK(tree_->AllTasks()->CreateAsyncTask(
+      Name() + "::AsyncRead", std::bind(&AsyncFileReader::IoThread, async_reader_.get()), nullptr, id()));
+    ++num_io_threads_;
+  }
   return Status::OK();
 }
 
+Status MappableLeafOp::SetReadDepth(int32_t depth) {
+  CHECK_FAIL_RETURN_UNEXPECTED(depth > 0, "Invalid read depth, it should be larger than 0, but got: " +
+                                            std::to_string(depth));
+  RETURN_OK_IF_TRUE(async_reader_ == nullptr);
+  read_depth_ = depth;
+  async_reader_->SetDepth(depth);
+  return LaunchIoThreads();
+}
+
+Status MappableLeafOp::ReadAhead(const std::shared_ptr<Tensor> &sample_ids, int64_t pos, int64_t *read_ahead_pos) {
+  RETURN_OK_IF_TRUE(async_reader_ == nullptr);
+  // The sampler hands out the ids of a whole epoch at once by default, so the window looks that far ahead.
+  int64_t end_pos = std::min(pos + read_ahead_window_ + 1, sample_ids->Size());
+  for (; *read_ahead_pos < end_pos; ++(*read_ahead_pos)) {
+    int64_t row_id;
+    RETURN_IF_NOT_OK(sample_ids->GetItemAt(&row_id, {*read_ahead_pos}));
+    if (row_id >= num_rows_) {
+      continue;
+    }
+    std::string path;
+    RETURN_IF_NOT_OK(GetRowFilePath(row_id, &path));
+    async_reader_->Submit(row_id, path);
+  }
+  return Status::OK();
+}
+
+bool MappableLeafOp::GetReadAheadStats(AsyncFileReader::Stats *stats) const {
+  auto reader = std::atomic_load(&async_reader_);
+  if (reader == nullptr || stats == nullptr) {
+    return false;
+  }
+  *stats = reader->GetStats();
+  return true;
+}
+
+int32_t MappableLeafOp::MaxReadDepth(int32_t max_depth) const {
+  auto reader = std::atomic_load(&async_reader_);
+  return reader == nullptr ? max_depth : reader->MaxDepthInMemory(max_depth);
+}
+
+Status MappableLeafOp::TakeRowFile(row_id_type row_id, std::shared_ptr<Tensor> *tensor, bool *found) {
+  RETURN_UNEXPECTED_IF_NULL(found);
+  if (async_reader_ == nullptr) {
+    *found = false;
+    return Status::OK();
+  }
+  return async_reader_->Take(row_id, tensor, found);
+}
+
+Status MappableLeafOp::RestoreEpochState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.contains("sampler"), "Invalid state of " + Name() + ".");
+  return sampler_->RestoreState(state["sampler"]);
+}
+
 // Reset Sampler and wakeup Master thread (functor)
 Status MappableLeafOp::Reset() {
   MS_LOG(DEBUG) << Name() << " performing a self-reset.";
+  if (async_reader_ != nullptr) {
+    // The rows of the last epoch which were read ahead and not taken yet are dropped, so that they do not pile up over
+    // the epochs, the workers read the files of the few still in their queues themselves.
+    async_reader_->Reset();
+  }
   RETURN_IF_NOT_OK(sampler_->ResetSampler());
   return Status::OK();
 }
@@ -21,6 +21,7 @@
 #include <queue>
 #include <string>
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <set>
 #include <utility>
@@ -29,6 +30,7 @@
 
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
+#include "minddata/dataset/engine/datasetops/source/async_file_reader.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/kernels/image/image_utils.h"
@@ -68,6 +70,30 @@ class MappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>, p
   /// @return Name of the current Op
   std::string Name() const override { return "MappableLeafPp"; }
 
+  /// Restore the state of the sampler at the start of an epoch
+  /// \param[in] state The state recorded by the op at the start of the epoch
+  /// \return Status The status code returned
+  Status RestoreEpochState(const nlohmann::json &state) override;
+
+  /// Change the number of file reads kept in flight ahead of the workers, more IO threads are launched if needed.
+  /// \param depth - The new read depth, larger than 0
+  /// \return Status The status code returned
+  Status SetReadDepth(int32_t depth);
+
+  /// \return The number of file reads kept in flight ahead of the workers, 0 if the files are not read ahead
+  int32_t ReadDepth() const { return read_depth_; }
+
+  /// The largest read depth whose files, of the mean size read so far, fit in read_ahead_memory_limit, safe to call
+  /// from any thread
+  /// \param max_depth - The largest read depth allowed, returned as is while no file has been read ahead
+  /// \return The read depth, between 1 and max_depth
+  int32_t MaxReadDepth(int32_t max_depth) const;
+
+  /// Get the counters of the files read ahead of the workers, safe to call from any thread
+  /// \param stats - The counters
+  /// \return false if the files are not read ahead
+  bool GetReadAheadStats(AsyncFileReader::Stats *stats) const;
+
 #ifdef ENABLE_PYTHON
   /// \brief Decrypt the encrypted image data as a public function.
   /// \param[in] path - The path of the image that needs to be decrypted.
@@ -103,11 +129,54 @@ class MappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>, p
   /// \return Status The status code returned
   virtual Status LoadTensorRow(row_id_type row_id, TensorRow *row) = 0;
 
+  /// Whether the rows are loaded from one file each, whose path GetRowFilePath gives. The files are then read ahead
+  /// of the workers, in the order of the sampler, when async_read_depth is set in the config.
+  /// \return true if the files of the rows can be read ahead
+  virtual bool SupportsReadAhead() const { return false; }
+
+  /// Virtual function to get the file of the row at location row_id, only called if SupportsReadAhead
+  /// \param row_id_type row_id - id for this tensor row
+  /// \param std::string path - the file of the row
+  /// \return Status The status code returned
+  virtual Status GetRowFilePath(row_id_type row_id, std::string *path) {
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] " + Name() + " does not read its files ahead.");
+  }
+
+  /// Take the content of the file of a row if it was read ahead, to be called from LoadTensorRow
+  /// \param row_id_type row_id - id for this tensor row
+  /// \param std::shared_ptr<Tensor> tensor - the content of the file
+  /// \param bool found - false if the file was not read ahead, it is up to the caller to read it then
+  /// \return Status The status code returned
+  Status TakeRowFile(row_id_type row_id, std::shared_ptr<Tensor> *tensor, bool *found);
+
   /// Reset function to be called after every epoch to reset the source op after
   /// \return Status The status code returned
   Status Reset() override;
   Status SendWaitFlagToWorker(int32_t worker_id) override;
   Status SendQuitFlagToWorker(int32_t worker_id) override;
+
+ private:
+  /// Create the reader of the files of the rows and launch its IO threads, if enabled
+  /// \return Status The status code returned
+  Status LaunchAsyncReader();
+
+  /// Launch IO threads until there are as many as the read depth
+  /// \return Status The status code returned
+  Status LaunchIoThreads();
+
+  /// Queue the reads of the files of the row at position pos of the sample ids and of the rows of the read ahead
+  /// window past it, to be called before the row is sent to a worker
+  /// \param std::shared_ptr<Tensor> sample_ids - the sample ids the row is taken from
+  /// \param int64_t pos - the position of the row in the sample ids
+  /// \param int64_t read_ahead_pos - the position of the first row whose file is not queued yet, updated
+  /// \return Status The status code returned
+  Status ReadAhead(const std::shared_ptr<Tensor> &sample_ids, int64_t pos, int64_t *read_ahead_pos);
+
+  // Shared with the profiling thread, which reads its stats
+  std::shared_ptr<AsyncFileReader> async_reader_;
+  int64_t read_ahead_window_{0};
+  std::atomic<int32_t> read_depth_{0};  // Read by AutoTune, from its own thread
+  int32_t num_io_threads_{0};
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <set>
 #include <utility>
 
 #include "utils/ms_utils.h"
@@ -27,6 +29,7 @@
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/memory_pool.h"
 
 namespace mindspore {
 namespace dataset {
@@ -37,6 +40,47 @@ using mindrecord::Schema;
 using mindrecord::ShardOperator;
 using mindrecord::ShardReader;
 
+namespace {
+// Memory pool for the tensors referring to a memory mapped mindrecord file. It holds the mapping alive as long as
+// any tensor refers to it. Memory which is reallocated by the tensor itself comes from the system.
+class MappedFilePool : public MemoryPool {
+ public:
+  explicit MappedFilePool(std::shared_ptr<mindrecord::ShardMappedFile> file) : file_(std::move(file)) {}
+
+  ~MappedFilePool() override = default;
+
+  Status Allocate(size_t n, void **pp) override { return DeMalloc(n, pp, false); }
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override {
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] Reallocate is not supported for memory mapped tensor.");
+  }
+
+  void Deallocate(void *p) override {
+    if (p != nullptr && !file_->Contains(p)) {
+      free(p);
+    }
+  }
+
+  uint64_t get_max_size() const override { return std::numeric_limits<uint64_t>::max(); }
+
+  int PercentFree() const override { return 100; }
+
+ private:
+  std::shared_ptr<mindrecord::ShardMappedFile> file_;
+};
+
+// Create a tensor which refers to the data through the view pool if it is given, otherwise copy the data
+Status CreateTensor(const TensorShape &shape, const DataType &type, const unsigned char *data,
+                    const std::shared_ptr<MemoryPool> &view_pool, std::shared_ptr<Tensor> *tensor) {
+  if (view_pool == nullptr) {
+    return Tensor::CreateFromMemory(shape, type, data, tensor);
+  }
+  // the mapping is read-only, the caller guarantees that no op downstream modifies the tensor in place
+  auto length = static_cast<dsize_t>(shape.NumOfElements() * type.SizeInBytes());
+  return Tensor::CreateFromMemoryView(shape, type, const_cast<unsigned char *>(data), length, view_pool, tensor);
+}
+}  // namespace
+
 // Constructor of the MindRecordOp.
 MindRecordOp::MindRecordOp(int32_t num_mind_record_workers, std::vector<std::string> dataset_file, bool load_dataset,
                            int32_t op_connector_queue_size, const std::vector<std::string> &columns_to_load,
@@ -55,13 +99,15 @@ MindRecordOp::MindRecordOp(int32_t num_mind_record_workers, std::vector<std::str
       sample_json_(sample_json),
       sample_bytes_(sample_bytes),
       shuffle_mode_(shuffle_mode),
-      shard_reader_(std::move(shard_reader)) {
+      shard_reader_(std::move(shard_reader)),
+      use_mapped_view_(false) {
   epoch_sync_flag_ = true;  // MindRecordOp needs to turn this flag on, otherwise, calling ShuffleTask() before all
                             // tasks are consumed by the worker threads would cause problem.
 }
 
 // Private helper method to encapsulate some common construction/reset tasks
 Status MindRecordOp::Init() {
+  shard_reader_->SetMmapMode(GlobalContext::config_manager()->enable_mmap_read());
   RETURN_IF_NOT_OK(shard_reader_->Open(dataset_file_, load_dataset_, num_mind_record_workers_, columns_to_load_,
                                        operators_, num_padded_));
 
@@ -182,6 +228,22 @@ Status MindRecordOp::WorkerEntry(int32_t worker_id) {
 
 Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, int32_t worker_id) {
   *fetched_row = {};
+  if (shard_reader_->IsMmapEnabled()) {
+    std::shared_ptr<mindrecord::MAPPED_TASK_CONTENT> task_content;
+    RETURN_IF_NOT_OK(shard_reader_->GetNextMappedById(row_id, &task_content));
+    if (task_content->first == mindrecord::TaskType::kPaddedTask) {
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, {}, mindrecord::json(), task_content->first));
+    }
+    for (const auto &tupled_row : task_content->second) {
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, std::get<0>(tupled_row), std::get<1>(tupled_row)));
+    }
+    if (task_content->first == mindrecord::TaskType::kPaddedTask || !task_content->second.empty()) {
+      std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
+      fetched_row->setPath(file_path);
+      fetched_row->setId(row_id);
+    }
+    return Status::OK();
+  }
   auto rc = shard_reader_->GetNextById(row_id, worker_id);
   auto task_type = rc.first;
   auto tupled_buffer = rc.second;
@@ -210,6 +272,23 @@ Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, i
 
 Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
                                    const mindrecord::json &columns_json, const mindrecord::TaskType task_type) {
+  return LoadTensorRow(tensor_row, columns_blob.data(), columns_blob.size(), columns_json, task_type, nullptr);
+}
+
+Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const mindrecord::ShardBlobSlice &columns_blob,
+                                   const mindrecord::json &columns_json) {
+  // one pool for the whole row, it keeps the mapped file alive until the last tensor of the row is released
+  std::shared_ptr<MemoryPool> view_pool = nullptr;
+  if (use_mapped_view_) {
+    view_pool = std::make_shared<MappedFilePool>(columns_blob.file);
+  }
+  return LoadTensorRow(tensor_row, columns_blob.data, columns_blob.size, columns_json,
+                       mindrecord::TaskType::kCommonTask, view_pool);
+}
+
+Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const uint8_t *columns_blob, uint64_t blob_size,
+                                   const mindrecord::json &columns_json, const mindrecord::TaskType task_type,
+                                   const std::shared_ptr<MemoryPool> &view_pool) {
   for (int32_t i_col = 0; i_col < columns_to_load_.size(); i_col++) {
     auto column_name = columns_to_load_[i_col];
 
@@ -245,9 +324,9 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
         data = reinterpret_cast<const unsigned char *>(data_ptr.get());
       }
     } else {
-      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, columns_json, &data, &data_ptr,
-                                                          &n_bytes, &column_data_type, &column_data_type_size,
-                                                          &column_shape));
+      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, blob_size, columns_json, &data,
+                                                          &data_ptr, &n_bytes, &column_data_type,
+                                                          &column_data_type_size, &column_shape));
     }
 
     std::shared_ptr<Tensor> tensor;
@@ -258,6 +337,10 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
     CHECK_FAIL_RETURN_UNEXPECTED(column_data_type_size != 0,
                                  "[Internal ERROR] Found memory size of column data type is 0.");
     auto num_elements = n_bytes / column_data_type_size;
+    // Data which points into the mapped blob (neither from json nor uncompressed) can be used in place, as long as it
+    // is aligned for its type
+    bool use_view = view_pool != nullptr && data_ptr == nullptr && data != nullptr && n_bytes > 0 &&
+                    type.IsNumeric() && reinterpret_cast<uintptr_t>(data) % type.SizeInBytes() == 0;
     if (type == DataType::DE_STRING) {
       std::string s{data, data + n_bytes};
       RETURN_IF_NOT_OK(Tensor::CreateScalar(s, &tensor));
@@ -269,11 +352,11 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
       } else {
         RETURN_IF_NOT_OK(column.MaterializeTensorShape(static_cast<int32_t>(num_elements), &new_shape));
       }
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, type, data, &tensor));
+      RETURN_IF_NOT_OK(CreateTensor(new_shape, type, data, use_view ? view_pool : nullptr, &tensor));
     } else {
       std::vector<dsize_t> shapeDetails = {static_cast<dsize_t>(num_elements)};
       auto new_shape = TensorShape(shapeDetails);
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(new_shape, type, data, &tensor));
+      RETURN_IF_NOT_OK(CreateTensor(new_shape, type, data, use_view ? view_pool : nullptr, &tensor));
     }
     tensor_row->push_back(std::move(tensor));
   }
@@ -295,7 +378,33 @@ Status MindRecordOp::PrepareData() {
   return Status::OK();
 }
 
+bool MindRecordOp::RowsCopiedDownstream(const DatasetOp *op) {
+  // ops which pass the tensors through without touching their data
+  static const std::set<std::string> pass_through_ops = {kConcatOp, kEpochCtrlOp, kProjectOp, kRenameOp, kRepeatOp,
+                                                         kShuffleOp, kSkipOp,     kTakeOp,    kZipOp};
+  auto parents = op->parents();
+  if (parents.empty()) {
+    // the rows reach the consumer as they are
+    return false;
+  }
+  for (auto *parent : parents) {
+    if (parent->Name() == kBatchOp) {
+      // a batch of one row reuses the tensor of the row, a batch size function may also decide to do so
+      if (parent->IsPython() || parent->GetTreeBatchSize() <= 1) {
+        return false;
+      }
+    } else if (pass_through_ops.count(parent->Name()) == 0 || !RowsCopiedDownstream(parent)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Status MindRecordOp::RegisterAndLaunchThreads() {
+  // the mapping is read-only, so refer to it only if no op can modify the tensors in place
+  use_mapped_view_ = RowsCopiedDownstream(this);
+  MS_LOG(INFO) << "MindRecordOp refers to the memory mapped file without copy: " << std::boolalpha
+               << use_mapped_view_;
   RETURN_IF_NOT_OK(ParallelOp::RegisterAndLaunchThreads());
   RETURN_IF_NOT_OK(shard_reader_->Launch(true));
   return Status::OK();
@@ -127,6 +127,29 @@ class MindRecordOp : public MappableLeafOp {
   Status LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
                        const mindrecord::json &columns_json, const mindrecord::TaskType task_type);
 
+  /// Parses a single cell and puts the data into a tensor, blob columns refer to the memory mapped file if possible
+  /// @param tensor_row - the tensor row to put the parsed data in
+  /// @param columns_blob - the blob data slice received from the reader
+  /// @param columns_json - the data for fields received from the reader
+  Status LoadTensorRow(TensorRow *tensor_row, const mindrecord::ShardBlobSlice &columns_blob,
+                       const mindrecord::json &columns_json);
+
+  /// Parses a single cell and puts the data into a tensor
+  /// @param tensor_row - the tensor row to put the parsed data in
+  /// @param columns_blob - the start address of the blob data
+  /// @param blob_size - the size of the blob data
+  /// @param columns_json - the data for fields received from the reader
+  /// @param view_pool - if not null, blob columns are not copied, the tensors refer to the blob through this pool
+  Status LoadTensorRow(TensorRow *tensor_row, const uint8_t *columns_blob, uint64_t blob_size,
+                       const mindrecord::json &columns_json, const mindrecord::TaskType task_type,
+                       const std::shared_ptr<MemoryPool> &view_pool);
+
+  /// Check whether the rows of the given op are copied into new tensors on every path to the root before any op
+  /// could modify them in place. Only then the tensors may refer to the read-only memory mapped file.
+  /// @param op - the op whose output rows are checked
+  /// @return bool true if the rows never reach an op which could modify them
+  static bool RowsCopiedDownstream(const DatasetOp *op);
+
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override {
     return Status(StatusCode::kMDSyntaxError, "[Internal ERROR] Cannot call this method.");
   }
@@ -172,6 +195,7 @@ class MindRecordOp : public MappableLeafOp {
   std::mutex ended_worker_mutex_;
 
   ShuffleMode shuffle_mode_;
+  bool use_mapped_view_;  // blob columns refer to the memory mapped file instead of being copied
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -38,6 +38,9 @@ NonMappableLeafOp::NonMappableLeafOp(int32_t num_workers, int32_t worker_connect
       total_rows_(total_num_rows),
       load_io_block_queue_(true),
       shuffle_files_(shuffle_files),
+      shuffle_seed_(0),
+      skip_rows_(0),
+      rows_to_drop_(0),
       num_rows_per_shard_(0),
       num_rows_(0) {
   worker_connector_size_ = worker_connector_size;
@@ -66,7 +69,8 @@ Status NonMappableLeafOp::operator()() {
   NotifyToFillIOBlockQueue();
   while (!finished_reading_dataset_) {
     int32_t workers_done = 0;
-    int64_t rows_read = 0;
+    // The rows skipped in the first epoch count against the rows to read, like for a skip op above.
+    int64_t rows_read = op_current_repeats_ == 0 ? skip_rows_ : 0;
     {
       std::unique_lock<std::mutex> lock(load_io_block_queue_mutex_);
       load_io_block_queue_ = true;
@@ -77,6 +81,8 @@ Status NonMappableLeafOp::operator()() {
       RETURN_IF_NOT_OK(jagged_rows_connector_->Pop(0, &fetched_row));
       if (fetched_row.eoe()) {
         workers_done++;
+      } else if (rows_to_drop_ > 0) {
+        rows_to_drop_--;
       } else if (total_rows_ == 0 || rows_read < total_rows_) {
         // we need to push a row
         RETURN_IF_NOT_OK(out_connector_->Add(std::move(fetched_row)));
@@ -104,6 +110,7 @@ Status NonMappableLeafOp::operator()() {
       }
     }
 
+    rows_to_drop_ = 0;
     // all workers finished reading for this epoch, and we have read all the data from all workers
     RETURN_IF_NOT_OK(out_connector_->SendEOE());
 
@@ -244,6 +251,17 @@ bool NonMappableLeafOp::NeedPushFileToBlockQueue(const std::string &file_name, i
   return push;
 }
 
+Status NonMappableLeafOp::RestoreEpochState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.contains("seed") && state["seed"].is_number_unsigned() &&
+                                 state.contains("shuffle_seed") && state["shuffle_seed"].is_number_unsigned() &&
+                                 state.contains("keys") && state["keys"].is_array(),
+                               "Invalid state of " + Name() + ".");
+  CHECK_FAIL_RETURN_UNEXPECTED(shuffle_files_ && state["keys"].size() == filename_index_->size(),
+                               "Invalid state of " + Name() + ", it does not match the files of the dataset.");
+  restored_state_ = state;
+  return Status::OK();
+}
+
 void NonMappableLeafOp::ShuffleKeys(std::vector<int64_t> *i_keys, uint32_t seed) {
   std::mt19937 rng(seed);
   std::shuffle(i_keys->begin(), i_keys->end(), rng);
@@ -260,6 +278,7 @@ Status NonMappableLeafOp::WaitToFillIOBlockQueue() {
     }
   }
   uint32_t seed = 0;
+  int32_t num_repeats = 0;
   while (true) {
     RETURN_IF_NOT_OK(io_block_queue_wait_post_.Wait());
     io_block_queue_wait_post_.Clear();
@@ -269,8 +288,19 @@ Status NonMappableLeafOp::WaitToFillIOBlockQueue() {
     }
 
     if (shuffle_files_) {
-      ShuffleKeys(&i_keys, num_devices_ == 1 ? GetSeed() : ++seed);
+      // The keys are shuffled again every epoch, so the state is the keys before the shuffle and the seed of it.
+      if (!restored_state_.is_null()) {
+        seed = restored_state_["seed"].get<uint32_t>();
+        shuffle_seed_ = restored_state_["shuffle_seed"].get<uint32_t>();
+        i_keys = restored_state_["keys"].get<std::vector<int64_t>>();
+        restored_state_ = nullptr;
+      } else {
+        shuffle_seed_ = num_devices_ == 1 ? GetSeed() : ++seed;
+      }
+      RecordRepeatState(num_repeats, {{"seed", seed}, {"shuffle_seed", shuffle_seed_}, {"keys", i_keys}});
+      ShuffleKeys(&i_keys, shuffle_seed_);
     }
+    num_repeats++;
     RETURN_IF_NOT_OK(FillIOBlockQueue(i_keys));
   }
   return Status::OK();
@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_NONMAPPABLE_LEAF_OP_H_
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -80,6 +81,11 @@ class NonMappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>
   // @return Name of the current Op
   std::string Name() const override { return "NonMappableLeafOp"; }
 
+  // Restore the order of the files at the start of an epoch, it is used by the first epoch read.
+  // @param state - the state recorded by the op at the start of the epoch.
+  // @return Status - the error code returned.
+  Status RestoreEpochState(const nlohmann::json &state) override;
+
  protected:
   // The entry point for when workers are launched.
   // @param worker_id - the id of the worker that is executing this function.
@@ -158,6 +164,10 @@ class NonMappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>
   std::mutex load_io_block_queue_mutex_;
   std::unique_ptr<JaggedConnector> jagged_rows_connector_;
   bool shuffle_files_;
+  uint32_t shuffle_seed_;              // Seed the files of the current epoch are shuffled with
+  nlohmann::json restored_state_;      // State of the files order to start from, null if not restored
+  int64_t skip_rows_;                  // Rows of the first epoch skipped by the op itself
+  std::atomic<int64_t> rows_to_drop_;  // Rows of the first epoch left for the master thread to drop
   int64_t num_rows_per_shard_;
   int64_t num_rows_;
 };
@@ -58,7 +58,11 @@ Status DistributedSamplerRT::InitSampler() {
     device_id_ < num_devices_ && device_id_ >= 0 && num_rows_ > 0 && num_samples_ > 0,
     "Invalid parameter, num_shard must be greater than shard_id and greater than 0, got num_shard: " +
       std::to_string(num_devices_) + ", shard_id: " + std::to_string(device_id_) + ".\n");
-  rnd_.seed(seed_++);
+  // A restored sampler has the ids and the seed of the next epoch already.
+  bool restored = !shuffle_vec_.empty();
+  if (!restored) {
+    rnd_.seed(seed_++);
+  }
 
   if (offset_ != -1 || !even_dist_) {
     if (offset_ == -1) {
@@ -77,13 +81,17 @@ Status DistributedSamplerRT::InitSampler() {
     samples_per_tensor_ = (num_rows_ + num_devices_ - 1) / num_devices_;  // equals to ceil(num_rows/num_devices)
   }
   samples_per_tensor_ = num_samples_ < samples_per_tensor_ ? num_samples_ : samples_per_tensor_;
-  if (shuffle_) {
+  if (shuffle_ && !restored) {
     shuffle_vec_.reserve(num_rows_);
     for (int64_t i = 0; i < num_rows_; i++) {
       shuffle_vec_.push_back(i);
     }
     std::shuffle(shuffle_vec_.begin(), shuffle_vec_.end(), rnd_);
   }
+  CHECK_FAIL_RETURN_UNEXPECTED(!shuffle_ || shuffle_vec_.size() == static_cast<size_t>(num_rows_),
+                               "The state of DistributedSampler does not match the dataset, it has " +
+                                 std::to_string(shuffle_vec_.size()) + " ids but the dataset has " +
+                                 std::to_string(num_rows_) + " rows.");
   if (!samples_per_tensor_) {
     non_empty_ = false;
   }
@@ -174,6 +182,26 @@ Status DistributedSamplerRT::ResetSampler() {
   return Status::OK();
 }
 
+// The ids are shuffled again from the order of the last epoch, so they are kept as they are.
+Status DistributedSamplerRT::GetState(nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  *state = nullptr;
+  if (shuffle_) {
+    *state = {{"seed", seed_}, {"ids", shuffle_vec_}};
+  }
+  return Status::OK();
+}
+
+Status DistributedSamplerRT::RestoreState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!is_initialized, "[Internal ERROR] DistributedSampler state restored after its init.");
+  CHECK_FAIL_RETURN_UNEXPECTED(shuffle_ && state.contains("seed") && state["seed"].is_number_unsigned() &&
+                                 state.contains("ids") && state["ids"].is_array(),
+                               "Invalid state of DistributedSampler.");
+  seed_ = state["seed"].get<uint32_t>();
+  shuffle_vec_ = state["ids"].get<std::vector<int64_t>>();
+  return Status::OK();
+}
+
 int64_t DistributedSamplerRT::CalculateNumSamples(int64_t num_rows) {
   int64_t child_num_rows = num_rows;
   if (!child_.empty()) {
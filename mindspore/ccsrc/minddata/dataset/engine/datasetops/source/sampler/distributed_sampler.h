@@ -77,6 +77,16 @@ class DistributedSamplerRT : public SamplerRT {
   /// \return Status of the function
   Status to_json(nlohmann::json *out_json) override;
 
+  /// \brief Get the ids of the current epoch and the seed of the next one
+  /// \param[out] state The state, null if the ids are not shuffled
+  /// \return Status of the function
+  Status GetState(nlohmann::json *state) override;
+
+  /// \brief Restore a state returned by GetState, before the sampler is initialized
+  /// \param[in] state The state
+  /// \return Status of the function
+  Status RestoreState(const nlohmann::json &state) override;
+
  private:
   int64_t cnt_;  // number of samples that have already been filled in to Tensor
   uint32_t seed_;
@@ -88,11 +88,18 @@ Status RandomSamplerRT::InitSampler() {
   rnd_.seed(seed_);
 
   if (!replacement_) {
-    shuffled_ids_.reserve(num_rows_);
-    for (int64_t i = 0; i < num_rows_; i++) {
-      shuffled_ids_.push_back(i);
+    // A restored sampler has the ids of the epoch it resumes from already.
+    if (shuffled_ids_.empty()) {
+      shuffled_ids_.reserve(num_rows_);
+      for (int64_t i = 0; i < num_rows_; i++) {
+        shuffled_ids_.push_back(i);
+      }
+      std::shuffle(shuffled_ids_.begin(), shuffled_ids_.end(), rnd_);
     }
-    std::shuffle(shuffled_ids_.begin(), shuffled_ids_.end(), rnd_);
+    CHECK_FAIL_RETURN_UNEXPECTED(shuffled_ids_.size() == static_cast<size_t>(num_rows_),
+                                 "The state of RandomSampler does not match the dataset, it has " +
+                                   std::to_string(shuffled_ids_.size()) + " ids but the dataset has " +
+                                   std::to_string(num_rows_) + " rows.");
   } else {
     dist = std::make_unique<std::uniform_int_distribution<int64_t>>(0, num_rows_ - 1);
   }
@@ -122,6 +129,29 @@ Status RandomSamplerRT::ResetSampler() {
   return Status::OK();
 }
 
+// The generator is seeded again every epoch, which draws the ids with replacement. Without replacement, the ids are
+// shuffled again from the order of the last epoch, so they are kept as they are.
+Status RandomSamplerRT::GetState(nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  *state = {{"seed", seed_}};
+  if (!replacement_) {
+    (*state)["ids"] = shuffled_ids_;
+  }
+  return Status::OK();
+}
+
+Status RandomSamplerRT::RestoreState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!is_initialized, "[Internal ERROR] RandomSampler state restored after its init.");
+  CHECK_FAIL_RETURN_UNEXPECTED(state.contains("seed") && state["seed"].is_number_unsigned() &&
+                                 (replacement_ || (state.contains("ids") && state["ids"].is_array())),
+                               "Invalid state of RandomSampler.");
+  seed_ = state["seed"].get<uint32_t>();
+  if (!replacement_) {
+    shuffled_ids_ = state["ids"].get<std::vector<int64_t>>();
+  }
+  return Status::OK();
+}
+
 void RandomSamplerRT::SamplerPrint(std::ostream &out, bool show_all) const {
   out << "\nSampler: RandomSampler";
   if (show_all) {
@@ -57,6 +57,16 @@ class RandomSamplerRT : public SamplerRT {
   /// \return Status of the function
   Status to_json(nlohmann::json *out_json) override;
 
+  /// \brief Get the seed of the current epoch, and the ids of the epoch when sampling without replacement
+  /// \param[out] state The state
+  /// \return Status of the function
+  Status GetState(nlohmann::json *state) override;
+
+  /// \brief Restore a state returned by GetState, before the sampler is initialized
+  /// \param[in] state The state
+  /// \return Status of the function
+  Status RestoreState(const nlohmann::json &state) override;
+
  private:
   uint32_t seed_;
   bool replacement_;
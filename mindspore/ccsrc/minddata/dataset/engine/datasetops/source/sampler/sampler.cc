@@ -207,5 +207,21 @@ Status SamplerRT::to_json(nlohmann::json *out_json) {
   return Status::OK();
 }
 
+Status SamplerRT::GetState(nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  if (HasChildSampler()) {
+    return child_[0]->GetState(state);
+  }
+  *state = nullptr;
+  return Status::OK();
+}
+
+Status SamplerRT::RestoreState(const nlohmann::json &state) {
+  if (HasChildSampler()) {
+    return child_[0]->RestoreState(state);
+  }
+  return Status::OK();
+}
+
 }  // namespace dataset
 }  // namespace mindspore
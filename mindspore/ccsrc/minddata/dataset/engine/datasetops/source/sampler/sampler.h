@@ -158,6 +158,16 @@ class SamplerRT {
   /// \return Status of the function
   virtual Status to_json(nlohmann::json *out_json);
 
+  /// \brief Get the state the sampler needs to replay its current epoch, the default one is the state of its child
+  /// \param[out] state The state, null if the sampler keeps no state across epochs
+  /// \return Status of the function
+  virtual Status GetState(nlohmann::json *state);
+
+  /// \brief Restore a state returned by GetState, before the sampler is initialized
+  /// \param[in] state The state
+  /// \return Status of the function
+  virtual Status RestoreState(const nlohmann::json &state);
+
  protected:
   // Number of rows of data from the place this sampler is sampling from. If this sampler
   // has a child sampler, num_rows_ is the number of ids the child sampler will
@@ -0,0 +1,444 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Field numbers of example.proto and feature.proto
+constexpr uint32_t kExampleFeaturesField = 1;
+constexpr uint32_t kFeaturesMapField = 1;
+constexpr uint32_t kMapKeyField = 1;
+constexpr uint32_t kMapValueField = 2;
+constexpr uint32_t kListValueField = 1;
+
+constexpr uint32_t kWireVarint = 0;
+constexpr uint32_t kWireFixed64 = 1;
+constexpr uint32_t kWireLengthDelimited = 2;
+constexpr uint32_t kWireFixed32 = 5;
+constexpr uint32_t kTagTypeBits = 3;
+constexpr uint32_t kTagTypeMask = 7;
+constexpr uint32_t kVarintPayloadBits = 7;
+constexpr uint8_t kVarintPayloadMask = 0x7F;
+constexpr uint8_t kVarintMoreBit = 0x80;
+constexpr int kMaxVarintBytes = 10;
+constexpr size_t kFixed32Size = 4;
+constexpr size_t kFixed64Size = 8;
+constexpr uint32_t kBitsOfByte = 8;
+
+// A cursor over a serialized message
+class WireReader {
+ public:
+  WireReader(const uint8_t *data, size_t size) : pos_(data), end_(data + size) {}
+
+  bool Done() const { return pos_ >= end_; }
+
+  bool ReadVarint(uint64_t *value) {
+    uint64_t result = 0;
+    for (int i = 0; i < kMaxVarintBytes && pos_ < end_; ++i) {
+      uint8_t byte = *pos_++;
+      result |= static_cast<uint64_t>(byte & kVarintPayloadMask) << (kVarintPayloadBits * i);
+      if ((byte & kVarintMoreBit) == 0) {
+        *value = result;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadTag(uint32_t *field, uint32_t *wire_type) {
+    uint64_t tag = 0;
+    if (!ReadVarint(&tag) || tag > UINT32_MAX) {
+      return false;
+    }
+    *field = static_cast<uint32_t>(tag >> kTagTypeBits);
+    *wire_type = static_cast<uint32_t>(tag & kTagTypeMask);
+    return *field != 0;
+  }
+
+  bool ReadLengthDelimited(const uint8_t **data, size_t *size) {
+    uint64_t length = 0;
+    if (!ReadVarint(&length) || length > static_cast<uint64_t>(end_ - pos_)) {
+      return false;
+    }
+    *data = pos_;
+    *size = static_cast<size_t>(length);
+    pos_ += length;
+    return true;
+  }
+
+  // Protobuf stores fixed size values in little endian, whatever the host is
+  bool ReadFixed32(uint32_t *value) {
+    if (static_cast<size_t>(end_ - pos_) < kFixed32Size) {
+      return false;
+    }
+    uint32_t result = 0;
+    for (size_t i = 0; i < kFixed32Size; ++i) {
+      result |= static_cast<uint32_t>(pos_[i]) << (kBitsOfByte * i);
+    }
+    pos_ += kFixed32Size;
+    *value = result;
+    return true;
+  }
+
+  // Skip the value of a field the decoder doesn't care about
+  bool Skip(uint32_t wire_type) {
+    uint64_t varint = 0;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    switch (wire_type) {
+      case kWireVarint:
+        return ReadVarint(&varint);
+      case kWireFixed64:
+        if (static_cast<size_t>(end_ - pos_) < kFixed64Size) {
+          return false;
+        }
+        pos_ += kFixed64Size;
+        return true;
+      case kWireLengthDelimited:
+        return ReadLengthDelimited(&data, &size);
+      case kWireFixed32:
+        if (static_cast<size_t>(end_ - pos_) < kFixed32Size) {
+          return false;
+        }
+        pos_ += kFixed32Size;
+        return true;
+      default:
+        // Groups are not used by the Example protos.
+        return false;
+    }
+  }
+
+ private:
+  const uint8_t *pos_;
+  const uint8_t *end_;
+};
+
+float FloatFromBits(uint32_t bits) {
+  float value = 0;
+  (void)memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Call fn with every value of a list, the list must have been validated by CountValues
+template <typename Fn>
+void ForEachFloat(const TFExampleDecoder::Feature &feature, Fn fn) {
+  WireReader reader(feature.data, feature.size);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done() && reader.ReadTag(&field, &wire_type)) {
+    if (field == kListValueField && wire_type == kWireFixed32) {
+      uint32_t bits = 0;
+      (void)reader.ReadFixed32(&bits);
+      if (!fn(FloatFromBits(bits))) {
+        return;
+      }
+    } else if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      (void)reader.ReadLengthDelimited(&data, &size);
+      WireReader packed(data, size);
+      uint32_t bits = 0;
+      while (!packed.Done() && packed.ReadFixed32(&bits)) {
+        if (!fn(FloatFromBits(bits))) {
+          return;
+        }
+      }
+    } else {
+      (void)reader.Skip(wire_type);
+    }
+  }
+}
+
+template <typename Fn>
+void ForEachInt64(const TFExampleDecoder::Feature &feature, Fn fn) {
+  WireReader reader(feature.data, feature.size);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done() && reader.ReadTag(&field, &wire_type)) {
+    uint64_t value = 0;
+    if (field == kListValueField && wire_type == kWireVarint) {
+      (void)reader.ReadVarint(&value);
+      if (!fn(static_cast<int64_t>(value))) {
+        return;
+      }
+    } else if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      (void)reader.ReadLengthDelimited(&data, &size);
+      WireReader packed(data, size);
+      while (!packed.Done() && packed.ReadVarint(&value)) {
+        if (!fn(static_cast<int64_t>(value))) {
+          return;
+        }
+      }
+    } else {
+      (void)reader.Skip(wire_type);
+    }
+  }
+}
+
+template <typename Fn>
+void ForEachBytes(const TFExampleDecoder::Feature &feature, Fn fn) {
+  WireReader reader(feature.data, feature.size);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done() && reader.ReadTag(&field, &wire_type)) {
+    if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      (void)reader.ReadLengthDelimited(&data, &size);
+      if (!fn(data, size)) {
+        return;
+      }
+    } else {
+      (void)reader.Skip(wire_type);
+    }
+  }
+}
+}  // namespace
+
+TFExampleDecoder::TFExampleDecoder(std::vector<std::string> column_names) : column_names_(std::move(column_names)) {}
+
+bool TFExampleDecoder::FindFeatures(const uint8_t *data, size_t size, std::vector<Feature> *features) const {
+  features->assign(column_names_.size(), Feature());
+  WireReader example(data, size);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!example.Done()) {
+    if (!example.ReadTag(&field, &wire_type)) {
+      return false;
+    }
+    if (field != kExampleFeaturesField) {
+      if (!example.Skip(wire_type)) {
+        return false;
+      }
+      continue;
+    }
+    const uint8_t *features_data = nullptr;
+    size_t features_size = 0;
+    if (wire_type != kWireLengthDelimited || !example.ReadLengthDelimited(&features_data, &features_size)) {
+      return false;
+    }
+    // A message given twice is merged by protobuf, so later map entries replace the earlier ones either way.
+    WireReader feature_map(features_data, features_size);
+    while (!feature_map.Done()) {
+      if (!feature_map.ReadTag(&field, &wire_type)) {
+        return false;
+      }
+      if (field != kFeaturesMapField) {
+        if (!feature_map.Skip(wire_type)) {
+          return false;
+        }
+        continue;
+      }
+      const uint8_t *entry_data = nullptr;
+      size_t entry_size = 0;
+      if (wire_type != kWireLengthDelimited || !feature_map.ReadLengthDelimited(&entry_data, &entry_size) ||
+          !ParseMapEntry(entry_data, entry_size, features)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TFExampleDecoder::ParseMapEntry(const uint8_t *data, size_t size, std::vector<Feature> *features) const {
+  WireReader entry(data, size);
+  const uint8_t *key = nullptr;
+  size_t key_size = 0;
+  const uint8_t *value = nullptr;
+  size_t value_size = 0;
+  bool has_key = false;
+  bool has_value = false;
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!entry.Done()) {
+    if (!entry.ReadTag(&field, &wire_type)) {
+      return false;
+    }
+    if (field == kMapKeyField || field == kMapValueField) {
+      bool &seen = field == kMapKeyField ? has_key : has_value;
+      // Protobuf merges a value given twice, leave that to it.
+      if (seen || wire_type != kWireLengthDelimited) {
+        return false;
+      }
+      seen = true;
+      bool ok = field == kMapKeyField ? entry.ReadLengthDelimited(&key, &key_size)
+                                      : entry.ReadLengthDelimited(&value, &value_size);
+      if (!ok) {
+        return false;
+      }
+    } else if (!entry.Skip(wire_type)) {
+      return false;
+    }
+  }
+
+  auto it = std::find_if(column_names_.begin(), column_names_.end(), [key, key_size](const std::string &name) {
+    return name.size() == key_size && (key_size == 0 || memcmp(name.data(), key, key_size) == 0);
+  });
+  if (it == column_names_.end()) {
+    return true;
+  }
+  Feature feature;
+  feature.found = true;
+  WireReader kinds(value, value_size);
+  int num_kinds = 0;
+  while (!kinds.Done()) {
+    if (!kinds.ReadTag(&field, &wire_type)) {
+      return false;
+    }
+    if (field >= static_cast<uint32_t>(Kind::kBytesList) && field <= static_cast<uint32_t>(Kind::kInt64List)) {
+      // One list only, protobuf would merge or replace the others.
+      if (++num_kinds > 1 || wire_type != kWireLengthDelimited ||
+          !kinds.ReadLengthDelimited(&feature.data, &feature.size)) {
+        return false;
+      }
+      feature.kind = static_cast<Kind>(field);
+    } else if (!kinds.Skip(wire_type)) {
+      return false;
+    }
+  }
+  (*features)[it - column_names_.begin()] = feature;
+  return true;
+}
+
+bool TFExampleDecoder::CountValues(const Feature &feature, int64_t *num_values, uint64_t *max_size) {
+  *num_values = 0;
+  *max_size = 0;
+  WireReader reader(feature.data, feature.size);
+  uint32_t field = 0;
+  uint32_t wire_type = 0;
+  while (!reader.Done()) {
+    if (!reader.ReadTag(&field, &wire_type)) {
+      return false;
+    }
+    if (field != kListValueField) {
+      if (!reader.Skip(wire_type)) {
+        return false;
+      }
+      continue;
+    }
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    if (feature.kind == Kind::kBytesList) {
+      if (wire_type != kWireLengthDelimited || !reader.ReadLengthDelimited(&data, &size)) {
+        return false;
+      }
+      ++(*num_values);
+      *max_size = std::max(*max_size, static_cast<uint64_t>(size));
+    } else if (feature.kind == Kind::kFloatList && wire_type == kWireFixed32) {
+      if (!reader.Skip(wire_type)) {
+        return false;
+      }
+      ++(*num_values);
+    } else if (feature.kind == Kind::kInt64List && wire_type == kWireVarint) {
+      if (!reader.Skip(wire_type)) {
+        return false;
+      }
+      ++(*num_values);
+    } else if (wire_type == kWireLengthDelimited) {
+      // Packed values
+      if (!reader.ReadLengthDelimited(&data, &size)) {
+        return false;
+      }
+      if (feature.kind == Kind::kFloatList) {
+        if (size % kFixed32Size != 0) {
+          return false;
+        }
+        *num_values += static_cast<int64_t>(size / kFixed32Size);
+      } else {
+        WireReader packed(data, size);
+        uint64_t value = 0;
+        while (!packed.Done()) {
+          if (!packed.ReadVarint(&value)) {
+            return false;
+          }
+          ++(*num_values);
+        }
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TFExampleDecoder::ReadFloatList(const Feature &feature, float *out, int64_t max_values) {
+  int64_t i = 0;
+  ForEachFloat(feature, [out, max_values, &i](float value) {
+    if (i >= max_values) {
+      return false;
+    }
+    out[i++] = value;
+    return true;
+  });
+}
+
+template <typename T>
+void TFExampleDecoder::ReadInt64List(const Feature &feature, T *out, int64_t max_values) {
+  int64_t i = 0;
+  ForEachInt64(feature, [out, max_values, &i](int64_t value) {
+    if (i >= max_values) {
+      return false;
+    }
+    out[i++] = static_cast<T>(value);
+    return true;
+  });
+}
+
+template void TFExampleDecoder::ReadInt64List<int8_t>(const Feature &, int8_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<uint8_t>(const Feature &, uint8_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<int16_t>(const Feature &, int16_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<uint16_t>(const Feature &, uint16_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<int32_t>(const Feature &, int32_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<uint32_t>(const Feature &, uint32_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<int64_t>(const Feature &, int64_t *, int64_t);
+template void TFExampleDecoder::ReadInt64List<uint64_t>(const Feature &, uint64_t *, int64_t);
+
+bool TFExampleDecoder::ReadBytesList(const Feature &feature, uint8_t *out, int64_t out_size, int64_t pad_size) {
+  bool ok = true;
+  int64_t remaining = out_size;
+  ForEachBytes(feature, [&out, &remaining, &ok, pad_size](const uint8_t *data, size_t size) {
+    if (static_cast<int64_t>(size) > pad_size || pad_size > remaining) {
+      ok = false;
+      return false;
+    }
+    if (size > 0) {
+      (void)memcpy(out, data, size);
+    }
+    if (static_cast<int64_t>(size) < pad_size) {
+      (void)memset(out + size, ' ', static_cast<size_t>(pad_size) - size);
+    }
+    out += pad_size;
+    remaining -= pad_size;
+    return true;
+  });
+  return ok;
+}
+
+void TFExampleDecoder::ReadBytesList(const Feature &feature, std::vector<std::string> *out) {
+  ForEachBytes(feature, [out](const uint8_t *data, size_t size) {
+    out->emplace_back(reinterpret_cast<const char *>(data), size);
+    return true;
+  });
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mindspore {
+namespace dataset {
+// Decoder of serialized tf.train.Example records which reads the protobuf wire format in place.
+// It only locates the features of the columns it is asked for; the values are then copied from the record straight
+// into the memory of the tensors, so neither the Example message nor the strings and arrays it is made of are built.
+// The decoder accepts the encodings protobuf writes, packed and unpacked. A record it does not understand (malformed,
+// or with a feature given twice in one map entry) is reported as such, the caller then parses it with protobuf.
+class TFExampleDecoder {
+ public:
+  enum class Kind { kNone = 0, kBytesList = 1, kFloatList = 2, kInt64List = 3 };
+
+  // The serialized value list of a feature, pointing into the record
+  struct Feature {
+    bool found = false;
+    Kind kind = Kind::kNone;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+  };
+
+  // @param column_names - The names of the features to look for, in the order of the columns
+  explicit TFExampleDecoder(std::vector<std::string> column_names);
+
+  ~TFExampleDecoder() = default;
+
+  // Locate the features of the columns in a record.
+  // @param data - The serialized Example
+  // @param size - The size of the record
+  // @param features - One entry per column, found is false for the columns the record has no feature for
+  // @return false if the record can't be decoded here
+  bool FindFeatures(const uint8_t *data, size_t size, std::vector<Feature> *features) const;
+
+  // Validate the value list of a feature and count its values. It must succeed before any value of the feature is
+  // read.
+  // @param feature - The feature
+  // @param num_values - The number of values
+  // @param max_size - The size of the largest value of a bytes list, 0 for the other kinds
+  // @return false if the value list can't be decoded here
+  static bool CountValues(const Feature &feature, int64_t *num_values, uint64_t *max_size);
+
+  // Read at most max_values values of a float list.
+  static void ReadFloatList(const Feature &feature, float *out, int64_t max_values);
+
+  // Read at most max_values values of an int64 list, cast to T.
+  template <typename T>
+  static void ReadInt64List(const Feature &feature, T *out, int64_t max_values);
+
+  // Read the values of a bytes list into consecutive slots of pad_size bytes, padded with spaces.
+  // @param out_size - The size of the output buffer
+  // @return false if a value is larger than pad_size or the buffer is too small
+  static bool ReadBytesList(const Feature &feature, uint8_t *out, int64_t out_size, int64_t pad_size);
+
+  // Read the values of a bytes list as strings.
+  static void ReadBytesList(const Feature &feature, std::vector<std::string> *out);
+
+ private:
+  // Parse one entry of the feature map
+  bool ParseMapEntry(const uint8_t *data, size_t size, std::vector<Feature> *features) const;
+
+  std::vector<std::string> column_names_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_DECODER_H_
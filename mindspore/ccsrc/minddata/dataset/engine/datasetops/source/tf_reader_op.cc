@@ -17,9 +17,12 @@
 
 #include <algorithm>
 #include <fstream>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,6 +43,12 @@
 namespace mindspore {
 namespace dataset {
 const int64_t kTFRecordFileLimit = 0x140000000;
+// One offset out of kRecordIndexStride records is kept, the records in between are skipped by reading their headers.
+const int64_t kRecordIndexStride = 64;
+// A file is not split into blocks smaller than this.
+const int64_t kMinRecordsPerBlock = 256;
+// Blocks of records queued per worker when the records are shuffled, the filling thread waits when a queue is full.
+const int32_t kRecordShuffleQueueSize = 16;
 
 std::vector<std::string> TFReaderOp::ValidateFirstRowCrc(const std::vector<std::string> &filenames) {
   std::vector<std::string> invalid_files;
@@ -100,13 +109,16 @@ std::vector<std::string> TFReaderOp::ValidateFirstRowCrc(const std::vector<std::
 TFReaderOp::TFReaderOp(int32_t num_workers, int32_t worker_connector_size, int64_t total_num_rows,
                        std::vector<std::string> dataset_files_list, std::unique_ptr<DataSchema> data_schema,
                        int32_t op_connector_size, std::vector<std::string> columns_to_load, bool shuffle_files,
-                       int32_t num_devices, int32_t device_id, bool equal_rows_per_shard)
+                       int32_t num_devices, int32_t device_id, bool equal_rows_per_shard, bool shuffle_records)
     : NonMappableLeafOp(num_workers, worker_connector_size, total_num_rows, op_connector_size, shuffle_files,
                         num_devices, device_id),
       dataset_files_list_(std::move(dataset_files_list)),
       columns_to_load_(std::move(columns_to_load)),
       data_schema_(std::move(data_schema)),
-      equal_rows_per_shard_(equal_rows_per_shard) {}
+      equal_rows_per_shard_(equal_rows_per_shard),
+      split_records_(false),
+      shuffle_records_(shuffle_records),
+      hold_blocks_(false) {}
 
 // A print method typically used for debugging
 void TFReaderOp::Print(std::ostream &out, bool show_all) const {
@@ -121,6 +133,7 @@ void TFReaderOp::Print(std::ostream &out, bool show_all) const {
     // Then show any custom derived-internal stuff
     out << "\nTotal rows: " << total_rows_ << "\nDevice id: " << device_id_ << "\nNumber of devices: " << num_devices_
         << "\nShuffle files: " << ((shuffle_files_) ? "yes" : "no")
+        << "\nShuffle records: " << ((shuffle_records_) ? "yes" : "no")
         << "\nDataset files list: Size: " << dataset_files_list_.size() << "\n";
     for (size_t i = 0; i < dataset_files_list_.size(); ++i) {
       out << " " << dataset_files_list_[i];
@@ -155,9 +168,26 @@ Status TFReaderOp::Init() {
 
   jagged_rows_connector_ = std::make_unique<JaggedConnector>(num_workers_, 1, worker_connector_size_);
 
+  split_records_ = GlobalContext::config_manager()->enable_tfrecord_record_split();
+
   // temporary: make size large enough to hold all files + EOE to avoid hangs
   int32_t safe_queue_size = static_cast<int32_t>(std::ceil(dataset_files_list_.size() / num_workers_)) + 1;
+  if (split_records_) {
+    // A file is cut into num_workers blocks at most, every queue gets one block of each file at most.
+    safe_queue_size = static_cast<int32_t>(dataset_files_list_.size()) + 1;
+  }
+  if (shuffle_records_) {
+    RETURN_IF_NOT_OK(BuildAllRecordIndexes());
+    safe_queue_size = kRecordShuffleQueueSize;
+  }
   io_block_queues_.Init(num_workers_, safe_queue_size);
+  worker_skip_rows_.assign(num_workers_, 0);
+
+  std::vector<std::string> column_names;
+  for (int32_t i = 0; i < data_schema_->NumColumns(); ++i) {
+    column_names.push_back(data_schema_->Column(i).Name());
+  }
+  example_decoder_ = std::make_unique<TFExampleDecoder>(std::move(column_names));
 
   return Status::OK();
 }
@@ -249,18 +279,14 @@ Status TFReaderOp::FillIOBlockShuffle(const std::vector<int64_t> &i_keys) {
       }
       if (!equal_rows_per_shard_) {
         if (key_index++ % num_devices_ == device_id_) {
-          auto ioBlock = std::make_unique<FilenameBlock>(*it, kInvalidOffset, kInvalidOffset, IOBlock::kDeIoBlockNone);
-          RETURN_IF_NOT_OK(PushIoBlockQueue(queue_index, std::move(ioBlock)));
-          queue_index = (queue_index + 1) % num_workers_;
+          RETURN_IF_NOT_OK(PushFileBlocks(*it, (*filename_index_)[*it], kInvalidOffset, kInvalidOffset, &queue_index));
         }
       } else {
         // Do an index lookup using that key to get the filename.
         std::string file_name = (*filename_index_)[*it];
         if (NeedPushFileToBlockQueue(file_name, &start_offset, &end_offset, pre_count)) {
-          auto ioBlock = std::make_unique<FilenameBlock>(*it, start_offset, end_offset, IOBlock::kDeIoBlockNone);
-          RETURN_IF_NOT_OK(PushIoBlockQueue(queue_index, std::move(ioBlock)));
+          RETURN_IF_NOT_OK(PushFileBlocks(*it, file_name, start_offset, end_offset, &queue_index));
           MS_LOG(DEBUG) << "File name " << *it << " start offset " << start_offset << " end_offset " << end_offset;
-          queue_index = (queue_index + 1) % num_workers_;
         }
 
         pre_count += filename_numrows_[file_name];
@@ -273,6 +299,7 @@ Status TFReaderOp::FillIOBlockShuffle(const std::vector<int64_t> &i_keys) {
       finish = true;
     }
   }
+  RETURN_IF_NOT_OK(PushHeldBlocks());
   RETURN_IF_NOT_OK(PostEndOfEpoch(queue_index));
   return Status::OK();
 }
@@ -297,17 +324,12 @@ Status TFReaderOp::FillIOBlockNoShuffle() {
       }
       if (!equal_rows_per_shard_) {
         if (key_index++ % num_devices_ == device_id_) {
-          auto ioBlock =
-            std::make_unique<FilenameBlock>(it.key(), kInvalidOffset, kInvalidOffset, IOBlock::kDeIoBlockNone);
-          RETURN_IF_NOT_OK(PushIoBlockQueue(queue_index, std::move(ioBlock)));
-          queue_index = (queue_index + 1) % num_workers_;
+          RETURN_IF_NOT_OK(PushFileBlocks(it.key(), it.value(), kInvalidOffset, kInvalidOffset, &queue_index));
         }
       } else {
         std::string file_name = it.value();
         if (NeedPushFileToBlockQueue(file_name, &start_offset, &end_offset, pre_count)) {
-          auto ioBlock = std::make_unique<FilenameBlock>(it.key(), start_offset, end_offset, IOBlock::kDeIoBlockNone);
-          RETURN_IF_NOT_OK(PushIoBlockQueue(queue_index, std::move(ioBlock)));
-          queue_index = (queue_index + 1) % num_workers_;
+          RETURN_IF_NOT_OK(PushFileBlocks(it.key(), file_name, start_offset, end_offset, &queue_index));
         }
 
         pre_count += filename_numrows_[file_name];
@@ -321,10 +343,183 @@ Status TFReaderOp::FillIOBlockNoShuffle() {
     }
   }
 
+  RETURN_IF_NOT_OK(PushHeldBlocks());
   RETURN_IF_NOT_OK(PostEndOfEpoch(queue_index));
   return Status::OK();
 }
 
+Status TFReaderOp::FillIOBlockRecordShuffle() {
+  // The blocks of all the files are numbered one file after the other.
+  std::vector<int64_t> keys;
+  std::vector<int64_t> first_blocks;
+  std::vector<std::shared_ptr<const RecordIndex>> indexes;
+  int64_t num_blocks = 0;
+  for (auto it = filename_index_->begin(); it != filename_index_->end(); ++it) {
+    std::shared_ptr<const RecordIndex> index;
+    RETURN_IF_NOT_OK(GetRecordIndex(it.value(), &index));
+    keys.push_back(it.key());
+    first_blocks.push_back(num_blocks);
+    num_blocks += static_cast<int64_t>(index->offsets.size());
+    indexes.push_back(std::move(index));
+  }
+  std::vector<int64_t> blocks(num_blocks);
+  std::iota(blocks.begin(), blocks.end(), 0);
+  // Every shard shuffles with the same seed, and takes its own part of the shuffled blocks.
+  ShuffleKeys(&blocks, shuffle_seed_);
+
+  int32_t queue_index = 0;
+  auto push_block = [this, &queue_index](int64_t key, int64_t start_offset, int64_t end_offset) {
+    return PushBlock(key, start_offset, end_offset, &queue_index);
+  };
+  // With equal rows per shard, a shard gets the rows [shard_start, shard_end) of the records of the shuffled blocks,
+  // going through the blocks again if it runs past the last one.
+  const int64_t shard_start = static_cast<int64_t>(device_id_) * num_rows_per_shard_;
+  const int64_t shard_end = shard_start + num_rows_per_shard_;
+  int64_t pre_count = 0;
+  bool finish = num_blocks == 0;
+  while (!finish) {
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      {
+        std::unique_lock<std::mutex> lock(load_io_block_queue_mutex_);
+        if (load_io_block_queue_ == false) {
+          finish = true;
+          break;
+        }
+      }
+      const int64_t block = blocks[i];
+      const auto file = std::upper_bound(first_blocks.begin(), first_blocks.end(), block) - first_blocks.begin() - 1;
+      const int64_t start_offset = (block - first_blocks[file]) * kRecordIndexStride;
+      const int64_t end_offset = std::min(start_offset + kRecordIndexStride, indexes[file]->num_records);
+      if (!equal_rows_per_shard_) {
+        if (i % num_devices_ == device_id_) {
+          RETURN_IF_NOT_OK(push_block(keys[file], start_offset, end_offset));
+        }
+        continue;
+      }
+      const int64_t low = std::max(shard_start, pre_count);
+      const int64_t high = std::min(shard_end, pre_count + end_offset - start_offset);
+      if (low < high) {
+        RETURN_IF_NOT_OK(push_block(keys[file], start_offset + low - pre_count, start_offset + high - pre_count));
+      }
+      pre_count += end_offset - start_offset;
+      if (pre_count >= shard_end) {
+        finish = true;
+        break;
+      }
+    }
+    finish = finish || !equal_rows_per_shard_;
+  }
+  RETURN_IF_NOT_OK(PushHeldBlocks());
+  RETURN_IF_NOT_OK(PostEndOfEpoch(queue_index));
+  return Status::OK();
+}
+
+Status TFReaderOp::PushFileBlocks(int64_t key, const std::string &filename, int64_t start_offset, int64_t end_offset,
+                                  int32_t *queue_index) {
+  int64_t num_blocks = 1;
+  if (split_records_) {
+    if (start_offset == kInvalidOffset) {
+      std::shared_ptr<const RecordIndex> index;
+      RETURN_IF_NOT_OK(GetRecordIndex(filename, &index));
+      start_offset = 0;
+      end_offset = index->num_records;
+    }
+    num_blocks = std::min<int64_t>(num_workers_, (end_offset - start_offset) / kMinRecordsPerBlock);
+    num_blocks = std::max<int64_t>(num_blocks, 1);
+  }
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    int64_t block_start = start_offset;
+    int64_t block_end = end_offset;
+    if (num_blocks > 1) {
+      block_start = start_offset + (end_offset - start_offset) * i / num_blocks;
+      block_end = start_offset + (end_offset - start_offset) * (i + 1) / num_blocks;
+    }
+    RETURN_IF_NOT_OK(PushBlock(key, block_start, block_end, queue_index));
+  }
+  return Status::OK();
+}
+
+void TFReaderOp::SetFirstEpochSkip(int64_t num_rows) {
+  skip_rows_ = num_rows;
+  hold_blocks_ = num_rows > 0;
+}
+
+Status TFReaderOp::PushBlock(int64_t key, int64_t start_offset, int64_t end_offset, int32_t *queue_index) {
+  if (hold_blocks_) {
+    held_blocks_.push_back({key, start_offset, end_offset, *queue_index});
+  } else {
+    auto io_block = std::make_unique<FilenameBlock>(key, start_offset, end_offset, IOBlock::kDeIoBlockNone);
+    RETURN_IF_NOT_OK(PushIoBlockQueue(*queue_index, std::move(io_block)));
+  }
+  *queue_index = (*queue_index + 1) % num_workers_;
+  return Status::OK();
+}
+
+Status TFReaderOp::PushHeldBlocks() {
+  if (!hold_blocks_) {
+    return Status::OK();
+  }
+  hold_blocks_ = false;
+  std::vector<int64_t> worker_rows(num_workers_, 0);
+  for (auto &block : held_blocks_) {
+    std::shared_ptr<const RecordIndex> index;
+    RETURN_IF_NOT_OK(GetRecordIndex((*filename_index_)[block.key], &index));
+    if (block.start_offset == kInvalidOffset) {
+      block.start_offset = 0;
+      block.end_offset = index->num_records;
+    }
+    block.end_offset = std::min(block.end_offset, index->num_records);
+    worker_rows[block.queue_index] += std::max<int64_t>(block.end_offset - block.start_offset, 0);
+  }
+  // Find the last turn all the workers send their rows in before the rows to skip run out.
+  auto rows_before_turn = [&worker_rows](int64_t turn) {
+    int64_t rows = 0;
+    for (auto num_rows : worker_rows) {
+      rows += std::min(num_rows, turn);
+    }
+    return rows;
+  };
+  int64_t low = 0;
+  int64_t high = *std::max_element(worker_rows.begin(), worker_rows.end());
+  while (low < high) {
+    int64_t mid = low + (high - low + 1) / 2;
+    if (rows_before_turn(mid) <= skip_rows_) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+  rows_to_drop_ = skip_rows_ - rows_before_turn(low);
+  std::vector<int64_t> worker_skip(num_workers_);
+  for (int32_t i = 0; i < num_workers_; ++i) {
+    worker_skip[i] = std::min(worker_rows[i], low);
+  }
+
+  for (auto &block : held_blocks_) {
+    int64_t &to_skip = worker_skip[block.queue_index];
+    int64_t num_rows = std::max<int64_t>(block.end_offset - block.start_offset, 0);
+    if (to_skip >= num_rows) {
+      to_skip -= num_rows;
+      continue;
+    }
+    if (to_skip > 0) {
+      if (shuffle_records_) {
+        // The rows of the block are shuffled by its start, so the worker drops them once they are shuffled.
+        worker_skip_rows_[block.queue_index] = to_skip;
+      } else {
+        block.start_offset += to_skip;
+      }
+      to_skip = 0;
+    }
+    auto io_block =
+      std::make_unique<FilenameBlock>(block.key, block.start_offset, block.end_offset, IOBlock::kDeIoBlockNone);
+    RETURN_IF_NOT_OK(PushIoBlockQueue(block.queue_index, std::move(io_block)));
+  }
+  held_blocks_.clear();
+  held_blocks_.shrink_to_fit();
+  return Status::OK();
+}
+
 // Reads a tf_file file and loads the data into multiple TensorRows.
 Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, int64_t end_offset, int32_t worker_id) {
   auto realpath = FileUtils::GetRealPath(filename.c_str());
@@ -342,8 +537,23 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
   int64_t rows_read = 0;
   int64_t rows_total = 0;
 
+  if (start_offset != kInvalidOffset && start_offset > 0) {
+    // Jump close to the first row of the block rather than reading all the rows before it
+    std::shared_ptr<const RecordIndex> index;
+    RETURN_IF_NOT_OK(GetRecordIndex(filename, &index));
+    if (start_offset >= index->num_records) {
+      return Status::OK();
+    }
+    rows_total = start_offset / kRecordIndexStride * kRecordIndexStride;
+    (void)reader.seekg(index->offsets[start_offset / kRecordIndexStride], std::ios::beg);
+  }
+
+  int32_t num_columns = data_schema_->NumColumns();
+  std::string serialized_example;
+  // With the records shuffled, the rows of the block are sent in a random order once they are all read.
+  std::vector<TensorRow> block_rows;
   while (reader.peek() != EOF) {
-    if (!load_jagged_connector_) {
+    if (!load_jagged_connector_ || (start_offset != kInvalidOffset && rows_total >= end_offset)) {
       break;
     }
     RETURN_IF_INTERRUPTED();
@@ -355,27 +565,35 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     // ignore crc header
     (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
 
-    // read serialized Example
-    std::string serialized_example;
-    serialized_example.resize(record_length);
-    (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
-
-    int32_t num_columns = data_schema_->NumColumns();
-    TensorRow newRow(num_columns, nullptr);
-
-    if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      dataengine::Example tf_file;
-      if (!tf_file.ParseFromString(serialized_example)) {
-        std::string errMsg = "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
-        MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
-        RETURN_STATUS_UNEXPECTED(errMsg);
+    if (start_offset == kInvalidOffset || rows_total >= start_offset) {
+      // read serialized Example
+      serialized_example.resize(record_length);
+      (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
+
+      TensorRow newRow(num_columns, nullptr);
+      bool decoded = false;
+      RETURN_IF_NOT_OK(DecodeExample(serialized_example, &newRow, &decoded));
+      if (!decoded) {
+        dataengine::Example tf_file;
+        if (!tf_file.ParseFromString(serialized_example)) {
+          std::string errMsg =
+            "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
+          MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
+          RETURN_STATUS_UNEXPECTED(errMsg);
+        }
+        RETURN_IF_NOT_OK(LoadExample(&tf_file, &newRow));
       }
 
       std::vector<std::string> file_path(num_columns, filename);
       newRow.setPath(file_path);
-      RETURN_IF_NOT_OK(LoadExample(&tf_file, &newRow));
       rows_read++;
-      RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(newRow)));
+      if (shuffle_records_) {
+        block_rows.push_back(std::move(newRow));
+      } else {
+        RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(newRow)));
+      }
+    } else {
+      (void)reader.ignore(static_cast<std::streamsize>(record_length));
     }
 
     // ignore crc footer
@@ -383,6 +601,19 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     rows_total++;
   }
 
+  if (!block_rows.empty() && load_jagged_connector_) {
+    std::seed_seq seeds{shuffle_seed_, static_cast<uint32_t>(std::hash<std::string>()(filename)),
+                        static_cast<uint32_t>(start_offset)};
+    std::mt19937 rng(seeds);
+    std::shuffle(block_rows.begin(), block_rows.end(), rng);
+    auto first_row = block_rows.begin() + std::min<int64_t>(worker_skip_rows_[worker_id], block_rows.size());
+    for (auto row = first_row; row != block_rows.end(); ++row) {
+      RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(*row)));
+    }
+  }
+  if (shuffle_records_) {
+    worker_skip_rows_[worker_id] = 0;
+  }
   return Status::OK();
 }
 
@@ -494,7 +725,19 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
 #endif
   }
 
-  int64_t pad_size = max_size;
+  int64_t pad_size = 0;
+  RETURN_IF_NOT_OK(GetBytesListPadSize(current_col, max_size, &pad_size));
+
+  // know how many elements there are and the total bytes, create tensor here:
+  TensorShape current_shape = TensorShape::CreateScalar();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.Type(), pad_size, tensor));
+
+  return Status::OK();
+}
+
+Status TFReaderOp::GetBytesListPadSize(const ColDescriptor &current_col, uint64_t max_size, int64_t *pad_size) {
+  *pad_size = max_size;
 
   // if user provides a shape in the form of [-1, d1, 2d, ... , dn], we need to pad to d1 * d2 * ... * dn
   if (current_col.HasShape()) {
@@ -510,7 +753,7 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
         }
         new_pad_size *= cur_shape[i];
       }
-      pad_size = new_pad_size;
+      *pad_size = new_pad_size;
     } else {
       if (cur_shape.known() && cur_shape.NumOfElements() != max_size) {
         std::string err_msg = "Data dimensions of '" + current_col.Name() +
@@ -521,12 +764,6 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
       }
     }
   }
-
-  // know how many elements there are and the total bytes, create tensor here:
-  TensorShape current_shape = TensorShape::CreateScalar();
-  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
-  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.Type(), pad_size, tensor));
-
   return Status::OK();
 }
 
@@ -614,6 +851,199 @@ Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengin
   return Status::OK();
 }
 
+// Parses a single row straight from the serialized record.
+Status TFReaderOp::DecodeExample(const std::string &serialized_example, TensorRow *out_row, bool *decoded) {
+  *decoded = false;
+  std::vector<TFExampleDecoder::Feature> features;
+  if (example_decoder_ == nullptr ||
+      !example_decoder_->FindFeatures(reinterpret_cast<const uint8_t *>(serialized_example.data()),
+                                      serialized_example.size(), &features)) {
+    return Status::OK();
+  }
+  // Validate the whole row first, so that a record protobuf has to parse gives the same errors as before.
+  std::vector<int64_t> num_elements(features.size(), 0);
+  std::vector<uint64_t> max_sizes(features.size(), 0);
+  for (size_t col = 0; col < features.size(); ++col) {
+    if (features[col].found && !TFExampleDecoder::CountValues(features[col], &num_elements[col], &max_sizes[col])) {
+      return Status::OK();
+    }
+  }
+  int32_t num_columns = data_schema_->NumColumns();
+  for (int32_t col = 0; col < num_columns; ++col) {
+    const ColDescriptor current_col = data_schema_->Column(col);
+    if (!features[col].found) {
+      RETURN_STATUS_UNEXPECTED("Invalid columns_list, column name: " + current_col.Name() +
+                               " does not exist in tfrecord file, check tfrecord files.");
+    }
+    RETURN_IF_NOT_OK(
+      DecodeFeature(current_col, features[col], num_elements[col], max_sizes[col], &(*out_row)[col]));
+  }
+  *decoded = true;
+  return Status::OK();
+}
+
+// Reads values from a serialized int64 list and casts the value to type T
+template <typename T>
+Status TFReaderOp::DecodeIntList(const ColDescriptor &current_col, const TFExampleDecoder::Feature &feature,
+                                 int64_t num_elements, std::shared_ptr<Tensor> *tensor) {
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(static_cast<int32_t>(num_elements), &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  if ((*tensor)->Size() > 0) {
+    TFExampleDecoder::ReadInt64List(feature, &*(*tensor)->begin<T>(), (*tensor)->Size());
+  }
+  return Status::OK();
+}
+
+// Creates the tensor of a single cell from its serialized value list, with the same checks as LoadFeature.
+Status TFReaderOp::DecodeFeature(const ColDescriptor &current_col, const TFExampleDecoder::Feature &feature,
+                                 int64_t num_elements, uint64_t max_size, std::shared_ptr<Tensor> *tensor) {
+  const DataType type = current_col.Type();
+  switch (feature.kind) {
+    case TFExampleDecoder::Kind::kBytesList: {
+      if (type != DataType::DE_UINT8 && type != DataType::DE_INT8 && type != DataType::DE_STRING) {
+        std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                              " should be int8, uint8 or string, but got " + type.ToString();
+        RETURN_STATUS_UNEXPECTED(err_msg);
+      }
+      if (type == DataType::DE_STRING) {
+        TensorShape shape = TensorShape::CreateScalar();
+        RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(static_cast<int32_t>(num_elements), &shape));
+        std::vector<std::string> values;
+        values.reserve(num_elements);
+        TFExampleDecoder::ReadBytesList(feature, &values);
+        RETURN_IF_NOT_OK(Tensor::CreateFromVector(values, TensorShape({num_elements}), tensor));
+        return (*tensor)->Reshape(shape);
+      }
+      int64_t pad_size = 0;
+      RETURN_IF_NOT_OK(GetBytesListPadSize(current_col, max_size, &pad_size));
+      TensorShape current_shape = TensorShape::CreateScalar();
+      RETURN_IF_NOT_OK(
+        current_col.MaterializeTensorShape(static_cast<int32_t>(num_elements * pad_size), &current_shape));
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, type, tensor));
+      uint8_t *buffer = (*tensor)->SizeInBytes() > 0 ? &*(*tensor)->begin<uint8_t>() : nullptr;
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        TFExampleDecoder::ReadBytesList(feature, buffer, (*tensor)->SizeInBytes(), pad_size),
+        "memcpy_s failed when reading bytesList element into Tensor");
+      return Status::OK();
+    }
+    case TFExampleDecoder::Kind::kFloatList: {
+      if (type != DataType::DE_FLOAT32) {
+        std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                              " should be string, but got " + type.ToString();
+        RETURN_STATUS_UNEXPECTED(err_msg);
+      }
+      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(static_cast<int32_t>(num_elements), &current_shape));
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, type, tensor));
+      if ((*tensor)->Size() > 0) {
+        TFExampleDecoder::ReadFloatList(feature, &*(*tensor)->begin<float>(), (*tensor)->Size());
+      }
+      return Status::OK();
+    }
+    case TFExampleDecoder::Kind::kInt64List: {
+      if (type == DataType::DE_UINT64) {
+        return DecodeIntList<uint64_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_INT64) {
+        return DecodeIntList<int64_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_UINT32) {
+        return DecodeIntList<uint32_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_INT32) {
+        return DecodeIntList<int32_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_UINT16) {
+        return DecodeIntList<uint16_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_INT16) {
+        return DecodeIntList<int16_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_UINT8) {
+        return DecodeIntList<uint8_t>(current_col, feature, num_elements, tensor);
+      } else if (type == DataType::DE_INT8) {
+        return DecodeIntList<int8_t>(current_col, feature, num_elements, tensor);
+      }
+      std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                            " should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8, but got " +
+                            type.ToString();
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+    default: {
+      std::string err_msg =
+        "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+  }
+}
+
+Status TFReaderOp::BuildRecordIndex(const std::string &filename, RecordIndex *index) {
+  auto realpath = FileUtils::GetRealPath(filename.c_str());
+  if (!realpath.has_value()) {
+    RETURN_STATUS_UNEXPECTED("Invalid file path, " + filename + " does not exist.");
+  }
+  std::ifstream reader;
+  reader.open(realpath.value());
+  if (!reader) {
+    RETURN_STATUS_UNEXPECTED("Invalid file, " + filename + " open failed: permission denied!");
+  }
+  // Same walk as CountTotalRowsSectioned, so that both agree on the number of rows of a file
+  index->num_records = 0;
+  index->offsets.clear();
+  while (reader.peek() != EOF) {
+    if (index->num_records % kRecordIndexStride == 0) {
+      index->offsets.push_back(static_cast<int64_t>(reader.tellg()));
+    }
+    // read length
+    int64_t record_length = 0;
+    (void)reader.read(reinterpret_cast<char *>(&record_length), static_cast<std::streamsize>(sizeof(int64_t)));
+
+    // ignore crc header, tf_file contents and crc footer
+    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
+    (void)reader.ignore(static_cast<std::streamsize>(record_length));
+    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
+    index->num_records++;
+  }
+  return Status::OK();
+}
+
+Status TFReaderOp::GetRecordIndex(const std::string &filename, std::shared_ptr<const RecordIndex> *index) {
+  {
+    std::lock_guard<std::mutex> lock(record_index_mutex_);
+    auto it = record_indexes_.find(filename);
+    if (it != record_indexes_.end()) {
+      *index = it->second;
+      return Status::OK();
+    }
+  }
+  // Built outside the lock, the workers reading other files don't wait for it.
+  auto new_index = std::make_shared<RecordIndex>();
+  RETURN_IF_NOT_OK(BuildRecordIndex(filename, new_index.get()));
+  std::lock_guard<std::mutex> lock(record_index_mutex_);
+  *index = record_indexes_.emplace(filename, std::move(new_index)).first->second;
+  return Status::OK();
+}
+
+Status TFReaderOp::BuildAllRecordIndexes() {
+  // constrain the workers
+  const int32_t kThreadCount = 8;
+  int32_t threads = std::min(GlobalContext::config_manager()->num_cpu_threads(), kThreadCount);
+  threads = std::max(std::min(threads, static_cast<int32_t>(dataset_files_list_.size())), 1);
+  std::vector<std::future<Status>> async_tasks;
+  for (int32_t t = 0; t < threads; ++t) {
+    async_tasks.emplace_back(std::async(std::launch::async, [this, t, threads]() {
+      for (size_t i = t; i < dataset_files_list_.size(); i += threads) {
+        std::shared_ptr<const RecordIndex> index;
+        RETURN_IF_NOT_OK(GetRecordIndex(dataset_files_list_[i], &index));
+      }
+      return Status::OK();
+    }));
+  }
+  Status rc;
+  for (auto &task : async_tasks) {
+    Status task_rc = task.get();
+    if (rc.IsOk()) {
+      rc = task_rc;
+    }
+  }
+  return rc;
+}
+
 Status TFReaderOp::CreateSchema(const std::string tf_file, std::vector<std::string> columns_to_load) {
   auto realpath = FileUtils::GetRealPath(tf_file.c_str());
   if (!realpath.has_value()) {
@@ -798,6 +1228,9 @@ Status TFReaderOp::ComputeColMap() {
   return Status::OK();
 }
 Status TFReaderOp::FillIOBlockQueue(const std::vector<int64_t> &i_keys) {
+  if (shuffle_records_) {
+    return FillIOBlockRecordShuffle();
+  }
   if (shuffle_files_) {
     return FillIOBlockShuffle(i_keys);
   }
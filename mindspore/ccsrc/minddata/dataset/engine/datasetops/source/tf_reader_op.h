@@ -32,6 +32,7 @@
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
 #include "minddata/dataset/engine/jagged_connector.h"
 
 namespace dataengine {
@@ -66,10 +67,12 @@ class TFReaderOp : public NonMappableLeafOp {
   // @param columns_to_load - the names of the columns to load data from.
   // @param shuffle_files - whether or not to shuffle the files before reading data.
   // @param equal_rows_per_shard - whether or not to get equal rows for each process.
+  // @param shuffle_records - whether or not to shuffle the blocks of records of all the files, and the records of
+  //     each block, rather than the files only.
   TFReaderOp(int32_t num_workers, int32_t worker_connector_size, int64_t total_num_rows,
              std::vector<std::string> dataset_files_list, std::unique_ptr<DataSchema> data_schema,
              int32_t op_connector_size, std::vector<std::string> columns_to_load, bool shuffle_files,
-             int32_t num_devices, int32_t device_id, bool equal_rows_per_shard);
+             int32_t num_devices, int32_t device_id, bool equal_rows_per_shard, bool shuffle_records = false);
 
   /// Default destructor
   ~TFReaderOp() = default;
@@ -104,6 +107,11 @@ class TFReaderOp : public NonMappableLeafOp {
 
   static std::vector<std::string> ValidateFirstRowCrc(const std::vector<std::string> &filename);
 
+  /// Skip the first rows of the first epoch. The blocks of records before them are not read, and the records of the
+  /// first blocks read are passed over without decoding them.
+  /// @param num_rows - the number of rows to skip.
+  void SetFirstEpochSkip(int64_t num_rows);
+
  private:
   // Reads a tf_file file and loads the data into multiple TensorRows.
   // @param filename - the tf_file file to read.
@@ -165,6 +173,40 @@ class TFReaderOp : public NonMappableLeafOp {
   Status LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
                            int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
+  /// Computes the size every value of a bytes list is padded to
+  /// @param current_col - the column descriptor containing the expected shape and type of the data.
+  /// @param max_size - the size of the largest value of the list.
+  /// @param pad_size - the padded size of the values.
+  /// @return Status - the error code returned.
+  static Status GetBytesListPadSize(const ColDescriptor &current_col, uint64_t max_size, int64_t *pad_size);
+
+  /// Parses a single row straight from the serialized record, without building the Example message
+  /// @param serialized_example - the record.
+  /// @param out_row - the row to put the tensors in.
+  /// @param decoded - set to false if the record has to be parsed by protobuf instead, out_row is then incomplete.
+  /// @return Status - the error code returned.
+  Status DecodeExample(const std::string &serialized_example, TensorRow *out_row, bool *decoded);
+
+  /// Creates the tensor of a single cell from its serialized value list
+  /// @param current_col - the column descriptor containing the expected shape and type of the data.
+  /// @param feature - the value list, validated by TFExampleDecoder::CountValues.
+  /// @param num_elements - number of values in the list.
+  /// @param max_size - the size of the largest value of a bytes list.
+  /// @param tensor - the tensor we read the values into.
+  /// @return Status - the error code returned.
+  Status DecodeFeature(const ColDescriptor &current_col, const TFExampleDecoder::Feature &feature, int64_t num_elements,
+                       uint64_t max_size, std::shared_ptr<Tensor> *tensor);
+
+  /// Reads values from a serialized int64 list and casts the value to type T
+  /// @param current_col - the column descriptor containing the expected shape and type of the data.
+  /// @param feature - the value list.
+  /// @param num_elements - number of values in the list.
+  /// @param tensor - the tensor we read the values into.
+  /// @return Status - the error code returned.
+  template <typename T>
+  Status DecodeIntList(const ColDescriptor &current_col, const TFExampleDecoder::Feature &feature, int64_t num_elements,
+                       std::shared_ptr<Tensor> *tensor);
+
   /// Reads one row of data from a tf file and creates a schema based on that row
   /// @return Status - the error code returned.
   Status CreateSchema(const std::string tf_file, std::vector<std::string> columns_to_load);
@@ -177,6 +219,28 @@ class TFReaderOp : public NonMappableLeafOp {
   static int64_t CountTotalRowsSectioned(const std::vector<std::string> &filenames, const int64_t begin,
                                          const int64_t end);
 
+  /// Offsets of the records of a file, one every kRecordIndexStride records
+  struct RecordIndex {
+    int64_t num_records = 0;
+    std::vector<int64_t> offsets;
+  };
+
+  /// Scans the record headers of a file to index the offsets of its records
+  /// @param filename - the tf file.
+  /// @param index - the index built.
+  /// @return Status - the error code returned.
+  static Status BuildRecordIndex(const std::string &filename, RecordIndex *index);
+
+  /// Gets the record index of a file, it is built the first time only
+  /// @param filename - the tf file.
+  /// @param index - the index of the file.
+  /// @return Status - the error code returned.
+  Status GetRecordIndex(const std::string &filename, std::shared_ptr<const RecordIndex> *index);
+
+  /// Builds the record index of all the files in parallel
+  /// @return Status - the error code returned.
+  Status BuildAllRecordIndexes();
+
  protected:
   Status FillIOBlockQueue(const std::vector<int64_t> &i_keys) override;
 
@@ -193,6 +257,36 @@ class TFReaderOp : public NonMappableLeafOp {
    */
   Status FillIOBlockNoShuffle();
 
+  // Fill IO block queue with the blocks of records of all the files in a random order. The blocks are the ones of
+  // the record index, so that every read starts at an indexed offset.
+  // @return Status - the error code returned.
+  Status FillIOBlockRecordShuffle();
+
+  // Push the rows [start_offset, end_offset) of a file to the IO block queues. With record split enabled, they are cut
+  // into up to num_workers blocks.
+  // @param key - the key of the file.
+  // @param filename - the file.
+  // @param start_offset - the first row, kInvalidOffset for the whole file.
+  // @param end_offset - one past the last row.
+  // @param queue_index - the queue to push to, moved past the queues pushed to.
+  // @return Status - the error code returned.
+  Status PushFileBlocks(int64_t key, const std::string &filename, int64_t start_offset, int64_t end_offset,
+                        int32_t *queue_index);
+
+  // Push a block of rows to an IO block queue, or hold it while the rows to skip are not known to be in it.
+  // @param key - the key of the file.
+  // @param start_offset - the first row, kInvalidOffset for the whole file.
+  // @param end_offset - one past the last row.
+  // @param queue_index - the queue to push to, moved to the next queue.
+  // @return Status - the error code returned.
+  Status PushBlock(int64_t key, int64_t start_offset, int64_t end_offset, int32_t *queue_index);
+
+  // Push the blocks held for the first epoch, without the rows to skip. The workers send their rows in turn, so every
+  // worker skips the same number of rows, the ones of a worker with fewer rows aside, and the master thread drops the
+  // rest of them.
+  // @return Status - the error code returned.
+  Status PushHeldBlocks();
+
   // Calculate number of rows in each shard.
   // @return Status - the error code returned.
   Status CalculateNumRowsPerShard() override;
@@ -206,6 +300,22 @@ class TFReaderOp : public NonMappableLeafOp {
   std::unique_ptr<DataSchema> data_schema_;
 
   bool equal_rows_per_shard_;
+  bool split_records_;
+  bool shuffle_records_;
+  std::unique_ptr<TFExampleDecoder> example_decoder_;
+  std::mutex record_index_mutex_;
+  std::map<std::string, std::shared_ptr<const RecordIndex>> record_indexes_;
+
+  /// A block of rows pushed to a queue
+  struct HeldBlock {
+    int64_t key;
+    int64_t start_offset;
+    int64_t end_offset;
+    int32_t queue_index;
+  };
+  bool hold_blocks_;                       // Whether the blocks of the first epoch are held to skip rows
+  std::vector<HeldBlock> held_blocks_;     // Blocks of the first epoch, held until they are all known
+  std::vector<int64_t> worker_skip_rows_;  // Rows each worker drops from its first block once shuffled
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -14,14 +14,18 @@
  * limitations under the License.
  */
 #include "minddata/dataset/engine/execution_tree.h"
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <limits>
+#include <map>
+#include <utility>
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/engine/datasetops/device_queue_op.h"
 #if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
 #include "mindspore/core/utils/numa_interface.h"
 #endif
+#include "minddata/dataset/util/numa_placement.h"
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/util/service.h"
 
@@ -33,8 +37,14 @@ ExecutionTree::ExecutionTree() : id_count_(0), tree_state_(kDeTStateInit) {
   root_ = nullptr;
   prepare_flags_ = 0;
   unique_id_ = Services::GetUniqueID();
-#if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  if (cfg->enable_tensor_mem_pool()) {
+    // Tensors created by the tasks of this tree recycle their buffers through a pool of its own.
+    const uint64_t kMBytes = 1024 * 1024;
+    tensor_mem_pool_ = std::make_shared<SizeClassPool>(static_cast<uint64_t>(cfg->tensor_mem_pool_limit()) * kMBytes);
+    tg_->SetMemoryPool(tensor_mem_pool_);
+  }
+#if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
   rank_id_ = cfg->rank_id();
   numa_enable_ = cfg->numa_enable();
   handle_ = nullptr;
@@ -55,6 +65,9 @@ ExecutionTree::~ExecutionTree() {
 #endif
 #endif
   (void)tg_->ServiceStop();
+  if (tensor_mem_pool_ != nullptr) {
+    MS_LOG(INFO) << "Tensor memory pool of the execution tree " << unique_id_ << ": " << *tensor_mem_pool_;
+  }
 }
 
 // Associates a DatasetOp with this tree. This assigns a valid node id to the operator and
@@ -181,6 +194,10 @@ Status ExecutionTree::Launch() {
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
+  if (GlobalContext::config_manager()->numa_policy() != NumaPolicy::kNone) {
+    RETURN_IF_NOT_OK(AssignNumaNodes());
+  }
+
   std::ostringstream ss;
   ss << *this;
   MS_LOG(DEBUG) << "Printing the tree before launch tasks:\n" << ss.str();
@@ -202,6 +219,85 @@ Status ExecutionTree::Launch() {
   return Status::OK();
 }
 
+// Find the NUMA node of the device the tree sends its data to
+int32_t ExecutionTree::GetDeviceNumaNode() const {
+  auto *op = dynamic_cast<DeviceQueueOp *>(root_.get());
+  if (op == nullptr || op->device_type() == DeviceQueueOp::DeviceType::CPU) {
+    return NumaPlacement::kNoNode;
+  }
+  // The drivers number the devices in the order of their PCI addresses, which is also the order of CUDA when
+  // CUDA_DEVICE_ORDER=PCI_BUS_ID. The device id is an index into the visible devices, so the guess is wrong if only
+  // some of them are visible, it then only costs some cross node traffic.
+  constexpr uint32_t kHuaweiVendorId = 0x19e5;
+  constexpr uint32_t kNvidiaVendorId = 0x10de;
+  constexpr uint32_t kAcceleratorClass = 0x12;
+  constexpr uint32_t kDisplayClass = 0x03;
+  std::vector<std::string> devices = op->device_type() == DeviceQueueOp::DeviceType::Ascend
+                                       ? NumaPlacement::ListPciDevices(kHuaweiVendorId, kAcceleratorClass)
+                                       : NumaPlacement::ListPciDevices(kNvidiaVendorId, kDisplayClass);
+  if (op->device_id() < 0 || static_cast<size_t>(op->device_id()) >= devices.size()) {
+    return NumaPlacement::kNoNode;
+  }
+  return NumaPlacement::GetPciDeviceNode(devices[op->device_id()]);
+}
+
+// Assign the operators of the tree to the NUMA nodes of the host
+Status ExecutionTree::AssignNumaNodes() {
+  std::shared_ptr<NumaPlacement> placement;
+  RETURN_IF_NOT_OK(NumaPlacement::CreateNumaPlacement(&placement));
+  const int32_t num_nodes = placement->num_nodes();
+  if (num_nodes <= 1) {
+    MS_LOG(INFO) << "The host has only one NUMA node, the operators are not bound.";
+    return Status::OK();
+  }
+  int32_t device_node = GetDeviceNumaNode();
+  if (device_node == NumaPlacement::kNoNode) {
+    // Same choice as the process level bind when the device is unknown.
+    int32_t rank_id = GlobalContext::config_manager()->rank_id();
+    device_node = rank_id >= 0 ? rank_id % num_nodes : NumaPlacement::kNoNode;
+  }
+  if (device_node == NumaPlacement::kNoNode) {
+    MS_LOG(INFO) << "Neither the device nor the rank of the pipeline is known, the operators are not bound.";
+    return Status::OK();
+  }
+
+  std::ostringstream ss;
+  if (GlobalContext::config_manager()->numa_policy() == NumaPolicy::kDeviceLocal) {
+    for (auto itr = begin(); itr != end(); ++itr) {
+      placement->SetOperatorNode(itr->id(), device_node);
+    }
+    ss << "all the operators on node " << device_node;
+  } else {
+    // Cut the operators, from the leaves to the root, into one segment per node of about the same number of threads,
+    // so that only the connectors between two segments cross the nodes. The segment of the root is the one feeding
+    // the device and goes to the node of the device, the other ones take the other nodes in order.
+    std::vector<std::pair<int32_t, int64_t>> ops;
+    int64_t total_threads = 0;
+    for (auto itr = begin(); itr != end(); ++itr) {
+      int64_t num_threads = 1 + std::max(static_cast<const DatasetOp &>(*itr).NumWorkers(), 0);
+      ops.emplace_back(itr->id(), num_threads);
+      total_threads += num_threads;
+    }
+    std::vector<int32_t> nodes;
+    for (int32_t node = 0; node < num_nodes; ++node) {
+      if (node != device_node) {
+        nodes.push_back(node);
+      }
+    }
+    nodes.push_back(device_node);
+    int64_t threads_so_far = 0;
+    for (const auto &op : ops) {
+      auto segment = std::min<int64_t>(threads_so_far * num_nodes / total_threads, num_nodes - 1);
+      threads_so_far += op.second;
+      placement->SetOperatorNode(op.first, nodes[segment]);
+      ss << "operator " << op.first << " on node " << nodes[segment] << ", ";
+    }
+  }
+  MS_LOG(INFO) << "NUMA placement of the execution tree " << unique_id_ << ": " << ss.str();
+  tg_->SetNumaPlacement(placement);
+  return Status::OK();
+}
+
 // A function that traverse the tree in postorder then save the results in nodes
 void ExecutionTree::Iterator::PostOrderTraverse(const std::shared_ptr<DatasetOp> &node) {
   if (node == nullptr) {
@@ -278,5 +374,40 @@ Status ExecutionTree::Prepare() {
   tree_state_ = kDeTStatePrepared;
   return Status::OK();
 }
+
+// The operators are keyed by their name and their rank among the operators of the same name, which stay the same
+// when the pipeline is compiled again with skip operators for a reset.
+Status ExecutionTree::GetEpochState(int32_t epoch, nlohmann::json *states) {
+  RETURN_UNEXPECTED_IF_NULL(states);
+  *states = nlohmann::json::object();
+  std::map<std::string, int32_t> ranks;
+  for (auto itr = this->begin(); itr != this->end(); ++itr) {
+    std::string key = itr->Name() + "#" + std::to_string(ranks[itr->Name()]++);
+    nlohmann::json state;
+    RETURN_IF_NOT_OK(itr->GetEpochState(epoch, &state));
+    if (!state.is_null()) {
+      (*states)[key] = std::move(state);
+    }
+  }
+  return Status::OK();
+}
+
+Status ExecutionTree::RestoreEpochState(const nlohmann::json &states) {
+  CHECK_FAIL_RETURN_UNEXPECTED(tree_state_ == kDeTStatePrepared, "The state can only be restored before launch.");
+  std::map<std::string, int32_t> ranks;
+  int32_t num_restored = 0;
+  for (auto itr = this->begin(); itr != this->end(); ++itr) {
+    std::string key = itr->Name() + "#" + std::to_string(ranks[itr->Name()]++);
+    auto state = states.find(key);
+    if (state != states.end()) {
+      RETURN_IF_NOT_OK(itr->RestoreEpochState(*state));
+      num_restored++;
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(num_restored == states.size(),
+                               "The state does not match the pipeline, " + std::to_string(states.size()) +
+                                 " operators have a state but only " + std::to_string(num_restored) + " were found.");
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -28,6 +28,7 @@
 #endif
 #endif
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
+#include "minddata/dataset/util/size_class_pool.h"
 #include "minddata/dataset/util/status.h"
 #ifndef ENABLE_SECURITY
 #include "mindspore/ccsrc/minddata/dataset/engine/perf/profiling.h"
@@ -181,6 +182,17 @@ class ExecutionTree {
   /// \return Status The status code returned
   Status Prepare();
 
+  /// \brief Collect the states the operators recorded at the start of an epoch, to resume the pipeline from it
+  /// \param[in] epoch The epoch, counted from the start of this tree
+  /// \param[out] states The states of the operators which keep one
+  /// \return Status The status code returned
+  Status GetEpochState(int32_t epoch, nlohmann::json *states);
+
+  /// \brief Restore the states returned by GetEpochState into the operators, before the tree is launched
+  /// \param[in] states The states of the operators
+  /// \return Status The status code returned
+  Status RestoreEpochState(const nlohmann::json &states);
+
   /// \brief Return the pointer to the TaskGroup
   /// \return raw pointer to the TaskGroup
   TaskGroup *const AllTasks() const { return tg_.get(); }
@@ -213,6 +225,10 @@ class ExecutionTree {
   /// \return unique ID as a string
   std::string GetUniqueId() { return unique_id_; }
 
+  /// \brief Get the memory pool for the data of the tensors created by the tasks of the tree
+  /// \return The pool, nullptr if the tree uses the global memory pool
+  std::shared_ptr<SizeClassPool> TensorMemPool() const { return tensor_mem_pool_; }
+
  private:
   /// \brief A helper functions for doing the recursive printing
   /// \param dataset_op - The dataset op to print
@@ -222,12 +238,22 @@ class ExecutionTree {
   void PrintNode(std::ostream &out, const std::shared_ptr<DatasetOp> &dataset_op, std::string indent, bool last,
                  bool detailed) const;
 
+  /// \brief Assign the operators to the NUMA nodes of the host following the numa_policy of the config, the threads
+  ///     of an operator bind themselves to its node when they start
+  /// \return Status The status code returned
+  Status AssignNumaNodes();
+
+  /// \brief Find the NUMA node of the device the tree feeds
+  /// \return The node, NumaPlacement::kNoNode if the tree feeds no device or the node is unknown
+  int32_t GetDeviceNumaNode() const;
+
   std::unique_ptr<TaskGroup> tg_;    // Class for worker management
   std::shared_ptr<DatasetOp> root_;  // The root node of the tree
   int32_t id_count_;                 // Counter for generating operator id's
   uint32_t prepare_flags_;           // Flags used during tree prepare
   TreeState tree_state_;             // Tracking the current tree state
   std::string unique_id_;            // A unique identifier for the tree
+  std::shared_ptr<SizeClassPool> tensor_mem_pool_;  // Pool for tensor data, nullptr if the global pool is used
 
 #if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
   // This rank_id is for numa and device_queue, one process work with only one rank_id,
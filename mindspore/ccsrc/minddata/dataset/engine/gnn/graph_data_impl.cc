@@ -16,6 +16,8 @@
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -24,6 +26,7 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/gnn/graph_loader.h"
 #include "minddata/dataset/util/random.h"
+#include "minddata/dataset/util/task_manager.h"
 namespace mindspore {
 namespace dataset {
 namespace gnn {
@@ -118,15 +121,10 @@ Status GraphDataImpl::GetNodesFromEdges(const std::vector<EdgeIdType> &edge_list
   std::vector<std::vector<NodeIdType>> node_list;
   node_list.reserve(edge_list.size());
   for (const auto &edge_id : edge_list) {
-    auto itr = edge_id_map_.find(edge_id);
-    if (itr == edge_id_map_.end()) {
-      std::string err_msg = "Invalid edge id:" + std::to_string(edge_id);
-      RETURN_STATUS_UNEXPECTED(err_msg);
-    } else {
-      std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> nodes;
-      RETURN_IF_NOT_OK(itr->second->GetNode(&nodes));
-      node_list.push_back({nodes.first->id(), nodes.second->id()});
-    }
+    int64_t pos = 0;
+    RETURN_IF_NOT_OK(GetEdgePosition(edge_id, &pos));
+    node_list.push_back({graph_storage_->node_id(graph_storage_->EdgeSource(pos)),
+                         graph_storage_->node_id(graph_storage_->EdgeTarget(pos))});
   }
   RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>(node_list, DataType(DataType::DE_INT32), out));
   return Status::OK();
@@ -143,11 +141,22 @@ Status GraphDataImpl::GetEdgesFromNodes(const std::vector<std::pair<NodeIdType,
   edge_list.reserve(node_list.size());
 
   for (const auto &node_id : node_list) {
-    std::shared_ptr<Node> src_node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_id.first, &src_node));
-
-    EdgeIdType edge_id;
-    src_node->GetEdgeByAdjNodeId(node_id.second, &edge_id);
+    int64_t src_index = 0;
+    RETURN_IF_NOT_OK(GetNodeIndex(node_id.first, &src_index));
+
+    // The first edge to the node, as loaded
+    EdgeIdType edge_id = -1;
+    auto row = graph_storage_->Row(src_index);
+    for (int64_t pos = row.first; pos < row.second; ++pos) {
+      if (graph_storage_->node_id(graph_storage_->EdgeTarget(pos)) == node_id.second) {
+        edge_id = graph_storage_->edge_id(pos);
+        break;
+      }
+    }
+    if (edge_id == -1) {
+      MS_LOG(WARNING) << "Number " << node_id.second << " node is not adjacent to number " << node_id.first
+                      << " node.";
+    }
 
     std::vector<EdgeIdType> connection_edge = {edge_id};
     edge_list.emplace_back(std::move(connection_edge));
@@ -172,16 +181,14 @@ Status GraphDataImpl::GetAllNeighbors(const std::vector<NodeIdType> &node_list,
   // Collect information of adjacent table
   neighbors.resize(node_list.size());
   for (size_t i = 0; i < node_list.size(); ++i) {
-    std::shared_ptr<Node> node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[i], &node));
     if (format == OutputFormat::kNormal) {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i]));
+      RETURN_IF_NOT_OK(GetNeighbors(node_list[i], neighbor_type, &neighbors[i]));
       max_neighbor_num = max_neighbor_num > neighbors[i].size() ? max_neighbor_num : neighbors[i].size();
     } else if (format == OutputFormat::kCoo) {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i], true));
+      RETURN_IF_NOT_OK(GetNeighbors(node_list[i], neighbor_type, &neighbors[i], true));
       total_edge_num += neighbors[i].size();
     } else {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i], true));
+      RETURN_IF_NOT_OK(GetNeighbors(node_list[i], neighbor_type, &neighbors[i], true));
       total_edge_num += neighbors[i].size();
       if (i < node_list.size() - 1) {
         offset_table[i + 1] = total_edge_num;
@@ -225,9 +232,7 @@ Status GraphDataImpl::GetAllNeighbors(const std::vector<NodeIdType> &node_list,
 }
 
 Status GraphDataImpl::CheckSamplesNum(NodeIdType samples_num) {
-  NodeIdType all_nodes_number =
-    std::accumulate(node_type_map_.begin(), node_type_map_.end(), 0,
-                    [](NodeIdType t1, const auto &t2) -> NodeIdType { return t1 + t2.second.size(); });
+  auto all_nodes_number = static_cast<NodeIdType>(graph_storage_->num_nodes());
   if ((samples_num < 1) || (samples_num > all_nodes_number)) {
     std::string err_msg = "Wrong samples number, should be between 1 and " + std::to_string(all_nodes_number) +
                           ", got " + std::to_string(samples_num);
@@ -258,36 +263,108 @@ Status GraphDataImpl::GetSampledNeighbors(const std::vector<NodeIdType> &node_li
     RETURN_IF_NOT_OK(CheckNeighborType(type));
   }
   RETURN_UNEXPECTED_IF_NULL(out);
-  std::vector<std::vector<NodeIdType>> neighbors_vec(node_list.size());
+  std::vector<int64_t> input_indices(node_list.size());
   for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
-    std::shared_ptr<Node> input_node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &input_node));
-    neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
-    std::vector<NodeIdType> input_list = {node_list[node_idx]};
-    for (size_t i = 0; i < neighbor_nums.size(); ++i) {
-      std::vector<NodeIdType> neighbors;
-      neighbors.reserve(input_list.size() * neighbor_nums[i]);
-      for (const auto &node_id : input_list) {
-        if (node_id == kDefaultNodeId) {
-          for (int32_t j = 0; j < neighbor_nums[i]; ++j) {
-            neighbors.emplace_back(kDefaultNodeId);
+    RETURN_IF_NOT_OK(GetNodeIndex(node_list[node_idx], &input_indices[node_idx]));
+  }
+  std::vector<std::vector<NodeIdType>> neighbors_vec(node_list.size());
+  auto sample_block = [&](size_t begin, size_t end, std::mt19937 *rnd) -> Status {
+    for (size_t node_idx = begin; node_idx < end; ++node_idx) {
+      neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
+      // The nodes of a hop are kept by index, -1 for kDefaultNodeId
+      std::vector<int64_t> input_list = {input_indices[node_idx]};
+      for (size_t i = 0; i < neighbor_nums.size(); ++i) {
+        std::vector<int64_t> neighbors;
+        neighbors.reserve(input_list.size() * neighbor_nums[i]);
+        for (const auto &index : input_list) {
+          if (index < 0) {
+            neighbors.insert(neighbors.end(), static_cast<size_t>(neighbor_nums[i]), int64_t(-1));
+          } else {
+            RETURN_IF_NOT_OK(SampleNeighbors(index, neighbor_types[i], neighbor_nums[i], strategy, rnd, &neighbors));
           }
-        } else {
-          std::shared_ptr<Node> node;
-          RETURN_IF_NOT_OK(GetNodeByNodeId(node_id, &node));
-          std::vector<NodeIdType> out;
-          RETURN_IF_NOT_OK(node->GetSampledNeighbors(neighbor_types[i], neighbor_nums[i], strategy, &out));
-          neighbors.insert(neighbors.end(), out.begin(), out.end());
         }
+        (void)std::transform(
+          neighbors.begin(), neighbors.end(), std::back_inserter(neighbors_vec[node_idx]),
+          [this](int64_t index) { return index < 0 ? kDefaultNodeId : graph_storage_->node_id(index); });
+        input_list = std::move(neighbors);
       }
-      neighbors_vec[node_idx].insert(neighbors_vec[node_idx].end(), neighbors.begin(), neighbors.end());
-      input_list = std::move(neighbors);
     }
-  }
+    return Status::OK();
+  };
+  RETURN_IF_NOT_OK(ParallelForBlocks(node_list.size(), num_workers_, sample_block));
   RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>(neighbors_vec, DataType(DataType::DE_INT32), out));
   return Status::OK();
 }
 
+Status GraphDataImpl::SampleNeighbors(int64_t index, NodeType neighbor_type, int32_t samples_num,
+                                      SamplingStrategy strategy, std::mt19937 *rnd,
+                                      std::vector<int64_t> *out_neighbors) {
+  RETURN_UNEXPECTED_IF_NULL(rnd);
+  RETURN_UNEXPECTED_IF_NULL(out_neighbors);
+  auto range = graph_storage_->Neighbors(index, neighbor_type);
+  int64_t num_neighbors = range.second - range.first;
+  if (num_neighbors == 0) {
+    MS_LOG(DEBUG) << "There are no neighbors. node_id:" << graph_storage_->node_id(index)
+                  << " neighbor_type:" << neighbor_type;
+    // If there are no neighbors, they are filled with kDefaultNodeId
+    out_neighbors->insert(out_neighbors->end(), static_cast<size_t>(samples_num), int64_t(-1));
+    return Status::OK();
+  }
+  if (strategy == SamplingStrategy::kRandom) {
+    // Draw the neighbors without replacement, and draw them again while more samples are needed
+    std::vector<int64_t> positions(num_neighbors);
+    std::iota(positions.begin(), positions.end(), range.first);
+    int64_t remaining = samples_num;
+    while (remaining > 0) {
+      int64_t num = std::min(remaining, num_neighbors);
+      for (int64_t i = 0; i < num; ++i) {
+        std::uniform_int_distribution<int64_t> dist(i, num_neighbors - 1);
+        std::swap(positions[i], positions[dist(*rnd)]);
+        out_neighbors->push_back(graph_storage_->EdgeTarget(positions[i]));
+      }
+      remaining -= num;
+    }
+  } else if (strategy == SamplingStrategy::kEdgeWeight) {
+    const auto &weights = graph_storage_->edge_weights();
+    std::discrete_distribution<int64_t> discrete_dist(weights.begin() + range.first, weights.begin() + range.second);
+    for (int32_t i = 0; i < samples_num; ++i) {
+      out_neighbors->push_back(graph_storage_->EdgeTarget(range.first + discrete_dist(*rnd)));
+    }
+  } else {
+    RETURN_STATUS_UNEXPECTED("Invalid strategy");
+  }
+  return Status::OK();
+}
+
+Status GraphDataImpl::ParallelForBlocks(size_t num_items, int32_t num_workers,
+                                        const std::function<Status(size_t, size_t, std::mt19937 *)> &func) {
+  const uint32_t seed = rnd_();
+  const size_t num_blocks = (num_items + kSamplingBlockSize - 1) / kSamplingBlockSize;
+  std::atomic<size_t> next_block(0);
+  auto worker = [&]() -> Status {
+    for (size_t block = next_block++; block < num_blocks; block = next_block++) {
+      std::seed_seq seed_seq{seed, static_cast<uint32_t>(block)};
+      std::mt19937 rnd(seed_seq);
+      size_t begin = block * kSamplingBlockSize;
+      RETURN_IF_NOT_OK(func(begin, std::min(begin + kSamplingBlockSize, num_items), &rnd));
+    }
+    return Status::OK();
+  };
+  size_t num_threads = std::min(static_cast<size_t>(std::max(num_workers, 1)), num_blocks);
+  if (num_threads <= 1) {
+    return worker();
+  }
+  TaskGroup vg;
+  for (size_t i = 0; i < num_threads; ++i) {
+    RETURN_IF_NOT_OK(vg.CreateAsyncTask("GraphSampler", [&worker]() {
+      TaskManager::FindMe()->Post();
+      return worker();
+    }));
+  }
+  RETURN_IF_NOT_OK(vg.join_all(Task::WaitFlag::kBlocking));
+  return vg.GetTaskErrorIfAny();
+}
+
 Status GraphDataImpl::NegativeSample(const std::vector<NodeIdType> &data, const std::vector<NodeIdType> shuffled_ids,
                                      size_t *start_index, const std::unordered_set<NodeIdType> &exclude_data,
                                      int32_t samples_num, std::vector<NodeIdType> *out_samples) {
@@ -326,15 +403,13 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
   std::vector<std::vector<NodeIdType>> neg_neighbors_vec;
   neg_neighbors_vec.resize(node_list.size());
   for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
-    std::shared_ptr<Node> node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &node));
     std::vector<NodeIdType> neighbors;
-    RETURN_IF_NOT_OK(node->GetAllNeighbors(neg_neighbor_type, &neighbors));
+    RETURN_IF_NOT_OK(GetNeighbors(node_list[node_idx], neg_neighbor_type, &neighbors));
     std::unordered_set<NodeIdType> exclude_nodes;
     (void)std::transform(neighbors.begin(), neighbors.end(),
                          std::insert_iterator<std::unordered_set<NodeIdType>>(exclude_nodes, exclude_nodes.begin()),
                          [](const NodeIdType node) { return node; });
-    neg_neighbors_vec[node_idx].emplace_back(node->id());
+    neg_neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
     if (all_nodes.size() > exclude_nodes.size()) {
       while (neg_neighbors_vec[node_idx].size() < samples_num + 1) {
         RETURN_IF_NOT_OK(NegativeSample(all_nodes, shuffled_id, &start_index, exclude_nodes, samples_num + 1,
@@ -345,7 +420,7 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
         }
       }
     } else {
-      MS_LOG(DEBUG) << "There are no negative neighbors. node_id:" << node->id()
+      MS_LOG(DEBUG) << "There are no negative neighbors. node_id:" << node_list[node_idx]
                     << " neg_neighbor_type:" << neg_neighbor_type;
       // If there are no negative neighbors, they are filled with kDefaultNodeId
       for (int32_t i = 0; i < samples_num; ++i) {
@@ -366,7 +441,8 @@ Status GraphDataImpl::RandomWalk(const std::vector<NodeIdType> &node_list, const
                                  float step_home_param, float step_away_param, NodeIdType default_node,
                                  std::shared_ptr<Tensor> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
-  RETURN_IF_NOT_OK(random_walk_.Build(node_list, meta_path, step_home_param, step_away_param, default_node));
+  RETURN_IF_NOT_OK(
+    random_walk_.Build(node_list, meta_path, step_home_param, step_away_param, default_node, 1, num_workers_));
   std::vector<std::vector<NodeIdType>> walks;
   RETURN_IF_NOT_OK(random_walk_.SimulateWalk(&walks));
   RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>({walks}, DataType(DataType::DE_INT32), out));
@@ -404,6 +480,16 @@ Status GraphDataImpl::GetNodeFeature(const std::shared_ptr<Tensor> &nodes,
   }
   CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Input feature_types is empty");
   RETURN_UNEXPECTED_IF_NULL(out);
+  // The nodes which can't be found get the default value
+  std::vector<int64_t> slots;
+  slots.reserve(nodes->Size());
+  for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
+    int64_t index = -1;
+    if (*node_itr == kDefaultNodeId || !graph_storage_->FindNode(*node_itr, &index)) {
+      index = -1;
+    }
+    slots.push_back(index);
+  }
   TensorRow tensors;
   for (const auto &f_type : feature_types) {
     std::shared_ptr<Feature> default_feature;
@@ -416,22 +502,7 @@ Status GraphDataImpl::GetNodeFeature(const std::shared_ptr<Tensor> &nodes,
     shape = shape.PrependDim(size);
     std::shared_ptr<Tensor> fea_tensor;
     RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, default_feature->Value()->type(), &fea_tensor));
-
-    dsize_t index = 0;
-    for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
-      std::shared_ptr<Feature> feature;
-      if (*node_itr == kDefaultNodeId) {
-        feature = default_feature;
-      } else {
-        std::shared_ptr<Node> node;
-
-        if (!GetNodeByNodeId(*node_itr, &node).IsOk() || !node->GetFeatures(f_type, &feature).IsOk()) {
-          feature = default_feature;
-        }
-      }
-      RETURN_IF_NOT_OK(fea_tensor->InsertTensor({index}, feature->Value()));
-      index++;
-    }
+    RETURN_IF_NOT_OK(CopyFeatures(graph_storage_->NodeFeatures(f_type), slots, default_feature->Value(), fea_tensor));
 
     TensorShape reshape(nodes->shape());
     for (auto s : default_feature->Value()->shape().AsVector()) {
@@ -451,35 +522,19 @@ Status GraphDataImpl::GetNodeFeatureSharedMemory(const std::shared_ptr<Tensor> &
     RETURN_STATUS_UNEXPECTED("Input nodes is empty");
   }
   RETURN_UNEXPECTED_IF_NULL(out);
-  TensorShape shape = nodes->shape().AppendDim(2);
-  std::shared_ptr<Tensor> fea_tensor;
-  RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, DataType(DataType::DE_INT64), &fea_tensor));
-
-  auto out_fea_itr = fea_tensor->begin<int64_t>();
+  std::vector<int64_t> slots;
+  slots.reserve(nodes->Size());
   for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
-    if (*node_itr == kDefaultNodeId) {
-      *out_fea_itr = -1;
-      ++out_fea_itr;
-      *out_fea_itr = -1;
-      ++out_fea_itr;
-    } else {
-      std::shared_ptr<Node> node;
-      RETURN_IF_NOT_OK(GetNodeByNodeId(*node_itr, &node));
-      std::shared_ptr<Feature> feature;
-      if (!node->GetFeatures(type, &feature).IsOk()) {
-        *out_fea_itr = -1;
-        ++out_fea_itr;
-        *out_fea_itr = -1;
-        ++out_fea_itr;
-      } else {
-        for (auto fea_itr = feature->Value()->begin<int64_t>(); fea_itr != feature->Value()->end<int64_t>();
-             ++fea_itr) {
-          *out_fea_itr = *fea_itr;
-          ++out_fea_itr;
-        }
-      }
+    int64_t index = -1;
+    if (*node_itr != kDefaultNodeId) {
+      RETURN_IF_NOT_OK(GetNodeIndex(*node_itr, &index));
     }
+    slots.push_back(index);
   }
+  TensorShape shape = nodes->shape().AppendDim(2);
+  std::shared_ptr<Tensor> fea_tensor;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, DataType(DataType::DE_INT64), &fea_tensor));
+  RETURN_IF_NOT_OK(CopyFeatureAddresses(graph_storage_->NodeFeatures(type), slots, fea_tensor));
 
   fea_tensor->Squeeze();
 
@@ -494,6 +549,16 @@ Status GraphDataImpl::GetEdgeFeature(const std::shared_ptr<Tensor> &edges,
   }
   CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Input feature_types is empty");
   RETURN_UNEXPECTED_IF_NULL(out);
+  // The edges which can't be found get the default value
+  std::vector<int64_t> slots;
+  slots.reserve(edges->Size());
+  for (auto edge_itr = edges->begin<EdgeIdType>(); edge_itr != edges->end<EdgeIdType>(); ++edge_itr) {
+    int64_t pos = -1;
+    if (!graph_storage_->FindEdge(*edge_itr, &pos)) {
+      pos = -1;
+    }
+    slots.push_back(pos);
+  }
   TensorRow tensors;
   for (const auto &f_type : feature_types) {
     std::shared_ptr<Feature> default_feature;
@@ -506,18 +571,7 @@ Status GraphDataImpl::GetEdgeFeature(const std::shared_ptr<Tensor> &edges,
     shape = shape.PrependDim(size);
     std::shared_ptr<Tensor> fea_tensor;
     RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, default_feature->Value()->type(), &fea_tensor));
-
-    dsize_t index = 0;
-    for (auto edge_itr = edges->begin<EdgeIdType>(); edge_itr != edges->end<EdgeIdType>(); ++edge_itr) {
-      std::shared_ptr<Edge> edge;
-      std::shared_ptr<Feature> feature;
-
-      if (!GetEdgeByEdgeId(*edge_itr, &edge).IsOk() || !edge->GetFeatures(f_type, &feature).IsOk()) {
-        feature = default_feature;
-      }
-      RETURN_IF_NOT_OK(fea_tensor->InsertTensor({index}, feature->Value()));
-      index++;
-    }
+    RETURN_IF_NOT_OK(CopyFeatures(graph_storage_->EdgeFeatures(f_type), slots, default_feature->Value(), fea_tensor));
 
     TensorShape reshape(edges->shape());
     for (auto s : default_feature->Value()->shape().AsVector()) {
@@ -537,27 +591,17 @@ Status GraphDataImpl::GetEdgeFeatureSharedMemory(const std::shared_ptr<Tensor> &
     RETURN_STATUS_UNEXPECTED("Input edges is empty");
   }
   RETURN_UNEXPECTED_IF_NULL(out);
+  std::vector<int64_t> slots;
+  slots.reserve(edges->Size());
+  for (auto edge_itr = edges->begin<EdgeIdType>(); edge_itr != edges->end<EdgeIdType>(); ++edge_itr) {
+    int64_t pos = -1;
+    RETURN_IF_NOT_OK(GetEdgePosition(*edge_itr, &pos));
+    slots.push_back(pos);
+  }
   TensorShape shape = edges->shape().AppendDim(2);
   std::shared_ptr<Tensor> fea_tensor;
   RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, DataType(DataType::DE_INT64), &fea_tensor));
-
-  auto out_fea_itr = fea_tensor->begin<int64_t>();
-  for (auto edge_itr = edges->begin<EdgeIdType>(); edge_itr != edges->end<EdgeIdType>(); ++edge_itr) {
-    std::shared_ptr<Edge> edge;
-    RETURN_IF_NOT_OK(GetEdgeByEdgeId(*edge_itr, &edge));
-    std::shared_ptr<Feature> feature;
-    if (!edge->GetFeatures(type, &feature).IsOk()) {
-      *out_fea_itr = -1;
-      ++out_fea_itr;
-      *out_fea_itr = -1;
-      ++out_fea_itr;
-    } else {
-      for (auto fea_itr = feature->Value()->begin<int64_t>(); fea_itr != feature->Value()->end<int64_t>(); ++fea_itr) {
-        *out_fea_itr = *fea_itr;
-        ++out_fea_itr;
-      }
-    }
-  }
+  RETURN_IF_NOT_OK(CopyFeatureAddresses(graph_storage_->EdgeFeatures(type), slots, fea_tensor));
 
   fea_tensor->Squeeze();
 
@@ -565,11 +609,68 @@ Status GraphDataImpl::GetEdgeFeatureSharedMemory(const std::shared_ptr<Tensor> &
   return Status::OK();
 }
 
+Status GraphDataImpl::CopyFeatures(const GraphStorage::FeatureArray *array, const std::vector<int64_t> &slots,
+                                   const std::shared_ptr<Tensor> &default_value, const std::shared_ptr<Tensor> &out) {
+  auto value_size = default_value->SizeInBytes();
+  if (value_size == 0) {
+    return Status::OK();
+  }
+  uchar *dst = nullptr;
+  TensorShape remaining({-1});
+  RETURN_IF_NOT_OK(out->StartAddrOfIndex({0}, &dst, &remaining));
+  for (auto slot : slots) {
+    const uchar *src = default_value->GetBuffer();
+    if (array != nullptr && slot >= 0 && array->offsets[slot + 1] > array->offsets[slot]) {
+      CHECK_FAIL_RETURN_UNEXPECTED(array->offsets[slot + 1] - array->offsets[slot] == value_size &&
+                                     array->data_type == default_value->type(),
+                                   "Invalid data, the value of feature type " + std::to_string(array->type) +
+                                     " does not match the type and shape of its default value.");
+      src = array->data.begin() + array->offsets[slot];
+    }
+    (void)std::memcpy(dst, src, value_size);
+    dst += value_size;
+  }
+  return Status::OK();
+}
+
+Status GraphDataImpl::CopyFeatureAddresses(const GraphStorage::FeatureArray *array, const std::vector<int64_t> &slots,
+                                           const std::shared_ptr<Tensor> &out) {
+  const int64_t kNoValue[] = {-1, -1};
+  const dsize_t kAddressSize = sizeof(kNoValue);
+  auto out_fea_itr = out->begin<int64_t>();
+  for (auto slot : slots) {
+    const int64_t *address = kNoValue;
+    if (array != nullptr && slot >= 0 && array->offsets[slot + 1] > array->offsets[slot]) {
+      CHECK_FAIL_RETURN_UNEXPECTED(array->offsets[slot + 1] - array->offsets[slot] == kAddressSize,
+                                   "Invalid data, the feature type " + std::to_string(array->type) +
+                                     " is not in shared memory.");
+      address = reinterpret_cast<const int64_t *>(array->data.begin() + array->offsets[slot]);
+    }
+    *out_fea_itr = address[0];
+    ++out_fea_itr;
+    *out_fea_itr = address[1];
+    ++out_fea_itr;
+  }
+  return Status::OK();
+}
+
 Status GraphDataImpl::Init() {
-  RETURN_IF_NOT_OK(LoadNodeAndEdge());
+  if (GraphStorage::IsGraphFile(dataset_file_)) {
+    RETURN_IF_NOT_OK(LoadGraphFile());
+  } else {
+    RETURN_IF_NOT_OK(LoadNodeAndEdge());
+  }
+  InitTypeMaps();
   return Status::OK();
 }
 
+Status GraphDataImpl::SaveGraph(const std::string &file) {
+  CHECK_FAIL_RETURN_UNEXPECTED(graph_storage_ != nullptr, "The graph is not loaded yet.");
+  // The features of a graph server loaded from mindrecord only hold their place in shared memory
+  CHECK_FAIL_RETURN_UNEXPECTED(!server_mode_, "Saving the graph is not supported in server mode.");
+  return graph_storage_->Save(file);
+}
+
 Status GraphDataImpl::GetMetaInfo(MetaInfo *meta_info) {
   RETURN_UNEXPECTED_IF_NULL(meta_info);
   meta_info->node_type.resize(node_type_map_.size());
@@ -634,26 +735,100 @@ Status GraphDataImpl::LoadNodeAndEdge() {
   return Status::OK();
 }
 
-Status GraphDataImpl::GetNodeByNodeId(NodeIdType id, std::shared_ptr<Node> *node) {
-  RETURN_UNEXPECTED_IF_NULL(node);
-  auto itr = node_id_map_.find(id);
-  if (itr == node_id_map_.end()) {
+Status GraphDataImpl::LoadGraphFile() {
+  graph_storage_ = std::make_unique<GraphStorage>();
+  RETURN_IF_NOT_OK(graph_storage_->Load(dataset_file_));
+  try {
+    data_schema_ = mindrecord::json::parse(graph_storage_->data_schema());
+  } catch (const std::exception &e) {
+    RETURN_STATUS_UNEXPECTED("Invalid data, failed to parse the schema of graph file: " + dataset_file_ + ", " +
+                             e.what());
+  }
+  RETURN_IF_NOT_OK(InitFeatureMaps());
+  if (server_mode_) {
+#if !defined(_WIN32) && !defined(_WIN64)
+    // The clients read the features from shared memory
+    graph_shared_memory_ =
+      std::make_unique<GraphSharedMemory>(std::max<int64_t>(graph_storage_->FeatureDataSize(), 1), dataset_file_);
+    RETURN_IF_NOT_OK(graph_shared_memory_->CreateSharedMemory());
+    RETURN_IF_NOT_OK(graph_storage_->MoveFeaturesToSharedMemory(graph_shared_memory_.get()));
+#endif
+  }
+  MS_LOG(INFO) << "Load graph from file: " << dataset_file_ << ", node num: " << graph_storage_->num_nodes()
+               << ", edge num: " << graph_storage_->num_edges();
+  return Status::OK();
+}
+
+void GraphDataImpl::InitTypeMaps() {
+  node_type_map_.clear();
+  edge_type_map_.clear();
+  for (int64_t i = 0; i < graph_storage_->num_nodes(); ++i) {
+    node_type_map_[graph_storage_->node_type(i)].push_back(graph_storage_->node_id(i));
+  }
+  for (auto pos : graph_storage_->edge_order()) {
+    edge_type_map_[graph_storage_->edge_type(pos)].push_back(graph_storage_->edge_id(pos));
+  }
+  for (auto &itr : node_type_map_) itr.second.shrink_to_fit();
+  for (auto &itr : edge_type_map_) itr.second.shrink_to_fit();
+}
+
+Status GraphDataImpl::InitFeatureMaps() {
+  for (const auto &array : graph_storage_->node_features()) {
+    std::shared_ptr<Tensor> zero_tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(array.shape, array.data_type, &zero_tensor));
+    RETURN_IF_NOT_OK(zero_tensor->Zero());
+    default_node_feature_map_[array.type] = std::make_shared<Feature>(array.type, zero_tensor);
+    for (int64_t i = 0; i < graph_storage_->num_nodes(); ++i) {
+      if (array.offsets[i + 1] > array.offsets[i]) {
+        node_feature_map_[graph_storage_->node_type(i)].insert(array.type);
+      }
+    }
+  }
+  for (const auto &array : graph_storage_->edge_features()) {
+    std::shared_ptr<Tensor> zero_tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(array.shape, array.data_type, &zero_tensor));
+    RETURN_IF_NOT_OK(zero_tensor->Zero());
+    default_edge_feature_map_[array.type] = std::make_shared<Feature>(array.type, zero_tensor);
+    for (int64_t pos = 0; pos < graph_storage_->num_edges(); ++pos) {
+      if (array.offsets[pos + 1] > array.offsets[pos]) {
+        edge_feature_map_[graph_storage_->edge_type(pos)].insert(array.type);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status GraphDataImpl::GetNodeIndex(NodeIdType id, int64_t *index) {
+  RETURN_UNEXPECTED_IF_NULL(index);
+  if (!graph_storage_->FindNode(id, index)) {
     std::string err_msg = "Invalid node id:" + std::to_string(id);
     RETURN_STATUS_UNEXPECTED(err_msg);
-  } else {
-    *node = itr->second;
   }
   return Status::OK();
 }
 
-Status GraphDataImpl::GetEdgeByEdgeId(EdgeIdType id, std::shared_ptr<Edge> *edge) {
-  RETURN_UNEXPECTED_IF_NULL(edge);
-  auto itr = edge_id_map_.find(id);
-  if (itr == edge_id_map_.end()) {
+Status GraphDataImpl::GetEdgePosition(EdgeIdType id, int64_t *pos) {
+  RETURN_UNEXPECTED_IF_NULL(pos);
+  if (!graph_storage_->FindEdge(id, pos)) {
     std::string err_msg = "Invalid edge id:" + std::to_string(id);
     RETURN_STATUS_UNEXPECTED(err_msg);
-  } else {
-    *edge = itr->second;
+  }
+  return Status::OK();
+}
+
+Status GraphDataImpl::GetNeighbors(NodeIdType id, NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                                   bool exclude_itself) {
+  RETURN_UNEXPECTED_IF_NULL(out_neighbors);
+  int64_t index = 0;
+  RETURN_IF_NOT_OK(GetNodeIndex(id, &index));
+  auto range = graph_storage_->Neighbors(index, neighbor_type);
+  out_neighbors->clear();
+  out_neighbors->reserve(range.second - range.first + 1);
+  if (!exclude_itself) {
+    out_neighbors->push_back(id);
+  }
+  for (int64_t pos = range.first; pos < range.second; ++pos) {
+    out_neighbors->push_back(graph_storage_->node_id(graph_storage_->EdgeTarget(pos)));
   }
   return Status::OK();
 }
@@ -702,7 +877,9 @@ Status GraphDataImpl::RandomWalkBase::Build(const std::vector<NodeIdType> &node_
   return Status::OK();
 }
 
-Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node, std::vector<NodeIdType> *walk_path) {
+Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node, std::mt19937 *rnd,
+                                                   std::vector<NodeIdType> *walk_path) {
+  RETURN_UNEXPECTED_IF_NULL(rnd);
   RETURN_UNEXPECTED_IF_NULL(walk_path);
   // Simulate a random walk starting from start node.
   auto walk = std::vector<NodeIdType>(1, start_node);  // walk is an vector
@@ -710,12 +887,10 @@ Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node,
   while (walk.size() - 1 < meta_path_.size()) {
     // current nodE
     auto cur_node_id = walk.back();
-    std::shared_ptr<Node> cur_node;
-    RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(cur_node_id, &cur_node));
 
     // current neighbors
     std::vector<NodeIdType> cur_neighbors;
-    RETURN_IF_NOT_OK(cur_node->GetAllNeighbors(meta_path_[walk.size() - 1], &cur_neighbors, true));
+    RETURN_IF_NOT_OK(graph_->GetNeighbors(cur_node_id, meta_path_[walk.size() - 1], &cur_neighbors, true));
     std::sort(cur_neighbors.begin(), cur_neighbors.end());
 
     // break if no neighbors
@@ -726,12 +901,12 @@ Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node,
     // walk by the fist node, then by the previous 2 nodes
     std::shared_ptr<StochasticIndex> stochastic_index;
     if (walk.size() == 1) {
-      RETURN_IF_NOT_OK(GetNodeProbability(cur_node_id, meta_path_[0], &stochastic_index));
+      RETURN_IF_NOT_OK(GetNodeProbability(cur_node_id, meta_path_[0], rnd, &stochastic_index));
     } else {
       NodeIdType prev_node_id = walk[walk.size() - 2];
-      RETURN_IF_NOT_OK(GetEdgeProbability(prev_node_id, cur_node_id, walk.size() - 2, &stochastic_index));
+      RETURN_IF_NOT_OK(GetEdgeProbability(prev_node_id, cur_node_id, walk.size() - 2, rnd, &stochastic_index));
     }
-    NodeIdType next_node_id = cur_neighbors[WalkToNextNode(*stochastic_index)];
+    NodeIdType next_node_id = cur_neighbors[WalkToNextNode(*stochastic_index, rnd)];
     walk.push_back(next_node_id);
   }
 
@@ -745,48 +920,46 @@ Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node,
 
 Status GraphDataImpl::RandomWalkBase::SimulateWalk(std::vector<std::vector<NodeIdType>> *walks) {
   RETURN_UNEXPECTED_IF_NULL(walks);
-  for (int32_t i = 0; i < num_walks_; ++i) {
-    for (const auto &node : node_list_) {
-      std::vector<NodeIdType> walk;
-      RETURN_IF_NOT_OK(Node2vecWalk(node, &walk));
-      walks->push_back(walk);
+  // The walks are laid out walk by walk, each one over all the nodes of the list
+  const size_t num_nodes = node_list_.size();
+  walks->assign(num_nodes * num_walks_, {});
+  auto walk_block = [this, walks, num_nodes](size_t begin, size_t end, std::mt19937 *rnd) -> Status {
+    for (size_t i = begin; i < end; ++i) {
+      RETURN_IF_NOT_OK(Node2vecWalk(node_list_[i % num_nodes], rnd, &(*walks)[i]));
     }
-  }
-  return Status::OK();
+    return Status::OK();
+  };
+  return graph_->ParallelForBlocks(walks->size(), num_workers_, walk_block);
 }
 
 Status GraphDataImpl::RandomWalkBase::GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type,
+                                                         std::mt19937 *rnd,
                                                          std::shared_ptr<StochasticIndex> *node_probability) {
   RETURN_UNEXPECTED_IF_NULL(node_probability);
   // Generate alias nodes
-  std::shared_ptr<Node> node;
-  RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(node_id, &node));
   std::vector<NodeIdType> neighbors;
-  RETURN_IF_NOT_OK(node->GetAllNeighbors(node_type, &neighbors, true));
+  RETURN_IF_NOT_OK(graph_->GetNeighbors(node_id, node_type, &neighbors, true));
   std::sort(neighbors.begin(), neighbors.end());
   auto non_normalized_probability = std::vector<float>(neighbors.size(), 1.0);
   *node_probability =
-    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability)));
+    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability), rnd));
   return Status::OK();
 }
 
 Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src, const NodeIdType &dst,
-                                                         uint32_t meta_path_index,
+                                                         uint32_t meta_path_index, std::mt19937 *rnd,
                                                          std::shared_ptr<StochasticIndex> *edge_probability) {
   RETURN_UNEXPECTED_IF_NULL(edge_probability);
   // Get the alias edge setup lists for a given edge.
-  std::shared_ptr<Node> src_node;
-  RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(src, &src_node));
   std::vector<NodeIdType> src_neighbors;
-  RETURN_IF_NOT_OK(src_node->GetAllNeighbors(meta_path_[meta_path_index], &src_neighbors, true));
+  RETURN_IF_NOT_OK(graph_->GetNeighbors(src, meta_path_[meta_path_index], &src_neighbors, true));
 
-  std::shared_ptr<Node> dst_node;
-  RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(dst, &dst_node));
   std::vector<NodeIdType> dst_neighbors;
-  RETURN_IF_NOT_OK(dst_node->GetAllNeighbors(meta_path_[meta_path_index + 1], &dst_neighbors, true));
+  RETURN_IF_NOT_OK(graph_->GetNeighbors(dst, meta_path_[meta_path_index + 1], &dst_neighbors, true));
 
   CHECK_FAIL_RETURN_UNEXPECTED(step_home_param_ != 0, "Invalid data, step home parameter can't be zero.");
   CHECK_FAIL_RETURN_UNEXPECTED(step_away_param_ != 0, "Invalid data, step away parameter can't be zero.");
+  std::sort(src_neighbors.begin(), src_neighbors.end());
   std::sort(dst_neighbors.begin(), dst_neighbors.end());
   std::vector<float> non_normalized_probability;
   for (const auto &dst_nbr : dst_neighbors) {
@@ -794,8 +967,7 @@ Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src,
       non_normalized_probability.push_back(1.0 / step_home_param_);  // replace 1.0 with G[dst][dst_nbr]['weight']
       continue;
     }
-    auto it = std::find(src_neighbors.begin(), src_neighbors.end(), dst_nbr);
-    if (it != src_neighbors.end()) {
+    if (std::binary_search(src_neighbors.begin(), src_neighbors.end(), dst_nbr)) {
       // stay close, this node connect both src and dst
       non_normalized_probability.push_back(1.0);  // replace 1.0 with G[dst][dst_nbr]['weight']
     } else {
@@ -805,21 +977,21 @@ Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src,
   }
 
   *edge_probability =
-    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability)));
+    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability), rnd));
   return Status::OK();
 }
 
-StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::vector<float> &probability) {
+StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::vector<float> &probability,
+                                                                   std::mt19937 *rnd) {
   uint32_t K = probability.size();
   std::vector<int32_t> switch_to_large_index(K, 0);
   std::vector<float> weight(K, .0);
   std::vector<int32_t> smaller;
   std::vector<int32_t> larger;
-  auto random_device = GetRandomDevice();
   std::uniform_real_distribution<> distribution(-kGnnEpsilon, kGnnEpsilon);
   float accumulate_threshold = 0.0;
   for (uint32_t i = 0; i < K; i++) {
-    float threshold_one = distribution(random_device);
+    float threshold_one = distribution(*rnd);
     accumulate_threshold += threshold_one;
     weight[i] = i < K - 1 ? probability[i] * K + threshold_one : probability[i] * K - accumulate_threshold;
     weight[i] < 1.0 ? smaller.push_back(i) : larger.push_back(i);
@@ -837,18 +1009,17 @@ StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::ve
   return StochasticIndex(switch_to_large_index, weight);
 }
 
-uint32_t GraphDataImpl::RandomWalkBase::WalkToNextNode(const StochasticIndex &stochastic_index) {
-  auto switch_to_large_index = stochastic_index.first;
-  auto weight = stochastic_index.second;
+uint32_t GraphDataImpl::RandomWalkBase::WalkToNextNode(const StochasticIndex &stochastic_index, std::mt19937 *rnd) {
+  const auto &switch_to_large_index = stochastic_index.first;
+  const auto &weight = stochastic_index.second;
   const uint32_t size_of_index = switch_to_large_index.size();
 
-  auto random_device = GetRandomDevice();
   std::uniform_real_distribution<> distribution(0.0, 1.0);
 
   // Generate random integer between [0, K)
-  uint32_t random_idx = std::floor(distribution(random_device) * size_of_index);
+  uint32_t random_idx = std::floor(distribution(*rnd) * size_of_index);
 
-  if (distribution(random_device) < weight[random_idx]) {
+  if (distribution(*rnd) < weight[random_idx]) {
     return random_idx;
   }
   return switch_to_large_index[random_idx];
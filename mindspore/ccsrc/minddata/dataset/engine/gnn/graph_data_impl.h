@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_DATA_IMPL_H_
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <map>
@@ -26,6 +27,7 @@
 #include <utility>
 
 #include "minddata/dataset/engine/gnn/graph_data.h"
+#include "minddata/dataset/engine/gnn/graph_storage.h"
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/graph_shared_memory.h"
 #endif
@@ -37,12 +39,14 @@ namespace gnn {
 
 const float kGnnEpsilon = 0.0001;
 const uint32_t kMaxNumWalks = 80;
+// The number of nodes or walks sampled with one random number generator
+const size_t kSamplingBlockSize = 64;
 using StochasticIndex = std::pair<std::vector<int32_t>, std::vector<float>>;
 
 class GraphDataImpl : public GraphData {
  public:
   // Constructor
-  // @param std::string dataset_file -
+  // @param std::string dataset_file - A mindrecord file of the graph, or a graph file written by SaveGraph
   // @param int32_t num_workers - number of parallel threads
   GraphDataImpl(const std::string &dataset_file, int32_t num_workers, bool server_mode = false);
 
@@ -164,6 +168,11 @@ class GraphDataImpl : public GraphData {
 
   std::string GetDataSchema() { return data_schema_.dump(); }
 
+  // Save the storage of the graph to a file, which can then be given as dataset file to load the graph from
+  // @param std::string file - The file to write
+  // @return Status The status code returned
+  Status SaveGraph(const std::string &file);
+
 #if !defined(_WIN32) && !defined(_WIN64)
   key_t GetSharedMemoryKey() { return graph_shared_memory_->memory_key(); }
 
@@ -185,17 +194,17 @@ class GraphDataImpl : public GraphData {
     Status SimulateWalk(std::vector<std::vector<NodeIdType>> *walks);
 
    private:
-    Status Node2vecWalk(const NodeIdType &start_node, std::vector<NodeIdType> *walk_path);
+    Status Node2vecWalk(const NodeIdType &start_node, std::mt19937 *rnd, std::vector<NodeIdType> *walk_path);
 
-    Status GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type,
+    Status GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type, std::mt19937 *rnd,
                               std::shared_ptr<StochasticIndex> *node_probability);
 
     Status GetEdgeProbability(const NodeIdType &src, const NodeIdType &dst, uint32_t meta_path_index,
-                              std::shared_ptr<StochasticIndex> *edge_probability);
+                              std::mt19937 *rnd, std::shared_ptr<StochasticIndex> *edge_probability);
 
-    static StochasticIndex GenerateProbability(const std::vector<float> &probability);
+    static StochasticIndex GenerateProbability(const std::vector<float> &probability, std::mt19937 *rnd);
 
-    static uint32_t WalkToNextNode(const StochasticIndex &stochastic_index);
+    static uint32_t WalkToNextNode(const StochasticIndex &stochastic_index, std::mt19937 *rnd);
 
     template <typename T>
     std::vector<float> Normalize(const std::vector<T> &non_normalized_probability);
@@ -215,6 +224,17 @@ class GraphDataImpl : public GraphData {
   // @return Status The status code returned
   Status LoadNodeAndEdge();
 
+  // Map a graph file written by SaveGraph
+  // @return Status The status code returned
+  Status LoadGraphFile();
+
+  // Build the lists of nodes and edges of each type from the storage
+  void InitTypeMaps();
+
+  // Build the feature types and default features from the storage
+  // @return Status The status code returned
+  Status InitFeatureMaps();
+
   // Create Tensor By Vector
   // @param std::vector<std::vector<T>> &data -
   // @param DataType type -
@@ -243,17 +263,65 @@ class GraphDataImpl : public GraphData {
   // @return Status The status code returned
   Status GetEdgeDefaultFeature(FeatureType feature_type, std::shared_ptr<Feature> *out_feature);
 
-  // Find node object using node id
+  // Find the index of a node in the storage
   // @param NodeIdType id -
-  // @param std::shared_ptr<Node> *node - Returned node object
+  // @param int64_t *index - Returned node index
   // @return Status The status code returned
-  Status GetNodeByNodeId(NodeIdType id, std::shared_ptr<Node> *node);
+  Status GetNodeIndex(NodeIdType id, int64_t *index);
 
-  // Find edge object using edge id
+  // Find the position of an edge in the storage
   // @param EdgeIdType id -
-  // @param std::shared_ptr<Node> *edge - Returned edge object
+  // @param int64_t *pos - Returned edge position
   // @return Status The status code returned
-  Status GetEdgeByEdgeId(EdgeIdType id, std::shared_ptr<Edge> *edge);
+  Status GetEdgePosition(EdgeIdType id, int64_t *pos);
+
+  // Get the neighbors of a type of a node
+  // @param NodeIdType id - The node
+  // @param NodeType neighbor_type - The type of neighbor
+  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id, after the node itself unless excluded
+  // @param bool exclude_itself -
+  // @return Status The status code returned
+  Status GetNeighbors(NodeIdType id, NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                      bool exclude_itself = false);
+
+  // Sample the neighbors of a type of a node
+  // @param int64_t index - The index of the node
+  // @param NodeType neighbor_type - The type of neighbor
+  // @param int32_t samples_num - Number of neighbors to be acquired
+  // @param SamplingStrategy strategy - Sampling strategy
+  // @param std::mt19937 *rnd - The random number generator to sample with
+  // @param std::vector<int64_t> *out_neighbors - The indices of the sampled neighbors are appended, -1 if the node
+  //     has no neighbors
+  // @return Status The status code returned
+  Status SampleNeighbors(int64_t index, NodeType neighbor_type, int32_t samples_num, SamplingStrategy strategy,
+                         std::mt19937 *rnd, std::vector<int64_t> *out_neighbors);
+
+  // Run a function over the items [0, num_items), split in blocks of kSamplingBlockSize items, on up to num_workers
+  // threads. Each block has its own random number generator, seeded from rnd_ and the index of the block, so that
+  // for a given seed the results do not depend on the number of threads.
+  // @param size_t num_items - The number of items
+  // @param int32_t num_workers - The maximum number of threads
+  // @param std::function func - Called with the first and past the last item of a block, and its generator
+  // @return Status The status code returned
+  Status ParallelForBlocks(size_t num_items, int32_t num_workers,
+                           const std::function<Status(size_t, size_t, std::mt19937 *)> &func);
+
+  // Copy a feature of nodes or edges into a tensor
+  // @param GraphStorage::FeatureArray *array - The values of the feature, nullptr if there is none
+  // @param std::vector<int64_t> slots - The index of each node or position of each edge, -1 for the default value
+  // @param std::shared_ptr<Tensor> default_value - The value used for the nodes or edges without the feature
+  // @param std::shared_ptr<Tensor> out - The tensor to fill, of one value per slot
+  // @return Status The status code returned
+  Status CopyFeatures(const GraphStorage::FeatureArray *array, const std::vector<int64_t> &slots,
+                      const std::shared_ptr<Tensor> &default_value, const std::shared_ptr<Tensor> &out);
+
+  // Copy the offsets and sizes in shared memory of a feature of nodes or edges into a tensor
+  // @param GraphStorage::FeatureArray *array - The values of the feature, nullptr if there is none
+  // @param std::vector<int64_t> slots - The index of each node or position of each edge, -1 for no value
+  // @param std::shared_ptr<Tensor> out - The tensor to fill, of two int64 per slot
+  // @return Status The status code returned
+  Status CopyFeatureAddresses(const GraphStorage::FeatureArray *array, const std::vector<int64_t> &slots,
+                              const std::shared_ptr<Tensor> &out);
 
   // Negative sampling
   // @param std::vector<NodeIdType> &input_data - The data set to be sampled
@@ -278,11 +346,9 @@ class GraphDataImpl : public GraphData {
 #if !defined(_WIN32) && !defined(_WIN64)
   std::unique_ptr<GraphSharedMemory> graph_shared_memory_;
 #endif
+  std::unique_ptr<GraphStorage> graph_storage_;
   std::unordered_map<NodeType, std::vector<NodeIdType>> node_type_map_;
-  std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;
-
   std::unordered_map<EdgeType, std::vector<EdgeIdType>> edge_type_map_;
-  std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;
 
   std::unordered_map<NodeType, std::unordered_set<FeatureType>> node_feature_map_;
   std::unordered_map<EdgeType, std::unordered_set<FeatureType>> edge_feature_map_;
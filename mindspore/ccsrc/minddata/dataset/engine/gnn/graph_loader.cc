@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
+#include "minddata/dataset/engine/gnn/graph_storage.h"
 #include "minddata/dataset/engine/gnn/local_edge.h"
 #include "minddata/dataset/engine/gnn/local_node.h"
 #include "minddata/dataset/util/task_manager.h"
@@ -44,41 +45,26 @@ GraphLoader::GraphLoader(GraphDataImpl *graph_impl, std::string mr_filepath, int
       optional_key_({{"weight", false}}) {}
 
 Status GraphLoader::GetNodesAndEdges() {
-  NodeIdMap *n_id_map = &graph_impl_->node_id_map_;
-  EdgeIdMap *e_id_map = &graph_impl_->edge_id_map_;
+  std::vector<std::shared_ptr<Node>> nodes;
   for (std::deque<std::shared_ptr<Node>> &dq : n_deques_) {
-    while (dq.empty() == false) {
-      std::shared_ptr<Node> node_ptr = dq.front();
-      n_id_map->insert({node_ptr->id(), node_ptr});
-      graph_impl_->node_type_map_[node_ptr->type()].push_back(node_ptr->id());
-      dq.pop_front();
-    }
+    nodes.insert(nodes.end(), dq.begin(), dq.end());
+    dq.clear();
   }
-
+  std::vector<std::shared_ptr<Edge>> edges;
   for (std::deque<std::shared_ptr<Edge>> &dq : e_deques_) {
-    while (dq.empty() == false) {
-      std::shared_ptr<Edge> edge_ptr = dq.front();
-      std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> p;
-      RETURN_IF_NOT_OK(edge_ptr->GetNode(&p));
-      auto src_itr = n_id_map->find(p.first->id()), dst_itr = n_id_map->find(p.second->id());
-
-      CHECK_FAIL_RETURN_UNEXPECTED(src_itr != n_id_map->end(), "invalid src_id.");
-      CHECK_FAIL_RETURN_UNEXPECTED(dst_itr != n_id_map->end(), "invalid src_id.");
-
-      RETURN_IF_NOT_OK(edge_ptr->SetNode({src_itr->second, dst_itr->second}));
-      RETURN_IF_NOT_OK(src_itr->second->AddNeighbor(dst_itr->second, edge_ptr->weight()));
-      RETURN_IF_NOT_OK(src_itr->second->AddAdjacent(dst_itr->second, edge_ptr));
-
-      e_id_map->insert({edge_ptr->id(), edge_ptr});  // add edge to edge_id_map_
-      graph_impl_->edge_type_map_[edge_ptr->type()].push_back(edge_ptr->id());
-      dq.pop_front();
-    }
+    edges.insert(edges.end(), dq.begin(), dq.end());
+    dq.clear();
   }
 
-  for (auto &itr : graph_impl_->node_type_map_) itr.second.shrink_to_fit();
-  for (auto &itr : graph_impl_->edge_type_map_) itr.second.shrink_to_fit();
-
   MergeFeatureMaps();
+  std::unordered_set<FeatureType> node_features, edge_features;
+  for (const auto &itr : graph_impl_->node_feature_map_) node_features.insert(itr.second.begin(), itr.second.end());
+  for (const auto &itr : graph_impl_->edge_feature_map_) edge_features.insert(itr.second.begin(), itr.second.end());
+
+  // The nodes and edges are released once they are copied into the storage
+  graph_impl_->graph_storage_ = std::make_unique<GraphStorage>();
+  RETURN_IF_NOT_OK(graph_impl_->graph_storage_->Build(&nodes, &edges, node_features, edge_features,
+                                                      graph_impl_->data_schema_.dump()));
   return Status::OK();
 }
 
@@ -41,10 +41,6 @@ namespace dataset {
 namespace gnn {
 
 using mindrecord::ShardReader;
-using NodeIdMap = std::unordered_map<NodeIdType, std::shared_ptr<Node>>;
-using EdgeIdMap = std::unordered_map<EdgeIdType, std::shared_ptr<Edge>>;
-using NodeTypeMap = std::unordered_map<NodeType, std::vector<NodeIdType>>;
-using EdgeTypeMap = std::unordered_map<EdgeType, std::vector<EdgeIdType>>;
 using NodeFeatureMap = std::unordered_map<NodeType, std::unordered_set<FeatureType>>;
 using EdgeFeatureMap = std::unordered_map<EdgeType, std::unordered_set<FeatureType>>;
 using DefaultNodeFeatureMap = std::unordered_map<FeatureType, std::shared_ptr<Feature>>;
@@ -63,8 +59,8 @@ class GraphLoader {
   // @return Status - the status code
   Status InitAndLoad();
 
-  // this function will query mindrecord and construct all nodes and edges
-  // nodes and edges are added to map without any connection. That's because there nodes and edges are read in
+  // this function will build the storage of the graph from all the nodes and edges which were loaded
+  // nodes and edges are loaded without any connection. That's because there nodes and edges are read in
   // random order. src_node and dst_node in Edge are node_id only with -1 as type.
   // features attached to each node and edge are expected to be filled correctly
   Status GetNodesAndEdges();
@@ -0,0 +1,559 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/gnn/graph_storage.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+constexpr char kGraphMagic[8] = {'M', 'S', 'G', 'N', 'N', 'C', 'S', 'R'};
+constexpr uint32_t kGraphVersion = 2;
+// Written in the byte order of the machine which saved the file, the arrays are mapped as is
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr int64_t kImageAlignment = 8;
+constexpr int32_t kMaxFeatureRank = 8;
+constexpr int32_t kDataTypeNameSize = 16;
+constexpr int32_t kNumNodeTypes = 256;
+
+struct ImageHeader {
+  char magic[sizeof(kGraphMagic)];
+  uint32_t version;
+  uint32_t num_node_features;
+  uint32_t num_edge_features;
+  uint32_t byte_order;
+  int64_t num_nodes;
+  int64_t num_edges;
+  int64_t schema_size;
+};
+
+struct FeatureHeader {
+  int32_t type;
+  int32_t rank;
+  char data_type[kDataTypeNameSize];
+  int64_t shape[kMaxFeatureRank];
+  int64_t data_size;
+};
+
+// The layout of the values of one feature type in the image
+struct FeatureLayout {
+  FeatureHeader header;
+  std::vector<int64_t> offsets;
+  int64_t data_start = 0;  // The offset of the values in the image
+};
+
+int64_t AlignUp(int64_t size) { return (size + kImageAlignment - 1) / kImageAlignment * kImageAlignment; }
+
+// Append an array to the image, padded to keep the next one aligned
+template <typename T>
+void Append(const T *data, int64_t count, std::vector<uint8_t> *image) {
+  auto bytes = static_cast<int64_t>(sizeof(T)) * count;
+  auto start = image->size();
+  image->resize(start + AlignUp(bytes), 0);
+  if (bytes > 0) {
+    (void)std::memcpy(image->data() + start, data, bytes);
+  }
+}
+
+// Reads the arrays of an image in the order they were appended
+class ImageReader {
+ public:
+  ImageReader(const uint8_t *image, int64_t size) : image_(image), size_(size), cursor_(0) {}
+
+  template <typename T>
+  Status Read(int64_t count, GraphStorage::Array<T> *out) {
+    auto bytes = static_cast<int64_t>(sizeof(T)) * count;
+    CHECK_FAIL_RETURN_UNEXPECTED(count >= 0 && bytes <= size_ - cursor_,
+                                 "Invalid data, the graph file is truncated at offset " + std::to_string(cursor_));
+    *out = GraphStorage::Array<T>(reinterpret_cast<const T *>(image_ + cursor_), count);
+    cursor_ = std::min(size_, cursor_ + AlignUp(bytes));
+    return Status::OK();
+  }
+
+ private:
+  const uint8_t *image_;
+  int64_t size_;
+  int64_t cursor_;
+};
+
+// Binary search of the position of an id in a permutation sorted by id
+template <typename IdType>
+bool FindSorted(const GraphStorage::Array<int32_t> &sorted, const GraphStorage::Array<IdType> &ids, IdType id,
+                int64_t *out) {
+  auto itr = std::lower_bound(sorted.begin(), sorted.end(), id, [&ids](int32_t i, IdType v) { return ids[i] < v; });
+  if (itr == sorted.end() || ids[*itr] != id) {
+    return false;
+  }
+  *out = *itr;
+  return true;
+}
+
+// Whether every index of an array is in [0, bound)
+bool InRange(const GraphStorage::Array<int32_t> &array, int64_t bound) {
+  return std::all_of(array.begin(), array.end(), [bound](int32_t i) { return i >= 0 && i < bound; });
+}
+
+// Whether the ids are strictly increasing in the order of a permutation whose indices are in range
+template <typename IdType>
+bool SortedById(const GraphStorage::Array<int32_t> &sorted, const GraphStorage::Array<IdType> &ids) {
+  return std::adjacent_find(sorted.begin(), sorted.end(),
+                            [&ids](int32_t a, int32_t b) { return ids[a] >= ids[b]; }) == sorted.end();
+}
+
+// Compute the offsets and the header of the values of a feature type
+// @param int64_t num_slots - The number of nodes or edges
+// @param FeatureType type - The feature type
+// @param GetFeature get_feature - Returns the feature of a slot, nullptr if it has none
+// @param FeatureLayout *layout - The layout, whose values are not placed in the image yet
+// @return Status The status code returned
+template <typename GetFeature>
+Status LayOutFeatures(int64_t num_slots, FeatureType type, const GetFeature &get_feature, FeatureLayout *layout) {
+  FeatureHeader &header = layout->header;
+  header = FeatureHeader{};
+  header.type = type;
+  std::vector<int64_t> &offsets = layout->offsets;
+  offsets.assign(num_slots + 1, 0);
+  std::shared_ptr<Tensor> first;
+  for (int64_t i = 0; i < num_slots; ++i) {
+    auto feature = get_feature(i);
+    int64_t size = 0;
+    if (feature != nullptr) {
+      const auto &value = feature->Value();
+      if (first == nullptr) {
+        first = value;
+      }
+      CHECK_FAIL_RETURN_UNEXPECTED(value->type() == first->type() && value->type().IsNumeric(),
+                                   "Invalid data, the values of feature type " + std::to_string(type) +
+                                     " must be of the same numeric type, got " + value->type().ToString() + " and " +
+                                     first->type().ToString());
+      size = value->SizeInBytes();
+    }
+    offsets[i + 1] = offsets[i] + size;
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(first != nullptr, "Invalid data, no value of feature type " + std::to_string(type));
+  auto type_name = first->type().ToString();
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<int32_t>(type_name.size()) < kDataTypeNameSize &&
+                                 static_cast<int32_t>(first->shape().Rank()) <= kMaxFeatureRank,
+                               "Invalid data, unsupported value of feature type " + std::to_string(type));
+  (void)std::memcpy(header.data_type, type_name.data(), type_name.size());
+  header.rank = static_cast<int32_t>(first->shape().Rank());
+  for (int32_t d = 0; d < header.rank; ++d) {
+    header.shape[d] = first->shape()[d];
+  }
+  header.data_size = offsets[num_slots];
+  return Status::OK();
+}
+
+// The size in bytes of the values of a feature type in the image, with their header and offsets
+int64_t ImageSize(const FeatureLayout &layout) {
+  return AlignUp(sizeof(FeatureHeader)) + AlignUp(static_cast<int64_t>(layout.offsets.size() * sizeof(int64_t))) +
+         AlignUp(layout.header.data_size);
+}
+}  // namespace
+
+Status GraphStorage::Build(std::vector<std::shared_ptr<Node>> *node_list, std::vector<std::shared_ptr<Edge>> *edge_list,
+                           const std::unordered_set<FeatureType> &node_features,
+                           const std::unordered_set<FeatureType> &edge_features, const std::string &data_schema) {
+  RETURN_UNEXPECTED_IF_NULL(node_list);
+  RETURN_UNEXPECTED_IF_NULL(edge_list);
+  auto &nodes = *node_list;
+  auto &edges = *edge_list;
+  CHECK_FAIL_RETURN_UNEXPECTED(nodes.size() < static_cast<size_t>(std::numeric_limits<int32_t>::max()) &&
+                                 edges.size() < static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                               "Invalid data, the graph has too many nodes or edges.");
+  auto num_nodes = static_cast<int64_t>(nodes.size());
+  auto num_edges = static_cast<int64_t>(edges.size());
+  std::vector<NodeIdType> node_ids(num_nodes);
+  std::vector<NodeType> node_types(num_nodes);
+  for (int64_t i = 0; i < num_nodes; ++i) {
+    node_ids[i] = nodes[i]->id();
+    node_types[i] = nodes[i]->type();
+  }
+  std::vector<int32_t> node_by_id(num_nodes);
+  std::iota(node_by_id.begin(), node_by_id.end(), 0);
+  std::sort(node_by_id.begin(), node_by_id.end(),
+            [&node_ids](int32_t a, int32_t b) { return node_ids[a] < node_ids[b]; });
+  for (int64_t i = 1; i < num_nodes; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED(node_ids[node_by_id[i]] != node_ids[node_by_id[i - 1]],
+                                 "Invalid data, duplicate node id:" + std::to_string(node_ids[node_by_id[i]]));
+  }
+  Array<NodeIdType> node_id_array(node_ids.data(), num_nodes);
+  Array<int32_t> node_by_id_array(node_by_id.data(), num_nodes);
+
+  // Find the end nodes of the edges, and the number of out edges of each node.
+  std::vector<int32_t> src(num_edges), dst(num_edges);
+  std::vector<int64_t> row_offsets(num_nodes + 1, 0);
+  std::vector<int64_t> type_counts(kNumNodeTypes + 1, 0);
+  for (int64_t k = 0; k < num_edges; ++k) {
+    std::pair<std::shared_ptr<Node>, std::shared_ptr<Node>> p;
+    RETURN_IF_NOT_OK(edges[k]->GetNode(&p));
+    int64_t src_index = 0, dst_index = 0;
+    CHECK_FAIL_RETURN_UNEXPECTED(FindSorted(node_by_id_array, node_id_array, p.first->id(), &src_index),
+                                 "Invalid data, invalid src_id:" + std::to_string(p.first->id()));
+    CHECK_FAIL_RETURN_UNEXPECTED(FindSorted(node_by_id_array, node_id_array, p.second->id(), &dst_index),
+                                 "Invalid data, invalid dst_id:" + std::to_string(p.second->id()));
+    src[k] = static_cast<int32_t>(src_index);
+    dst[k] = static_cast<int32_t>(dst_index);
+    ++row_offsets[src_index + 1];
+    ++type_counts[node_types[dst_index] - std::numeric_limits<NodeType>::min() + 1];
+  }
+  std::partial_sum(row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+  std::partial_sum(type_counts.begin(), type_counts.end(), type_counts.begin());
+
+  // Two stable counting sorts order the edges by source node, then by type of destination node, then as loaded.
+  std::vector<int32_t> by_type(num_edges);
+  for (int64_t k = 0; k < num_edges; ++k) {
+    by_type[type_counts[node_types[dst[k]] - std::numeric_limits<NodeType>::min()]++] = static_cast<int32_t>(k);
+  }
+  std::vector<int32_t> edge_order(num_edges), edge_at(num_edges);
+  std::vector<int64_t> cursor(row_offsets.begin(), row_offsets.end() - 1);
+  for (auto k : by_type) {
+    auto pos = cursor[src[k]]++;
+    edge_order[k] = static_cast<int32_t>(pos);
+    edge_at[pos] = k;
+  }
+  by_type.clear();
+  by_type.shrink_to_fit();
+
+  std::vector<int32_t> neighbors(num_edges);
+  std::vector<EdgeIdType> edge_ids(num_edges);
+  std::vector<EdgeType> edge_types(num_edges);
+  std::vector<WeightType> edge_weights(num_edges);
+  for (int64_t pos = 0; pos < num_edges; ++pos) {
+    const auto &edge = edges[edge_at[pos]];
+    neighbors[pos] = dst[edge_at[pos]];
+    edge_ids[pos] = edge->id();
+    edge_types[pos] = edge->type();
+    edge_weights[pos] = edge->weight();
+  }
+  std::vector<int32_t> edge_by_id(num_edges);
+  std::iota(edge_by_id.begin(), edge_by_id.end(), 0);
+  std::sort(edge_by_id.begin(), edge_by_id.end(),
+            [&edge_ids](int32_t a, int32_t b) { return edge_ids[a] < edge_ids[b]; });
+  for (int64_t i = 1; i < num_edges; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED(edge_ids[edge_by_id[i]] != edge_ids[edge_by_id[i - 1]],
+                                 "Invalid data, duplicate edge id:" + std::to_string(edge_ids[edge_by_id[i]]));
+  }
+
+  // The feature types are saved sorted, so that the same graph always makes the same file.
+  std::vector<FeatureType> node_feature_types(node_features.begin(), node_features.end());
+  std::vector<FeatureType> edge_feature_types(edge_features.begin(), edge_features.end());
+  std::sort(node_feature_types.begin(), node_feature_types.end());
+  std::sort(edge_feature_types.begin(), edge_feature_types.end());
+
+  auto node_feature = [&nodes](int64_t i, FeatureType type) {
+    std::shared_ptr<Feature> feature;
+    return nodes[i]->GetFeatures(type, &feature).IsOk() ? feature : nullptr;
+  };
+  auto edge_feature = [&edges, &edge_at](int64_t pos, FeatureType type) {
+    std::shared_ptr<Feature> feature;
+    return edges[edge_at[pos]]->GetFeatures(type, &feature).IsOk() ? feature : nullptr;
+  };
+  std::vector<FeatureLayout> node_layouts(node_feature_types.size()), edge_layouts(edge_feature_types.size());
+  for (size_t f = 0; f < node_feature_types.size(); ++f) {
+    auto type = node_feature_types[f];
+    RETURN_IF_NOT_OK(LayOutFeatures(
+      num_nodes, type, [&node_feature, type](int64_t i) { return node_feature(i, type); }, &node_layouts[f]));
+  }
+  for (size_t f = 0; f < edge_feature_types.size(); ++f) {
+    auto type = edge_feature_types[f];
+    RETURN_IF_NOT_OK(LayOutFeatures(
+      num_edges, type, [&edge_feature, type](int64_t pos) { return edge_feature(pos, type); }, &edge_layouts[f]));
+  }
+
+  ImageHeader header{};
+  (void)std::memcpy(header.magic, kGraphMagic, sizeof(kGraphMagic));
+  header.version = kGraphVersion;
+  header.byte_order = kByteOrderMark;
+  header.num_node_features = static_cast<uint32_t>(node_feature_types.size());
+  header.num_edge_features = static_cast<uint32_t>(edge_feature_types.size());
+  header.num_nodes = num_nodes;
+  header.num_edges = num_edges;
+  header.schema_size = static_cast<int64_t>(data_schema.size());
+  // The image is sized once, rather than grown while the values are copied.
+  int64_t image_size = AlignUp(sizeof(ImageHeader)) + AlignUp(header.schema_size);
+  for (int64_t bytes : {sizeof(NodeIdType), sizeof(NodeType), sizeof(int32_t)}) {
+    image_size += AlignUp(num_nodes * bytes);
+  }
+  image_size += AlignUp((num_nodes + 1) * static_cast<int64_t>(sizeof(int64_t)));
+  for (int64_t bytes : {sizeof(int32_t), sizeof(EdgeIdType), sizeof(EdgeType), sizeof(WeightType), sizeof(int32_t),
+                        sizeof(int32_t)}) {
+    image_size += AlignUp(num_edges * bytes);
+  }
+  for (const auto &layouts : {&node_layouts, &edge_layouts}) {
+    for (const auto &layout : *layouts) {
+      image_size += ImageSize(layout);
+    }
+  }
+  image_.clear();
+  image_.reserve(image_size);
+  Append(&header, 1, &image_);
+  Append(data_schema.data(), header.schema_size, &image_);
+  Append(node_ids.data(), num_nodes, &image_);
+  Append(node_types.data(), num_nodes, &image_);
+  Append(node_by_id.data(), num_nodes, &image_);
+  Append(row_offsets.data(), num_nodes + 1, &image_);
+  Append(neighbors.data(), num_edges, &image_);
+  Append(edge_ids.data(), num_edges, &image_);
+  Append(edge_types.data(), num_edges, &image_);
+  Append(edge_weights.data(), num_edges, &image_);
+  Append(edge_by_id.data(), num_edges, &image_);
+  Append(edge_order.data(), num_edges, &image_);
+  for (auto layouts : {&node_layouts, &edge_layouts}) {
+    for (auto &layout : *layouts) {
+      Append(&layout.header, 1, &image_);
+      Append(layout.offsets.data(), static_cast<int64_t>(layout.offsets.size()), &image_);
+      layout.data_start = static_cast<int64_t>(image_.size());
+      image_.resize(image_.size() + AlignUp(layout.header.data_size), 0);
+    }
+  }
+
+  // The values are copied node by node and edge by edge, so that each one is released once its values are in the
+  // image, instead of keeping every node and edge alive until the whole image is built.
+  auto copy_values = [this](const std::vector<FeatureType> &types, const std::vector<FeatureLayout> &layouts,
+                            int64_t slot, const auto &get_feature) {
+    for (size_t f = 0; f < types.size(); ++f) {
+      const auto &offsets = layouts[f].offsets;
+      if (offsets[slot + 1] > offsets[slot]) {
+        (void)std::memcpy(image_.data() + layouts[f].data_start + offsets[slot],
+                          get_feature(slot, types[f])->Value()->GetBuffer(), offsets[slot + 1] - offsets[slot]);
+      }
+    }
+  };
+  for (int64_t i = 0; i < num_nodes; ++i) {
+    copy_values(node_feature_types, node_layouts, i, node_feature);
+    nodes[i] = nullptr;
+  }
+  for (int64_t pos = 0; pos < num_edges; ++pos) {
+    copy_values(edge_feature_types, edge_layouts, pos, edge_feature);
+    edges[edge_at[pos]] = nullptr;
+  }
+  nodes.clear();
+  edges.clear();
+  image_.shrink_to_fit();
+  mapped_file_ = nullptr;
+  return Attach(image_.data(), static_cast<int64_t>(image_.size()));
+}
+
+Status GraphStorage::Attach(const uint8_t *image, int64_t size) {
+  ImageReader reader(image, size);
+  Array<ImageHeader> header_array;
+  RETURN_IF_NOT_OK(reader.Read(1, &header_array));
+  const ImageHeader &header = header_array[0];
+  CHECK_FAIL_RETURN_UNEXPECTED(std::memcmp(header.magic, kGraphMagic, sizeof(kGraphMagic)) == 0,
+                               "Invalid data, the file is not a graph file.");
+  CHECK_FAIL_RETURN_UNEXPECTED(header.version == kGraphVersion, "Invalid data, unsupported version of graph file: " +
+                                                                  std::to_string(header.version));
+  CHECK_FAIL_RETURN_UNEXPECTED(header.byte_order == kByteOrderMark,
+                               "Invalid data, the graph file was saved on a machine of a different byte order.");
+  CHECK_FAIL_RETURN_UNEXPECTED(header.num_nodes >= 0 && header.num_edges >= 0,
+                               "Invalid data, the graph file is corrupted.");
+  int64_t n = header.num_nodes, m = header.num_edges;
+  Array<char> schema;
+  RETURN_IF_NOT_OK(reader.Read(header.schema_size, &schema));
+  data_schema_.assign(schema.begin(), schema.end());
+  RETURN_IF_NOT_OK(reader.Read(n, &node_ids_));
+  RETURN_IF_NOT_OK(reader.Read(n, &node_types_));
+  RETURN_IF_NOT_OK(reader.Read(n, &node_by_id_));
+  RETURN_IF_NOT_OK(reader.Read(n + 1, &row_offsets_));
+  RETURN_IF_NOT_OK(reader.Read(m, &neighbors_));
+  RETURN_IF_NOT_OK(reader.Read(m, &edge_ids_));
+  RETURN_IF_NOT_OK(reader.Read(m, &edge_types_));
+  RETURN_IF_NOT_OK(reader.Read(m, &edge_weights_));
+  RETURN_IF_NOT_OK(reader.Read(m, &edge_by_id_));
+  RETURN_IF_NOT_OK(reader.Read(m, &edge_order_));
+  // The arrays are only checked once here, so that a corrupted file fails to load rather than reading out of bounds
+  // later on.
+  CHECK_FAIL_RETURN_UNEXPECTED(n < std::numeric_limits<int32_t>::max() && m < std::numeric_limits<int32_t>::max(),
+                               "Invalid data, the graph file is corrupted.");
+  CHECK_FAIL_RETURN_UNEXPECTED(row_offsets_[0] == 0 && row_offsets_[n] == m &&
+                                 std::is_sorted(row_offsets_.begin(), row_offsets_.end()),
+                               "Invalid data, the graph file is corrupted, invalid row offsets.");
+  CHECK_FAIL_RETURN_UNEXPECTED(InRange(neighbors_, n), "Invalid data, the graph file is corrupted, invalid neighbors.");
+  CHECK_FAIL_RETURN_UNEXPECTED(InRange(node_by_id_, n) && SortedById(node_by_id_, node_ids_),
+                               "Invalid data, the graph file is corrupted, invalid node index.");
+  CHECK_FAIL_RETURN_UNEXPECTED(InRange(edge_by_id_, m) && SortedById(edge_by_id_, edge_ids_),
+                               "Invalid data, the graph file is corrupted, invalid edge index.");
+  CHECK_FAIL_RETURN_UNEXPECTED(InRange(edge_order_, m),
+                               "Invalid data, the graph file is corrupted, invalid edge order.");
+
+  auto read_features = [&reader](uint32_t num_features, int64_t num_slots, std::vector<FeatureArray> *out) {
+    out->clear();
+    for (uint32_t f = 0; f < num_features; ++f) {
+      Array<FeatureHeader> feature_header;
+      RETURN_IF_NOT_OK(reader.Read(1, &feature_header));
+      const FeatureHeader &h = feature_header[0];
+      CHECK_FAIL_RETURN_UNEXPECTED(h.rank >= 0 && h.rank <= kMaxFeatureRank && h.data_size >= 0,
+                                   "Invalid data, the graph file is corrupted.");
+      FeatureArray array;
+      array.type = static_cast<FeatureType>(h.type);
+      array.data_type = DataType(std::string(h.data_type, strnlen(h.data_type, kDataTypeNameSize)));
+      array.shape = TensorShape(std::vector<dsize_t>(h.shape, h.shape + h.rank));
+      RETURN_IF_NOT_OK(reader.Read(num_slots + 1, &array.offsets));
+      RETURN_IF_NOT_OK(reader.Read(h.data_size, &array.data));
+      CHECK_FAIL_RETURN_UNEXPECTED(array.offsets[0] == 0 && array.offsets[num_slots] == h.data_size &&
+                                     std::is_sorted(array.offsets.begin(), array.offsets.end()),
+                                   "Invalid data, the graph file is corrupted, invalid offsets of feature type " +
+                                     std::to_string(h.type));
+      out->push_back(std::move(array));
+    }
+    return Status::OK();
+  };
+  RETURN_IF_NOT_OK(read_features(header.num_node_features, n, &node_features_));
+  RETURN_IF_NOT_OK(read_features(header.num_edge_features, m, &edge_features_));
+  owned_.clear();
+  image_base_ = image;
+  image_size_ = size;
+  return Status::OK();
+}
+
+Status GraphStorage::Save(const std::string &file) const {
+  CHECK_FAIL_RETURN_UNEXPECTED(image_base_ != nullptr, "The graph is not loaded yet.");
+  std::ofstream fs(file, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(fs.is_open(), "Failed to open graph file for writing: " + file);
+  (void)fs.write(reinterpret_cast<const char *>(image_base_), image_size_);
+  fs.close();
+  CHECK_FAIL_RETURN_UNEXPECTED(!fs.fail(), "Failed to write graph file: " + file);
+  MS_LOG(INFO) << "Save graph to file: " << file << ", size: " << image_size_;
+  return Status::OK();
+}
+
+Status GraphStorage::Load(const std::string &file) {
+  RETURN_IF_NOT_OK(mindrecord::ShardMappedFile::Map(file, &mapped_file_));
+  if (mapped_file_ != nullptr) {
+    image_.clear();
+    image_.shrink_to_fit();
+    uint8_t *base = nullptr;
+    RETURN_IF_NOT_OK(mapped_file_->GetData(0, mapped_file_->GetSize(), &base));
+    return Attach(base, static_cast<int64_t>(mapped_file_->GetSize()));
+  }
+  // No memory mapped read on this platform, the file is read in.
+  auto realpath = FileUtils::GetRealPath(file.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED(realpath.has_value(), "Invalid file, failed to get the realpath of: " + file);
+  std::ifstream fs(realpath.value(), std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED(fs.is_open(), "Invalid file, failed to open graph file: " + file);
+  auto size = static_cast<int64_t>(fs.tellg());
+  (void)fs.seekg(0, std::ios::beg);
+  image_.resize(size);
+  (void)fs.read(reinterpret_cast<char *>(image_.data()), size);
+  CHECK_FAIL_RETURN_UNEXPECTED(!fs.fail(), "Invalid file, failed to read graph file: " + file);
+  return Attach(image_.data(), size);
+}
+
+bool GraphStorage::IsGraphFile(const std::string &file) {
+  std::ifstream fs(file, std::ios::in | std::ios::binary);
+  char magic[sizeof(kGraphMagic)] = {0};
+  if (!fs.is_open() || !fs.read(magic, sizeof(magic))) {
+    return false;
+  }
+  return std::memcmp(magic, kGraphMagic, sizeof(kGraphMagic)) == 0;
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+int64_t GraphStorage::FeatureDataSize() const {
+  int64_t size = 0;
+  for (const auto &features : {&node_features_, &edge_features_}) {
+    for (const auto &array : *features) {
+      size += array.data.size();
+    }
+  }
+  return size;
+}
+
+Status GraphStorage::MoveFeaturesToSharedMemory(GraphSharedMemory *shared_memory) {
+  RETURN_UNEXPECTED_IF_NULL(shared_memory);
+  const int64_t kPairSize = 2;
+  for (auto features : {&node_features_, &edge_features_}) {
+    for (auto &array : *features) {
+      int64_t base = 0;
+      if (array.data.size() > 0) {
+        RETURN_IF_NOT_OK(shared_memory->InsertData(array.data.begin(), array.data.size(), &base));
+      }
+      int64_t num_slots = array.offsets.size() - 1;
+      std::vector<int64_t> offsets(num_slots + 1, 0);
+      std::vector<int64_t> pairs;
+      for (int64_t i = 0; i < num_slots; ++i) {
+        int64_t size = array.offsets[i + 1] - array.offsets[i];
+        if (size > 0) {
+          pairs.push_back(base + array.offsets[i]);
+          pairs.push_back(size);
+        }
+        offsets[i + 1] = static_cast<int64_t>(pairs.size() * sizeof(int64_t));
+      }
+      owned_.push_back(std::move(offsets));
+      array.offsets = Array<int64_t>(owned_.back().data(), num_slots + 1);
+      owned_.push_back(std::move(pairs));
+      array.data = Array<uint8_t>(reinterpret_cast<const uint8_t *>(owned_.back().data()),
+                                  static_cast<int64_t>(owned_.back().size() * sizeof(int64_t)));
+      array.data_type = DataType(DataType::DE_INT64);
+      array.shape = TensorShape({kPairSize});
+    }
+  }
+  return Status::OK();
+}
+#endif
+
+bool GraphStorage::FindNode(NodeIdType id, int64_t *index) const {
+  return FindSorted(node_by_id_, node_ids_, id, index);
+}
+
+bool GraphStorage::FindEdge(EdgeIdType id, int64_t *pos) const { return FindSorted(edge_by_id_, edge_ids_, id, pos); }
+
+std::pair<int64_t, int64_t> GraphStorage::Neighbors(int64_t index, NodeType neighbor_type) const {
+  // The row is sorted by the type of the destination nodes.
+  auto bound = [this, index](auto before) {
+    int64_t first = row_offsets_[index], count = row_offsets_[index + 1] - first;
+    while (count > 0) {
+      int64_t step = count / 2;
+      if (before(node_types_[neighbors_[first + step]])) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first;
+  };
+  return {bound([neighbor_type](NodeType t) { return t < neighbor_type; }),
+          bound([neighbor_type](NodeType t) { return t <= neighbor_type; })};
+}
+
+int64_t GraphStorage::EdgeSource(int64_t pos) const {
+  auto itr = std::upper_bound(row_offsets_.begin(), row_offsets_.end(), pos);
+  return (itr - row_offsets_.begin()) - 1;
+}
+
+const GraphStorage::FeatureArray *GraphStorage::NodeFeatures(FeatureType type) const {
+  auto itr = std::find_if(node_features_.begin(), node_features_.end(),
+                          [type](const FeatureArray &array) { return array.type == type; });
+  return itr == node_features_.end() ? nullptr : &(*itr);
+}
+
+const GraphStorage::FeatureArray *GraphStorage::EdgeFeatures(FeatureType type) const {
+  auto itr = std::find_if(edge_features_.begin(), edge_features_.end(),
+                          [type](const FeatureArray &array) { return array.type == type; });
+  return itr == edge_features_.end() ? nullptr : &(*itr);
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
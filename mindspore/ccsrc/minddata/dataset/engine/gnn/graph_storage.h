@@ -0,0 +1,190 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_STORAGE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_STORAGE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/core/tensor_shape.h"
+#include "minddata/dataset/engine/gnn/edge.h"
+#include "minddata/dataset/engine/gnn/feature.h"
+#include "minddata/dataset/engine/gnn/node.h"
+#if !defined(_WIN32) && !defined(_WIN64)
+#include "minddata/dataset/engine/gnn/graph_shared_memory.h"
+#endif
+#include "minddata/dataset/util/status.h"
+#include "minddata/mindrecord/include/shard_mapped_file.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+// Compressed sparse row storage of a graph.
+// Nodes are numbered by their position, in the order they were loaded. The out edges of a node make one row of the
+// edge arrays, grouped by the type of their destination node, so that the neighbors of a node of one type are an
+// index range. The features of one type are one contiguous array with a slot per node, or per edge position.
+// All the arrays live in a single image, which can be saved to a file and mapped back into memory as is: loading a
+// graph from that file costs the time to map it, not the time to parse it.
+class GraphStorage {
+ public:
+  // A read only view of one of the arrays of the image
+  template <typename T>
+  class Array {
+   public:
+    Array() : data_(nullptr), size_(0) {}
+    Array(const T *data, int64_t size) : data_(data), size_(size) {}
+    const T &operator[](int64_t i) const { return data_[i]; }
+    const T *begin() const { return data_; }
+    const T *end() const { return data_ + size_; }
+    int64_t size() const { return size_; }
+
+   private:
+    const T *data_;
+    int64_t size_;
+  };
+
+  // The values of one feature type
+  struct FeatureArray {
+    FeatureType type = 0;
+    DataType data_type;
+    TensorShape shape = TensorShape::CreateScalar();  // The shape of one value
+    Array<int64_t> offsets;  // Offsets of the values in data, one more than the slots. An empty value is missing
+    Array<uint8_t> data;
+  };
+
+  GraphStorage() = default;
+
+  ~GraphStorage() = default;
+
+  // Build the storage from the nodes and edges of the loader
+  // @param std::vector<std::shared_ptr<Node>> *nodes - The nodes, in the order they were loaded. Each one is released
+  //     once it is copied into the storage
+  // @param std::vector<std::shared_ptr<Edge>> *edges - The edges, in the order they were loaded, whose end nodes are
+  //     only set by their ids. Each one is released once it is copied into the storage
+  // @param std::unordered_set<FeatureType> node_features - All the feature types of the nodes
+  // @param std::unordered_set<FeatureType> edge_features - All the feature types of the edges
+  // @param std::string data_schema - The schema of the mindrecord file, saved along
+  // @return Status The status code returned
+  Status Build(std::vector<std::shared_ptr<Node>> *nodes, std::vector<std::shared_ptr<Edge>> *edges,
+               const std::unordered_set<FeatureType> &node_features,
+               const std::unordered_set<FeatureType> &edge_features, const std::string &data_schema);
+
+  // Save the image to a file
+  // @param std::string file - The file to write
+  // @return Status The status code returned
+  Status Save(const std::string &file) const;
+
+  // Map a file written by Save
+  // @param std::string file - The file to map
+  // @return Status The status code returned
+  Status Load(const std::string &file);
+
+  // @return Whether the file was written by Save
+  static bool IsGraphFile(const std::string &file);
+
+#if !defined(_WIN32) && !defined(_WIN64)
+  // Copy the features to the shared memory of the graph server, each value is then replaced by its offset and size
+  // in the shared memory
+  // @param GraphSharedMemory *shared_memory - The shared memory, with room for the data of all the features
+  // @return Status The status code returned
+  Status MoveFeaturesToSharedMemory(GraphSharedMemory *shared_memory);
+
+  // @return The size in bytes of the data of all the features
+  int64_t FeatureDataSize() const;
+#endif
+
+  int64_t num_nodes() const { return node_ids_.size(); }
+
+  int64_t num_edges() const { return edge_ids_.size(); }
+
+  // Find the index of a node
+  // @return false if there is no such node
+  bool FindNode(NodeIdType id, int64_t *index) const;
+
+  // Find the position of an edge in the edge arrays
+  // @return false if there is no such edge
+  bool FindEdge(EdgeIdType id, int64_t *pos) const;
+
+  NodeIdType node_id(int64_t index) const { return node_ids_[index]; }
+
+  NodeType node_type(int64_t index) const { return node_types_[index]; }
+
+  // The range of positions of the out edges of a node whose destination is of a type
+  std::pair<int64_t, int64_t> Neighbors(int64_t index, NodeType neighbor_type) const;
+
+  // The range of positions of all the out edges of a node
+  std::pair<int64_t, int64_t> Row(int64_t index) const { return {row_offsets_[index], row_offsets_[index + 1]}; }
+
+  // The index of the source node of the edge at a position
+  int64_t EdgeSource(int64_t pos) const;
+
+  // The index of the destination node of the edge at a position
+  int64_t EdgeTarget(int64_t pos) const { return neighbors_[pos]; }
+
+  EdgeIdType edge_id(int64_t pos) const { return edge_ids_[pos]; }
+
+  EdgeType edge_type(int64_t pos) const { return edge_types_[pos]; }
+
+  const Array<WeightType> &edge_weights() const { return edge_weights_; }
+
+  // The positions of the edges, in the order they were loaded
+  const Array<int32_t> &edge_order() const { return edge_order_; }
+
+  // @return The features of a type, nullptr if no node has any
+  const FeatureArray *NodeFeatures(FeatureType type) const;
+
+  // @return The features of a type, nullptr if no edge has any
+  const FeatureArray *EdgeFeatures(FeatureType type) const;
+
+  const std::vector<FeatureArray> &node_features() const { return node_features_; }
+
+  const std::vector<FeatureArray> &edge_features() const { return edge_features_; }
+
+  const std::string &data_schema() const { return data_schema_; }
+
+ private:
+  // Point the arrays into the image, after checking that the indices and offsets it holds are in range
+  Status Attach(const uint8_t *image, int64_t size);
+
+  std::vector<uint8_t> image_;  // The image when it was built or read rather than mapped
+  std::shared_ptr<mindrecord::ShardMappedFile> mapped_file_;
+  const uint8_t *image_base_ = nullptr;
+  int64_t image_size_ = 0;
+  std::vector<std::vector<int64_t>> owned_;  // Arrays which replace the ones of the image
+
+  Array<NodeIdType> node_ids_;
+  Array<NodeType> node_types_;
+  Array<int32_t> node_by_id_;     // The node indices, sorted by node id
+  Array<int64_t> row_offsets_;    // The start of the row of each node, and the number of edges
+  Array<int32_t> neighbors_;      // The index of the destination node of each edge
+  Array<EdgeIdType> edge_ids_;
+  Array<EdgeType> edge_types_;
+  Array<WeightType> edge_weights_;
+  Array<int32_t> edge_by_id_;  // The edge positions, sorted by edge id
+  Array<int32_t> edge_order_;
+  std::vector<FeatureArray> node_features_;
+  std::vector<FeatureArray> edge_features_;
+  std::string data_schema_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_STORAGE_H_
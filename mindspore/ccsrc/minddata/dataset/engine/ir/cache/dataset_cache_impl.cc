@@ -29,7 +29,7 @@ Status DatasetCacheImpl::Build() {
   if (cache_client_) return Status::OK();
 
   CacheClient::Builder builder;
-  builder.SetSessionId(session_id_).SetCacheMemSz(cache_mem_sz_).SetSpill(spill_);
+  builder.SetSessionId(session_id_).SetCacheMemSz(cache_mem_sz_).SetSpill(spill_).SetCompress(compress_);
   if (hostname_) {
     (void)builder.SetHostname(hostname_.value());
   }
@@ -88,6 +88,7 @@ Status DatasetCacheImpl::to_json(nlohmann::json *out_json) {
   if (port_) args["port"] = port_.value();
   if (num_connections_) args["num_connections"] = num_connections_.value();
   if (prefetch_sz_) args["cache_prefetch_size"] = prefetch_sz_.value();
+  if (compress_) args["compress"] = compress_;
   *out_json = args;
   return Status::OK();
 }
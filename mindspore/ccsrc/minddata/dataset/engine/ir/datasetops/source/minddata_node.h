@@ -93,6 +93,14 @@ class MindDataNode : public MappableSourceNode {
   /// \brief Sampler setter
   void SetSampler(std::shared_ptr<SamplerObj> sampler) override { sampler_ = sampler; }
 
+  /// \brief Getter functions
+  const std::vector<std::string> &ColumnsList() const { return columns_list_; }
+  int64_t NumPadded() const { return num_padded_; }
+
+  /// \brief Set the columns to load, used to push a projection down into the reader
+  /// \param[in] columns_list The columns to load
+  void SetColumnsList(const std::vector<std::string> &columns_list) { columns_list_ = columns_list; }
+
   /// \brief Base-class override for accepting IRNodePass visitor
   /// \param[in] p The node to visit
   /// \param[out] modified Indicator if the node was modified
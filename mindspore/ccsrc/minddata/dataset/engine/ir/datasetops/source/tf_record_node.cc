@@ -44,9 +44,16 @@ std::shared_ptr<DatasetNode> TFRecordNode::Copy() {
   }
   node->SetNumWorkers(num_workers_);
   node->SetConnectorQueueSize(connector_que_size_);
+  node->SetFirstEpochSkip(first_epoch_skip_);
   return node;
 }
 
+bool TFRecordNode::CanSkipRows() const {
+  bool shuffle_records =
+    shuffle_ == ShuffleMode::kGlobal && GlobalContext::config_manager()->enable_tfrecord_record_shuffle();
+  return !IsCached() && (shuffle_ != ShuffleMode::kGlobal || shuffle_records);
+}
+
 void TFRecordNode::Print(std::ostream &out) const {
   out << (Name() + "(num_samples:" + std::to_string(num_samples_) + ",num_shards:" + std::to_string(num_shards_) +
           ",shard_id:" + std::to_string(shard_id_) + ",...)");
@@ -96,19 +103,23 @@ Status TFRecordNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_o
   }
 
   bool shuffle_files = (shuffle_ == ShuffleMode::kGlobal || shuffle_ == ShuffleMode::kFiles);
+  // A global shuffle can permute the blocks of records of the files instead of going through a shuffle buffer.
+  bool shuffle_records =
+    shuffle_ == ShuffleMode::kGlobal && GlobalContext::config_manager()->enable_tfrecord_record_shuffle();
 
   // Create and initialize TFReaderOp
   std::shared_ptr<TFReaderOp> tf_reader_op = std::make_shared<TFReaderOp>(
     num_workers_, worker_connector_size_, num_samples_, sorted_dir_files, std::move(data_schema), connector_que_size_,
-    columns_list_, shuffle_files, num_shards_, shard_id_, shard_equal_rows_);
+    columns_list_, shuffle_files, num_shards_, shard_id_, shard_equal_rows_, shuffle_records);
 
   RETURN_IF_NOT_OK(tf_reader_op->Init());
+  tf_reader_op->SetFirstEpochSkip(first_epoch_skip_);
 
   // If a global shuffle is used for TFRecord, it will inject a shuffle op over the TFRecord.
   // But, if there is a cache in the tree, we do not need the global shuffle and the shuffle op should not be built.
   // This is achieved in the cache transform pass where we call MakeSimpleProducer to reset TFRecord's shuffle
   // option to false.
-  if (shuffle_ == ShuffleMode::kGlobal) {
+  if (shuffle_ == ShuffleMode::kGlobal && !shuffle_records) {
     // Inject ShuffleOp
 
     std::shared_ptr<DatasetOp> shuffle_op = nullptr;
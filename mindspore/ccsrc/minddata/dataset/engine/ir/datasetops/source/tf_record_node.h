@@ -45,7 +45,8 @@ class TFRecordNode : public NonMappableSourceNode {
         shuffle_(shuffle),
         num_shards_(num_shards),
         shard_id_(shard_id),
-        shard_equal_rows_(shard_equal_rows) {
+        shard_equal_rows_(shard_equal_rows),
+        first_epoch_skip_(0) {
     // Update the num_shards_ in global context. this number is only used for now by auto_num_worker_pass. User
     // discretion is advised. Auto_num_worker_pass is currently an experimental feature which can still work if the
     // num_shards_ isn't 100% correct. The reason behind is for now, PreBuildSampler doesn't offer a way to return
@@ -66,7 +67,8 @@ class TFRecordNode : public NonMappableSourceNode {
         shuffle_(shuffle),
         num_shards_(num_shards),
         shard_id_(shard_id),
-        shard_equal_rows_(shard_equal_rows) {}
+        shard_equal_rows_(shard_equal_rows),
+        first_epoch_skip_(0) {}
 
   /// \brief Destructor
   ~TFRecordNode() override = default;
@@ -120,6 +122,19 @@ class TFRecordNode : public NonMappableSourceNode {
   int32_t NumShards() const { return num_shards_; }
   bool ShardEqualRows() const { return shard_equal_rows_; }
 
+  /// \brief Set the columns to load, used to push a projection down into the reader
+  /// \param[in] columns_list The columns to load
+  void SetColumnsList(const std::vector<std::string> &columns_list) { columns_list_ = columns_list; }
+
+  /// \brief Whether the reader can skip the first rows of the first epoch itself, used to push a skip down into it.
+  ///     It cannot when the rows are shuffled by a buffer above the reader or when they come from a cache.
+  /// \return True if SetFirstEpochSkip can be used
+  bool CanSkipRows() const;
+
+  /// \brief Set the number of rows the reader skips at the start of the first epoch, to resume a pipeline
+  /// \param[in] num_rows The number of rows
+  void SetFirstEpochSkip(int64_t num_rows) { first_epoch_skip_ = num_rows; }
+
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
   /// \return Status of the function
@@ -169,6 +184,7 @@ class TFRecordNode : public NonMappableSourceNode {
   int32_t num_shards_;
   int32_t shard_id_;
   bool shard_equal_rows_;
+  int64_t first_epoch_skip_;  // Rows skipped without being decoded at the start of the first epoch
 };
 }  // namespace dataset
 }  // namespace mindspore
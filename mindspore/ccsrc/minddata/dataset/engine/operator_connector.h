@@ -16,9 +16,12 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPERATOR_CONNECTOR_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPERATOR_CONNECTOR_H_
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include "minddata/dataset/core/tensor_row.h"
 #include "minddata/dataset/engine/connector.h"
 
@@ -31,7 +34,10 @@ class OperatorConnector : public Queue<TensorRow> {
  public:
   /// Constructor of OperatorConnector
   /// \param queue_capacity The number of element (TensorRows) for the queue.
-  explicit OperatorConnector(int32_t queue_capacity) : Queue<TensorRow>(queue_capacity) {
+  /// \param lock_free Whether the queue is lock free. The operator and its parent must then be the only producer and
+  ///     the only consumer.
+  explicit OperatorConnector(int32_t queue_capacity, bool lock_free = false)
+      : Queue<TensorRow>(queue_capacity, lock_free) {
     my_name_ = Services::GetUniqueID();
     out_rows_count_ = 0;
   }
@@ -39,10 +45,49 @@ class OperatorConnector : public Queue<TensorRow> {
   /// Destructor of -OperatorConnector
   ~OperatorConnector() = default;
 
+  /// Pop a row. When the chunk size is larger than 1, the consumer moves up to a chunk of the rows available in the
+  /// queue in one go, and serves the following pops from them without touching the queue.
+  /// \param row The row popped
+  /// \return Status The status code returned
   Status PopFront(TensorRow *row) {
     out_rows_count_++;
-    return Queue::PopFront(row);
+    if (pop_idx_ < popped_rows_.size()) {
+      return TakePoppedRow(row);
+    }
+    auto chunk_size = static_cast<size_t>(std::min<int32_t>(chunk_size_, static_cast<int32_t>(capacity())));
+    if (chunk_size <= 1) {
+      return Queue::PopFront(row);
+    }
+    popped_rows_.clear();
+    pop_idx_ = 0;
+    RETURN_IF_NOT_OK(PopFrontBatch(&popped_rows_, chunk_size));
+    num_popped_rows_ = popped_rows_.size();
+    return TakePoppedRow(row);
   }
+
+  /// Push a vector of rows in order, the queue is synchronized once per chunk of rows it has room for.
+  /// \param rows The rows to push, the vector is cleared afterwards
+  /// \return Status The status code returned
+  Status AddRows(std::vector<TensorRow> *rows) noexcept { return AddBatch(rows); }
+
+  /// Number of rows in the connector, including the ones popped in a chunk but not handed out yet
+  size_t num_rows() const { return size() + num_popped_rows_; }
+
+  /// Drop the rows in the queue and the ones popped in a chunk but not handed out yet
+  void Reset() override {
+    Queue::Reset();
+    popped_rows_.clear();
+    pop_idx_ = 0;
+    num_popped_rows_ = 0;
+  }
+
+  /// Set the maximum number of rows moved between the queue and the consumer in one operation
+  /// \param chunk_size The chunk size, 1 to move rows one by one
+  void SetChunkSize(int32_t chunk_size) { chunk_size_ = std::max(chunk_size, 1); }
+
+  /// \return The maximum number of rows moved in one operation
+  int32_t chunk_size() const { return chunk_size_; }
+
   Status SendEOE() noexcept {
     TensorRow eoe = TensorRow(TensorRow::kFlagEOE);
     return Add(std::move(eoe));
@@ -55,8 +100,20 @@ class OperatorConnector : public Queue<TensorRow> {
   auto out_rows_count() const { return out_rows_count_; }
 
  private:
+  Status TakePoppedRow(TensorRow *row) {
+    *row = std::move(popped_rows_[pop_idx_++]);
+    num_popped_rows_--;
+    return Status::OK();
+  }
+
   std::string my_name_;
   int64_t out_rows_count_;
+  std::atomic<int32_t> chunk_size_{1};
+  // Rows popped in one chunk, only touched by the consumer
+  std::vector<TensorRow> popped_rows_;
+  size_t pop_idx_{0};
+  // Read by the profiler through num_rows()
+  std::atomic<size_t> num_popped_rows_{0};
 };
 }  // namespace dataset
 }  // namespace mindspore
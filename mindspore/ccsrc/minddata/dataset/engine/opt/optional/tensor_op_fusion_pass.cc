@@ -1,5 +1,5 @@
 /**
- * Copyright 2020-2021 Huawei Technologies Co., Ltd
+ * Copyright 2020-2022 Huawei Technologies Co., Ltd
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,54 +16,198 @@
 
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/engine/ir/datasetops/map_node.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
+#include "minddata/dataset/kernels/ir/vision/center_crop_ir.h"
+#include "minddata/dataset/kernels/ir/vision/center_crop_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/kernels/ir/vision/resize_ir.h"
+#include "minddata/dataset/text/ir/kernels/text_ir.h"
+#include "minddata/dataset/text/kernels/lookup_op.h"
+#include "minddata/dataset/text/kernels/sentence_piece_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/tokenizer_op.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// start temporary code, to deal with pre-built TensorOperation
+Status FuseDecodeRandomCropAndResizeOp(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                                       std::shared_ptr<TensorOperation> *fused_op) {
+  MS_LOG(WARNING) << "Fusing pre-build Decode and RandomCropResize into one pre-build.";
+  std::shared_ptr<TensorOp> tensor_op = ops[1]->Build();
+  auto *crop_resize_op = dynamic_cast<RandomCropAndResizeOp *>(tensor_op.get());
+  RETURN_UNEXPECTED_IF_NULL(crop_resize_op);
+  *fused_op =
+    std::make_shared<transforms::PreBuiltOperation>(std::make_shared<RandomCropDecodeResizeOp>(*crop_resize_op));
+  return Status::OK();
+}  // end of temporary code, needs to be deleted when tensorOperation's pybind completes
+
+Status FuseDecodeRandomResizedCrop(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                                   std::shared_ptr<TensorOperation> *fused_op) {
+  auto *crop_resize_ir = dynamic_cast<vision::RandomResizedCropOperation *>(ops[1].get());
+  RETURN_UNEXPECTED_IF_NULL(crop_resize_ir);
+  *fused_op = std::make_shared<vision::RandomCropDecodeResizeOperation>(*crop_resize_ir);
+  return Status::OK();
+}
+
+Status FuseCenterCropResize(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                            std::shared_ptr<TensorOperation> *fused_op) {
+  nlohmann::json crop_args;
+  nlohmann::json resize_args;
+  RETURN_IF_NOT_OK(ops[0]->to_json(&crop_args));
+  RETURN_IF_NOT_OK(ops[1]->to_json(&resize_args));
+  std::vector<int32_t> crop_size = crop_args["size"];
+  std::vector<int32_t> size = resize_args["size"];
+  InterpolationMode interpolation = static_cast<InterpolationMode>(resize_args["interpolation"]);
+  *fused_op = std::make_shared<vision::CenterCropResizeOperation>(crop_size, size, interpolation);
+  return Status::OK();
+}
+
+// Fuse a chain [CenterCrop] Normalize [TypeCast] [HwcToChw], the parameters are read from the ops
+Status FuseNormalize(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                     std::shared_ptr<TensorOperation> *fused_op) {
+  std::vector<int32_t> crop_size;
+  std::vector<float> mean;
+  std::vector<float> std;
+  DataType data_type(DataType::DE_FLOAT32);
+  bool hwc_to_chw = false;
+  for (const auto &op : ops) {
+    nlohmann::json args;
+    RETURN_IF_NOT_OK(op->to_json(&args));
+    if (op->Name() == vision::kCenterCropOperation) {
+      crop_size = args["size"].get<std::vector<int32_t>>();
+    } else if (op->Name() == vision::kNormalizeOperation) {
+      // The crop and the transpose are only done in the loop for an HWC image
+      if (!args["is_hwc"].get<bool>()) {
+        return Status::OK();
+      }
+      mean = args["mean"].get<std::vector<float>>();
+      std = args["std"].get<std::vector<float>>();
+    } else if (op->Name() == transforms::kTypeCastOperation) {
+      data_type = DataType(args["data_type"].get<std::string>());
+      // FusedNormalize only outputs float32 or float16
+      if (data_type != DataType::DE_FLOAT32 && data_type != DataType::DE_FLOAT16) {
+        return Status::OK();
+      }
+    } else if (op->Name() == vision::kHwcToChwOperation) {
+      hwc_to_chw = true;
+    }
+  }
+  // A Rescale is not fused, its output is rounded by OpenCV, which the loops of FusedNormalizeOp can't match exactly.
+  *fused_op =
+    std::make_shared<vision::FusedNormalizeOperation>(crop_size, mean, std, 1.0, 0.0, data_type, hwc_to_chw);
+  return Status::OK();
+}
+
+// Fuse a tokenizer and the Lookup of its tokens. The ops are built here, as what the tokenizer outputs is only known
+// from its TensorOp, and the fused op reuses them.
+Status FuseTokenizerLookup(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                           std::shared_ptr<TensorOperation> *fused_op) {
+  std::shared_ptr<TensorOp> tokenizer = ops[0]->Build();
+  std::shared_ptr<TensorOp> lookup = ops[1]->Build();
+  auto *tokenizer_op = dynamic_cast<TokenizerOp *>(tokenizer.get());
+  auto *sentence_piece_op = dynamic_cast<SentencePieceTokenizerOp *>(tokenizer.get());
+  // A tokenizer with offsets outputs 3 columns, which a Lookup can't take
+  bool tokens_only = tokenizer_op != nullptr ? !tokenizer_op->with_offsets()
+                                             : sentence_piece_op != nullptr &&
+                                                 sentence_piece_op->out_type() == SPieceTokenizerOutType::kString;
+  if (!tokens_only || dynamic_cast<LookupOp *>(lookup.get()) == nullptr) {
+    return Status::OK();
+  }
+  *fused_op = std::make_shared<text::TokenizerLookupOperation>(tokenizer, lookup);
+  return Status::OK();
+}
+}  // namespace
+
+TensorOpFusionPass::TensorOpFusionPass() {
+  (void)AddPattern({{kDecodeOp, kRandomCropAndResizeOp}, FuseDecodeRandomCropAndResizeOp});
+  (void)AddPattern({{vision::kDecodeOperation, vision::kRandomResizedCropOperation}, FuseDecodeRandomResizedCrop});
+  (void)AddPattern({{vision::kCenterCropOperation, vision::kResizeOperation}, FuseCenterCropResize});
+  // Every chain [CenterCrop] Normalize [TypeCast] [HwcToChw] of at least 2 ops, the longest ones first
+  std::vector<std::vector<std::string>> chains;
+  constexpr int kNumOptionalOps = 3;
+  for (int mask = (1 << kNumOptionalOps) - 1; mask > 0; mask--) {
+    std::vector<std::string> chain;
+    if (mask & 1) {
+      chain.emplace_back(vision::kCenterCropOperation);
+    }
+    chain.emplace_back(vision::kNormalizeOperation);
+    if (mask & 2) {
+      chain.emplace_back(transforms::kTypeCastOperation);
+    }
+    if (mask & 4) {
+      chain.emplace_back(vision::kHwcToChwOperation);
+    }
+    chains.push_back(std::move(chain));
+  }
+  std::stable_sort(chains.begin(), chains.end(), [](const auto &a, const auto &b) { return a.size() > b.size(); });
+  for (auto &chain : chains) {
+    (void)AddPattern({std::move(chain), FuseNormalize});
+  }
+  for (const auto &tokenizer :
+       {text::kBasicTokenizerOperation, text::kBertTokenizerOperation, text::kJiebaTokenizerOperation,
+        text::kRegexTokenizerOperation, text::kSentencepieceTokenizerOperation, text::kUnicodeCharTokenizerOperation,
+        text::kUnicodeScriptTokenizerOperation, text::kWhitespaceTokenizerOperation}) {
+    (void)AddPattern({{tokenizer, text::kLookupOperation}, FuseTokenizerLookup});
+  }
+}
+
+Status TensorOpFusionPass::AddPattern(FusionPattern pattern) {
+  CHECK_FAIL_RETURN_UNEXPECTED(!pattern.op_names.empty() && pattern.fuse != nullptr,
+                               "TensorOpFusionPass: a fusion pattern needs tensor ops and a fusion function.");
+  patterns_.push_back(std::move(pattern));
+  return Status::OK();
+}
 
 Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
   RETURN_UNEXPECTED_IF_NULL(node);
   RETURN_UNEXPECTED_IF_NULL(modified);
   std::vector<std::shared_ptr<TensorOperation>> ops = node->operations();
-
-  // start temporary code, to deal with pre-built TensorOperation
-  std::vector<std::string> pattern = {kDecodeOp, kRandomCropAndResizeOp};
-  auto itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
-                         [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
-  if (itr != ops.end()) {
-    MS_LOG(WARNING) << "Fusing pre-build Decode and RandomCropResize into one pre-build.";
-    auto fused_op = dynamic_cast<RandomCropAndResizeOp *>((*(itr + 1))->Build().get());
-    RETURN_UNEXPECTED_IF_NULL(fused_op);
-    (*itr) = std::make_shared<transforms::PreBuiltOperation>(std::make_shared<RandomCropDecodeResizeOp>(*fused_op));
-    ops.erase(itr + 1);
+  bool fused = false;
+  for (const auto &pattern : patterns_) {
+    auto begin = ops.begin();
+    while (true) {
+      auto itr = std::search(begin, ops.end(), pattern.op_names.begin(), pattern.op_names.end(),
+                             [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
+      if (itr == ops.end()) {
+        break;
+      }
+      auto end = itr + static_cast<std::ptrdiff_t>(pattern.op_names.size());
+      std::shared_ptr<TensorOperation> fused_op;
+      RETURN_IF_NOT_OK(pattern.fuse(std::vector<std::shared_ptr<TensorOperation>>(itr, end), &fused_op));
+      if (fused_op == nullptr) {
+        // The fusion function declined, look for the pattern after this occurrence
+        begin = itr + 1;
+        continue;
+      }
+      std::string fusion;
+      for (const auto &name : pattern.op_names) {
+        fusion += (fusion.empty() ? "" : "+") + name;
+      }
+      fusion += " -> " + fused_op->Name();
+      MS_LOG(INFO) << "Fused tensor ops in " << node->Name() << ": " << fusion;
+      applied_fusions_.push_back(fusion);
+      *itr = std::move(fused_op);
+      begin = ops.erase(itr + 1, end);
+      fused = true;
+    }
+  }
+  if (fused) {
     node->setOperations(ops);
     *modified = true;
-    return Status::OK();
-  }  // end of temporary code, needs to be deleted when tensorOperation's pybind completes
-
-  // logic below is for non-prebuilt TensorOperation
-  pattern = {vision::kDecodeOperation, vision::kRandomResizedCropOperation};
-  itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
-                    [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
-
-  // return here if no pattern is found
-  RETURN_OK_IF_TRUE(itr == ops.end());
-  auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>((itr + 1)->get());
-  RETURN_UNEXPECTED_IF_NULL(fused_ir);
-  // fuse the two ops
-  (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
-  ops.erase(itr + 1);
-  node->setOperations(ops);
-  *modified = true;
+  }
   return Status::OK();
 }
 }  // namespace dataset
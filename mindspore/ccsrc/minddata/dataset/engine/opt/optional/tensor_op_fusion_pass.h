@@ -1,5 +1,5 @@
 /**
- * Copyright 2020 Huawei Technologies Co., Ltd
+ * Copyright 2020-2022 Huawei Technologies Co., Ltd
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,21 +16,58 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 #include "minddata/dataset/engine/opt/pass.h"
 
 namespace mindspore {
 namespace dataset {
 
+class TensorOperation;
+
 /// \class TensorOpFusionPass tensor_op_fusion_pass.h
 /// \brief And optional optimization pass identifying and fusing
 ///     tensor ops within MapOp
 class TensorOpFusionPass : public IRNodePass {
+ public:
+  /// \brief Function fusing the tensor ops matched by a pattern
+  /// \param[in] ops The matched tensor ops, in the order of the pattern
+  /// \param[out] fused_op The tensor op replacing them, nullptr to leave them as they are
+  /// \return Status The status code returned
+  using FusionFunc = std::function<Status(const std::vector<std::shared_ptr<TensorOperation>> &ops,
+                                          std::shared_ptr<TensorOperation> *fused_op)>;
+
+  /// \brief A sequence of consecutive tensor ops, by name, and how they are fused
+  struct FusionPattern {
+    std::vector<std::string> op_names;
+    FusionFunc fuse;
+  };
+
+  /// \brief Constructor, registering the built-in patterns
+  TensorOpFusionPass();
+
+  ~TensorOpFusionPass() override = default;
+
+  /// \brief Register a pattern, tried after the ones registered before it
+  /// \param[in] pattern The pattern
+  /// \return Status The status code returned
+  Status AddPattern(FusionPattern pattern);
+
+  /// \brief Getter of the fusions applied by the pass, e.g. "Decode+RandomResizedCrop -> RandomCropDecodeResize"
+  /// \return The fusions, in the order they were applied
+  const std::vector<std::string> &GetAppliedFusions() const { return applied_fusions_; }
+
+ private:
   /// \brief Identifies and fuses tensor ops within MapOp
   /// \param[in] node The node being visited
   /// \param[in, out] *modified indicates whether the node has been visited
   /// \return Status The status code returned
   Status Visit(std::shared_ptr<MapNode> node, bool *const modified) override;
+
+  std::vector<FusionPattern> patterns_;
+  std::vector<std::string> applied_fusions_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,238 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/opt/pre/projection_pushdown_pass.h"
+#include <algorithm>
+#include <sstream>
+#include "minddata/dataset/engine/ir/datasetops/batch_node.h"
+#include "minddata/dataset/engine/ir/datasetops/dataset_node.h"
+#include "minddata/dataset/engine/ir/datasetops/filter_node.h"
+#include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/engine/ir/datasetops/project_node.h"
+#include "minddata/dataset/engine/ir/datasetops/rename_node.h"
+#include "minddata/dataset/engine/ir/datasetops/repeat_node.h"
+#include "minddata/dataset/engine/ir/datasetops/shuffle_node.h"
+#include "minddata/dataset/engine/ir/datasetops/skip_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/tf_record_node.h"
+#include "minddata/dataset/engine/ir/datasetops/take_node.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+std::string JoinColumns(const std::vector<std::string> &columns) {
+  std::ostringstream ss;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    ss << (i == 0 ? "" : ", ") << columns[i];
+  }
+  return ss.str();
+}
+}  // namespace
+
+void ProjectionPushdownPass::ProjectionNodes::AddColumn(const std::string &column) {
+  if (std::find(columns_.begin(), columns_.end(), column) == columns_.end()) {
+    columns_.push_back(column);
+  }
+}
+
+std::vector<std::string> ProjectionPushdownPass::ProjectionNodes::PruneColumns(
+  const std::vector<std::string> &columns_list) const {
+  if (columns_list.empty()) {
+    return columns_;
+  }
+  std::vector<std::string> pruned;
+  for (const auto &column : columns_list) {
+    if (std::find(columns_.begin(), columns_.end(), column) != columns_.end()) {
+      pruned.push_back(column);
+    }
+  }
+  // Keep the reader as it is if nothing is dropped, or if the columns needed are not there, it reports the error then.
+  if (pruned.size() == columns_list.size() || pruned.empty()) {
+    return {};
+  }
+  return pruned;
+}
+
+// A project node below another one keeps the columns needed above, it can only have more of them.
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<ProjectNode> node, bool *const modified) {
+  if (node->IsCached()) {
+    active_ = false;
+    return Status::OK();
+  }
+  if (!active_) {
+    columns_.clear();
+    for (const auto &column : node->Columns()) {
+      AddColumn(column);
+    }
+    active_ = true;
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
+  // A map with project columns projects its own output.
+  if (!active_ && !node->ProjectColumns().empty()) {
+    columns_.clear();
+    for (const auto &column : node->ProjectColumns()) {
+      AddColumn(column);
+    }
+    active_ = true;
+  }
+  if (!active_) return Status::OK();
+  // Without input columns the map works on the first column, whichever it is.
+  if (node->IsCached() || node->InputColumns().empty()) {
+    active_ = false;
+    return Status::OK();
+  }
+  const auto &outputs = node->OutputColumns().empty() ? node->InputColumns() : node->OutputColumns();
+  std::vector<std::string> above = std::move(columns_);
+  columns_.clear();
+  for (const auto &column : above) {
+    if (std::find(outputs.begin(), outputs.end(), column) == outputs.end()) {
+      AddColumn(column);
+    }
+  }
+  for (const auto &column : node->InputColumns()) {
+    AddColumn(column);
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<RenameNode> node, bool *const modified) {
+  if (!active_) return Status::OK();
+  if (node->IsCached()) {
+    active_ = false;
+    return Status::OK();
+  }
+  const auto &inputs = node->InputColumns();
+  const auto &outputs = node->OutputColumns();
+  std::vector<std::string> above = std::move(columns_);
+  columns_.clear();
+  for (const auto &column : above) {
+    auto it = std::find(outputs.begin(), outputs.end(), column);
+    AddColumn(it == outputs.end() ? column : inputs[std::distance(outputs.begin(), it)]);
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<FilterNode> node, bool *const modified) {
+  if (!active_) return Status::OK();
+  // Without input columns the predicate gets the whole row.
+  if (node->IsCached() || node->InputColumns().empty()) {
+    active_ = false;
+    return Status::OK();
+  }
+  for (const auto &column : node->InputColumns()) {
+    AddColumn(column);
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<BatchNode> node, bool *const modified) {
+  if (!active_) return Status::OK();
+#ifdef ENABLE_PYTHON
+  // Padding and per batch maps work on columns of their own.
+  if (node->Pad() || node->BatchSizeFunc() || node->BatchMapFunc()) {
+    active_ = false;
+    return Status::OK();
+  }
+#endif
+  if (node->IsCached()) {
+    active_ = false;
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<RepeatNode> node, bool *const modified) {
+  if (node->IsCached()) {
+    active_ = false;
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<ShuffleNode> node, bool *const modified) {
+  if (node->IsCached()) {
+    active_ = false;
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<SkipNode> node, bool *const modified) {
+  if (node->IsCached()) {
+    active_ = false;
+  }
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<TakeNode> node, bool *const modified) {
+  if (node->IsCached()) {
+    active_ = false;
+  }
+  return Status::OK();
+}
+
+// The padded samples of a MindDataNode are built with the columns it loads, so it is left alone when it has some.
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<MindDataNode> node, bool *const modified) {
+  if (active_ && !node->IsCached() && node->NumPadded() == 0) {
+    auto columns = PruneColumns(node->ColumnsList());
+    if (!columns.empty()) {
+      minddata_nodes_.emplace_back(node, std::move(columns));
+    }
+  }
+  active_ = false;
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<TFRecordNode> node, bool *const modified) {
+  if (active_ && !node->IsCached()) {
+    auto columns = PruneColumns(node->ColumnsList());
+    if (!columns.empty()) {
+      tfrecord_nodes_.emplace_back(node, std::move(columns));
+    }
+  }
+  active_ = false;
+  return Status::OK();
+}
+
+Status ProjectionPushdownPass::ProjectionNodes::Visit(std::shared_ptr<DatasetNode> node, bool *const modified) {
+  active_ = false;
+  return Status::OK();
+}
+
+// Walk the tree to load only the projected columns in the readers.
+Status ProjectionPushdownPass::RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const modified) {
+  MS_LOG(INFO) << "Pre pass: projection pushdown pass started.";
+  auto projection_nodes = std::make_unique<ProjectionPushdownPass::ProjectionNodes>();
+  RETURN_IF_NOT_OK(projection_nodes->Run(root_ir, modified));
+
+  for (const auto &iter : projection_nodes->minddata_nodes()) {
+    MS_LOG(INFO) << "Loading only the projected columns in " << iter.first->Name() << ": "
+                 << JoinColumns(iter.second);
+    iter.first->SetColumnsList(iter.second);
+    *modified = true;
+  }
+  for (const auto &iter : projection_nodes->tfrecord_nodes()) {
+    MS_LOG(INFO) << "Loading only the projected columns in " << iter.first->Name() << ": "
+                 << JoinColumns(iter.second);
+    iter.first->SetColumnsList(iter.second);
+    *modified = true;
+  }
+
+  MS_LOG(INFO) << "Pre pass: projection pushdown pass is complete.";
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,174 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_PROJECTION_PUSHDOWN_PASS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_PROJECTION_PUSHDOWN_PASS_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "minddata/dataset/engine/opt/pass.h"
+
+namespace mindspore {
+namespace dataset {
+class BatchNode;
+class DatasetNode;
+class FilterNode;
+class MapNode;
+class MindDataNode;
+class ProjectNode;
+class RenameNode;
+class RepeatNode;
+class ShuffleNode;
+class SkipNode;
+class TakeNode;
+class TFRecordNode;
+
+/// \class ProjectionPushdownPass projection_pushdown_pass.h
+/// \brief This is a tree pass that pushes the columns kept by a project node down into the MindRecord or TFRecord
+///     reader below it, so that the reader doesn't read or decode the columns which are dropped anyway. The columns
+///     are followed down through the nodes which only use some columns by name (map, rename, filter, batch) or don't
+///     look at them (repeat, shuffle, skip, take). Any other node, or a cache, stops the pushdown.
+class ProjectionPushdownPass : public IRTreePass {
+  /// \class ProjectionNodes
+  /// \brief This is a NodePass whose job is to find the columns each reader has to load.
+  ///     It works in conjunction with the ProjectionPushdownPass.
+  class ProjectionNodes : public IRNodePass {
+   public:
+    /// \brief Constructor
+    ProjectionNodes() = default;
+
+    /// \brief Destructor
+    ~ProjectionNodes() = default;
+
+    /// \brief Start a pushdown, or keep the one from above, on a ProjectNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<ProjectNode> node, bool *const modified) override;
+
+    /// \brief Map the columns needed above a MapNode to the ones needed below it
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<MapNode> node, bool *const modified) override;
+
+    /// \brief Map the columns needed above a RenameNode to the ones needed below it
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<RenameNode> node, bool *const modified) override;
+
+    /// \brief Add the columns a FilterNode reads to the ones needed
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<FilterNode> node, bool *const modified) override;
+
+    /// \brief Keep the pushdown going through a BatchNode which batches every column the same way
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<BatchNode> node, bool *const modified) override;
+
+    /// \brief Keep the pushdown going through a RepeatNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<RepeatNode> node, bool *const modified) override;
+
+    /// \brief Keep the pushdown going through a ShuffleNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<ShuffleNode> node, bool *const modified) override;
+
+    /// \brief Keep the pushdown going through a SkipNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<SkipNode> node, bool *const modified) override;
+
+    /// \brief Keep the pushdown going through a TakeNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<TakeNode> node, bool *const modified) override;
+
+    /// \brief Complete the pushdown on a MindDataNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<MindDataNode> node, bool *const modified) override;
+
+    /// \brief Complete the pushdown on a TFRecordNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<TFRecordNode> node, bool *const modified) override;
+
+    /// \brief Stop the pushdown on any other node
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<DatasetNode> node, bool *const modified) override;
+
+    /// \brief Getter
+    /// \return The MindDataNodes to update and the columns they have to load
+    const std::vector<std::pair<std::shared_ptr<MindDataNode>, std::vector<std::string>>> &minddata_nodes() const {
+      return minddata_nodes_;
+    }
+
+    /// \brief Getter
+    /// \return The TFRecordNodes to update and the columns they have to load
+    const std::vector<std::pair<std::shared_ptr<TFRecordNode>, std::vector<std::string>>> &tfrecord_nodes() const {
+      return tfrecord_nodes_;
+    }
+
+   private:
+    /// \brief Add a column to the ones needed, if it is not there yet
+    /// \param[in] column The column name
+    void AddColumn(const std::string &column);
+
+    /// \brief Keep the columns of the reader which are needed
+    /// \param[in] columns_list The columns the reader loads, empty if it loads all of them
+    /// \return The columns the reader has to load, empty if nothing can be dropped
+    std::vector<std::string> PruneColumns(const std::vector<std::string> &columns_list) const;
+
+    bool active_ = false;               // a project node above is being pushed down
+    std::vector<std::string> columns_;  // the columns needed from the node being visited
+    std::vector<std::pair<std::shared_ptr<MindDataNode>, std::vector<std::string>>> minddata_nodes_;
+    std::vector<std::pair<std::shared_ptr<TFRecordNode>, std::vector<std::string>>> tfrecord_nodes_;
+  };
+
+ public:
+  /// \brief Constructor
+  ProjectionPushdownPass() = default;
+
+  /// \brief Destructor
+  ~ProjectionPushdownPass() = default;
+
+  /// \brief Runs a projection_pushdown pass to load only the projected columns in the readers.
+  /// \param[in, out] root_ir The tree to operate on.
+  /// \param[in, out] modified Indicate if the tree was modified.
+  /// \return Status The status code returned
+  Status RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const modified) override;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_PROJECTION_PUSHDOWN_PASS_H_
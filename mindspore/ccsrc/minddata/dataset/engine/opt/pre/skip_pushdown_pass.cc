@@ -24,6 +24,7 @@
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
 #endif
+#include "minddata/dataset/engine/ir/datasetops/source/tf_record_node.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/skip_first_epoch_sampler_ir.h"
 
 namespace mindspore {
@@ -127,6 +128,21 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MindDataNode> node, bo
 }
 #endif
 
+// TFReaderOp skips the rows itself, going past the records without decoding them.
+Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<TFRecordNode> node, bool *const modified) {
+  CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
+  if (skip_count_ == 0) return Status::OK();  // no active skip node above. normal flow
+
+  if (!node->CanSkipRows()) {
+    insert_skip_above_.emplace_back(node, skip_count_);
+  } else {
+    MS_LOG(INFO) << "Skipping the first " << skip_count_ << " rows in TFRecordDataset.";
+    node->SetFirstEpochSkip(skip_count_);
+  }
+  skip_count_ = 0;
+  return Status::OK();
+}
+
 // This functions is used for Ops that are random, and the ones in which Visit is Not Implemented yet;
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<DatasetNode> node, bool *const modified) {
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
@@ -36,6 +36,7 @@ class NonMappableSourceNode;
 class ProjectNode;
 class RenameNode;
 class SkipNode;
+class TFRecordNode;
 
 /// \class SkipPushdownPass skip_pushdown_pass.h
 /// \brief This is a tree pass that will push down a skip node.  It uses SkipNodes to first identify if we have a skip
@@ -109,6 +110,12 @@ class SkipPushdownPass : public IRTreePass {
     Status Visit(std::shared_ptr<MindDataNode> node, bool *const modified) override;
 #endif
 
+    /// \brief Perform skip node pushdown check on a TFRecordNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<TFRecordNode> node, bool *const modified) override;
+
     /// \brief Perform skip node pushdown check on a DatasetNode
     /// \param[in] node The node being visited
     /// \param[in, out] modified Indicator if the node was changed at all
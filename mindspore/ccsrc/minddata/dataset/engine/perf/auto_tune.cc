@@ -28,6 +28,7 @@
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/serdes.h"
 #endif
+#include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #include "minddata/dataset/util/task_manager.h"
 
 namespace mindspore {
@@ -562,6 +563,13 @@ Status AutoTune::RequestConnectorCapacityChange(int32_t op_id, int32_t old_size,
   AT_change_ = true;
   new_size = std::min(new_size, MAX_QUEUE_SIZE);
   new_size = std::max(new_size, MIN_QUEUE_SIZE);
+  OperatorConnector *connector = ops_[op_id]->OutputConnector();
+  if (connector != nullptr && static_cast<size_t>(new_size) > connector->max_capacity()) {
+    MS_LOG(WARNING) << "Requested \"prefetch_size\" of Operator: " << ops_[op_id]->NameWithID() << " [" << new_size
+                    << "] exceeds the slots reserved by its lock free connector, clamped to ["
+                    << connector->max_capacity() << "].";
+    new_size = static_cast<int32_t>(connector->max_capacity());
+  }
   RETURN_IF_NOT_OK(tree_modifier_->AddChangeRequest(op_id, std::make_shared<ResizeConnectorRequest>(new_size)));
   if (old_size == -1) {
     MS_LOG(INFO) << "Added request to change \"prefetch_size\" of Operator: " << ops_[op_id]->NameWithID()
@@ -573,6 +581,30 @@ Status AutoTune::RequestConnectorCapacityChange(int32_t op_id, int32_t old_size,
   return Status::OK();
 }
 
+Status AutoTune::RequestConnectorChunkSizeChange(int32_t op_id, int32_t old_chunk_size, int32_t new_chunk_size) {
+  AT_change_ = true;
+  new_chunk_size = std::min(new_chunk_size, MAX_CHUNK_SIZE);
+  new_chunk_size = std::max(new_chunk_size, 1);
+  RETURN_IF_NOT_OK(
+    tree_modifier_->AddChangeRequest(op_id, std::make_shared<ChangeConnectorChunkSizeRequest>(new_chunk_size)));
+  MS_LOG(INFO) << "Added request to change connector chunk size of Operator: " << ops_[op_id]->NameWithID()
+               << "From old value: [" << old_chunk_size << "] to new value: [" << new_chunk_size << "].";
+  return Status::OK();
+}
+
+Status AutoTune::RequestReadDepthChange(int32_t op_id, int32_t old_depth, int32_t new_depth) {
+  AT_change_ = true;
+  // More reads in flight than the files which fit in read_ahead_memory_limit would only wait for the memory.
+  auto leaf_op = std::dynamic_pointer_cast<MappableLeafOp>(ops_[op_id]);
+  int32_t max_depth = leaf_op == nullptr ? MAX_READ_DEPTH : leaf_op->MaxReadDepth(MAX_READ_DEPTH);
+  new_depth = std::min(new_depth, max_depth);
+  new_depth = std::max(new_depth, 1);
+  RETURN_IF_NOT_OK(tree_modifier_->AddChangeRequest(op_id, std::make_shared<ChangeReadDepthRequest>(new_depth)));
+  MS_LOG(INFO) << "Added request to change read depth of Operator: " << ops_[op_id]->NameWithID()
+               << "From old value: [" << old_depth << "] to new value: [" << new_depth << "].";
+  return Status::OK();
+}
+
 bool AutoTune::SkipOpsCheck(int op_id) {
   // Skip Generator op
   if (ops_[op_id]->Name() == "GeneratorOp") {
@@ -646,6 +678,30 @@ Status AutoTune::AnalyseTime() {
       new_queue_capacity = std::max(new_queue_capacity, static_cast<int64_t>(requested_workers));
       RETURN_IF_NOT_OK(RequestConnectorCapacityChange(op_id, queue_capacity, new_queue_capacity));
     }
+    // map decisions - chunk
+    // Rows pile up in the output connector, so the consumer can take them (and the collector push them) in chunks
+    // instead of synchronizing on the connector once per row.
+    int32_t chunk_size = ops_[op_id]->OutputConnector()->chunk_size();
+    if (output_queue_util > CHUNK_QUEUE_UTIL_THRESHOLD && chunk_size < MAX_CHUNK_SIZE &&
+        chunk_size < new_queue_capacity) {
+      MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID() << ") output connector utilization=" << output_queue_util
+                   << " > " << CHUNK_QUEUE_UTIL_THRESHOLD << " threshold.";
+      int32_t new_chunk_size = std::min(chunk_size * 2, static_cast<int32_t>(new_queue_capacity));
+      RETURN_IF_NOT_OK(RequestConnectorChunkSizeChange(op_id, chunk_size, new_chunk_size));
+    }
+    // leaf decisions - read depth
+    // A leaf whose workers sit idle while its output connector runs low is waiting on the storage, more reads in
+    // flight hide more of its latency.
+    auto leaf_op = std::dynamic_pointer_cast<MappableLeafOp>(ops_[op_id]);
+    int32_t read_depth = leaf_op == nullptr ? 0 : leaf_op->ReadDepth();
+    int32_t max_read_depth = leaf_op == nullptr ? 0 : leaf_op->MaxReadDepth(MAX_READ_DEPTH);
+    if (read_depth > 0 && read_depth < max_read_depth && output_queue_util < LEAF_QUEUE_THRESHOLD &&
+        (cpu_util / num_workers) < MAP_OP_WORKER_LOW_THRESHOLD) {
+      MS_LOG(INFO) << "Op (" << ops_[op_id]->NameWithID() << ") output connector utilization=" << output_queue_util
+                   << " < " << LEAF_QUEUE_THRESHOLD << " threshold with low average worker cpu utilization "
+                   << (cpu_util / num_workers) << "% < " << MAP_OP_WORKER_LOW_THRESHOLD << "% threshold.";
+      RETURN_IF_NOT_OK(RequestReadDepthChange(op_id, read_depth, read_depth * 2));
+    }
   }
   return Status::OK();
 }
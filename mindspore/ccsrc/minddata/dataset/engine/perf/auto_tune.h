@@ -141,6 +141,11 @@ class AutoTune {
   const float_t LEAF_QUEUE_THRESHOLD = 0.9;
   const float_t INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD = 0.35;
   const int64_t INCREMENT_QUEUE_SIZE = 4;
+  // Chunk specifics
+  const int32_t MAX_CHUNK_SIZE = 32;
+  const float_t CHUNK_QUEUE_UTIL_THRESHOLD = 0.75;
+  // Read ahead specifics, the depth is also capped by the files which fit in read_ahead_memory_limit
+  const int32_t MAX_READ_DEPTH = 64;
   // CPU Specifics
   const float_t MAP_OP_WORKER_HIGH_THRESHOLD = 75;
   const float_t MAP_OP_WORKER_LOW_THRESHOLD = 35;
@@ -206,6 +211,20 @@ class AutoTune {
   /// \return Status code
   Status RequestConnectorCapacityChange(int32_t op_id, int32_t old_size, int32_t new_size);
 
+  /// Send a ChangeRequest to the operator to update the number of rows moved through its connector in one operation
+  /// \param op_id operator ID
+  /// \param old_chunk_size Old chunk size for logging purposes
+  /// \param new_chunk_size new chunk size
+  /// \return Status code
+  Status RequestConnectorChunkSizeChange(int32_t op_id, int32_t old_chunk_size, int32_t new_chunk_size);
+
+  /// Send a ChangeRequest to the leaf operator to update the number of file reads it keeps in flight
+  /// \param op_id operator ID
+  /// \param old_depth Old read depth for logging purposes
+  /// \param new_depth new read depth
+  /// \return Status code
+  Status RequestReadDepthChange(int32_t op_id, int32_t old_depth, int32_t new_depth);
+
   /// Track the pipeline time of the current epoch into avg_pipeline_times_
   /// \return Status code
   Status TrackPipelineTime();
@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/util/path.h"
 
@@ -44,6 +45,19 @@ Status ConnectorSize::Sample() {
   // Push new row of sample
   sample_table_.push_back(cur_row);
   (void)ts_.emplace_back(ProfilingTime::GetCurMilliSecond());
+  // The counters only grow, keep the latest ones.
+  for (const auto &op : *tree_) {
+    auto leaf_op = dynamic_cast<const MappableLeafOp *>(&op);
+    AsyncFileReader::Stats stats;
+    if (leaf_op != nullptr && leaf_op->GetReadAheadStats(&stats)) {
+      read_ahead_stats_[op.id()] = stats;
+    }
+  }
+  auto pool = tree_->TensorMemPool();
+  if (pool != nullptr) {
+    has_tensor_mem_pool_ = true;
+    tensor_mem_pool_stats_ = pool->GetStats();
+  }
   return Status::OK();
 }
 
@@ -93,6 +107,32 @@ Status ConnectorSize::SaveToFile(const std::string &dir_path, const std::string
     if (ops_data[idx]["metrics"].contains("output_queue") && ops_data[idx]["op_type"] != "DeviceQueueOp") {
       ops_data[idx]["metrics"]["output_queue"]["size"] = cur_queue_size;
     }
+    auto stats_itr = read_ahead_stats_.find(ops_data[idx]["op_id"].get<int32_t>());
+    if (stats_itr != read_ahead_stats_.end()) {
+      const auto &stats = stats_itr->second;
+      int64_t total = stats.num_ready + stats.num_waited + stats.num_missed;
+      // A hit is a file the worker found read when it got to its row.
+      double hit_rate = total == 0 ? 0.0 : static_cast<double>(stats.num_ready) / total;
+      ops_data[idx]["metrics"]["read_ahead"] = {{"ready", stats.num_ready},
+                                                {"waited", stats.num_waited},
+                                                {"missed", stats.num_missed},
+                                                {"hit_rate", hit_rate},
+                                                {"peak_bytes", stats.peak_bytes}};
+    }
+  }
+
+  if (has_tensor_mem_pool_) {
+    const auto &stats = tensor_mem_pool_stats_;
+    double hit_rate =
+      stats.num_allocs == 0 ? 0.0 : static_cast<double>(stats.num_cache_hits) / static_cast<double>(stats.num_allocs);
+    output["tensor_mem_pool"] = {{"allocs", stats.num_allocs},
+                                 {"cache_hits", stats.num_cache_hits},
+                                 {"hit_rate", hit_rate},
+                                 {"system_allocs", stats.num_system_allocs},
+                                 {"system_frees", stats.num_system_frees},
+                                 {"bytes_in_use", stats.bytes_in_use},
+                                 {"peak_bytes_in_use", stats.peak_bytes_in_use},
+                                 {"bytes_cached", stats.bytes_cached}};
   }
 
   // Discard the content of the file when opening.
@@ -118,6 +158,9 @@ Status ConnectorSize::Init() {
 void ConnectorSize::Clear() {
   ts_.clear();
   sample_table_.clear();
+  read_ahead_stats_.clear();
+  has_tensor_mem_pool_ = false;
+  tensor_mem_pool_stats_ = SizeClassPool::Stats();
   initial_nodes_data.clear();
 }
 
@@ -16,11 +16,14 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_CONNECTOR_SIZE_H
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_CONNECTOR_SIZE_H
 
+#include <map>
 #include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "minddata/dataset/engine/perf/profiling.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
+#include "minddata/dataset/engine/datasetops/source/async_file_reader.h"
+#include "minddata/dataset/util/size_class_pool.h"
 
 using json = nlohmann::json;
 
@@ -76,6 +79,9 @@ class ConnectorSize : public Sampling {
   ExecutionTree *tree_ = nullptr;          // ExecutionTree pointer
   ConnectorSizeSampleTable sample_table_;  // Dataset structure to store all samples of connector size sampling
   Timestamps ts_;                          // time of sample
+  std::map<int32_t, AsyncFileReader::Stats> read_ahead_stats_;  // Latest read ahead counters of the leaf ops
+  bool has_tensor_mem_pool_ = false;                            // Whether the tree has its own tensor pool
+  SizeClassPool::Stats tensor_mem_pool_stats_;                  // Latest counters of the tensor pool of the tree
   Path GetFileName(const std::string &dir_path, const std::string &rank_id) override;
 };
 
@@ -308,6 +308,7 @@ Serdes::InitializeFuncPtr() {
   ops_ptr[vision::kDvppResizeJpegOperation] = &(vision::DvppResizeJpegOperation::from_json);
 #endif
   ops_ptr[vision::kEqualizeOperation] = &(vision::EqualizeOperation::from_json);
+  ops_ptr[vision::kFusedNormalizeOperation] = &(vision::FusedNormalizeOperation::from_json);
   ops_ptr[vision::kGaussianBlurOperation] = &(vision::GaussianBlurOperation::from_json);
   ops_ptr[vision::kHorizontalFlipOperation] = &(vision::HorizontalFlipOperation::from_json);
   ops_ptr[vision::kHwcToChwOperation] = &(vision::HwcToChwOperation::from_json);
@@ -22,6 +22,7 @@
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/opt/pre/cache_transform_pass.h"
 #include "minddata/dataset/engine/opt/pre/node_offload_pass.h"
+#include "minddata/dataset/engine/opt/pre/projection_pushdown_pass.h"
 #include "minddata/dataset/engine/opt/post/repeat_pass.h"
 #endif
 #include "minddata/dataset/engine/opt/pass.h"
@@ -66,6 +67,7 @@ Status TreeAdapter::PrePass(std::shared_ptr<DatasetNode> ir) {
   actions.emplace_back(std::make_unique<EpochCtrlPass>());
   if (usage_ == kDeGetter) actions.emplace_back(std::make_unique<GetterPass>());
 #ifndef ENABLE_ANDROID
+  actions.emplace_back(std::make_unique<ProjectionPushdownPass>());
   actions.emplace_back(std::make_unique<CacheTransformPass>());
 
   std::unique_ptr<NodeOffloadPass> offload = std::make_unique<NodeOffloadPass>();
@@ -95,13 +97,19 @@ Status TreeAdapter::Optimize(std::shared_ptr<DatasetNode> ir) {
   std::vector<std::unique_ptr<IRNodePass>> optimizations;
   MS_LOG(INFO) << "Running optimization pass loops";
 #ifndef ENABLE_ANDROID
-  optimizations.emplace_back(std::make_unique<TensorOpFusionPass>());
+  auto fusion_pass = std::make_unique<TensorOpFusionPass>();
+  TensorOpFusionPass *fusion_pass_ptr = fusion_pass.get();
+  optimizations.emplace_back(std::move(fusion_pass));
 #endif
   // Apply optimization pass actions
   for (auto i = 0; i < optimizations.size(); i++) {
     bool modified = false;
     RETURN_IF_NOT_OK(optimizations[i]->Run(ir, &modified));
   }
+#ifndef ENABLE_ANDROID
+  applied_fusions_ = fusion_pass_ptr->GetAppliedFusions();
+  MS_LOG(INFO) << "Number of tensor op fusions applied: " << applied_fusions_.size();
+#endif
   MS_LOG(INFO) << "Optimization pass complete.";
   return Status::OK();
 }
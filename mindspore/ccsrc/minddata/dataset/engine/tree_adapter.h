@@ -87,6 +87,9 @@ class TreeAdapter {
   // Optional optimizations status
   bool OptimizationEnabled() const { return optimize_; }
 
+  // Return the tensor op fusions applied by the optional optimization pass, one string per fusion
+  const std::vector<std::string> &GetAppliedFusions() const { return applied_fusions_; }
+
   // Return Offload Json
   nlohmann::json GetOffloadJson();
 #ifndef ENABLE_SECURITY
@@ -123,6 +126,7 @@ class TreeAdapter {
   std::shared_ptr<DatasetNode> root_ir_;
   std::unique_ptr<ExecutionTree> tree_;
   bool optimize_;  // Flag to enable optional optimization pass
+  std::vector<std::string> applied_fusions_;  // Tensor op fusions applied by the optional optimization pass
 #ifndef ENABLE_SECURITY
   std::shared_ptr<ProfilingManager> profiling_manager_;  // Profiling manager
   std::shared_ptr<DatasetIteratorTracing> tracing_;      // trace profiling data
@@ -16,6 +16,8 @@
 
 #include "minddata/dataset/engine/tree_modifier.h"
 
+#include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
+
 namespace mindspore {
 namespace dataset {
 Status AutotuneCallback::DSNStepBegin(const CallbackParam &cb_param) {
@@ -65,6 +67,12 @@ Status ChangeNumWorkersRequest::ApplyChange(DatasetOp *op) {
   return Status::OK();
 }
 
+Status ChangeReadDepthRequest::ApplyChange(DatasetOp *op) {
+  auto leaf_op = dynamic_cast<MappableLeafOp *>(op);
+  CHECK_FAIL_RETURN_UNEXPECTED(leaf_op != nullptr, "[Internal ERROR] " + op->Name() + " has no read depth.");
+  return leaf_op->SetReadDepth(depth_);
+}
+
 TreeModifier::TreeModifier(TreeAdapter *adapter) : TreeModifier(adapter->tree_.get()) {}
 }  // namespace dataset
 }  // namespace mindspore
@@ -83,6 +83,44 @@ class ResizeConnectorRequest : public ChangeRequest {
   int32_t new_size_;
 };
 
+/// ChangeRequest to change the number of rows moved through the output connector of an operator in one operation.
+class ChangeConnectorChunkSizeRequest : public ChangeRequest {
+ public:
+  /// Constructor
+  /// \param chunk_size new chunk size.
+  explicit ChangeConnectorChunkSizeRequest(int32_t chunk_size) : chunk_size_(chunk_size) {}
+  virtual ~ChangeConnectorChunkSizeRequest() = default;
+
+  /// Actual change to the chunk size of the output connector of the given operator
+  /// \param op pointer to the operator that the change will be applied on
+  /// \return Status return Status code
+  Status ApplyChange(DatasetOp *op) override {
+    RETURN_UNEXPECTED_IF_NULL(op->OutputConnector());
+    op->OutputConnector()->SetChunkSize(chunk_size_);
+    return Status::OK();
+  }
+
+ private:
+  int32_t chunk_size_;
+};
+
+/// ChangeRequest to change the number of file reads a leaf operator keeps in flight ahead of its workers.
+class ChangeReadDepthRequest : public ChangeRequest {
+ public:
+  /// Constructor
+  /// \param depth new read depth.
+  explicit ChangeReadDepthRequest(int32_t depth) : depth_(depth) {}
+  virtual ~ChangeReadDepthRequest() = default;
+
+  /// Actual change to the read depth of the given operator
+  /// \param op pointer to the operator that the change will be applied on
+  /// \return Status return Status code
+  Status ApplyChange(DatasetOp *op) override;
+
+ private:
+  int32_t depth_;
+};
+
 /// A callback class used by Aututune to queue changes for opertors
 class AutotuneCallback : public DSCallback {
  public:
@@ -126,6 +126,13 @@ enum class MS_API ShuffleMode {
   kInfile = 3   ///< Shuffle data within each file.
 };
 
+/// \brief Possible policies to place the threads of a pipeline on the NUMA nodes of the host.
+enum class MS_API NumaPolicy {
+  kNone = 0,         ///< Leave the placement to the operating system.
+  kDeviceLocal = 1,  ///< Place all the operators on the NUMA node of the device the pipeline feeds.
+  kBalanced = 2      ///< Spread the operators over the nodes, with the ones next to the device on its node.
+};
+
 /// \brief Possible scale for input audio.
 enum class MS_API ScaleType {
   kMagnitude = 0,  ///< Audio scale is magnitude.
@@ -324,6 +331,9 @@ constexpr uint32_t kCfgRowsPerBuffer = 1;
 constexpr uint32_t kCfgParallelWorkers = 8;
 constexpr uint32_t kCfgWorkerConnectorSize = 16;
 constexpr uint32_t kCfgOpConnectorSize = 16;
+constexpr int32_t kCfgOpConnectorChunkSize = 1;
+constexpr int32_t kCfgTensorMemPoolLimit = 4096;
+constexpr int32_t kCfgReadAheadMemoryLimit = 512;
 constexpr uint32_t kCfgSendingBatch = 0;
 constexpr int32_t kCfgDefaultRankId = -1;
 constexpr uint32_t kCfgDefaultSeed = std::mt19937::default_seed;
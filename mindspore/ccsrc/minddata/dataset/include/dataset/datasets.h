@@ -6178,11 +6178,12 @@ inline std::shared_ptr<YesNoDataset> MS_API YesNo(const std::string &dataset_dir
 /// \param[in] port optional port (default=std::nullopt, means to use 50052).
 /// \param[in] num_connections optional number of connections (default=std::nullopt, means to use 12).
 /// \param[in] prefetch_sz optional prefetch size (default=std::nullopt, means to use 20).
+/// \param[in] compress Compress the rows in the cache to save cache memory at the cost of CPU (default=false).
 /// \return Shared pointer to DatasetCache. If error, nullptr is returned.
 std::shared_ptr<DatasetCache> MS_API CreateDatasetCacheCharIF(
   session_id_type id, uint64_t mem_sz, bool spill, const std::optional<std::vector<char>> &hostname = std::nullopt,
   const std::optional<int32_t> &port = std::nullopt, const std::optional<int32_t> &num_connections = std::nullopt,
-  const std::optional<int32_t> &prefetch_sz = std::nullopt);
+  const std::optional<int32_t> &prefetch_sz = std::nullopt, bool compress = false);
 
 /// \brief Function the create a cache to be attached to a dataset.
 /// \param[in] id A user assigned session id for the current pipeline.
@@ -6193,6 +6194,7 @@ std::shared_ptr<DatasetCache> MS_API CreateDatasetCacheCharIF(
 /// \param[in] port optional port (default=std::nullopt, means to use 50052).
 /// \param[in] num_connections optional number of connections (default=std::nullopt, means to use 12).
 /// \param[in] prefetch_sz optional prefetch size (default=std::nullopt, means to use 20).
+/// \param[in] compress Compress the rows in the cache to save cache memory at the cost of CPU (default=false).
 /// \return Shared pointer to DatasetCache. If error, nullptr is returned.
 /// \par Example
 /// \code
@@ -6209,12 +6211,12 @@ std::shared_ptr<DatasetCache> MS_API CreateDatasetCacheCharIF(
 inline std::shared_ptr<DatasetCache> MS_API CreateDatasetCache(
   session_id_type id, uint64_t mem_sz, bool spill, const std::optional<std::string> &hostname = std::nullopt,
   const std::optional<int32_t> &port = std::nullopt, const std::optional<int32_t> &num_connections = std::nullopt,
-  const std::optional<int32_t> &prefetch_sz = std::nullopt) {
+  const std::optional<int32_t> &prefetch_sz = std::nullopt, bool compress = false) {
   std::optional<std::vector<char>> hostname_c = std::nullopt;
   if (hostname != std::nullopt) {
     hostname_c = std::vector<char>(hostname->begin(), hostname->end());
   }
-  return CreateDatasetCacheCharIF(id, mem_sz, spill, hostname_c, port, num_connections, prefetch_sz);
+  return CreateDatasetCacheCharIF(id, mem_sz, spill, hostname_c, port, num_connections, prefetch_sz, compress);
 }
 
 /// \brief Function to create a ZipDataset.
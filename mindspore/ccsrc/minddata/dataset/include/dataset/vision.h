@@ -309,6 +309,47 @@ class MS_API Equalize final : public TensorTransform {
   std::shared_ptr<TensorOperation> Parse() override;
 };
 
+/// \brief Rescale, normalize and cast the input uint8 image and convert it from HWC to CHW in a single pass, as
+///     Rescale, Normalize, TypeCast and HWC2CHW do one after the other.
+class MS_API FusedNormalize final : public TensorTransform {
+ public:
+  /// \brief Constructor.
+  /// \param[in] mean A vector of mean values for each channel, with respect to channel order.
+  /// \param[in] std A vector of standard deviations for each channel, with respect to channel order.
+  /// \param[in] rescale Rescale factor applied before the normalization (default = 1.0).
+  /// \param[in] shift Shift factor applied before the normalization (default = 0.0).
+  /// \param[in] dtype The output datatype of Tensor, "float32" or "float16" (default = "float32").
+  /// \param[in] hwc_to_chw Whether to convert the output from HWC to CHW (default = true).
+  /// \par Example
+  /// \code
+  ///     /* Define operations */
+  ///     auto decode_op = vision::Decode();
+  ///     auto fused_normalize_op = vision::FusedNormalize({121.0, 115.0, 100.0}, {70.0, 68.0, 71.0});
+  ///
+  ///     /* dataset is an instance of Dataset object */
+  ///     dataset = dataset->Map({decode_op, fused_normalize_op},  // operations
+  ///                            {"image"});                       // input columns
+  /// \endcode
+  FusedNormalize(const std::vector<float> &mean, const std::vector<float> &std, float rescale = 1.0,
+                 float shift = 0.0, const std::string &dtype = "float32", bool hwc_to_chw = true)
+      : FusedNormalize(mean, std, rescale, shift, StringToChar(dtype), hwc_to_chw) {}
+
+  FusedNormalize(const std::vector<float> &mean, const std::vector<float> &std, float rescale, float shift,
+                 const std::vector<char> &dtype, bool hwc_to_chw);
+
+  /// \brief Destructor.
+  ~FusedNormalize() = default;
+
+ protected:
+  /// \brief The function to convert a TensorTransform object into a TensorOperation object.
+  /// \return Shared pointer to TensorOperation object.
+  std::shared_ptr<TensorOperation> Parse() override;
+
+ private:
+  struct Data;
+  std::shared_ptr<Data> data_;
+};
+
 /// \brief Get the number of input image channels.
 /// \param[in] image Tensor of the image.
 /// \param[out] channels Channels of the image.
@@ -0,0 +1,107 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/center_crop_resize_op.h"
+
+#include <cmath>
+#include <limits>
+
+#include "minddata/dataset/core/cv_tensor.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+CenterCropResizeOp::CenterCropResizeOp(int32_t crop_height, int32_t crop_width, int32_t size1, int32_t size2,
+                                       InterpolationMode interpolation)
+    : crop_height_(crop_height),
+      crop_width_(crop_width == 0 ? crop_height : crop_width),
+      size1_(size1),
+      size2_(size2),
+      interpolation_(interpolation),
+      crop_op_(crop_height, crop_width),
+      resize_op_(size1, size2, interpolation) {}
+
+bool CenterCropResizeOp::GetOutputSize(int32_t *output_h, int32_t *output_w) const {
+  if (size2_ == 0) {
+    if (crop_height_ < crop_width_) {
+      *output_h = size1_;
+      *output_w = static_cast<int>(std::floor((static_cast<float>(crop_width_) / crop_height_) * *output_h));
+    } else {
+      *output_w = size1_;
+      *output_h = static_cast<int>(std::floor((static_cast<float>(crop_height_) / crop_width_) * *output_w));
+    }
+  } else {
+    *output_h = size1_;
+    *output_w = size2_;
+  }
+  // The sizes Resize rejects are left to it, for its error
+  const int32_t kResizeShapeLimits = 1000;
+  return *output_h > 0 && *output_w > 0 && crop_height_ < std::numeric_limits<int>::max() / kResizeShapeLimits &&
+         crop_width_ < std::numeric_limits<int>::max() / kResizeShapeLimits &&
+         *output_h <= crop_height_ * kResizeShapeLimits && *output_w <= crop_width_ * kResizeShapeLimits;
+}
+
+Status CenterCropResizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  dsize_t rank = input->shape().Rank();
+  int32_t output_h = 0;
+  int32_t output_w = 0;
+  bool fused = (rank == kMinImageRank || rank == kDefaultImageRank) && crop_height_ > 0 && crop_width_ > 0 &&
+               crop_height_ <= input->shape()[0] && crop_width_ <= input->shape()[1] &&
+               interpolation_ != InterpolationMode::kCubicPil && GetOutputSize(&output_h, &output_w);
+  if (!fused) {
+    std::shared_ptr<Tensor> crop;
+    RETURN_IF_NOT_OK(crop_op_.Compute(input, &crop));
+    return resize_op_.Compute(crop, output);
+  }
+  int32_t x = (static_cast<int32_t>(input->shape()[1]) - crop_width_) / 2;
+  int32_t y = (static_cast<int32_t>(input->shape()[0]) - crop_height_) / 2;
+  if (output_h == crop_height_ && output_w == crop_width_) {
+    return Crop(input, output, x, y, crop_width_, crop_height_);
+  }
+  std::shared_ptr<CVTensor> input_cv = CVTensor::AsCVTensor(input);
+  if (!input_cv->mat().data) {
+    RETURN_STATUS_UNEXPECTED("[Internal ERROR] CenterCropResize: load image failed.");
+  }
+  try {
+    TensorShape shape{output_h, output_w};
+    if (rank == kDefaultImageRank) {
+      shape = shape.AppendDim(input_cv->shape()[kChannelIndexHWC]);
+    }
+    std::shared_ptr<CVTensor> output_cv;
+    RETURN_IF_NOT_OK(CVTensor::CreateEmpty(shape, input_cv->type(), &output_cv));
+    cv::Rect roi(x, y, crop_width_, crop_height_);
+    cv::resize(input_cv->mat()(roi), output_cv->mat(), cv::Size(output_w, output_h), 0, 0,
+               GetCVInterpolationMode(interpolation_));
+    *output = std::static_pointer_cast<Tensor>(output_cv);
+  } catch (const cv::Exception &e) {
+    RETURN_STATUS_UNEXPECTED("CenterCropResize: " + std::string(e.what()));
+  }
+  return Status::OK();
+}
+
+Status CenterCropResizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  std::vector<TensorShape> crop_shapes;
+  RETURN_IF_NOT_OK(crop_op_.OutputShape(inputs, crop_shapes));
+  return resize_op_.OutputShape(crop_shapes, outputs);
+}
+
+void CenterCropResizeOp::Print(std::ostream &out) const {
+  out << Name() << ": cropHeight: " << crop_height_ << " cropWidth: " << crop_width_ << " size: " << size1_ << " "
+      << size2_;
+}
+}  // namespace dataset
+}  // namespace mindspore
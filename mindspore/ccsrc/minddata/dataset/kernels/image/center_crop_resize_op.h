@@ -0,0 +1,70 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_CENTER_CROP_RESIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_CENTER_CROP_RESIZE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// A CenterCropOp followed by a ResizeOp, as fused by the TensorOpFusionPass.
+// The crop is resized straight from the image, so it is never copied. The output is the same as the one of the two
+// ops; a crop larger than the image, which needs padding, and the PIL bicubic interpolation are left to them.
+class CenterCropResizeOp : public TensorOp {
+ public:
+  // @param crop_height - The height of the crop
+  // @param crop_width - The width of the crop, 0 for the height
+  // @param size1 - The first size of the output, as the one of ResizeOp
+  // @param size2 - The second size of the output, as the one of ResizeOp
+  // @param interpolation - The interpolation mode of the resize
+  CenterCropResizeOp(int32_t crop_height, int32_t crop_width, int32_t size1, int32_t size2,
+                     InterpolationMode interpolation);
+
+  ~CenterCropResizeOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  std::string Name() const override { return kCenterCropResizeOp; }
+
+ private:
+  // Compute the size of the output of the resize of the crop, as ResizeOp does
+  // @return false if the ops have to run one after the other
+  bool GetOutputSize(int32_t *output_h, int32_t *output_w) const;
+
+  int32_t crop_height_;
+  int32_t crop_width_;
+  int32_t size1_;
+  int32_t size2_;
+  InterpolationMode interpolation_;
+  CenterCropOp crop_op_;
+  ResizeOp resize_op_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_CENTER_CROP_RESIZE_OP_H_
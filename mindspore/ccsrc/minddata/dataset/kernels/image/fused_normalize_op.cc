@@ -0,0 +1,234 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+
+#include <type_traits>
+#include <utility>
+
+#include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/normalize_simd.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// The normalization of the crop, common to the loops of all the types
+struct CropParams {
+  int64_t top;
+  int64_t left;
+  std::vector<float> mean;
+  std::vector<float> std;
+  bool rescale;
+  float scale;
+  float shift;
+  bool hwc_to_chw;
+};
+
+// Normalize the crop at (top, left) of an HWC image. Each value is computed as NormalizeOp and TypeCastOp do, from T1
+// to float and then from float to T2, so the output is the same.
+template <typename T1, typename T2>
+void NormalizeCrop(const std::shared_ptr<Tensor> &input, const CropParams &p, const std::shared_ptr<Tensor> &output) {
+  const std::vector<float> &mean = p.mean;
+  const std::vector<float> &std = p.std;
+  const bool hwc_to_chw = p.hwc_to_chw;
+  const int64_t width = input->shape()[1];
+  const int64_t num_channels = input->shape()[kChannelIndexHWC];
+  const int64_t out_height = hwc_to_chw ? output->shape()[1] : output->shape()[0];
+  const int64_t out_width = hwc_to_chw ? output->shape()[2] : output->shape()[1];
+  const int64_t plane = out_height * out_width;
+  const auto *in = reinterpret_cast<const T1 *>(input->GetBuffer());
+  T2 *out = &(*output->begin<T2>());
+  for (int64_t y = 0; y < out_height; y++) {
+    const T1 *in_row = in + ((p.top + y) * width + p.left) * num_channels;
+    for (int64_t x = 0; x < out_width; x++) {
+      for (int64_t c = 0; c < num_channels; c++) {
+        float value = static_cast<float>(in_row[x * num_channels + c]);
+        if (p.rescale) {
+          value = value * p.scale + p.shift;
+        }
+        value = (value - mean[c]) / std[c];
+        int64_t out_index = hwc_to_chw ? c * plane + y * out_width + x : (y * out_width + x) * num_channels + c;
+        out[out_index] = static_cast<T2>(value);
+      }
+    }
+  }
+}
+
+// Run the vectorized kernel for the crop of a uint8 image
+template <typename T>
+bool NormalizeCropSimd(const std::shared_ptr<Tensor> &input, const CropParams &p,
+                       const std::shared_ptr<Tensor> &output) {
+  const int64_t width = input->shape()[1];
+  const int64_t num_channels = input->shape()[kChannelIndexHWC];
+  NormalizeU8Params params;
+  params.in = input->GetBuffer() + (p.top * width + p.left) * num_channels;
+  params.in_row_stride = width * num_channels;
+  params.height = p.hwc_to_chw ? output->shape()[1] : output->shape()[0];
+  params.width = p.hwc_to_chw ? output->shape()[2] : output->shape()[1];
+  params.num_channels = num_channels;
+  params.mean = p.mean.data();
+  params.std = p.std.data();
+  params.rescale = p.rescale;
+  params.scale = p.scale;
+  params.shift = p.shift;
+  params.hwc_to_chw = p.hwc_to_chw;
+  return NormalizeU8Simd(params, &(*output->begin<T>()));
+}
+
+template <typename T1>
+bool NormalizeCropTo(const std::shared_ptr<Tensor> &input, const CropParams &p, const std::shared_ptr<Tensor> &output) {
+  switch (output->type().value()) {
+    case DataType::DE_FLOAT32:
+      if (!std::is_same<T1, uint8_t>::value || !NormalizeCropSimd<float>(input, p, output)) {
+        NormalizeCrop<T1, float>(input, p, output);
+      }
+      return true;
+    case DataType::DE_FLOAT16:
+      if (!std::is_same<T1, uint8_t>::value || !NormalizeCropSimd<float16>(input, p, output)) {
+        NormalizeCrop<T1, float16>(input, p, output);
+      }
+      return true;
+    case DataType::DE_FLOAT64:
+      NormalizeCrop<T1, double>(input, p, output);
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+FusedNormalizeOp::FusedNormalizeOp(int32_t crop_height, int32_t crop_width, const std::vector<float> &mean,
+                                   const std::vector<float> &std, float rescale, float shift,
+                                   const DataType &output_type, bool hwc_to_chw)
+    : crop_height_(crop_height),
+      crop_width_(crop_width == 0 ? crop_height : crop_width),
+      mean_(mean),
+      std_(std),
+      rescale_(rescale),
+      shift_(shift),
+      output_type_(output_type),
+      hwc_to_chw_(hwc_to_chw) {}
+
+Status FusedNormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  const TensorShape &shape = input->shape();
+  if (shape.Rank() != kDefaultImageRank || mean_.size() != std_.size() ||
+      (mean_.size() != 1 && static_cast<int64_t>(mean_.size()) != shape[kChannelIndexHWC])) {
+    return ComputeChain(input, output);
+  }
+  int64_t height = shape[0];
+  int64_t width = shape[1];
+  if (crop_height_ != 0) {
+    if (crop_height_ < 0 || crop_height_ > height || crop_width_ <= 0 || crop_width_ > width) {
+      return ComputeChain(input, output);
+    }
+    height = crop_height_;
+    width = crop_width_;
+  }
+  int64_t num_channels = shape[kChannelIndexHWC];
+  CropParams params;
+  params.top = (shape[0] - height) / 2;
+  params.left = (shape[1] - width) / 2;
+  params.mean = mean_;
+  params.std = std_;
+  // 1 mean/std value for several channels is duplicated, as NormalizeOp does
+  params.mean.resize(num_channels, mean_[0]);
+  params.std.resize(num_channels, std_[0]);
+  params.rescale = IsRescaled();
+  params.scale = rescale_;
+  params.shift = shift_;
+  params.hwc_to_chw = hwc_to_chw_;
+  TensorShape out_shape = hwc_to_chw_ ? TensorShape({num_channels, height, width})
+                                      : TensorShape({height, width, num_channels});
+  std::shared_ptr<Tensor> out;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(out_shape, output_type_, &out));
+  bool done = false;
+  switch (input->type().value()) {
+    case DataType::DE_UINT8:
+      done = NormalizeCropTo<uint8_t>(input, params, out);
+      break;
+    case DataType::DE_FLOAT32:
+      done = NormalizeCropTo<float>(input, params, out);
+      break;
+    default:
+      break;
+  }
+  if (!done) {
+    return ComputeChain(input, output);
+  }
+  *output = std::move(out);
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::ComputeChain(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  std::shared_ptr<Tensor> image = input;
+  if (crop_height_ != 0) {
+    RETURN_IF_NOT_OK(CenterCropOp(crop_height_, crop_width_).Compute(input, &image));
+  }
+  if (IsRescaled()) {
+    std::shared_ptr<Tensor> rescaled;
+    RETURN_IF_NOT_OK(Rescale(image, &rescaled, rescale_, shift_));
+    image = std::move(rescaled);
+  }
+  std::shared_ptr<Tensor> normalized;
+  RETURN_IF_NOT_OK(Normalize(image, &normalized, mean_, std_, true));
+  if (output_type_ != DataType(DataType::DE_FLOAT32)) {
+    std::shared_ptr<Tensor> cast;
+    RETURN_IF_NOT_OK(TypeCast(normalized, &cast, output_type_));
+    normalized = std::move(cast);
+  }
+  if (hwc_to_chw_) {
+    return HwcToChw(normalized, output);
+  }
+  *output = std::move(normalized);
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
+  if (crop_height_ != 0) {
+    RETURN_IF_NOT_OK(CenterCropOp(crop_height_, crop_width_).OutputShape(inputs, outputs));
+  }
+  if (hwc_to_chw_ && outputs[0].Rank() == kDefaultImageRank) {
+    std::vector<TensorShape> crop_shapes = outputs;
+    RETURN_IF_NOT_OK(HwcToChwOp().OutputShape(crop_shapes, outputs));
+  }
+  return Status::OK();
+}
+
+Status FusedNormalizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = output_type_;
+  return Status::OK();
+}
+
+void FusedNormalizeOp::Print(std::ostream &out) const {
+  out << Name() << ": cropHeight: " << crop_height_ << " cropWidth: " << crop_width_ << " mean: ";
+  for (const auto &m : mean_) {
+    out << m << ", ";
+  }
+  out << "std: ";
+  for (const auto &s : std_) {
+    out << s << ", ";
+  }
+  out << "rescale: " << rescale_ << " shift: " << shift_ << " outputType: " << output_type_.ToString()
+      << " hwcToChw: " << hwc_to_chw_;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,80 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// The chain [CenterCropOp] [RescaleOp] NormalizeOp [TypeCastOp] [HwcToChwOp] of an HWC image, as fused by the
+// TensorOpFusionPass or created by the FusedNormalize vision op.
+// Each pixel of the crop is read once from the image, normalized, cast and written at its place in the layout of the
+// output, so none of the intermediate images is built. A uint8 image normalized to float32 or float16 is run through
+// the vectorized kernels of normalize_simd.h, the other types through a scalar loop. The output is the same as the one
+// of the chain, up to the last bit of a rescaled value. The inputs the loops are not meant for (a crop which needs
+// padding, an image which is not <H,W,C>, an unusual type) are run through the ops of the chain one after the other.
+class FusedNormalizeOp : public TensorOp {
+ public:
+  // @param crop_height - The height of the center crop, 0 for no crop
+  // @param crop_width - The width of the center crop, 0 for the height
+  // @param mean - The mean of the channels, as the one of NormalizeOp
+  // @param std - The standard deviation of the channels, as the one of NormalizeOp
+  // @param rescale - The scale applied before the normalization, as the one of RescaleOp
+  // @param shift - The shift applied before the normalization, no rescale is done for a scale of 1 and a shift of 0
+  // @param output_type - The type the normalized image is cast to
+  // @param hwc_to_chw - Whether the output is <C,H,W>
+  FusedNormalizeOp(int32_t crop_height, int32_t crop_width, const std::vector<float> &mean,
+                   const std::vector<float> &std, float rescale, float shift, const DataType &output_type,
+                   bool hwc_to_chw);
+
+  ~FusedNormalizeOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kFusedNormalizeOp; }
+
+ private:
+  // Run the ops of the chain one after the other
+  Status ComputeChain(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
+
+  bool IsRescaled() const { return rescale_ != 1.0f || shift_ != 0.0f; }
+
+  int32_t crop_height_;
+  int32_t crop_width_;
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  float rescale_;
+  float shift_;
+  DataType output_type_;
+  bool hwc_to_chw_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_FUSED_NORMALIZE_OP_H_
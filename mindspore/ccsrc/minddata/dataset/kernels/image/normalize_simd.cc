@@ -0,0 +1,404 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/normalize_simd.h"
+
+#include <atomic>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define NORMALIZE_SIMD_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define NORMALIZE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int64_t kMaxChannels = 4;
+constexpr int64_t kNumPlanarChannels = 3;
+constexpr int64_t kPlanarPixels = 16;  // The pixels deinterleaved at once
+
+std::atomic<int> g_simd_level{-1};
+
+// Normalize the pixels [x_begin, x_end) of a row of the crop one value at a time, as the lanes of the kernels do
+template <typename T>
+void NormalizePixels(const NormalizeU8Params &p, int64_t y, int64_t x_begin, int64_t x_end, T *out) {
+  const uint8_t *row = p.in + y * p.in_row_stride;
+  const int64_t plane = p.height * p.width;
+  for (int64_t x = x_begin; x < x_end; x++) {
+    for (int64_t c = 0; c < p.num_channels; c++) {
+      float value = static_cast<float>(row[x * p.num_channels + c]);
+      if (p.rescale) {
+        value = value * p.scale + p.shift;
+      }
+      value = (value - p.mean[c]) / p.std[c];
+      int64_t index = p.hwc_to_chw ? c * plane + y * p.width + x : (y * p.width + x) * p.num_channels + c;
+      out[index] = static_cast<T>(value);
+    }
+  }
+}
+
+// The mean and std of each lane of the num_channels vectors normalizing lanes consecutive pixels of an HWC row
+void RepeatChannels(const NormalizeU8Params &p, int64_t lanes, float *mean, float *std) {
+  for (int64_t i = 0; i < lanes * p.num_channels; i++) {
+    mean[i] = p.mean[i % p.num_channels];
+    std[i] = p.std[i % p.num_channels];
+  }
+}
+
+#ifdef NORMALIZE_SIMD_X86
+#define NORMALIZE_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#define NORMALIZE_TARGET_AVX512 __attribute__((target("avx512f,avx2,f16c")))
+#define NORMALIZE_TARGET_SSSE3 __attribute__((target("ssse3")))
+
+// pshufb masks gathering channel c of 16 RGB pixels from the 3 vectors of 16 bytes they are stored in
+alignas(16) const int8_t kDeinterleaveMasks[kNumPlanarChannels][kNumPlanarChannels][16] = {
+  {{0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+   {-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1},
+   {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13}},
+  {{1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+   {-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1},
+   {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14}},
+  {{2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+   {-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1},
+   {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15}}};
+
+// Split 16 RGB pixels into the 16 bytes of each channel, for both the AVX2 and the AVX-512 kernels
+NORMALIZE_TARGET_SSSE3 inline void Deinterleave3(const uint8_t *in, __m128i *channels) {
+  __m128i src[kNumPlanarChannels];
+  for (int64_t s = 0; s < kNumPlanarChannels; s++) {
+    src[s] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + s * 16));
+  }
+  for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+    __m128i value = _mm_setzero_si128();
+    for (int64_t s = 0; s < kNumPlanarChannels; s++) {
+      __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(kDeinterleaveMasks[c][s]));
+      value = _mm_or_si128(value, _mm_shuffle_epi8(src[s], mask));
+    }
+    channels[c] = value;
+  }
+}
+
+NORMALIZE_TARGET_AVX2 inline __m256 NormalizeAvx2(__m128i bytes, __m256 mean, __m256 std, const NormalizeU8Params &p) {
+  __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+  if (p.rescale) {
+    value = _mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(p.scale)), _mm256_set1_ps(p.shift));
+  }
+  return _mm256_div_ps(_mm256_sub_ps(value, mean), std);
+}
+
+NORMALIZE_TARGET_AVX2 inline void StoreAvx2(float *out, __m256 value) { _mm256_storeu_ps(out, value); }
+
+NORMALIZE_TARGET_AVX2 inline void StoreAvx2(float16 *out, __m256 value) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+}
+
+template <typename T>
+NORMALIZE_TARGET_AVX2 void NormalizeAvx2Rows(const NormalizeU8Params &p, T *out) {
+  constexpr int64_t lanes = 8;
+  const int64_t plane = p.height * p.width;
+  if (p.hwc_to_chw && p.num_channels == kNumPlanarChannels) {
+    __m256 mean[kNumPlanarChannels];
+    __m256 std[kNumPlanarChannels];
+    for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+      mean[c] = _mm256_set1_ps(p.mean[c]);
+      std[c] = _mm256_set1_ps(p.std[c]);
+    }
+    const int64_t end = p.width - p.width % kPlanarPixels;
+    for (int64_t y = 0; y < p.height; y++) {
+      const uint8_t *row = p.in + y * p.in_row_stride;
+      for (int64_t x = 0; x < end; x += kPlanarPixels) {
+        __m128i channels[kNumPlanarChannels];
+        Deinterleave3(row + x * kNumPlanarChannels, channels);
+        for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+          T *dst = out + c * plane + y * p.width + x;
+          StoreAvx2(dst, NormalizeAvx2(channels[c], mean[c], std[c], p));
+          StoreAvx2(dst + lanes, NormalizeAvx2(_mm_srli_si128(channels[c], lanes), mean[c], std[c], p));
+        }
+      }
+      NormalizePixels(p, y, end, p.width, out);
+    }
+    return;
+  }
+  // HWC, or CHW of 1 channel: the values of each row are normalized in place, the channels of the lanes repeat
+  float mean_lanes[lanes * kMaxChannels];
+  float std_lanes[lanes * kMaxChannels];
+  RepeatChannels(p, lanes, mean_lanes, std_lanes);
+  __m256 mean[kMaxChannels];
+  __m256 std[kMaxChannels];
+  for (int64_t v = 0; v < p.num_channels; v++) {
+    mean[v] = _mm256_loadu_ps(mean_lanes + v * lanes);
+    std[v] = _mm256_loadu_ps(std_lanes + v * lanes);
+  }
+  const int64_t end = p.width - p.width % lanes;
+  for (int64_t y = 0; y < p.height; y++) {
+    const uint8_t *row = p.in + y * p.in_row_stride;
+    T *dst = out + y * p.width * p.num_channels;
+    for (int64_t i = 0; i < end * p.num_channels; i += lanes * p.num_channels) {
+      for (int64_t v = 0; v < p.num_channels; v++) {
+        __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(row + i + v * lanes));
+        StoreAvx2(dst + i + v * lanes, NormalizeAvx2(bytes, mean[v], std[v], p));
+      }
+    }
+    NormalizePixels(p, y, end, p.width, out);
+  }
+}
+
+NORMALIZE_TARGET_AVX512 inline __m512 NormalizeAvx512(__m128i bytes, __m512 mean, __m512 std,
+                                                      const NormalizeU8Params &p) {
+  __m512 value = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+  if (p.rescale) {
+    value = _mm512_add_ps(_mm512_mul_ps(value, _mm512_set1_ps(p.scale)), _mm512_set1_ps(p.shift));
+  }
+  return _mm512_div_ps(_mm512_sub_ps(value, mean), std);
+}
+
+NORMALIZE_TARGET_AVX512 inline void StoreAvx512(float *out, __m512 value) { _mm512_storeu_ps(out, value); }
+
+NORMALIZE_TARGET_AVX512 inline void StoreAvx512(float16 *out, __m512 value) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm512_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT));
+}
+
+template <typename T>
+NORMALIZE_TARGET_AVX512 void NormalizeAvx512Rows(const NormalizeU8Params &p, T *out) {
+  constexpr int64_t lanes = 16;
+  const int64_t plane = p.height * p.width;
+  if (p.hwc_to_chw && p.num_channels == kNumPlanarChannels) {
+    __m512 mean[kNumPlanarChannels];
+    __m512 std[kNumPlanarChannels];
+    for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+      mean[c] = _mm512_set1_ps(p.mean[c]);
+      std[c] = _mm512_set1_ps(p.std[c]);
+    }
+    const int64_t end = p.width - p.width % kPlanarPixels;
+    for (int64_t y = 0; y < p.height; y++) {
+      const uint8_t *row = p.in + y * p.in_row_stride;
+      for (int64_t x = 0; x < end; x += kPlanarPixels) {
+        __m128i channels[kNumPlanarChannels];
+        Deinterleave3(row + x * kNumPlanarChannels, channels);
+        for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+          StoreAvx512(out + c * plane + y * p.width + x, NormalizeAvx512(channels[c], mean[c], std[c], p));
+        }
+      }
+      NormalizePixels(p, y, end, p.width, out);
+    }
+    return;
+  }
+  float mean_lanes[lanes * kMaxChannels];
+  float std_lanes[lanes * kMaxChannels];
+  RepeatChannels(p, lanes, mean_lanes, std_lanes);
+  __m512 mean[kMaxChannels];
+  __m512 std[kMaxChannels];
+  for (int64_t v = 0; v < p.num_channels; v++) {
+    mean[v] = _mm512_loadu_ps(mean_lanes + v * lanes);
+    std[v] = _mm512_loadu_ps(std_lanes + v * lanes);
+  }
+  const int64_t end = p.width - p.width % lanes;
+  for (int64_t y = 0; y < p.height; y++) {
+    const uint8_t *row = p.in + y * p.in_row_stride;
+    T *dst = out + y * p.width * p.num_channels;
+    for (int64_t i = 0; i < end * p.num_channels; i += lanes * p.num_channels) {
+      for (int64_t v = 0; v < p.num_channels; v++) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i + v * lanes));
+        StoreAvx512(dst + i + v * lanes, NormalizeAvx512(bytes, mean[v], std[v], p));
+      }
+    }
+    NormalizePixels(p, y, end, p.width, out);
+  }
+}
+
+#endif  // NORMALIZE_SIMD_X86
+
+#ifdef NORMALIZE_SIMD_NEON
+inline float32x4_t NormalizeNeon(uint16x4_t values, float32x4_t mean, float32x4_t std, const NormalizeU8Params &p) {
+  float32x4_t value = vcvtq_f32_u32(vmovl_u16(values));
+  if (p.rescale) {
+    value = vaddq_f32(vmulq_f32(value, vdupq_n_f32(p.scale)), vdupq_n_f32(p.shift));
+  }
+  return vdivq_f32(vsubq_f32(value, mean), std);
+}
+
+inline void StoreNeon(float *out, float32x4_t value) { vst1q_f32(out, value); }
+
+inline void StoreNeon(float16 *out, float32x4_t value) {
+  vst1_u16(reinterpret_cast<uint16_t *>(out), vreinterpret_u16_f16(vcvt_f16_f32(value)));
+}
+
+// Normalize 16 values of the same channel, or of the repeating channels whose mean and std are given per lane
+template <typename T>
+inline void Normalize16Neon(uint8x16_t bytes, const float32x4_t *mean, const float32x4_t *std,
+                            const NormalizeU8Params &p, T *out) {
+  constexpr int64_t lanes = 4;
+  uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+  uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+  StoreNeon(out, NormalizeNeon(vget_low_u16(low), mean[0], std[0], p));
+  StoreNeon(out + lanes, NormalizeNeon(vget_high_u16(low), mean[1], std[1], p));
+  StoreNeon(out + 2 * lanes, NormalizeNeon(vget_low_u16(high), mean[2], std[2], p));
+  StoreNeon(out + 3 * lanes, NormalizeNeon(vget_high_u16(high), mean[3], std[3], p));
+}
+
+template <typename T>
+void NormalizeNeonRows(const NormalizeU8Params &p, T *out) {
+  constexpr int64_t lanes = 4;
+  constexpr int64_t vectors = 4;  // The float vectors of the 16 bytes loaded at once
+  const int64_t plane = p.height * p.width;
+  if (p.hwc_to_chw && p.num_channels == kNumPlanarChannels) {
+    float32x4_t mean[kNumPlanarChannels][vectors];
+    float32x4_t std[kNumPlanarChannels][vectors];
+    for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+      for (int64_t v = 0; v < vectors; v++) {
+        mean[c][v] = vdupq_n_f32(p.mean[c]);
+        std[c][v] = vdupq_n_f32(p.std[c]);
+      }
+    }
+    const int64_t end = p.width - p.width % kPlanarPixels;
+    for (int64_t y = 0; y < p.height; y++) {
+      const uint8_t *row = p.in + y * p.in_row_stride;
+      for (int64_t x = 0; x < end; x += kPlanarPixels) {
+        uint8x16x3_t channels = vld3q_u8(row + x * kNumPlanarChannels);
+        for (int64_t c = 0; c < kNumPlanarChannels; c++) {
+          Normalize16Neon(channels.val[c], mean[c], std[c], p, out + c * plane + y * p.width + x);
+        }
+      }
+      NormalizePixels(p, y, end, p.width, out);
+    }
+    return;
+  }
+  // The 16 bytes of a load hold 16 / C pixels at most, so a chunk of lanes * C values is made of C loads of 4 pixels
+  // each, i.e. of 16 pixels per num_channels loads of 16 bytes.
+  constexpr int64_t pixels = kPlanarPixels;
+  float mean_lanes[pixels * kMaxChannels];
+  float std_lanes[pixels * kMaxChannels];
+  RepeatChannels(p, pixels, mean_lanes, std_lanes);
+  float32x4_t mean[kMaxChannels * vectors];
+  float32x4_t std[kMaxChannels * vectors];
+  for (int64_t v = 0; v < p.num_channels * vectors; v++) {
+    mean[v] = vld1q_f32(mean_lanes + v * lanes);
+    std[v] = vld1q_f32(std_lanes + v * lanes);
+  }
+  const int64_t end = p.width - p.width % pixels;
+  for (int64_t y = 0; y < p.height; y++) {
+    const uint8_t *row = p.in + y * p.in_row_stride;
+    T *dst = out + y * p.width * p.num_channels;
+    for (int64_t i = 0; i < end * p.num_channels; i += pixels * p.num_channels) {
+      for (int64_t v = 0; v < p.num_channels; v++) {
+        Normalize16Neon(vld1q_u8(row + i + v * pixels), mean + v * vectors, std + v * vectors, p,
+                        dst + i + v * pixels);
+      }
+    }
+    NormalizePixels(p, y, end, p.width, out);
+  }
+}
+#endif  // NORMALIZE_SIMD_NEON
+
+SimdLevel DetectSimdLevel() {
+#ifdef NORMALIZE_SIMD_X86
+  __builtin_cpu_init();
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+  // The float16 kernels convert with F16C, which every CPU with AVX2 has but __builtin_cpu_supports can't tell.
+  bool f16c = __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_F16C) != 0;
+  if (!f16c || !__builtin_cpu_supports("avx2")) {
+    return SimdLevel::kNone;
+  }
+  return __builtin_cpu_supports("avx512f") ? SimdLevel::kAvx512 : SimdLevel::kAvx2;
+#elif defined(NORMALIZE_SIMD_NEON)
+  return SimdLevel::kNeon;
+#else
+  return SimdLevel::kNone;
+#endif
+}
+
+template <typename T>
+bool NormalizeU8SimdImpl(const NormalizeU8Params &params, T *out) {
+  if (params.in == nullptr || params.mean == nullptr || params.std == nullptr || out == nullptr) {
+    return false;
+  }
+  if (params.num_channels < 1 || params.num_channels > kMaxChannels) {
+    return false;
+  }
+  // A <C,H,W> output is written one plane at a time, only RGB is deinterleaved.
+  if (params.hwc_to_chw && params.num_channels != 1 && params.num_channels != kNumPlanarChannels) {
+    return false;
+  }
+  NormalizeU8Params p = params;
+  if (p.num_channels == 1) {
+    p.hwc_to_chw = false;  // A single plane is laid out the same either way
+  }
+  switch (GetSimdLevel()) {
+#ifdef NORMALIZE_SIMD_X86
+    case SimdLevel::kAvx512:
+      NormalizeAvx512Rows(p, out);
+      return true;
+    case SimdLevel::kAvx2:
+      NormalizeAvx2Rows(p, out);
+      return true;
+#endif
+#ifdef NORMALIZE_SIMD_NEON
+    case SimdLevel::kNeon:
+      NormalizeNeonRows(p, out);
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+SimdLevel GetSupportedSimdLevel() {
+  static const SimdLevel supported = DetectSimdLevel();
+  return supported;
+}
+
+SimdLevel GetSimdLevel() {
+  int level = g_simd_level.load(std::memory_order_relaxed);
+  return level < 0 ? GetSupportedSimdLevel() : static_cast<SimdLevel>(level);
+}
+
+void SetSimdLevel(SimdLevel level) {
+  SimdLevel supported = GetSupportedSimdLevel();
+  // NEON and the x86 levels are not comparable, an instruction set of another architecture means none.
+  bool same_arch = level == SimdLevel::kNone || (level == SimdLevel::kNeon) == (supported == SimdLevel::kNeon);
+  if (!same_arch || supported == SimdLevel::kNone) {
+    level = SimdLevel::kNone;
+  } else if (static_cast<int>(level) > static_cast<int>(supported)) {
+    level = supported;
+  }
+  g_simd_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+std::string SimdLevelName(SimdLevel level) {
+  switch (level) {
+    case SimdLevel::kNeon:
+      return "NEON";
+    case SimdLevel::kAvx2:
+      return "AVX2";
+    case SimdLevel::kAvx512:
+      return "AVX-512";
+    default:
+      return "none";
+  }
+}
+
+bool NormalizeU8Simd(const NormalizeU8Params &params, float *out) { return NormalizeU8SimdImpl(params, out); }
+
+bool NormalizeU8Simd(const NormalizeU8Params &params, float16 *out) { return NormalizeU8SimdImpl(params, out); }
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,70 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_NORMALIZE_SIMD_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_NORMALIZE_SIMD_H_
+
+#include <cstdint>
+#include <string>
+
+#include "base/float16.h"
+
+namespace mindspore {
+namespace dataset {
+// The instruction sets the vectorized normalize kernels are written for
+enum class SimdLevel { kNone = 0, kNeon = 1, kAvx2 = 2, kAvx512 = 3 };
+
+// @return The best instruction set of the CPU the kernels are written for, detected once
+SimdLevel GetSupportedSimdLevel();
+
+// @return The instruction set the kernels use, the supported one unless lowered by SetSimdLevel
+SimdLevel GetSimdLevel();
+
+// Lower the instruction set the kernels use, e.g. to compare them with the scalar loops. A level the CPU does not
+// support is capped to the supported one.
+// @param level - The instruction set, kNone for the scalar loops
+void SetSimdLevel(SimdLevel level);
+
+std::string SimdLevelName(SimdLevel level);
+
+// The normalization of a crop of a uint8 HWC image: out = (in * rescale + shift - mean[c]) / std[c], where the rescale
+// is skipped when it is the identity. The sub and div are computed in float as NormalizeOp does, so without a rescale
+// the output of the kernels is the same as the one of the scalar loops; the rescale may be rounded once instead of
+// twice where the compiler fuses it into a multiply-add.
+struct NormalizeU8Params {
+  const uint8_t *in = nullptr;  // The first pixel of the crop
+  int64_t in_row_stride = 0;    // The number of values in a row of the image
+  int64_t height = 0;           // The height of the crop
+  int64_t width = 0;            // The width of the crop
+  int64_t num_channels = 0;
+  const float *mean = nullptr;  // One value per channel
+  const float *std = nullptr;   // One value per channel
+  bool rescale = false;
+  float scale = 1.0;
+  float shift = 0.0;
+  bool hwc_to_chw = false;  // Whether the output is <C,H,W>
+};
+
+// Run the vectorized kernel of the instruction set in use.
+// @param params - The normalization
+// @param out - The output, of height * width * num_channels values
+// @return false if there is no kernel for the instruction set in use or the number of channels, the caller then
+//     runs the scalar loop
+bool NormalizeU8Simd(const NormalizeU8Params &params, float *out);
+bool NormalizeU8Simd(const NormalizeU8Params &params, float16 *out);
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_NORMALIZE_SIMD_H_
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/ir/vision/center_crop_resize_ir.h"
+
+#include "minddata/dataset/kernels/image/center_crop_resize_op.h"
+
+#include "minddata/dataset/kernels/ir/validators.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+// CenterCropResizeOperation
+CenterCropResizeOperation::CenterCropResizeOperation(const std::vector<int32_t> &crop_size,
+                                                     const std::vector<int32_t> &size, InterpolationMode interpolation)
+    : crop_size_(crop_size), size_(size), interpolation_(interpolation) {}
+
+CenterCropResizeOperation::~CenterCropResizeOperation() = default;
+
+std::string CenterCropResizeOperation::Name() const { return kCenterCropResizeOperation; }
+
+Status CenterCropResizeOperation::ValidateParams() {
+  RETURN_IF_NOT_OK(ValidateVectorSize("CenterCropResize", crop_size_));
+  RETURN_IF_NOT_OK(ValidateVectorSize("CenterCropResize", size_));
+  return Status::OK();
+}
+
+std::shared_ptr<TensorOp> CenterCropResizeOperation::Build() {
+  constexpr size_t size_two = 2;
+  int32_t crop_height = crop_size_[0];
+  int32_t crop_width = crop_size_.size() == size_two ? crop_size_[1] : crop_height;
+  // A single size resizes the smaller edge of the crop, as Resize does
+  int32_t height = size_[0];
+  int32_t width = size_.size() == size_two ? size_[1] : 0;
+  return std::make_shared<CenterCropResizeOp>(crop_height, crop_width, height, width, interpolation_);
+}
+
+Status CenterCropResizeOperation::to_json(nlohmann::json *out_json) {
+  nlohmann::json args;
+  args["crop_size"] = crop_size_;
+  args["size"] = size_;
+  args["interpolation"] = interpolation_;
+  *out_json = args;
+  return Status::OK();
+}
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
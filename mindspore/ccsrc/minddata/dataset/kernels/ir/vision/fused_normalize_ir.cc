@@ -0,0 +1,101 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
+
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+
+#include "minddata/dataset/kernels/ir/validators.h"
+#include "minddata/dataset/util/validators.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+// FusedNormalizeOperation
+FusedNormalizeOperation::FusedNormalizeOperation(const std::vector<int32_t> &crop_size,
+                                                 const std::vector<float> &mean, const std::vector<float> &std,
+                                                 float rescale, float shift, const DataType &data_type,
+                                                 bool hwc_to_chw)
+    : crop_size_(crop_size),
+      mean_(mean),
+      std_(std),
+      rescale_(rescale),
+      shift_(shift),
+      data_type_(data_type),
+      hwc_to_chw_(hwc_to_chw) {}
+
+FusedNormalizeOperation::~FusedNormalizeOperation() = default;
+
+std::string FusedNormalizeOperation::Name() const { return kFusedNormalizeOperation; }
+
+Status FusedNormalizeOperation::ValidateParams() {
+  if (!crop_size_.empty()) {
+    RETURN_IF_NOT_OK(ValidateVectorSize("FusedNormalize", crop_size_));
+  }
+  RETURN_IF_NOT_OK(ValidateVectorMeanStd("FusedNormalize", mean_, std_));
+  if (data_type_ != DataType::DE_FLOAT32 && data_type_ != DataType::DE_FLOAT16) {
+    std::string err_msg = "FusedNormalize: data_type must be float32 or float16, but got: " + data_type_.ToString();
+    LOG_AND_RETURN_STATUS_SYNTAX_ERROR(err_msg);
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<TensorOp> FusedNormalizeOperation::Build() {
+  constexpr size_t size_two = 2;
+  int32_t crop_height = 0;
+  int32_t crop_width = 0;
+  if (!crop_size_.empty()) {
+    crop_height = crop_size_[0];
+    crop_width = crop_size_.size() == size_two ? crop_size_[1] : crop_height;
+  }
+  return std::make_shared<FusedNormalizeOp>(crop_height, crop_width, mean_, std_, rescale_, shift_, data_type_,
+                                            hwc_to_chw_);
+}
+
+Status FusedNormalizeOperation::to_json(nlohmann::json *out_json) {
+  nlohmann::json args;
+  args["crop_size"] = crop_size_;
+  args["mean"] = mean_;
+  args["std"] = std_;
+  args["rescale"] = rescale_;
+  args["shift"] = shift_;
+  args["data_type"] = data_type_.ToString();
+  args["hwc_to_chw"] = hwc_to_chw_;
+  *out_json = args;
+  return Status::OK();
+}
+
+Status FusedNormalizeOperation::from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation) {
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "crop_size", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "mean", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "std", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "rescale", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "shift", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "data_type", kFusedNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "hwc_to_chw", kFusedNormalizeOperation));
+  std::vector<int32_t> crop_size = op_params["crop_size"];
+  std::vector<float> mean = op_params["mean"];
+  std::vector<float> std = op_params["std"];
+  float rescale = op_params["rescale"];
+  float shift = op_params["shift"];
+  std::string data_type = op_params["data_type"];
+  bool hwc_to_chw = op_params["hwc_to_chw"];
+  *operation = std::make_shared<vision::FusedNormalizeOperation>(crop_size, mean, std, rescale, shift,
+                                                                 DataType(data_type), hwc_to_chw);
+  return Status::OK();
+}
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_NORMALIZE_IR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_NORMALIZE_IR_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/api/status.h"
+#include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/kernels/ir/tensor_operation.h"
+
+namespace mindspore {
+namespace dataset {
+
+namespace vision {
+
+constexpr char kFusedNormalizeOperation[] = "FusedNormalize";
+
+/// \brief The chain [CenterCrop] [Rescale] Normalize [TypeCast] [HwcToChw] of an HWC image, created by the
+///     TensorOpFusionPass or by the FusedNormalize vision op.
+class FusedNormalizeOperation : public TensorOperation {
+ public:
+  /// \param[in] crop_size The size of the center crop, empty for no crop.
+  /// \param[in] mean The mean of the channels.
+  /// \param[in] std The standard deviation of the channels.
+  /// \param[in] rescale The scale applied before the normalization, 1.0 for no rescale.
+  /// \param[in] shift The shift applied before the normalization, 0.0 for no rescale.
+  /// \param[in] data_type The type the normalized image is cast to, float32 for no cast.
+  /// \param[in] hwc_to_chw Whether the output is <C,H,W>.
+  FusedNormalizeOperation(const std::vector<int32_t> &crop_size, const std::vector<float> &mean,
+                          const std::vector<float> &std, float rescale, float shift, const DataType &data_type,
+                          bool hwc_to_chw);
+
+  ~FusedNormalizeOperation();
+
+  std::shared_ptr<TensorOp> Build() override;
+
+  Status ValidateParams() override;
+
+  std::string Name() const override;
+
+  Status to_json(nlohmann::json *out_json) override;
+
+  static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
+
+ private:
+  std::vector<int32_t> crop_size_;
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  float rescale_;
+  float shift_;
+  DataType data_type_;
+  bool hwc_to_chw_;
+};
+
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IR_VISION_FUSED_NORMALIZE_IR_H_
@@ -60,6 +60,7 @@ constexpr char kAutoContrastOp[] = "AutoContrastOp";
 constexpr char kBoundingBoxAugmentOp[] = "BoundingBoxAugmentOp";
 constexpr char kDecodeOp[] = "DecodeOp";
 constexpr char kCenterCropOp[] = "CenterCropOp";
+constexpr char kCenterCropResizeOp[] = "CenterCropResizeOp";
 constexpr char kConvertColorOp[] = "ConvertColorOp";
 constexpr char kCutMixBatchOp[] = "CutMixBatchOp";
 constexpr char kCutOutOp[] = "CutOutOp";
@@ -72,6 +73,7 @@ constexpr char kDvppDecodePngOp[] = "DvppDecodePngOp";
 constexpr char kDvppNormalizeOp[] = "DvppNormalizeOp";
 constexpr char kDvppResizeJpegOp[] = "DvppResizeJpegOp";
 constexpr char kEqualizeOp[] = "EqualizeOp";
+constexpr char kFusedNormalizeOp[] = "FusedNormalizeOp";
 constexpr char kGaussianBlurOp[] = "GaussianBlurOp";
 constexpr char kHorizontalFlipOp[] = "HorizontalFlipOp";
 constexpr char kHwcToChwOp[] = "HWC2CHWOp";
@@ -136,6 +138,7 @@ constexpr char kSlidingWindowOp[] = "SlidingWindowOp";
 constexpr char kNormalizeUTF8Op[] = "NormalizeUTF8Op";
 constexpr char kRegexReplaceOp[] = "RegexReplaceOp";
 constexpr char kRegexTokenizerOp[] = "RegexTokenizerOp";
+constexpr char kTokenizerLookupOp[] = "TokenizerLookupOp";
 constexpr char kToNumberOp[] = "ToNumberOp";
 constexpr char kToVectorsOp[] = "ToVectorsOp";
 constexpr char kTruncateSequencePairOp[] = "TruncateSequencePairOp";
@@ -34,6 +34,7 @@
 #include "minddata/dataset/text/kernels/sentence_piece_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/sliding_window_op.h"
 #include "minddata/dataset/text/kernels/to_number_op.h"
+#include "minddata/dataset/text/kernels/tokenizer_lookup_op.h"
 #include "minddata/dataset/text/kernels/to_vectors_op.h"
 #include "minddata/dataset/text/kernels/truncate_sequence_pair_op.h"
 #include "minddata/dataset/text/kernels/unicode_char_tokenizer_op.h"
@@ -481,6 +482,33 @@ std::shared_ptr<TensorOp> SlidingWindowOperation::Build() {
   return tensor_op;
 }
 
+// TokenizerLookupOperation
+TokenizerLookupOperation::TokenizerLookupOperation(const std::shared_ptr<TensorOp> &tokenizer,
+                                                   const std::shared_ptr<TensorOp> &lookup)
+    : tokenizer_(tokenizer), lookup_(lookup) {}
+
+Status TokenizerLookupOperation::ValidateParams() {
+  if (std::dynamic_pointer_cast<LookupOp>(lookup_) == nullptr) {
+    std::string err_msg = "TokenizerLookup: the lookup is not a Lookup op.";
+    LOG_AND_RETURN_STATUS_SYNTAX_ERROR(err_msg);
+  }
+  if (std::dynamic_pointer_cast<TokenizerOp>(tokenizer_) == nullptr &&
+      std::dynamic_pointer_cast<SentencePieceTokenizerOp>(tokenizer_) == nullptr) {
+    std::string err_msg = "TokenizerLookup: the tokenizer is not a tokenizer op.";
+    LOG_AND_RETURN_STATUS_SYNTAX_ERROR(err_msg);
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<TensorOp> TokenizerLookupOperation::Build() {
+  auto lookup = std::dynamic_pointer_cast<LookupOp>(lookup_);
+  auto tokenizer = std::dynamic_pointer_cast<TokenizerOp>(tokenizer_);
+  if (tokenizer != nullptr) {
+    return std::make_shared<TokenizerLookupOp>(tokenizer, lookup);
+  }
+  return std::make_shared<TokenizerLookupOp>(std::dynamic_pointer_cast<SentencePieceTokenizerOp>(tokenizer_), lookup);
+}
+
 // ToNumberOperation
 // DataType data_type - required for C++ API
 ToNumberOperation::ToNumberOperation(const DataType &data_type) : data_type_(data_type) {}
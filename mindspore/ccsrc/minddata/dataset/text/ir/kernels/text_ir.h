@@ -47,6 +47,7 @@ constexpr char kRegexReplaceOperation[] = "RegexReplace";
 constexpr char kRegexTokenizerOperation[] = "RegexTokenizer";
 constexpr char kSentencepieceTokenizerOperation[] = "SentencepieceTokenizer";
 constexpr char kSlidingWindowOperation[] = "SlidingWindow";
+constexpr char kTokenizerLookupOperation[] = "TokenizerLookup";
 constexpr char kToNumberOperation[] = "ToNumber";
 constexpr char kToVectorsOperation[] = "ToVectors";
 constexpr char kTruncateSequencePairOperation[] = "TruncateSequencePair";
@@ -290,6 +291,24 @@ class SlidingWindowOperation : public TensorOperation {
   int32_t axis_;
 };
 
+/// \brief A tokenizer followed by a Lookup, only created by the TensorOpFusionPass from the ops it built.
+class TokenizerLookupOperation : public TensorOperation {
+ public:
+  TokenizerLookupOperation(const std::shared_ptr<TensorOp> &tokenizer, const std::shared_ptr<TensorOp> &lookup);
+
+  ~TokenizerLookupOperation() = default;
+
+  std::shared_ptr<TensorOp> Build() override;
+
+  Status ValidateParams() override;
+
+  std::string Name() const override { return kTokenizerLookupOperation; }
+
+ private:
+  std::shared_ptr<TensorOp> tokenizer_;
+  std::shared_ptr<TensorOp> lookup_;
+};
+
 class ToNumberOperation : public TensorOperation {
  public:
   explicit ToNumberOperation(const DataType &data_type);     // Used for C++ API
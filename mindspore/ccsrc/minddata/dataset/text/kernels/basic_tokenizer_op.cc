@@ -24,6 +24,8 @@
 #include "unicode/errorcode.h"
 #include "unicode/normalizer2.h"
 
+#include "minddata/dataset/text/kernels/data_utils.h"
+
 namespace mindspore {
 namespace dataset {
 
@@ -56,7 +58,6 @@ BasicTokenizerOp::BasicTokenizerOp(const bool &lower_case, const bool &keep_whit
       keep_whitespace_(keep_whitespace),
       normalization_form_(normalization_form),
       preserve_unused_token_(preserve_unused_token),
-      case_fold_(std::make_unique<CaseFoldOp>()),
       nfd_normalize_(std::make_unique<NormalizeUTF8Op>(NormalizeForm::kNfd)),
       common_normalize_(std::make_unique<NormalizeUTF8Op>(normalization_form)),
       replace_accent_chars_(std::make_unique<RegexReplaceOp>("\\p{Mn}", "")),
@@ -127,20 +128,36 @@ Status BasicTokenizerOp::CaseFoldWithoutUnusedWords(const std::string_view &text
   return Status::OK();
 }
 
-Status BasicTokenizerOp::CaseFoldWithoutUnusedWords(const std::shared_ptr<Tensor> &input,
-                                                    std::shared_ptr<Tensor> *output) {
-  IO_CHECK(input, output);
-  CHECK_FAIL_RETURN_UNEXPECTED(input->type() == DataType::DE_STRING, "BasicTokenizer: input is not string datatype.");
-  std::vector<std::string> strs(input->Size());
-  size_t i = 0;
-  for (auto iter = input->begin<std::string_view>(); iter != input->end<std::string_view>(); iter++) {
-    RETURN_IF_NOT_OK(CaseFoldWithoutUnusedWords(*iter, kUnusedWords, &strs[i++]));
+Status BasicTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+                                  std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+  std::string text;
+  std::string processed_text;
+  if (lower_case_) {
+    if (!preserve_unused_token_) {
+      // to lower case
+      icu::ErrorCode error;
+      const icu::Normalizer2 *nfkc_case_fold = icu::Normalizer2::getNFKCCasefoldInstance(error);
+      CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "CaseFold: getNFKCCasefoldInstance failed.");
+      icu::StringByteSink<std::string> sink(&text);
+      nfkc_case_fold->normalizeUTF8(0, icu::StringPiece(str.data(), str.size()), sink, nullptr, error);
+      CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "CaseFold: normalizeUTF8 failed.");
+    } else {
+      // to lower case except words in kUnusedWords
+      RETURN_IF_NOT_OK(CaseFoldWithoutUnusedWords(str, kUnusedWords, &text));
+    }
+    // strip accent characters
+    RETURN_IF_NOT_OK(nfd_normalize_->Normalize(text, &processed_text));
+    RETURN_IF_NOT_OK(replace_accent_chars_->Replace(processed_text, &text));
+  } else {
+    RETURN_IF_NOT_OK(common_normalize_->Normalize(str, &text));
   }
-  return Tensor::CreateFromVector(strs, input->shape(), output);
+  // strip control characters
+  RETURN_IF_NOT_OK(replace_control_chars_->Replace(text, &processed_text));
+  return regex_tokenizer_->Tokenize(processed_text, splits, offsets_start, offsets_limit);
 }
 
-Status BasicTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
-  IO_CHECK_VECTOR(input, output);
+Status BasicTokenizerOp::TokenizeRow(const TensorRow &input, std::vector<std::string> *splits,
+                                     std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
   CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1, "BasicTokenizer: input only support one column data.");
   if (input[0]->Rank() != 0) {
     RETURN_STATUS_UNEXPECTED("BasicTokenizer: the input should be a scalar, but got a tensor with rank: " +
@@ -149,28 +166,28 @@ Status BasicTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   if (input[0]->type() != DataType::DE_STRING) {
     RETURN_STATUS_UNEXPECTED("BasicTokenizer: the input should be of type string.");
   }
-  std::shared_ptr<Tensor> cur_input;
-  std::shared_ptr<Tensor> processed_tensor;
-  if (lower_case_) {
-    if (!preserve_unused_token_) {
-      // to lower case
-      RETURN_IF_NOT_OK(case_fold_->Compute(input[0], &processed_tensor));
-    } else {
-      // to lower case except words in kUnusedWords
-      RETURN_IF_NOT_OK(CaseFoldWithoutUnusedWords(input[0], &processed_tensor));
-    }
-    cur_input = processed_tensor;
-    // strip accent characters
-    RETURN_IF_NOT_OK(nfd_normalize_->Compute(cur_input, &processed_tensor));
-    cur_input = processed_tensor;
-    RETURN_IF_NOT_OK(replace_accent_chars_->Compute(cur_input, &processed_tensor));
-  } else {
-    RETURN_IF_NOT_OK(common_normalize_->Compute(input[0], &processed_tensor));
+  std::string_view str;
+  RETURN_IF_NOT_OK(input[0]->GetItemAt(&str, {}));
+  return Tokenize(str, splits, offsets_start, offsets_limit);
+}
+
+Status BasicTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  std::vector<std::string> splits;
+  std::vector<uint32_t> offsets_start, offsets_limit;
+  RETURN_IF_NOT_OK(TokenizeRow(input, &splits, &offsets_start, &offsets_limit));
+  if (splits.empty()) {
+    (void)splits.emplace_back("");
+    offsets_start.push_back(0);
+    offsets_limit.push_back(0);
   }
-  // strip control characters
-  cur_input = processed_tensor;
-  RETURN_IF_NOT_OK(replace_control_chars_->Compute(cur_input, &processed_tensor));
-  return regex_tokenizer_->Compute(TensorRow(0, {std::move(processed_tensor)}), output);
+  std::shared_ptr<Tensor> token_tensor;
+  RETURN_IF_NOT_OK(Tensor::CreateFromVector(splits, &token_tensor));
+  output->push_back(token_tensor);
+  if (with_offsets_) {
+    RETURN_IF_NOT_OK(AppendOffsetsHelper(offsets_start, offsets_limit, output));
+  }
+  return Status::OK();
 }
 }  // namespace dataset
 }  // namespace mindspore
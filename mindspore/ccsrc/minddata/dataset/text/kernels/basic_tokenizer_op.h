@@ -17,11 +17,12 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_BASIC_TOKENIZER_OP_H_
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
-#include "minddata/dataset/text/kernels/case_fold_op.h"
 #include "minddata/dataset/text/kernels/normalize_utf8_op.h"
 #include "minddata/dataset/text/kernels/regex_replace_op.h"
 #include "minddata/dataset/text/kernels/regex_tokenizer_op.h"
@@ -47,10 +48,27 @@ class BasicTokenizerOp : public TokenizerOp {
 
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
+  // Tokenize a string, running the normalization steps on the string itself rather than on tensors
+  // @param str - The string
+  // @param splits - The tokens
+  // @param offsets_start - The offset of the first byte of each token
+  // @param offsets_limit - The offset past the last byte of each token
+  // @return Status The status code returned
+  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+                  std::vector<uint32_t> *offsets_limit) override;
+
+  // Check the row given to Compute and tokenize its string
+  // @param input - The row
+  // @param splits - The tokens, without the empty token Compute outputs for a string without any
+  // @param offsets_start - The offset of the first byte of each token
+  // @param offsets_limit - The offset past the last byte of each token
+  // @return Status The status code returned
+  Status TokenizeRow(const TensorRow &input, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+                     std::vector<uint32_t> *offsets_limit);
+
  protected:
   Status CaseFoldWithoutUnusedWords(const std::string_view &text, const std::unordered_set<std::string> &unused_words,
                                     std::string *output);
-  Status CaseFoldWithoutUnusedWords(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
 
   std::string Name() const override { return kBasicTokenizerOp; }
 
@@ -62,7 +80,6 @@ class BasicTokenizerOp : public TokenizerOp {
   bool keep_whitespace_;
   NormalizeForm normalization_form_;
   bool preserve_unused_token_;
-  std::unique_ptr<CaseFoldOp> case_fold_;
   std::unique_ptr<NormalizeUTF8Op> nfd_normalize_;
   std::unique_ptr<NormalizeUTF8Op> common_normalize_;
   std::unique_ptr<RegexReplaceOp> replace_accent_chars_;
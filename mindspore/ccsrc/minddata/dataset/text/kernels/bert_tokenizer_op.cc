@@ -14,14 +14,40 @@
  * limitations under the License.
  */
 #include "minddata/dataset/text/kernels/bert_tokenizer_op.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace mindspore {
 namespace dataset {
 Status BertTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
-  TensorRow basic_tensor;
-  RETURN_IF_NOT_OK(basic_tokenizer_.Compute(input, &basic_tensor));
-  RETURN_IF_NOT_OK(wordpiece_tokenizer_.Compute(basic_tensor, output));
-  return Status::OK();
+  // The basic tokens go straight to the wordpiece tokenizer, without a tensor in between
+  std::vector<std::string> basic_tokens;
+  std::vector<uint32_t> offsets_start, offsets_limit;
+  RETURN_IF_NOT_OK(basic_tokenizer_.TokenizeRow(input, &basic_tokens, &offsets_start, &offsets_limit));
+  if (basic_tokens.empty()) {
+    (void)basic_tokens.emplace_back("");
+    offsets_start.push_back(0);
+  }
+  if (!with_offsets_) {
+    offsets_start.clear();
+  }
+  return wordpiece_tokenizer_.ComputeTokens(basic_tokens, offsets_start, output);
+}
+
+Status BertTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+                                 std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+  std::vector<std::string> basic_tokens;
+  std::vector<uint32_t> basic_starts, basic_limits;
+  RETURN_IF_NOT_OK(basic_tokenizer_.Tokenize(str, &basic_tokens, &basic_starts, &basic_limits));
+  // As Compute does, a string without basic tokens is split as one empty token
+  if (basic_tokens.empty()) {
+    (void)basic_tokens.emplace_back("");
+    basic_starts.push_back(0);
+  }
+  return wordpiece_tokenizer_.SplitTokens(basic_tokens, basic_starts, splits, offsets_start, offsets_limit);
 }
 }  // namespace dataset
 }  // namespace mindspore
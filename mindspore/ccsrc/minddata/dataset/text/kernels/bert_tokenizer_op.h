@@ -17,6 +17,8 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_BERT_TOKENIZER_OP_H_
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -28,7 +30,7 @@
 
 namespace mindspore {
 namespace dataset {
-class BertTokenizerOp : public TensorOp {
+class BertTokenizerOp : public TokenizerOp {
  public:
   explicit BertTokenizerOp(const std::shared_ptr<Vocab> &vocab,
                            const std::string &suffix_indicator = WordpieceTokenizerOp::kDefSuffixIndicator,
@@ -39,13 +41,23 @@ class BertTokenizerOp : public TensorOp {
                            const NormalizeForm &normalization_form = BasicTokenizerOp::kDefNormalizationForm,
                            const bool &preserve_unused_token = BasicTokenizerOp::kDefPreserveUnusedToken,
                            const bool &with_offsets = TokenizerOp::kDefWithOffsets)
-      : wordpiece_tokenizer_(vocab, suffix_indicator, max_bytes_per_token, unknown_token, with_offsets),
+      : TokenizerOp(with_offsets),
+        wordpiece_tokenizer_(vocab, suffix_indicator, max_bytes_per_token, unknown_token, with_offsets),
         basic_tokenizer_(lower_case, keep_whitespace, normalization_form, preserve_unused_token, with_offsets) {}
 
   ~BertTokenizerOp() override = default;
 
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
+  // Tokenize a string into its wordpieces, without a tensor in between, e.g. for a fused Lookup of the wordpieces
+  // @param str - The string
+  // @param splits - The wordpieces, without the empty wordpiece Compute outputs for a string without any
+  // @param offsets_start - The offset of the first byte of each wordpiece
+  // @param offsets_limit - The offset past the last byte of each wordpiece
+  // @return Status The status code returned
+  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+                  std::vector<uint32_t> *offsets_limit) override;
+
   std::string Name() const override { return kBertTokenizerOp; }
 
  private:
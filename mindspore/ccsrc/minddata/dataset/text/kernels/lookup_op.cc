@@ -36,7 +36,44 @@ Status LookupOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
                                  "Lookup: invalid data, token: \"" + std::string(*itr) +
                                    "\" doesn't exist in vocab and no unknown token is specified.");
   }
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(word_ids, input->shape(), output));
+  return CreateOutput(word_ids, input->shape(), output);
+}
+
+std::shared_ptr<const LookupOp::WordIdMap> LookupOp::GetWordIds() const {
+  std::unique_lock<std::mutex> lock(word_ids_mutex_);
+  // Words are only ever appended to a vocab, so a map of the same size still holds all of them
+  const auto &vocab = vocab_->GetVocab();
+  if (word_ids_ == nullptr || word_ids_->size() != vocab.size()) {
+    auto word_ids = std::make_shared<WordIdMap>();
+    word_ids->reserve(vocab.size());
+    for (const auto &item : vocab) {
+      (void)word_ids->emplace(item.first, item.second);
+    }
+    word_ids_ = std::move(word_ids);
+  }
+  return word_ids_;
+}
+
+Status LookupOp::LookupWords(const std::vector<std::string_view> &words, const TensorShape &shape,
+                             std::shared_ptr<Tensor> *output) const {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  RETURN_UNEXPECTED_IF_NULL(vocab_);
+  auto word_to_id = GetWordIds();
+  std::vector<WordIdType> word_ids;
+  word_ids.reserve(words.size());
+  for (const auto &word : words) {
+    auto itr = word_to_id->find(word);
+    word_ids.emplace_back(itr == word_to_id->end() ? default_id_ : itr->second);
+    CHECK_FAIL_RETURN_UNEXPECTED(word_ids.back() != Vocab::kNoTokenExists,
+                                 "Lookup: invalid data, token: \"" + std::string(word) +
+                                   "\" doesn't exist in vocab and no unknown token is specified.");
+  }
+  return CreateOutput(word_ids, shape, output);
+}
+
+Status LookupOp::CreateOutput(const std::vector<WordIdType> &word_ids, const TensorShape &shape,
+                              std::shared_ptr<Tensor> *output) const {
+  RETURN_IF_NOT_OK(Tensor::CreateFromVector(word_ids, shape, output));
 
   // type cast to user's requirements if what user wants isn't int32_t
   if ((*output)->type() != type_) {
@@ -18,7 +18,10 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_LOOKUP_OP_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -45,6 +48,14 @@ class LookupOp : public TensorOp {
   /// \return[out] error code.
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  /// \brief look up words, e.g. the tokens of a sentence.
+  /// \param[in] const std::vector<std::string_view> &words - the words, which may be views into a larger string.
+  /// \param[in] const TensorShape &shape - the shape of the output.
+  /// \param[in] std::shared_ptr<Tensor> *output - the ids of the words.
+  /// \return[out] error code.
+  Status LookupWords(const std::vector<std::string_view> &words, const TensorShape &shape,
+                     std::shared_ptr<Tensor> *output) const;
+
   /// \brief print method.
   /// \param[in] std::ostream out
   void Print(std::ostream &out) const override;
@@ -57,7 +68,26 @@ class LookupOp : public TensorOp {
   std::string Name() const override { return kLookupOp; }
 
  private:
+  using WordIdMap = std::unordered_map<std::string_view, WordIdType>;
+
+  /// \brief get the views of the words of vocab_, built by the first LookupWords and again once words were
+  ///     appended to vocab_.
+  /// \return the views, which stay valid while a later call builds new ones.
+  std::shared_ptr<const WordIdMap> GetWordIds() const;
+
+  /// \brief create the tensor of the ids, cast to type_.
+  /// \param[in] const std::vector<WordIdType> &word_ids - the ids.
+  /// \param[in] const TensorShape &shape - the shape of the output.
+  /// \param[in] std::shared_ptr<Tensor> *output - the tensor.
+  /// \return[out] error code.
+  Status CreateOutput(const std::vector<WordIdType> &word_ids, const TensorShape &shape,
+                      std::shared_ptr<Tensor> *output) const;
+
   std::shared_ptr<Vocab> vocab_;
+  // Views of the words of vocab_, so that a word is found without being copied. Only the fused tokenizer and
+  // lookup use it, Compute looks up through vocab_
+  mutable std::shared_ptr<const WordIdMap> word_ids_;
+  mutable std::mutex word_ids_mutex_;
   WordIdType default_id_;
   DataType type_;  // type of tensor after lookup
 };
@@ -24,34 +24,32 @@
 namespace mindspore {
 namespace dataset {
 const NormalizeForm NormalizeUTF8Op::kDefNormalizeForm = NormalizeForm::kNfkc;
-Status NormalizeUTF8Op::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
-  IO_CHECK(input, output);
-  CHECK_FAIL_RETURN_UNEXPECTED(input->type() == DataType::DE_STRING, "NormalizeUTF8: input is not string datatype.");
-
+namespace {
+// Get the normalizer of a form, nullptr for kNone
+Status GetNormalizer(NormalizeForm normalize_form, const icu::Normalizer2 **normalize) {
   icu::ErrorCode error;
-  const icu::Normalizer2 *normalize = nullptr;
-  switch (normalize_form_) {
+  *normalize = nullptr;
+  switch (normalize_form) {
     case NormalizeForm::kNone: {
-      *output = input;
       return Status::OK();
     }
     case NormalizeForm::kNfc: {
-      normalize = icu::Normalizer2::getNFCInstance(error);
+      *normalize = icu::Normalizer2::getNFCInstance(error);
       CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "NormalizeUTF8: getNFCInstance failed.");
       break;
     }
     case NormalizeForm::kNfkc: {
-      normalize = icu::Normalizer2::getNFKCInstance(error);
+      *normalize = icu::Normalizer2::getNFKCInstance(error);
       CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "NormalizeUTF8: getNFKCInstance failed.");
       break;
     }
     case NormalizeForm::kNfd: {
-      normalize = icu::Normalizer2::getNFDInstance(error);
+      *normalize = icu::Normalizer2::getNFDInstance(error);
       CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "NormalizeUTF8: getNFDInstance failed.");
       break;
     }
     case NormalizeForm::kNfkd: {
-      normalize = icu::Normalizer2::getNFKDInstance(error);
+      *normalize = icu::Normalizer2::getNFKDInstance(error);
       CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "NormalizeUTF8: getNFKDInstance failed.");
       break;
     }
@@ -60,6 +58,21 @@ Status NormalizeUTF8Op::Compute(const std::shared_ptr<Tensor> &input, std::share
       break;
     }
   }
+  return Status::OK();
+}
+}  // namespace
+
+Status NormalizeUTF8Op::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  CHECK_FAIL_RETURN_UNEXPECTED(input->type() == DataType::DE_STRING, "NormalizeUTF8: input is not string datatype.");
+
+  icu::ErrorCode error;
+  const icu::Normalizer2 *normalize = nullptr;
+  RETURN_IF_NOT_OK(GetNormalizer(normalize_form_, &normalize));
+  if (normalize == nullptr) {
+    *output = input;
+    return Status::OK();
+  }
   std::vector<std::string> strs(input->Size());
   int i = 0;
   for (auto iter = input->begin<std::string_view>(); iter != input->end<std::string_view>(); iter++) {
@@ -69,5 +82,21 @@ Status NormalizeUTF8Op::Compute(const std::shared_ptr<Tensor> &input, std::share
   }
   return Tensor::CreateFromVector(strs, input->shape(), output);
 }
+
+Status NormalizeUTF8Op::Normalize(const std::string_view &text, std::string *out) const {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  const icu::Normalizer2 *normalize = nullptr;
+  RETURN_IF_NOT_OK(GetNormalizer(normalize_form_, &normalize));
+  if (normalize == nullptr) {
+    out->assign(text.data(), text.size());
+    return Status::OK();
+  }
+  icu::ErrorCode error;
+  out->clear();
+  icu::StringByteSink<std::string> sink(out);
+  normalize->normalizeUTF8(0, icu::StringPiece(text.data(), text.size()), sink, nullptr, error);
+  CHECK_FAIL_RETURN_UNEXPECTED(error.isSuccess(), "NormalizeUTF8: NormalizeUTF8 failed.");
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_NORMALIZE_UTF8_OP_H_
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -34,6 +35,12 @@ class NormalizeUTF8Op : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // Normalize one string
+  // @param text - The string
+  // @param out - The normalized string
+  // @return Status The status code returned
+  Status Normalize(const std::string_view &text, std::string *out) const;
+
   std::string Name() const override { return kNormalizeUTF8Op; }
 
  private:
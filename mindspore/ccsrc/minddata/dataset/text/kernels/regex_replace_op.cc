@@ -20,6 +20,28 @@
 
 namespace mindspore {
 namespace dataset {
+RegexReplaceOp::RegexReplaceOp(const std::string &pattern, const std::string &replace, bool replace_all)
+    : pattern_(icu::UnicodeString::fromUTF8(pattern)),
+      replace_(icu::UnicodeString::fromUTF8(replace)),
+      replace_all_(replace_all) {
+  // An invalid pattern is reported by Compute
+  UErrorCode icu_error = U_ZERO_ERROR;
+  regex_pattern_.reset(icu::RegexPattern::compile(pattern_, 0, icu_error));
+  if (U_FAILURE(icu_error)) {
+    regex_pattern_.reset();
+  }
+}
+
+Status RegexReplaceOp::CreateMatcher(std::unique_ptr<icu::RegexMatcher> *matcher) const {
+  UErrorCode icu_error = U_ZERO_ERROR;
+  if (regex_pattern_ != nullptr) {
+    matcher->reset(regex_pattern_->matcher(icu_error));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(*matcher != nullptr && U_SUCCESS(icu_error),
+                               "RegexReplace: create icu RegexMatcher failed, "
+                               "you may input one error pattern.");
+  return Status::OK();
+}
 
 Status RegexReplaceOp::RegexReplace(icu::RegexMatcher *const matcher, const std::string_view &text,
                                     std::string *out) const {
@@ -41,17 +63,20 @@ Status RegexReplaceOp::RegexReplace(icu::RegexMatcher *const matcher, const std:
 Status RegexReplaceOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   CHECK_FAIL_RETURN_UNEXPECTED(input->type() == DataType::DE_STRING, "RegexReplace: input is not string datatype.");
-  UErrorCode icu_error = U_ZERO_ERROR;
-  icu::RegexMatcher matcher(pattern_, 0, icu_error);
-  CHECK_FAIL_RETURN_UNEXPECTED(U_SUCCESS(icu_error),
-                               "RegexReplace: create icu RegexMatcher failed, "
-                               "you may input one error pattern.");
+  std::unique_ptr<icu::RegexMatcher> matcher;
+  RETURN_IF_NOT_OK(CreateMatcher(&matcher));
   std::vector<std::string> strs(input->Size());
   int i = 0;
   for (auto iter = input->begin<std::string_view>(); iter != input->end<std::string_view>(); iter++) {
-    RETURN_IF_NOT_OK(RegexReplace(&matcher, *iter, &strs[i]));
+    RETURN_IF_NOT_OK(RegexReplace(matcher.get(), *iter, &strs[i]));
   }
   return Tensor::CreateFromVector(strs, input->shape(), output);
 }
+
+Status RegexReplaceOp::Replace(const std::string_view &text, std::string *out) const {
+  std::unique_ptr<icu::RegexMatcher> matcher;
+  RETURN_IF_NOT_OK(CreateMatcher(&matcher));
+  return RegexReplace(matcher.get(), text, out);
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_REGEX_REPLACE_OP_H_
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "unicode/regex.h"
 #include "unicode/errorcode.h"
@@ -32,22 +33,29 @@ namespace dataset {
 
 class RegexReplaceOp : public TensorOp {
  public:
-  RegexReplaceOp(const std::string &pattern, const std::string &replace, bool replace_all = true)
-      : pattern_(icu::UnicodeString::fromUTF8(pattern)),
-        replace_(icu::UnicodeString::fromUTF8(replace)),
-        replace_all_(replace_all) {}
+  RegexReplaceOp(const std::string &pattern, const std::string &replace, bool replace_all = true);
 
   ~RegexReplaceOp() override = default;
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // Replace the matches of the pattern in one string
+  // @param text - The string
+  // @param out - The string after replacement
+  // @return Status The status code returned
+  Status Replace(const std::string_view &text, std::string *out) const;
+
   std::string Name() const override { return kRegexReplaceOp; }
 
  protected:
   Status RegexReplace(icu::RegexMatcher *const matcher, const std::string_view &text, std::string *out) const;
 
+  // Create a matcher of the pattern, which is compiled once by the constructor
+  Status CreateMatcher(std::unique_ptr<icu::RegexMatcher> *matcher) const;
+
  private:
   const icu::UnicodeString pattern_;
+  std::unique_ptr<icu::RegexPattern> regex_pattern_;  // nullptr if the pattern is invalid
   const icu::UnicodeString replace_;
   const bool replace_all_;
 };
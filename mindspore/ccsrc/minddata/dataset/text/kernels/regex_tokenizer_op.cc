@@ -21,6 +21,37 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+std::unique_ptr<icu::RegexPattern> CompilePattern(const icu::UnicodeString &pattern) {
+  // An invalid pattern is reported when a matcher is created
+  UErrorCode status = U_ZERO_ERROR;
+  std::unique_ptr<icu::RegexPattern> regex(icu::RegexPattern::compile(pattern, 0, status));
+  if (U_FAILURE(status)) {
+    return nullptr;
+  }
+  return regex;
+}
+}  // namespace
+
+RegexTokenizerOp::RegexTokenizerOp(const std::string &delim_pattern, const std::string &keep_delim_pattern,
+                                   const bool &with_offsets)
+    : TokenizerOp(with_offsets),
+      delim_pattern_(icu::UnicodeString::fromUTF8(delim_pattern)),
+      keep_delim_pattern_(icu::UnicodeString::fromUTF8(keep_delim_pattern)),
+      keep_delim_(!keep_delim_pattern.empty()),
+      delim_regex_(CompilePattern(delim_pattern_)),
+      keep_delim_regex_(CompilePattern(keep_delim_pattern_)) {}
+
+Status RegexTokenizerOp::CreateMatcher(const std::unique_ptr<icu::RegexPattern> &pattern,
+                                       std::unique_ptr<icu::RegexMatcher> *matcher) {
+  UErrorCode status = U_ZERO_ERROR;
+  if (pattern != nullptr) {
+    matcher->reset(pattern->matcher(status));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(*matcher != nullptr && U_SUCCESS(status),
+                               "RegexTokenizer: create ICU RegexMatcher failed, you may input one error pattern");
+  return Status::OK();
+}
 
 Status RegexTokenizerOp::GetUnicodeSubstr(const icu::UnicodeString &input, const int &start, const int &len,
                                           std::string *out_utf8, icu::UnicodeString *out_unicode) const {
@@ -45,23 +76,21 @@ Status RegexTokenizerOp::GetRegexTokens(const std::string &text, std::vector<std
                                         std::vector<uint32_t> *offsets_limit) const {
   UErrorCode status = U_ZERO_ERROR;
   out_tokens->clear();
-  icu::RegexMatcher token_matcher(delim_pattern_, 0, status);
-  CHECK_FAIL_RETURN_UNEXPECTED(U_SUCCESS(status),
-                               "RegexTokenizer: create ICU RegexMatcher failed, you may input one error pattern");
-  icu::RegexMatcher delim_matcher(keep_delim_pattern_, 0, status);
-  CHECK_FAIL_RETURN_UNEXPECTED(U_SUCCESS(status),
-                               "RegexTokenizer: create ICU RegexMatcher failed, you may input one error pattern");
+  std::unique_ptr<icu::RegexMatcher> token_matcher;
+  RETURN_IF_NOT_OK(CreateMatcher(delim_regex_, &token_matcher));
+  std::unique_ptr<icu::RegexMatcher> delim_matcher;
+  RETURN_IF_NOT_OK(CreateMatcher(keep_delim_regex_, &delim_matcher));
 
   icu::UnicodeString utext(icu::UnicodeString::fromUTF8(text));
-  token_matcher.reset(utext);
+  token_matcher->reset(utext);
 
   int text_start_index = 0;
   int token_start_index = 0;
   status = U_ZERO_ERROR;
-  while (token_matcher.find(status) && U_SUCCESS(status)) {
-    int deli_start_index = token_matcher.start(status);
+  while (token_matcher->find(status) && U_SUCCESS(status)) {
+    int deli_start_index = token_matcher->start(status);
     CHECK_FAIL_RETURN_UNEXPECTED(U_SUCCESS(status), "RegexTokenizer: get RegexMatcher matched start index failed");
-    int deli_end_index = token_matcher.end(status);
+    int deli_end_index = token_matcher->end(status);
     CHECK_FAIL_RETURN_UNEXPECTED(U_SUCCESS(status), "RegexTokenizer: get RegexMatcher matched start index failed");
 
     // Add non-empty token
@@ -83,9 +112,9 @@ Status RegexTokenizerOp::GetRegexTokens(const std::string &text, std::vector<std
       std::string delim_utf8_str;
       uint32_t delim_str_offset = 0;
       RETURN_IF_NOT_OK(GetUnicodeSubstr(utext, deli_start_index, delim_len, &delim_utf8_str, &delim_str));
-      delim_matcher.reset(delim_str);
+      delim_matcher->reset(delim_str);
       delim_str_offset = delim_utf8_str.length();
-      if (keep_delim_ && delim_matcher.matches(status) && U_SUCCESS(status)) {
+      if (keep_delim_ && delim_matcher->matches(status) && U_SUCCESS(status)) {
         (void)out_tokens->emplace_back(std::move(delim_utf8_str));
         offsets_start->push_back(static_cast<uint32_t>(text_start_index));
         offsets_limit->push_back(static_cast<uint32_t>(text_start_index + delim_str_offset));
@@ -34,11 +34,7 @@ namespace dataset {
 class RegexTokenizerOp : public TokenizerOp {
  public:
   RegexTokenizerOp(const std::string &delim_pattern, const std::string &keep_delim_pattern,
-                   const bool &with_offsets = kDefWithOffsets)
-      : TokenizerOp(with_offsets),
-        delim_pattern_(icu::UnicodeString::fromUTF8(delim_pattern)),
-        keep_delim_pattern_(icu::UnicodeString::fromUTF8(keep_delim_pattern)),
-        keep_delim_(!keep_delim_pattern.empty()) {}
+                   const bool &with_offsets = kDefWithOffsets);
 
   ~RegexTokenizerOp() override = default;
 
@@ -51,12 +47,19 @@ class RegexTokenizerOp : public TokenizerOp {
   Status GetRegexTokens(const std::string &text, std::vector<std::string> *out_tokens,
                         std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
 
+  // Create a matcher of a pattern compiled by the constructor
+  static Status CreateMatcher(const std::unique_ptr<icu::RegexPattern> &pattern,
+                              std::unique_ptr<icu::RegexMatcher> *matcher);
+
   std::string Name() const override { return kRegexTokenizerOp; }
 
  private:
   const icu::UnicodeString delim_pattern_;
   const icu::UnicodeString keep_delim_pattern_;
   const bool keep_delim_;
+  // The patterns are compiled once rather than for every string, nullptr if invalid
+  std::unique_ptr<icu::RegexPattern> delim_regex_;
+  std::unique_ptr<icu::RegexPattern> keep_delim_regex_;
 };
 }  // namespace dataset
 }  // namespace mindspore
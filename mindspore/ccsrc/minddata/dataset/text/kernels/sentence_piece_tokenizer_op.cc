@@ -69,10 +69,7 @@ Status SentencePieceTokenizerOp::Compute(const std::shared_ptr<Tensor> &input, s
 
   if (out_type_ == SPieceTokenizerOutType::kString) {
     std::vector<std::string> pieces;
-    auto status = processor_.Encode(sentence, &pieces);
-    if (!status.ok()) {
-      RETURN_STATUS_UNEXPECTED("SentencePieceTokenizer: Encode sentence failed.");
-    }
+    RETURN_IF_NOT_OK(Tokenize(sentence, &pieces));
     RETURN_IF_NOT_OK(Tensor::CreateFromVector(pieces, output));
   } else {
     std::vector<int> ids;
@@ -85,6 +82,18 @@ Status SentencePieceTokenizerOp::Compute(const std::shared_ptr<Tensor> &input, s
   return Status::OK();
 }
 
+Status SentencePieceTokenizerOp::Tokenize(std::string_view sentence, std::vector<std::string> *pieces) const {
+  RETURN_UNEXPECTED_IF_NULL(pieces);
+  if (!model_status_.IsOk()) {
+    RETURN_STATUS_UNEXPECTED(model_status_.GetErrDescription());
+  }
+  auto status = processor_.Encode(std::string(sentence), pieces);
+  if (!status.ok()) {
+    RETURN_STATUS_UNEXPECTED("SentencePieceTokenizer: Encode sentence failed.");
+  }
+  return Status::OK();
+}
+
 Status SentencePieceTokenizerOp::GetModelRealPath(const std::string &model_path, const std::string &filename) {
   auto realpath = FileUtils::GetRealPath(model_path.c_str());
   if (!realpath.has_value()) {
@@ -22,6 +22,8 @@
 #include <string>
 #include <iostream>
 #include <memory>
+#include <string_view>
+#include <vector>
 
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/include/dataset/text.h"
@@ -50,6 +52,11 @@ class SentencePieceTokenizerOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // Split a sentence into its pieces, as Compute does for a string output
+  Status Tokenize(std::string_view sentence, std::vector<std::string> *pieces) const;
+
+  SPieceTokenizerOutType out_type() const { return out_type_; }
+
   std::string Name() const override { return kSentencepieceTokenizerOp; }
 
  protected:
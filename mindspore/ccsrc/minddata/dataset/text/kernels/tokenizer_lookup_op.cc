@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/text/kernels/tokenizer_lookup_op.h"
+
+#include <utility>
+
+#include "minddata/dataset/text/kernels/data_utils.h"
+
+namespace mindspore {
+namespace dataset {
+TokenizerLookupOp::TokenizerLookupOp(std::shared_ptr<TokenizerOp> tokenizer, std::shared_ptr<LookupOp> lookup)
+    : tokenizer_(std::move(tokenizer)),
+      lookup_(std::move(lookup)),
+      with_offsets_(tokenizer_ != nullptr && tokenizer_->with_offsets()) {}
+
+TokenizerLookupOp::TokenizerLookupOp(std::shared_ptr<SentencePieceTokenizerOp> tokenizer,
+                                     std::shared_ptr<LookupOp> lookup)
+    : sentence_piece_tokenizer_(std::move(tokenizer)), lookup_(std::move(lookup)), with_offsets_(false) {}
+
+Status TokenizerLookupOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  RETURN_UNEXPECTED_IF_NULL(lookup_);
+  CHECK_FAIL_RETURN_UNEXPECTED(tokenizer_ != nullptr || sentence_piece_tokenizer_ != nullptr,
+                               "TokenizerLookup: the tokenizer is not set.");
+  std::string name = tokenizer_ != nullptr ? tokenizer_->Name() : sentence_piece_tokenizer_->Name();
+  CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1, name + ": input should be one column data.");
+  if (input[0]->Rank() != 0 || input[0]->type() != DataType::DE_STRING) {
+    RETURN_STATUS_UNEXPECTED(name + ": the input shape should be scalar and the input datatype should be string.");
+  }
+  std::string_view str;
+  RETURN_IF_NOT_OK(input[0]->GetItemAt(&str, {}));
+
+  // The strings of the tokenizers which don't give views, the views of the tokens point into them or into str
+  std::vector<std::string> strings;
+  std::vector<std::string_view> tokens;
+  std::vector<uint32_t> offsets_start, offsets_limit;
+  if (sentence_piece_tokenizer_ != nullptr) {
+    RETURN_IF_NOT_OK(sentence_piece_tokenizer_->Tokenize(str, &strings));
+    tokens.assign(strings.begin(), strings.end());
+  } else if (tokenizer_->HasTokenViews()) {
+    RETURN_IF_NOT_OK(tokenizer_->TokenizeViews(str, &tokens, &offsets_start, &offsets_limit));
+  } else {
+    RETURN_IF_NOT_OK(tokenizer_->Tokenize(str, &strings, &offsets_start, &offsets_limit));
+    tokens.assign(strings.begin(), strings.end());
+  }
+  // As the tokenizer does, an empty string gives one empty token
+  if (tokenizer_ != nullptr && tokens.empty()) {
+    (void)tokens.emplace_back("");
+    offsets_start.push_back(0);
+    offsets_limit.push_back(0);
+  }
+
+  std::shared_ptr<Tensor> ids;
+  RETURN_IF_NOT_OK(lookup_->LookupWords(tokens, TensorShape({static_cast<dsize_t>(tokens.size())}), &ids));
+  output->push_back(ids);
+  if (with_offsets_) {
+    RETURN_IF_NOT_OK(AppendOffsetsHelper(offsets_start, offsets_limit, output));
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
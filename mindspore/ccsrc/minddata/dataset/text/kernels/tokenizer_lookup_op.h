@@ -0,0 +1,64 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_TOKENIZER_LOOKUP_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_TOKENIZER_LOOKUP_OP_H_
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/text/kernels/lookup_op.h"
+#include "minddata/dataset/text/kernels/sentence_piece_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/tokenizer_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A tokenizer followed by a Lookup, only created by the TensorOpFusionPass.
+/// The tokens are looked up as they are found, without building a string tensor in between. The tokens of the
+/// tokenizers which split their input into substrings are views of it, so they are never copied.
+class TokenizerLookupOp : public TensorOp {
+ public:
+  /// \brief constructor.
+  /// \param[in] std::shared_ptr<TokenizerOp> tokenizer - the tokenizer, its offsets are output after the ids.
+  /// \param[in] std::shared_ptr<LookupOp> lookup - the lookup of the tokens.
+  TokenizerLookupOp(std::shared_ptr<TokenizerOp> tokenizer, std::shared_ptr<LookupOp> lookup);
+
+  /// \brief constructor.
+  /// \param[in] std::shared_ptr<SentencePieceTokenizerOp> tokenizer - the tokenizer, with a string output.
+  /// \param[in] std::shared_ptr<LookupOp> lookup - the lookup of the pieces.
+  TokenizerLookupOp(std::shared_ptr<SentencePieceTokenizerOp> tokenizer, std::shared_ptr<LookupOp> lookup);
+
+  ~TokenizerLookupOp() override = default;
+
+  Status Compute(const TensorRow &input, TensorRow *output) override;
+
+  uint32_t NumOutput() override { return with_offsets_ ? 3 : 1; }
+
+  std::string Name() const override { return kTokenizerLookupOp; }
+
+ private:
+  std::shared_ptr<TokenizerOp> tokenizer_;
+  std::shared_ptr<SentencePieceTokenizerOp> sentence_piece_tokenizer_;
+  std::shared_ptr<LookupOp> lookup_;
+  bool with_offsets_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_TOKENIZER_LOOKUP_OP_H_
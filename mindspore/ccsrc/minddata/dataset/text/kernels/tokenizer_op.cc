@@ -18,8 +18,33 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// An empty string gives one empty token
+template <typename T>
+Status CreateTokenTensor(std::vector<T> *splits, std::vector<uint32_t> *offsets_start,
+                         std::vector<uint32_t> *offsets_limit, std::shared_ptr<Tensor> *token_tensor) {
+  if (splits->empty()) {
+    (void)splits->emplace_back("");
+    offsets_start->push_back(0);
+    offsets_limit->push_back(0);
+  }
+  return Tensor::CreateFromVector(*splits, token_tensor);
+}
+}  // namespace
+
 const bool TokenizerOp::kDefWithOffsets = false;
 
+Status TokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+                             std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+  if (!HasTokenViews()) {
+    return Status::OK();
+  }
+  std::vector<std::string_view> views;
+  RETURN_IF_NOT_OK(TokenizeViews(str, &views, offsets_start, offsets_limit));
+  splits->insert(splits->end(), views.begin(), views.end());
+  return Status::OK();
+}
+
 Status TokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
   CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1, Name() + ": input should be one column data.");
@@ -30,15 +55,15 @@ Status TokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   RETURN_IF_NOT_OK(input[0]->GetItemAt(&str, {}));
   std::shared_ptr<Tensor> token_tensor;
   std::vector<uint32_t> offsets_start, offsets_limit;
-  std::vector<std::string> splits;
-  RETURN_IF_NOT_OK(Tokenize(str, &splits, &offsets_start, &offsets_limit));
-
-  if (splits.empty()) {
-    (void)splits.emplace_back("");
-    offsets_start.push_back(0);
-    offsets_limit.push_back(0);
+  if (HasTokenViews()) {
+    std::vector<std::string_view> splits;
+    RETURN_IF_NOT_OK(TokenizeViews(str, &splits, &offsets_start, &offsets_limit));
+    RETURN_IF_NOT_OK(CreateTokenTensor(&splits, &offsets_start, &offsets_limit, &token_tensor));
+  } else {
+    std::vector<std::string> splits;
+    RETURN_IF_NOT_OK(Tokenize(str, &splits, &offsets_start, &offsets_limit));
+    RETURN_IF_NOT_OK(CreateTokenTensor(&splits, &offsets_start, &offsets_limit, &token_tensor));
   }
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(splits, &token_tensor));
   output->push_back(token_tensor);
   if (with_offsets_) {
     RETURN_IF_NOT_OK(AppendOffsetsHelper(offsets_start, offsets_limit, output));
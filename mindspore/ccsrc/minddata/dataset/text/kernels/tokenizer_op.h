@@ -16,8 +16,9 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_TOKENIZER_OP_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_TOKENIZER_OP_H_
 #include <memory>
-#include <vector>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -34,13 +35,24 @@ class TokenizerOp : public TensorOp {
 
   ~TokenizerOp() override = default;
 
+  // Tokenize a string. By default the tokens of TokenizeViews are copied.
   virtual Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
-                          std::vector<uint32_t> *offsets_limit) {
-    return Status::OK();
+                          std::vector<uint32_t> *offsets_limit);
+
+  // Tokenize a string into views of it, only for the tokenizers whose tokens are substrings of their input, see
+  // HasTokenViews. The tokens are then copied once into the output tensor, or never when they are looked up in a vocab.
+  virtual Status TokenizeViews(std::string_view str, std::vector<std::string_view> *splits,
+                               std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+    RETURN_STATUS_UNEXPECTED(Name() + ": the tokens are not substrings of the input.");
   }
 
+  // @return Whether TokenizeViews is implemented
+  virtual bool HasTokenViews() const { return false; }
+
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
+  bool with_offsets() const { return with_offsets_; }
+
  protected:
   bool with_offsets_;
 };
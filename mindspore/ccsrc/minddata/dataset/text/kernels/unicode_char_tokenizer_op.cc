@@ -29,13 +29,14 @@ using cppjieba::RuneStrArray;
 namespace mindspore {
 namespace dataset {
 
-Status UnicodeCharTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
-                                        std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+Status UnicodeCharTokenizerOp::TokenizeViews(std::string_view str, std::vector<std::string_view> *splits,
+                                             std::vector<uint32_t> *offsets_start,
+                                             std::vector<uint32_t> *offsets_limit) {
   RuneStrArray runes;
   if (!DecodeRunesInString(str.data(), str.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("UnicodeCharTokenizer: Decode utf8 string failed.");
   }
-  std::vector<std::string> words(runes.size());
+  std::vector<std::string_view> words(runes.size());
   for (size_t i = 0; i < runes.size(); i++) {
     offsets_start->push_back(runes[i].offset);
     offsets_limit->push_back(runes[i].offset + runes[i].len);
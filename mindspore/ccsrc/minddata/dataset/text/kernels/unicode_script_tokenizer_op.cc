@@ -33,8 +33,9 @@ namespace dataset {
 
 const bool UnicodeScriptTokenizerOp::kDefKeepWhitespace = false;
 
-Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
-                                          std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+Status UnicodeScriptTokenizerOp::TokenizeViews(std::string_view str, std::vector<std::string_view> *splits,
+                                               std::vector<uint32_t> *offsets_start,
+                                               std::vector<uint32_t> *offsets_limit) {
   RuneStrArray runes;
   if (!DecodeRunesInString(str.data(), str.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("UnicodeScriptTokenizer: Decode utf8 string failed.");
@@ -62,8 +63,7 @@ Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, std::vector<std:
       if (keep_whitespace_ || !was_space) {
         offsets_start->push_back(static_cast<uint32_t>(start));
         offsets_limit->push_back(static_cast<uint32_t>(start + len));
-        std::string temp(str.substr(start, len));
-        (void)splits->emplace_back(std::move(temp));
+        (void)splits->emplace_back(str.substr(start, len));
       }
       start = runes[i].offset;
       len = runes[i].len;
@@ -77,8 +77,7 @@ Status UnicodeScriptTokenizerOp::Tokenize(std::string_view str, std::vector<std:
   if (len > 0 && (keep_whitespace_ || !was_space)) {
     offsets_start->push_back(static_cast<uint32_t>(start));
     offsets_limit->push_back(static_cast<uint32_t>(start + len));
-    std::string temp(str.substr(start, len));
-    (void)splits->emplace_back(std::move(temp));
+    (void)splits->emplace_back(str.substr(start, len));
   }
 
   return Status::OK();
@@ -37,8 +37,10 @@ class UnicodeScriptTokenizerOp : public TokenizerOp {
 
   ~UnicodeScriptTokenizerOp() override = default;
 
-  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
-                  std::vector<uint32_t> *offsets_limit) override;
+  Status TokenizeViews(std::string_view str, std::vector<std::string_view> *splits,
+                       std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) override;
+
+  bool HasTokenViews() const override { return true; }
 
   std::string Name() const override { return kUnicodeScriptTokenizerOp; }
 
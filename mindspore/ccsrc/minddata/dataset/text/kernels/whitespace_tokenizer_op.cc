@@ -27,8 +27,9 @@ using cppjieba::RuneStrArray;
 
 namespace mindspore {
 namespace dataset {
-Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
-                                       std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+Status WhitespaceTokenizerOp::TokenizeViews(std::string_view str, std::vector<std::string_view> *splits,
+                                            std::vector<uint32_t> *offsets_start,
+                                            std::vector<uint32_t> *offsets_limit) {
   RuneStrArray runes;
   if (!DecodeRunesInString(str.data(), str.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("WhitespaceTokenizer: Decode utf8 string failed.");
@@ -41,8 +42,7 @@ Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::st
       if (len > 0) {
         offsets_start->push_back(static_cast<uint32_t>(start));
         offsets_limit->push_back(static_cast<uint32_t>(start + len));
-        std::string temp(str.substr(start, len));
-        (void)splits->emplace_back(std::move(temp));
+        (void)splits->emplace_back(str.substr(start, len));
         len = 0;
       }
     } else {
@@ -55,8 +55,7 @@ Status WhitespaceTokenizerOp::Tokenize(std::string_view str, std::vector<std::st
   if (len > 0) {
     offsets_start->push_back(static_cast<uint32_t>(start));
     offsets_limit->push_back(static_cast<uint32_t>(start + len));
-    std::string temp(str.substr(start, len));
-    (void)splits->emplace_back(std::move(temp));
+    (void)splits->emplace_back(str.substr(start, len));
   }
   if (splits->empty()) {
     (void)splits->emplace_back("");
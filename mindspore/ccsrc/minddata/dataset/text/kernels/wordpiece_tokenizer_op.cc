@@ -33,22 +33,30 @@ WordpieceTokenizerOp::WordpieceTokenizerOp(const std::shared_ptr<Vocab> &vocab,
       vocab_(vocab),
       suffix_indicator_(suffix_indicator),
       max_bytes_per_token_(max_bytes_per_token),
-      unknown_token_(unknown_token) {}
+      unknown_token_(unknown_token),
+      trie_(vocab, suffix_indicator) {}
 
 Status WordpieceTokenizerOp::LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start,
                                         bool *out_found, int *out_end) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && start < input_token.size(), "WordpieceTokenizer: LookupWord Out of range");
   *out_found = false;
-  for (int i = runes.size() - 1; i >= 0; i--) {
-    *out_end = runes[i].offset + runes[i].len;
-    int len = *out_end - start;
-    std::string word = input_token.substr(start, len);
-    if (start > 0) {
-      word = suffix_indicator_ + word;
+  // Find the rune at start, then follow the runes down the trie: the last one ending a word ends the longest word.
+  size_t lo = 0;
+  size_t hi = runes.size();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (runes[mid].offset < static_cast<uint32_t>(start)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
-    if (vocab_->TokensToIds(word) != Vocab::kNoTokenExists) {
+  }
+  int32_t node = trie_.StartNode(start);
+  for (size_t i = lo; i < runes.size() && node != WordpieceTrie::kNoNode; ++i) {
+    node = trie_.Walk(node, std::string_view(input_token.data() + runes[i].offset, runes[i].len));
+    if (node != WordpieceTrie::kNoNode && trie_.Id(node) != Vocab::kNoTokenExists) {
       *out_found = true;
-      break;
+      *out_end = static_cast<int>(runes[i].offset + runes[i].len);
     }
   }
   return Status::OK();
@@ -115,26 +123,30 @@ Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uin
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
-  IO_CHECK_VECTOR(input, output);
-  if (input[0]->Rank() > 1 || input[0]->type() != DataType::DE_STRING) {
-    RETURN_STATUS_UNEXPECTED(
-      "WordpieceTokenizer: The input shape should be 1D scalar the input datatype should be string.");
+Status WordpieceTokenizerOp::SplitTokens(const std::vector<std::string> &input_tokens,
+                                         const std::vector<uint32_t> &basic_starts,
+                                         std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
+                                         std::vector<uint32_t> *offsets_limit) const {
+  RETURN_UNEXPECTED_IF_NULL(out_tokens);
+  RETURN_UNEXPECTED_IF_NULL(offsets_start);
+  RETURN_UNEXPECTED_IF_NULL(offsets_limit);
+  CHECK_FAIL_RETURN_UNEXPECTED(basic_starts.empty() || basic_starts.size() == input_tokens.size(),
+                               "WordpieceTokenizer: the number of offsets does not match the number of tokens.");
+  for (size_t i = 0; i < input_tokens.size(); ++i) {
+    uint32_t basic_start = basic_starts.empty() ? 0 : basic_starts[i];
+    std::vector<std::string> temp_tokens;
+    RETURN_IF_NOT_OK(GetTokens(input_tokens[i], basic_start, &temp_tokens, offsets_start, offsets_limit));
+    out_tokens->insert(out_tokens->end(), temp_tokens.begin(), temp_tokens.end());
   }
-  dsize_t count = 0;
+  return Status::OK();
+}
+
+Status WordpieceTokenizerOp::ComputeTokens(const std::vector<std::string> &input_tokens,
+                                           const std::vector<uint32_t> &basic_starts, TensorRow *output) const {
   std::vector<std::string> out_tokens;
   std::vector<uint32_t> offsets_start, offsets_limit;
   std::shared_ptr<Tensor> token_tensor;
-  for (auto iter = input[0]->begin<std::string_view>(); iter != input[0]->end<std::string_view>(); iter++) {
-    uint32_t basic_start = 0;
-    std::vector<std::string> temp_tokens;
-    if (with_offsets_ && input.size() == 3) {
-      RETURN_IF_NOT_OK(input[1]->GetItemAt<uint32_t>(&basic_start, {count}));
-    }
-    RETURN_IF_NOT_OK(GetTokens(std::string(*iter), basic_start, &temp_tokens, &offsets_start, &offsets_limit));
-    out_tokens.insert(out_tokens.end(), temp_tokens.begin(), temp_tokens.end());
-    count++;
-  }
+  RETURN_IF_NOT_OK(SplitTokens(input_tokens, basic_starts, &out_tokens, &offsets_start, &offsets_limit));
   if (out_tokens.empty()) {
     (void)out_tokens.emplace_back("");
     offsets_start.push_back(0);
@@ -148,5 +160,26 @@ Status WordpieceTokenizerOp::Compute(const TensorRow &input, TensorRow *output)
   return Status::OK();
 }
 
+Status WordpieceTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  if (input[0]->Rank() > 1 || input[0]->type() != DataType::DE_STRING) {
+    RETURN_STATUS_UNEXPECTED(
+      "WordpieceTokenizer: The input shape should be 1D scalar the input datatype should be string.");
+  }
+  dsize_t count = 0;
+  std::vector<std::string> input_tokens;
+  std::vector<uint32_t> basic_starts;
+  for (auto iter = input[0]->begin<std::string_view>(); iter != input[0]->end<std::string_view>(); iter++) {
+    if (with_offsets_ && input.size() == 3) {
+      uint32_t basic_start = 0;
+      RETURN_IF_NOT_OK(input[1]->GetItemAt<uint32_t>(&basic_start, {count}));
+      basic_starts.push_back(basic_start);
+    }
+    (void)input_tokens.emplace_back(*iter);
+    count++;
+  }
+  return ComputeTokens(input_tokens, basic_starts, output);
+}
+
 }  // namespace dataset
 }  // namespace mindspore
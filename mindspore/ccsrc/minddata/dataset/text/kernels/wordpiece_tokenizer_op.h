@@ -26,6 +26,7 @@
 #include "minddata/dataset/include/dataset/text.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/text/kernels/tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_trie.h"
 #include "minddata/dataset/util/status.h"
 
 using cppjieba::DecodeRunesInString;
@@ -46,6 +47,25 @@ class WordpieceTokenizerOp : public TokenizerOp {
 
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
+  // Split tokens into subwords and output them, with their offsets if with_offsets is set
+  // @param input_tokens - The tokens
+  // @param basic_starts - The offset of each token, or empty if the tokens have no offsets
+  // @param output - The row to append the subwords and their offsets to
+  // @return Status The status code returned
+  Status ComputeTokens(const std::vector<std::string> &input_tokens, const std::vector<uint32_t> &basic_starts,
+                       TensorRow *output) const;
+
+  // Split tokens into subwords
+  // @param input_tokens - The tokens
+  // @param basic_starts - The offset of each token, or empty if the tokens have no offsets
+  // @param out_tokens - The subwords, without the empty subword ComputeTokens outputs when there is none
+  // @param offsets_start - The offset of the first byte of each subword
+  // @param offsets_limit - The offset past the last byte of each subword
+  // @return Status The status code returned
+  Status SplitTokens(const std::vector<std::string> &input_tokens, const std::vector<uint32_t> &basic_starts,
+                     std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
+                     std::vector<uint32_t> *offsets_limit) const;
+
  protected:
   Status AddSubword(const std::string &input_token, const int &start, const int &end,
                     std::vector<std::string> *out_token) const;
@@ -63,6 +83,7 @@ class WordpieceTokenizerOp : public TokenizerOp {
   const std::string suffix_indicator_;
   const int max_bytes_per_token_;
   const std::string unknown_token_;
+  const WordpieceTrie trie_;
 };
 }  // namespace dataset
 }  // namespace mindspore
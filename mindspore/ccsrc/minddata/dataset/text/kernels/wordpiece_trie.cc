@@ -0,0 +1,106 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/text/kernels/wordpiece_trie.h"
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+WordpieceTrie::WordpieceTrie(const std::shared_ptr<Vocab> &vocab, const std::string &suffix_indicator)
+    : suffix_node_(kNoNode) {
+  std::vector<std::pair<std::string_view, WordIdType>> words;
+  if (vocab != nullptr) {
+    words.reserve(vocab->GetVocab().size());
+    for (const auto &item : vocab->GetVocab()) {
+      words.emplace_back(item.first, item.second);
+    }
+  }
+  std::sort(words.begin(), words.end());
+
+  // Insert the words in order, so that a new child always goes after the children of its parent.
+  struct TempNode {
+    WordIdType id = Vocab::kNoTokenExists;
+    std::vector<std::pair<uint8_t, int32_t>> children;
+  };
+  std::vector<TempNode> temp_nodes(1);
+  for (const auto &word : words) {
+    int32_t node = 0;
+    for (char c : word.first) {
+      auto byte = static_cast<uint8_t>(c);
+      auto &children = temp_nodes[node].children;
+      if (!children.empty() && children.back().first == byte) {
+        node = children.back().second;
+      } else {
+        auto child = static_cast<int32_t>(temp_nodes.size());
+        children.emplace_back(byte, child);
+        temp_nodes.emplace_back();
+        node = child;
+      }
+    }
+    temp_nodes[node].id = word.second;
+  }
+
+  // Number the nodes breadth first, so that the children of a node are next to each other.
+  std::vector<int32_t> order;
+  std::vector<int32_t> index(temp_nodes.size());
+  order.reserve(temp_nodes.size());
+  order.push_back(0);
+  for (size_t i = 0; i < order.size(); ++i) {
+    index[order[i]] = static_cast<int32_t>(i);
+    for (const auto &child : temp_nodes[order[i]].children) {
+      order.push_back(child.second);
+    }
+  }
+  ids_.reserve(order.size());
+  child_offsets_.reserve(order.size() + 1);
+  child_bytes_.reserve(order.size() - 1);
+  child_nodes_.reserve(order.size() - 1);
+  child_offsets_.push_back(0);
+  for (auto temp_index : order) {
+    const auto &temp_node = temp_nodes[temp_index];
+    ids_.push_back(temp_node.id);
+    for (const auto &child : temp_node.children) {
+      child_bytes_.push_back(child.first);
+      child_nodes_.push_back(index[child.second]);
+    }
+    child_offsets_.push_back(static_cast<int32_t>(child_bytes_.size()));
+  }
+  suffix_node_ = Walk(0, suffix_indicator);
+}
+
+int32_t WordpieceTrie::Child(int32_t node, uint8_t byte) const {
+  auto first = child_bytes_.begin() + child_offsets_[node];
+  auto last = child_bytes_.begin() + child_offsets_[node + 1];
+  auto itr = std::lower_bound(first, last, byte);
+  if (itr == last || *itr != byte) {
+    return kNoNode;
+  }
+  return child_nodes_[itr - child_bytes_.begin()];
+}
+
+int32_t WordpieceTrie::Walk(int32_t node, std::string_view bytes) const {
+  for (char c : bytes) {
+    if (node == kNoNode) {
+      break;
+    }
+    node = Child(node, static_cast<uint8_t>(c));
+  }
+  return node;
+}
+}  // namespace dataset
+}  // namespace mindspore
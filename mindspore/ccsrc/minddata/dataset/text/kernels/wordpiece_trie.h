@@ -0,0 +1,68 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_WORDPIECE_TRIE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_WORDPIECE_TRIE_H_
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "minddata/dataset/include/dataset/text.h"
+
+namespace mindspore {
+namespace dataset {
+// Byte trie of the words of a vocab, built once per tokenizer to find the longest word of a token at a position
+// without building and hashing every candidate substring.
+// The children of a node are stored next to each other, in the order of their bytes, so a node is an index into
+// flat arrays. The words which continue a token, prefixed with the suffix indicator, are the words below the node of
+// the suffix indicator.
+class WordpieceTrie {
+ public:
+  // @param vocab - The vocab
+  // @param suffix_indicator - The prefix of the words which continue a token
+  WordpieceTrie(const std::shared_ptr<Vocab> &vocab, const std::string &suffix_indicator);
+
+  ~WordpieceTrie() = default;
+
+  // The node to start matching the subword at a byte of a token from.
+  // @param start - The byte of the token
+  // @return The root for the first subword, the node of the suffix indicator otherwise, kNoNode if no word of the
+  //     vocab starts with the suffix indicator
+  int32_t StartNode(int64_t start) const { return start == 0 ? 0 : suffix_node_; }
+
+  // Follow the bytes of a string from a node.
+  // @return The node reached, kNoNode if no word continues that way
+  int32_t Walk(int32_t node, std::string_view bytes) const;
+
+  // @return The id of the word which ends at a node, Vocab::kNoTokenExists if none does
+  WordIdType Id(int32_t node) const { return ids_[node]; }
+
+  static constexpr int32_t kNoNode = -1;
+
+ private:
+  // Follow one byte from a node
+  int32_t Child(int32_t node, uint8_t byte) const;
+
+  std::vector<WordIdType> ids_;            // The id of the word ending at each node
+  std::vector<int32_t> child_offsets_;     // The children of node i are [child_offsets_[i], child_offsets_[i + 1])
+  std::vector<uint8_t> child_bytes_;       // The byte leading to each child, ascending per node
+  std::vector<int32_t> child_nodes_;       // The index of each child
+  int32_t suffix_node_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_WORDPIECE_TRIE_H_
@@ -0,0 +1,190 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/numa_placement.h"
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/path.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr char kSysNodePath[] = "/sys/devices/system/node";
+constexpr char kSysPciPath[] = "/sys/bus/pci/devices";
+constexpr char kNodeName[] = "node";
+constexpr int kHex = 16;
+constexpr int kDecimal = 10;
+constexpr uint32_t kClassShift = 16;
+#if defined(__linux__) && !defined(__ANDROID__)
+constexpr int kMpolPreferred = 1;
+constexpr int32_t kBitsPerWord = 64;
+#endif
+
+// Read the first line of a sysfs file, empty if it can't be read
+std::string ReadSysFile(const std::string &path) {
+  std::ifstream fs(path);
+  std::string line;
+  if (fs.fail() || !std::getline(fs, line)) {
+    return "";
+  }
+  return line;
+}
+}  // namespace
+
+Status NumaPlacement::CreateNumaPlacement(std::shared_ptr<NumaPlacement> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  std::shared_ptr<NumaPlacement> placement(new NumaPlacement());
+  std::map<int32_t, std::vector<int32_t>> nodes;
+#if defined(__linux__) && !defined(__ANDROID__)
+  Path node_dir(kSysNodePath);
+  auto it = Path::DirIterator::OpenDirectory(&node_dir);
+  while (it != nullptr && it->HasNext()) {
+    auto p = it->Next();
+    const std::string entry = p.Basename();
+    const size_t prefix_len = strlen(kNodeName);
+    if (entry.size() <= prefix_len || entry.compare(0, prefix_len, kNodeName) != 0 ||
+        !std::all_of(entry.begin() + prefix_len, entry.end(), ::isdigit)) {
+      continue;
+    }
+    auto node = static_cast<int32_t>(strtol(entry.c_str() + prefix_len, nullptr, kDecimal));
+    auto cpus = ParseCpuList(ReadSysFile((p / "cpulist").ToString()));
+    // A node with memory only has no cpu to run on.
+    if (!cpus.empty()) {
+      nodes[node] = std::move(cpus);
+    }
+  }
+#endif
+  if (nodes.empty()) {
+    MS_LOG(INFO) << "No NUMA information is found, the host is seen as one NUMA node.";
+    nodes[0] = {};
+  }
+  // Node ids are dense on all the hosts we know of, so index by id.
+  placement->node_cpus_.resize(nodes.rbegin()->first + 1);
+  for (auto &node : nodes) {
+    placement->node_cpus_[node.first] = std::move(node.second);
+  }
+  *out = std::move(placement);
+  return Status::OK();
+}
+
+std::vector<int32_t> NumaPlacement::ParseCpuList(const std::string &cpu_list) {
+  std::vector<int32_t> cpus;
+  std::stringstream ss(cpu_list);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    if (range.empty() || !::isdigit(range[0])) {
+      continue;
+    }
+    char *end = nullptr;
+    auto first = static_cast<int32_t>(strtol(range.c_str(), &end, kDecimal));
+    auto last = first;
+    if (end != nullptr && *end == '-') {
+      last = static_cast<int32_t>(strtol(end + 1, nullptr, kDecimal));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+std::vector<int32_t> NumaPlacement::GetCpus(int32_t node) const {
+  if (node < 0 || node >= num_nodes()) {
+    return {};
+  }
+  return node_cpus_[node];
+}
+
+int32_t NumaPlacement::GetPciDeviceNode(const std::string &bus_id) {
+  std::string node = ReadSysFile(std::string(kSysPciPath) + "/" + bus_id + "/numa_node");
+  if (node.empty()) {
+    return kNoNode;
+  }
+  // The kernel reports -1 when the platform doesn't say which node the device is attached to.
+  auto id = static_cast<int32_t>(strtol(node.c_str(), nullptr, kDecimal));
+  return id < 0 ? kNoNode : id;
+}
+
+std::vector<std::string> NumaPlacement::ListPciDevices(uint32_t vendor_id, uint32_t class_id) {
+  std::vector<std::string> devices;
+#if defined(__linux__) && !defined(__ANDROID__)
+  Path pci_dir(kSysPciPath);
+  auto it = Path::DirIterator::OpenDirectory(&pci_dir);
+  while (it != nullptr && it->HasNext()) {
+    auto p = it->Next();
+    auto vendor = strtoul(ReadSysFile((p / "vendor").ToString()).c_str(), nullptr, kHex);
+    auto device_class = strtoul(ReadSysFile((p / "class").ToString()).c_str(), nullptr, kHex);
+    if (vendor == vendor_id && (device_class >> kClassShift) == class_id) {
+      devices.push_back(p.Basename());
+    }
+  }
+  std::sort(devices.begin(), devices.end());
+#endif
+  return devices;
+}
+
+void NumaPlacement::SetOperatorNode(int32_t operator_id, int32_t node) {
+  std::unique_lock<std::mutex> lock(mux_);
+  operator_nodes_[operator_id] = node;
+}
+
+int32_t NumaPlacement::GetOperatorNode(int32_t operator_id) const {
+  std::unique_lock<std::mutex> lock(mux_);
+  auto it = operator_nodes_.find(operator_id);
+  return it == operator_nodes_.end() ? kNoNode : it->second;
+}
+
+void NumaPlacement::BindCurrentThread(int32_t operator_id) {
+  int32_t node = GetOperatorNode(operator_id);
+  if (node == kNoNode || GetCpus(node).empty()) {
+    return;
+  }
+#if defined(__linux__) && !defined(__ANDROID__)
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (auto cpu : node_cpus_[node]) {
+    CPU_SET(cpu, &cpuset);
+  }
+  std::string err_msg;
+  if (sched_setaffinity(0, sizeof(cpuset), &cpuset) != 0) {
+    err_msg = "sched_setaffinity failed, errno: " + std::to_string(errno);
+  } else {
+    std::vector<unsigned long> node_mask(node / kBitsPerWord + 1, 0);  // NOLINT
+    node_mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+    if (syscall(SYS_set_mempolicy, kMpolPreferred, node_mask.data(), node_mask.size() * kBitsPerWord + 1) != 0) {
+      err_msg = "set_mempolicy failed, errno: " + std::to_string(errno);
+    }
+  }
+  // Containers often forbid changing the memory policy, don't flood the log with it.
+  if (!err_msg.empty() && !warned_.exchange(true)) {
+    MS_LOG(WARNING) << "Failed to bind the threads of operator " << operator_id << " to NUMA node " << node << ", "
+                    << err_msg << ". Please use mindspore.dataset.config.set_numa_policy('none') to disable it.";
+  }
+#endif
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_NUMA_PLACEMENT_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_NUMA_PLACEMENT_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// The NUMA nodes of the host and the node assigned to the threads of every operator of a pipeline.
+// The topology is read from sysfs, so libnuma is not needed. A thread is bound to a node by restricting it to the cpus
+// of the node and by making the node the preferred one for the memory it allocates. Since the kernel places a page on
+// the node of the thread which touches it first, the tensors created by the workers of an operator end up on the node
+// of the operator as well.
+class NumaPlacement {
+ public:
+  static constexpr int32_t kNoNode = -1;
+
+  // Read the NUMA topology of the host. A host without NUMA information is seen as one node.
+  // @param out - The placement, with no operator assigned
+  // @return Status The status code returned
+  static Status CreateNumaPlacement(std::shared_ptr<NumaPlacement> *out);
+
+  ~NumaPlacement() = default;
+
+  int32_t num_nodes() const { return static_cast<int32_t>(node_cpus_.size()); }
+
+  // @param node - A NUMA node
+  // @return The cpus of the node
+  std::vector<int32_t> GetCpus(int32_t node) const;
+
+  // Find the NUMA node a PCI device is attached to.
+  // @param bus_id - The PCI address of the device, like 0000:3b:00.0
+  // @return The node, kNoNode if the platform doesn't tell
+  static int32_t GetPciDeviceNode(const std::string &bus_id);
+
+  // List the PCI devices of a vendor and class, ordered by bus address, which is the order drivers number their
+  // devices in by default.
+  // @param vendor_id - The PCI vendor id
+  // @param class_id - The upper byte of the PCI class code of the device
+  // @return The PCI addresses of the devices
+  static std::vector<std::string> ListPciDevices(uint32_t vendor_id, uint32_t class_id);
+
+  // @param operator_id - The id of an operator
+  // @param node - The node the threads of the operator are bound to
+  void SetOperatorNode(int32_t operator_id, int32_t node);
+
+  // @return The node of an operator, kNoNode if it has none
+  int32_t GetOperatorNode(int32_t operator_id) const;
+
+  // Bind the calling thread to the node of its operator. Nothing is done if the operator has no node. A failure is
+  // only logged, the thread then runs where the scheduler puts it.
+  // @param operator_id - The id of the operator of the calling thread
+  void BindCurrentThread(int32_t operator_id);
+
+ private:
+  NumaPlacement() = default;
+
+  // Parse a cpu list like 0-3,8,10-11
+  static std::vector<int32_t> ParseCpuList(const std::string &cpu_list);
+
+  std::vector<std::vector<int32_t>> node_cpus_;
+  mutable std::mutex mux_;
+  std::map<int32_t, int32_t> operator_nodes_;
+  std::atomic<bool> warned_{false};
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_NUMA_PLACEMENT_H_
@@ -16,10 +16,13 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_QUEUE_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_QUEUE_H_
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -34,7 +37,10 @@
 
 namespace mindspore {
 namespace dataset {
-// A simple thread safe queue using a fixed size array
+// A simple thread safe queue using a fixed size array.
+// The queue can also be created in lock free mode, in which case it must have exactly one producer thread and one
+// consumer thread. Add and PopFront then only synchronize through the head and tail indexes of a ring buffer, and a
+// thread only parks on the condition variables after spinning for a while on a full (or empty) queue.
 template <typename T>
 class Queue {
  public:
@@ -44,29 +50,46 @@ class Queue {
   using reference = T &;
   using const_reference = const T &;
 
-  explicit Queue(int sz)
-      : sz_(sz), arr_(Services::GetAllocator<T>()), head_(0), tail_(0), my_name_(Services::GetUniqueID()) {
-    Status rc = arr_.allocate(sz);
+  // A lock free ring can't be reallocated while the producer and the consumer are running, so it reserves enough
+  // slots upfront for AutoTune to grow the queue at runtime.
+  static constexpr int32_t kLockFreeReservedCapacity = 128;
+
+  explicit Queue(int sz, bool lock_free = false)
+      : sz_(sz),
+        slots_(lock_free ? RoundUpPowerOfTwo(std::max(sz, kLockFreeReservedCapacity)) : sz),
+        lock_free_(lock_free),
+        arr_(Services::GetAllocator<T>()),
+        head_(0),
+        tail_(0),
+        my_name_(Services::GetUniqueID()) {
+    Status rc = arr_.allocate(slots_);
     if (rc.IsError()) {
       MS_LOG(ERROR) << "Fail to create a queue.";
       std::terminate();
     } else {
-      MS_LOG(DEBUG) << "Create Q with uuid " << my_name_ << " of size " << sz_ << ".";
+      MS_LOG(DEBUG) << "Create Q with uuid " << my_name_ << " of size " << sz_ << (lock_free_ ? " (lock free)." : ".");
     }
   }
 
   virtual ~Queue() { ResetQue(); }
 
   size_t size() const {
-    size_t v = tail_ - head_;
-    return (v >= 0) ? v : 0;
+    // Load head first, tail never falls behind it.
+    size_t h = head_.load(std::memory_order_acquire);
+    size_t t = tail_.load(std::memory_order_acquire);
+    return t - h;
   }
 
-  size_t capacity() const { return sz_; }
+  size_t capacity() const { return sz_.load(std::memory_order_relaxed); }
+
+  bool empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
 
-  bool empty() const { return head_ == tail_; }
+  bool lock_free() const { return lock_free_; }
 
-  void Reset() {
+  // Largest capacity Resize accepts. A lock free ring can't grow beyond the slots reserved at construction.
+  size_t max_capacity() const { return lock_free_ ? slots_ : static_cast<size_t>(std::numeric_limits<int32_t>::max()); }
+
+  virtual void Reset() {
     std::unique_lock<std::mutex> _lock(mux_);
     ResetQue();
     extra_arr_.clear();
@@ -74,6 +97,9 @@ class Queue {
 
   // Producer
   Status Add(const_reference ele) noexcept {
+    if (lock_free_) {
+      return LockFreeAdd(ele);
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
     Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
@@ -88,6 +114,9 @@ class Queue {
   }
 
   Status Add(T &&ele) noexcept {
+    if (lock_free_) {
+      return LockFreeAdd(std::forward<T>(ele));
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
     Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
@@ -103,11 +132,14 @@ class Queue {
 
   template <typename... Ts>
   Status EmplaceBack(Ts &&... args) noexcept {
+    if (lock_free_) {
+      return LockFreeAdd(T(std::forward<Ts>(args)...));
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
     Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
     if (rc.IsOk()) {
-      auto k = tail_++ % sz_;
+      auto k = Slot(tail_++);
       new (arr_[k]) T(std::forward<Ts>(args)...);
       empty_cv_.NotifyAll();
       _lock.unlock();
@@ -117,8 +149,64 @@ class Queue {
     return rc;
   }
 
+  // Producer, moves all the elements into the queue and clears the vector. The queue is synchronized once every time
+  // it has room for some of the elements, rather than once per element.
+  Status AddBatch(std::vector<T> *elements) noexcept {
+    RETURN_UNEXPECTED_IF_NULL(elements);
+    size_t next = 0;
+    while (next < elements->size()) {
+      size_t n = 0;
+      if (lock_free_) {
+        RETURN_IF_NOT_OK(LockFreeAddBatch(elements, next, &n));
+      } else {
+        std::unique_lock<std::mutex> _lock(mux_);
+        // Block when full
+        Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() < capacity()); });
+        if (rc.IsError()) {
+          empty_cv_.Interrupt();
+          return rc;
+        }
+        n = std::min(capacity() - size(), elements->size() - next);
+        for (size_t i = 0; i < n; ++i) {
+          RETURN_IF_NOT_OK(AddWhileHoldingLock(std::move((*elements)[next + i])));
+        }
+        empty_cv_.NotifyAll();
+      }
+      next += n;
+    }
+    elements->clear();
+    return Status::OK();
+  }
+
+  // Consumer, blocks until the queue is not empty, then moves up to max_count elements to the back of the vector.
+  Status PopFrontBatch(std::vector<T> *elements, size_t max_count) {
+    RETURN_UNEXPECTED_IF_NULL(elements);
+    CHECK_FAIL_RETURN_UNEXPECTED(max_count > 0, "The number of elements to pop should be larger than 0.");
+    if (lock_free_) {
+      return LockFreePopFrontBatch(elements, max_count);
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    // Block when empty
+    Status rc = empty_cv_.Wait(&_lock, [this]() -> bool { return !empty(); });
+    if (rc.IsError()) {
+      full_cv_.Interrupt();
+      return rc;
+    }
+    size_t n = std::min(size(), max_count);
+    for (size_t i = 0; i < n; ++i) {
+      T ele;
+      RETURN_IF_NOT_OK(PopFrontWhileHoldingLock(&ele, true));
+      elements->push_back(std::move(ele));
+    }
+    full_cv_.NotifyAll();
+    return Status::OK();
+  }
+
   // Consumer
   Status PopFront(pointer p) {
+    if (lock_free_) {
+      return LockFreePopFront(p);
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when empty
     Status rc = empty_cv_.Wait(&_lock, [this]() -> bool { return !empty(); });
@@ -147,6 +235,17 @@ class Queue {
     CHECK_FAIL_RETURN_UNEXPECTED(new_capacity > 0,
                                  "New capacity: " + std::to_string(new_capacity) + ", should be larger than 0");
     RETURN_OK_IF_TRUE(new_capacity == static_cast<int32_t>(capacity()));
+    if (lock_free_) {
+      // Only the logical capacity changes. Elements beyond a reduced capacity stay in the ring, and the producer
+      // blocks until the consumer drains them.
+      CHECK_FAIL_RETURN_UNEXPECTED(static_cast<size_t>(new_capacity) <= slots_,
+                                   "New capacity: " + std::to_string(new_capacity) +
+                                     ", should not be larger than the reserved slots of a lock free queue: " +
+                                     std::to_string(slots_));
+      sz_.store(new_capacity, std::memory_order_relaxed);
+      full_cv_.NotifyAll();
+      return Status::OK();
+    }
     std::vector<T> queue;
     // pop from the original queue until the new_capacity is full
     for (int32_t i = 0; i < new_capacity; ++i) {
@@ -180,39 +279,167 @@ class Queue {
       RETURN_IF_NOT_OK(this->AddWhileHoldingLock(queue[i]));
     }
     queue.clear();
+    // Wake up the producer blocked on the old capacity
+    full_cv_.NotifyAll();
     _lock.unlock();
     return Status::OK();
   }
 
  private:
-  size_t sz_;
+  // Number of times a lock free producer (consumer) polls a full (empty) queue before parking on the condition variable
+  static constexpr int32_t kSpinCount = 1024;
+
+  std::atomic<size_t> sz_;
+  size_t slots_;  // number of slots allocated in arr_, a power of two in lock free mode
+  const bool lock_free_;
   MemGuard<T, Allocator<T>> arr_;
   std::vector<T> extra_arr_;  // used to store extra elements after reducing capacity, will not be changed by Add,
                               // will pop when there is a space in queue (by PopFront or Resize)
-  size_t head_;
-  size_t tail_;
+  // head_ and tail_ are only written by the consumer and the producer respectively in lock free mode. Keep them on
+  // separate cache lines so that the two threads don't invalidate each other on every element.
+  alignas(64) std::atomic<size_t> head_;
+  alignas(64) std::atomic<size_t> tail_;
+  alignas(64) std::atomic<bool> producer_parked_{false};
+  std::atomic<bool> consumer_parked_{false};
   std::string my_name_;
   std::mutex mux_;
   CondVar empty_cv_;
   CondVar full_cv_;
 
+  static size_t RoundUpPowerOfTwo(int32_t n) {
+    size_t v = 1;
+    while (v < static_cast<size_t>(n)) {
+      v <<= 1;
+    }
+    return v;
+  }
+
+  size_t Slot(size_t pos) const { return lock_free_ ? (pos & (slots_ - 1)) : (pos % sz_); }
+
+  // Spin until ready() holds, then fall back to parking on the condition variable. Only used in lock free mode.
+  template <typename F>
+  Status SpinThenPark(CondVar *cv, std::atomic<bool> *parked, const F &ready) {
+    for (int32_t i = 0; i < kSpinCount; ++i) {
+      if (ready()) {
+        return Status::OK();
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    parked->store(true);
+    // Pairs with the fence in Unpark: either the other side sees us parked, or we see its update in ready().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    Status rc = cv->Wait(&_lock, [&ready]() -> bool { return ready(); });
+    parked->store(false);
+    return rc;
+  }
+
+  // Wake up the other side of a lock free queue if it went to sleep.
+  void Unpark(CondVar *cv, const std::atomic<bool> *parked) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked->load()) {
+      std::unique_lock<std::mutex> _lock(mux_);
+      cv->NotifyAll();
+    }
+  }
+
+  template <typename U>
+  Status LockFreeAdd(U &&ele) noexcept {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    auto has_room = [this, tail]() -> bool {
+      return tail - head_.load(std::memory_order_acquire) < sz_.load(std::memory_order_relaxed);
+    };
+    if (!has_room()) {
+      Status rc = SpinThenPark(&full_cv_, &producer_parked_, has_room);
+      if (rc.IsError()) {
+        empty_cv_.Interrupt();
+        return rc;
+      }
+    }
+    *(arr_[Slot(tail)]) = std::forward<U>(ele);
+    tail_.store(tail + 1, std::memory_order_release);
+    Unpark(&empty_cv_, &consumer_parked_);
+    return Status::OK();
+  }
+
+  Status LockFreePopFront(pointer p) noexcept {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    auto has_data = [this, head]() -> bool { return tail_.load(std::memory_order_acquire) != head; };
+    if (!has_data()) {
+      Status rc = SpinThenPark(&empty_cv_, &consumer_parked_, has_data);
+      if (rc.IsError()) {
+        full_cv_.Interrupt();
+        return rc;
+      }
+    }
+    *p = std::move(*(arr_[Slot(head)]));
+    head_.store(head + 1, std::memory_order_release);
+    Unpark(&full_cv_, &producer_parked_);
+    return Status::OK();
+  }
+
+  // Move as many elements as there is room for, starting from elements[next]; blocks until there is room for one.
+  Status LockFreeAddBatch(std::vector<T> *elements, size_t next, size_t *added) noexcept {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    auto room = [this, tail]() -> size_t {
+      size_t used = tail - head_.load(std::memory_order_acquire);
+      size_t cap = sz_.load(std::memory_order_relaxed);
+      return cap > used ? cap - used : 0;
+    };
+    if (room() == 0) {
+      Status rc = SpinThenPark(&full_cv_, &producer_parked_, [&room]() -> bool { return room() > 0; });
+      if (rc.IsError()) {
+        empty_cv_.Interrupt();
+        return rc;
+      }
+    }
+    // The room may shrink to 0 again if the queue is resized meanwhile, the caller then simply retries.
+    size_t n = std::min(room(), elements->size() - next);
+    for (size_t i = 0; i < n; ++i) {
+      *(arr_[Slot(tail + i)]) = std::move((*elements)[next + i]);
+    }
+    tail_.store(tail + n, std::memory_order_release);
+    Unpark(&empty_cv_, &consumer_parked_);
+    *added = n;
+    return Status::OK();
+  }
+
+  Status LockFreePopFrontBatch(std::vector<T> *elements, size_t max_count) noexcept {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    auto has_data = [this, head]() -> bool { return tail_.load(std::memory_order_acquire) != head; };
+    if (!has_data()) {
+      Status rc = SpinThenPark(&empty_cv_, &consumer_parked_, has_data);
+      if (rc.IsError()) {
+        full_cv_.Interrupt();
+        return rc;
+      }
+    }
+    size_t n = std::min(tail_.load(std::memory_order_acquire) - head, max_count);
+    for (size_t i = 0; i < n; ++i) {
+      elements->push_back(std::move(*(arr_[Slot(head + i)])));
+    }
+    head_.store(head + n, std::memory_order_release);
+    Unpark(&full_cv_, &producer_parked_);
+    return Status::OK();
+  }
+
   // Helper function for Add, must be called when holding a lock
   Status AddWhileHoldingLock(const_reference ele) {
-    auto k = tail_++ % sz_;
+    auto k = Slot(tail_++);
     *(arr_[k]) = ele;
     return Status::OK();
   }
 
   // Helper function for Add, must be called when holding a lock
   Status AddWhileHoldingLock(T &&ele) {
-    auto k = tail_++ % sz_;
+    auto k = Slot(tail_++);
     *(arr_[k]) = std::forward<T>(ele);
     return Status::OK();
   }
 
   // Helper function for PopFront, must be called when holding a lock
   Status PopFrontWhileHoldingLock(pointer p, bool clean_extra) {
-    auto k = head_++ % sz_;
+    auto k = Slot(head_++);
     *p = std::move(*(arr_[k]));
     if (!extra_arr_.empty() && clean_extra) {
       RETURN_IF_NOT_OK(this->AddWhileHoldingLock(std::forward<T>(extra_arr_[0])));
@@ -241,10 +468,14 @@ class QueueList {
  public:
   QueueList() {}
 
-  void Init(int num_queues, int capacity) {
+  /// \brief Create the queues
+  /// \param num_queues number of queues
+  /// \param capacity capacity of each queue
+  /// \param lock_free whether the queues are lock free, every queue must then have a single producer and consumer
+  void Init(int num_queues, int capacity, bool lock_free = false) {
     queue_list_.reserve(num_queues);
     for (int i = 0; i < num_queues; i++) {
-      queue_list_.emplace_back(std::make_unique<Queue<T>>(capacity));
+      queue_list_.emplace_back(std::make_unique<Queue<T>>(capacity, lock_free));
     }
   }
 
@@ -267,7 +498,7 @@ class QueueList {
   ~QueueList() = default;
 
   Status AddQueue(TaskGroup *vg) {
-    queue_list_.emplace_back(std::make_unique<Queue<T>>(queue_list_[0]->capacity()));
+    queue_list_.emplace_back(std::make_unique<Queue<T>>(queue_list_[0]->capacity(), queue_list_[0]->lock_free()));
     return queue_list_[queue_list_.size() - 1]->Register(vg);
   }
   Status RemoveLastQueue() {
@@ -0,0 +1,208 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/size_class_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include "./securec.h"
+#include "minddata/dataset/util/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr size_t kMinPooledSize = 256;
+constexpr int32_t kClassesPerPowerOfTwo = 4;
+}  // namespace
+
+SizeClassPool::SizeClassPool(uint64_t limit) : limit_(limit) {}
+
+SizeClassPool::~SizeClassPool() { Trim(); }
+
+const std::array<size_t, SizeClassPool::kNumSizeClasses> &SizeClassPool::ClassSizes() {
+  static const std::array<size_t, kNumSizeClasses> sizes = []() {
+    std::array<size_t, kNumSizeClasses> v{};
+    int32_t i = 0;
+    for (size_t base = kMinPooledSize; base < kMaxPooledSize; base <<= 1) {
+      for (int32_t j = 0; j < kClassesPerPowerOfTwo; ++j) {
+        v[i++] = base + base / kClassesPerPowerOfTwo * j;
+      }
+    }
+    v[i] = kMaxPooledSize;
+    return v;
+  }();
+  return sizes;
+}
+
+uint32_t SizeClassPool::SizeClassOf(size_t n) {
+  if (n > kMaxPooledSize) {
+    return kLargeClass;
+  }
+  const auto &sizes = ClassSizes();
+  return static_cast<uint32_t>(std::lower_bound(sizes.begin(), sizes.end(), n) - sizes.begin());
+}
+
+SizeClassPool::Cache *SizeClassPool::MyCache() {
+  // Threads are spread over the caches in the order they first allocate or free a tensor.
+  static std::atomic<uint32_t> next_cache_id{0};
+  thread_local uint32_t my_cache_id = next_cache_id++ % kNumCaches;
+  return &caches_[my_cache_id];
+}
+
+SizeClassPool::BlockHeader *SizeClassPool::TakeCachedBlock(uint32_t size_class) {
+  Cache *mine = MyCache();
+  {
+    auto &free_list = mine->free_lists[size_class];
+    std::unique_lock<std::mutex> lock(free_list.mux);
+    if (!free_list.blocks.empty()) {
+      BlockHeader *block = free_list.blocks.back();
+      free_list.blocks.pop_back();
+      return block;
+    }
+  }
+  // Steal from the other caches, but don't wait for a busy one.
+  for (auto &cache : caches_) {
+    if (&cache == mine) {
+      continue;
+    }
+    auto &free_list = cache.free_lists[size_class];
+    std::unique_lock<std::mutex> lock(free_list.mux, std::try_to_lock);
+    if (lock.owns_lock() && !free_list.blocks.empty()) {
+      BlockHeader *block = free_list.blocks.back();
+      free_list.blocks.pop_back();
+      return block;
+    }
+  }
+  return nullptr;
+}
+
+Status SizeClassPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  ++num_allocs_;
+  uint32_t size_class = SizeClassOf(n);
+  size_t block_size = size_class == kLargeClass ? n : ClassSizes()[size_class];
+  BlockHeader *block = size_class == kLargeClass ? nullptr : TakeCachedBlock(size_class);
+  if (block != nullptr) {
+    ++num_cache_hits_;
+    bytes_cached_ -= block_size;
+  } else {
+    void *q = nullptr;
+    RETURN_IF_NOT_OK(DeMalloc(sizeof(BlockHeader) + block_size, &q, false));
+    ++num_system_allocs_;
+    block = reinterpret_cast<BlockHeader *>(q);
+    block->size_class = size_class;
+    block->magic = kMagic;
+    block->size = block_size;
+  }
+  uint64_t in_use = (bytes_in_use_ += block_size);
+  uint64_t peak = peak_bytes_in_use_.load();
+  while (in_use > peak && !peak_bytes_in_use_.compare_exchange_weak(peak, in_use)) {
+  }
+  *p = block + 1;
+  return Status::OK();
+}
+
+Status SizeClassPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  RETURN_UNEXPECTED_IF_NULL(*p);
+  BlockHeader *block = reinterpret_cast<BlockHeader *>(*p) - 1;
+  if (new_sz <= block->size) {
+    // The block is large enough already.
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  errno_t err = memcpy_s(q, new_sz, *p, std::min<size_t>(old_sz, block->size));
+  if (err != EOK) {
+    Deallocate(q);
+    RETURN_STATUS_UNEXPECTED("Failed to copy the block in Reallocate, errno: " + std::to_string(err));
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void SizeClassPool::ReleaseToSystem(BlockHeader *block) {
+  ++num_system_frees_;
+  free(block);
+}
+
+void SizeClassPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  BlockHeader *block = reinterpret_cast<BlockHeader *>(p) - 1;
+  if (block->magic != kMagic) {
+    MS_LOG(ERROR) << "SizeClassPool is asked to free a block it didn't allocate, address: " << p;
+    return;
+  }
+  uint64_t block_size = block->size;
+  uint64_t in_use = (bytes_in_use_ -= block_size);
+  if (block->size_class == kLargeClass || in_use + bytes_cached_ + block_size > limit_) {
+    ReleaseToSystem(block);
+    return;
+  }
+  bytes_cached_ += block_size;
+  auto &free_list = MyCache()->free_lists[block->size_class];
+  std::unique_lock<std::mutex> lock(free_list.mux);
+  free_list.blocks.push_back(block);
+}
+
+void SizeClassPool::Trim() {
+  for (auto &cache : caches_) {
+    for (auto &free_list : cache.free_lists) {
+      std::unique_lock<std::mutex> lock(free_list.mux);
+      for (auto block : free_list.blocks) {
+        bytes_cached_ -= block->size;
+        ReleaseToSystem(block);
+      }
+      free_list.blocks.clear();
+    }
+  }
+}
+
+uint64_t SizeClassPool::get_max_size() const { return std::numeric_limits<uint64_t>::max(); }
+
+int SizeClassPool::PercentFree() const {
+  uint64_t held = bytes_in_use_ + bytes_cached_;
+  if (limit_ == 0 || held >= limit_) {
+    return 0;
+  }
+  return static_cast<int>((limit_ - held) * 100 / limit_);
+}
+
+SizeClassPool::Stats SizeClassPool::GetStats() const {
+  Stats stats;
+  stats.num_allocs = num_allocs_;
+  stats.num_cache_hits = num_cache_hits_;
+  stats.num_system_allocs = num_system_allocs_;
+  stats.num_system_frees = num_system_frees_;
+  stats.bytes_in_use = bytes_in_use_;
+  stats.peak_bytes_in_use = peak_bytes_in_use_;
+  stats.bytes_cached = bytes_cached_;
+  return stats;
+}
+
+std::ostream &operator<<(std::ostream &os, const SizeClassPool &s) {
+  auto stats = s.GetStats();
+  os << "SizeClassPool limit: " << s.limit() << " bytes, allocations: " << stats.num_allocs
+     << ", cache hits: " << stats.num_cache_hits << ", system allocations: " << stats.num_system_allocs
+     << ", system frees: " << stats.num_system_frees << ", bytes in use: " << stats.bytes_in_use
+     << ", peak bytes in use: " << stats.peak_bytes_in_use << ", bytes cached: " << stats.bytes_cached;
+  return os;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// A MemoryPool for tensor buffers which recycles freed blocks instead of returning them to the system.
+// Requests are rounded up to a size class (four classes per power of two, so at most 25% of a block is wasted) and
+// freed blocks are kept in per-size-class free lists. The free lists are split into a number of caches, each thread
+// works on its own cache, and every free list has its own lock, so a lock is only contended by threads sharing a cache
+// and a size class, or by a thread taking a block from another cache. A thread whose cache is empty
+// takes a block from the caches of the other threads before falling back to malloc, which covers the usual case of
+// a buffer allocated by a worker and freed by the thread at the end of the pipeline.
+// The pool holds at most limit bytes (blocks in use plus cached blocks). A block freed while the pool is above the
+// limit goes back to the system, so the limit caps what the pool keeps, not what the pipeline may allocate.
+class SizeClassPool : public MemoryPool {
+ public:
+  struct Stats {
+    uint64_t num_allocs = 0;         // number of Allocate calls
+    uint64_t num_cache_hits = 0;     // number of allocations served by a cached block
+    uint64_t num_system_allocs = 0;  // number of blocks obtained from the system
+    uint64_t num_system_frees = 0;   // number of blocks returned to the system
+    uint64_t bytes_in_use = 0;       // bytes of the blocks handed out
+    uint64_t peak_bytes_in_use = 0;  // high water mark of bytes_in_use
+    uint64_t bytes_cached = 0;       // bytes of the blocks kept for reuse
+  };
+
+  // Blocks larger than this are not pooled
+  static constexpr size_t kMaxPooledSize = 64ULL * 1024 * 1024;
+
+  // @param limit - The maximum number of bytes held by the pool
+  explicit SizeClassPool(uint64_t limit);
+
+  SizeClassPool(const SizeClassPool &) = delete;
+
+  SizeClassPool &operator=(const SizeClassPool &) = delete;
+
+  ~SizeClassPool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // Return all the cached blocks to the system
+  void Trim();
+
+  // @return A snapshot of the counters of the pool
+  Stats GetStats() const;
+
+  uint64_t limit() const { return limit_; }
+
+  friend std::ostream &operator<<(std::ostream &os, const SizeClassPool &s);
+
+ private:
+  static constexpr int32_t kNumCaches = 16;
+  // 4 classes for each power of two from 256 bytes up to kMaxPooledSize
+  static constexpr int32_t kNumSizeClasses = 73;
+  static constexpr uint32_t kLargeClass = kNumSizeClasses;
+  static constexpr uint32_t kMagic = 0x5C1A55ED;
+
+  // Stored in front of every block, keeps the data 16 bytes aligned like malloc does
+  struct BlockHeader {
+    uint32_t size_class;
+    uint32_t magic;
+    uint64_t size;
+  };
+
+  // On its own cache line, so that the free lists of different classes don't slow each other down
+  struct alignas(64) FreeList {
+    std::mutex mux;
+    std::vector<BlockHeader *> blocks;
+  };
+
+  struct Cache {
+    std::array<FreeList, kNumSizeClasses> free_lists;
+  };
+
+  static const std::array<size_t, kNumSizeClasses> &ClassSizes();
+
+  static uint32_t SizeClassOf(size_t n);
+
+  // @return The cache of the calling thread
+  Cache *MyCache();
+
+  // Take a cached block of the given class from any cache, nullptr if there is none
+  BlockHeader *TakeCachedBlock(uint32_t size_class);
+
+  void ReleaseToSystem(BlockHeader *block);
+
+  uint64_t limit_;
+  std::array<Cache, kNumCaches> caches_;
+  std::atomic<uint64_t> num_allocs_{0};
+  std::atomic<uint64_t> num_cache_hits_{0};
+  std::atomic<uint64_t> num_system_allocs_{0};
+  std::atomic<uint64_t> num_system_frees_{0};
+  std::atomic<uint64_t> bytes_in_use_{0};
+  std::atomic<uint64_t> peak_bytes_in_use_{0};
+  std::atomic<uint64_t> bytes_cached_{0};
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SIZE_CLASS_POOL_H_
@@ -56,6 +56,11 @@ void Task::operator()() {
     TaskGroup *vg = MyTaskGroup();
     std::string uuid = ss.str();
     rc_ = vg->GetIntrpService()->Register(&uuid, this);
+    auto numa_placement = vg->GetNumaPlacement();
+    if (rc_.IsOk() && numa_placement != nullptr) {
+      // Bind before running anything so that the memory of the task is allocated on its node.
+      numa_placement->BindCurrentThread(operator_id_);
+    }
     if (rc_.IsOk()) {
       // Now we can run the given task.
       rc_ = fnc_obj_();
@@ -201,6 +206,10 @@ Status Task::Join(WaitFlag blocking) {
 
 TaskGroup *Task::MyTaskGroup() { return task_group_; }
 
+std::shared_ptr<MemoryPool> Task::GetMemoryPool() {
+  return task_group_ == nullptr ? nullptr : task_group_->GetMemoryPool();
+}
+
 void Task::set_task_group(TaskGroup *vg) { task_group_ = vg; }
 
 Task::~Task() { task_group_ = nullptr; }
@@ -107,6 +107,9 @@ class Task : public IntrpResource {
 
   static Status OverrideInterruptRc(const Status &rc);
 
+  // Memory pool of the task group of this task, nullptr if the group uses the global one
+  std::shared_ptr<MemoryPool> GetMemoryPool();
+
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__ANDROID__) && !defined(ANDROID) && !defined(__APPLE__)
   pthread_t GetNativeHandle() const;
 #endif
@@ -25,9 +25,11 @@
 #include <memory>
 #include <string>
 #include <set>
+#include <utility>
 #include "minddata/dataset/util/allocator.h"
 #include "minddata/dataset/util/intrp_service.h"
 #include "minddata/dataset/util/lock.h"
+#include "minddata/dataset/util/numa_placement.h"
 #include "minddata/dataset/util/services.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/util/task.h"
@@ -153,6 +155,18 @@ class TaskGroup : public Service {
 
   std::shared_ptr<IntrpService> GetIntrpService();
 
+  /// \brief Set the memory pool for the data of the tensors created by the tasks of this group
+  void SetMemoryPool(std::shared_ptr<MemoryPool> pool) { mem_pool_ = std::move(pool); }
+
+  /// \return The memory pool of this group, nullptr if the tasks use the global one
+  std::shared_ptr<MemoryPool> GetMemoryPool() const { return mem_pool_; }
+
+  /// \brief Set the NUMA nodes the tasks of this group are bound to, according to their operator
+  void SetNumaPlacement(std::shared_ptr<NumaPlacement> placement) { numa_placement_ = std::move(placement); }
+
+  /// \return The NUMA placement of this group, nullptr if the tasks are not bound
+  std::shared_ptr<NumaPlacement> GetNumaPlacement() const { return numa_placement_; }
+
  private:
   Status rc_;
   // Can't use rw_lock_ as we will lead to deadlatch. Create another mutex to serialize access to rc_.
@@ -160,6 +174,8 @@ class TaskGroup : public Service {
   RWLock rw_lock_;
   List<Task> grp_list_;
   std::shared_ptr<IntrpService> intrp_svc_;
+  std::shared_ptr<MemoryPool> mem_pool_;
+  std::shared_ptr<NumaPlacement> numa_placement_;
 };
 
 namespace this_thread {
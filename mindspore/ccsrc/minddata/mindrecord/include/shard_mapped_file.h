@@ -0,0 +1,74 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MAPPED_FILE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MAPPED_FILE_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "minddata/mindrecord/include/common/log_adapter.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+/// \brief A whole mindrecord file mapped into the address space of the process.
+/// \note The mapping is read-only, a slice handed out to a consumer must be copied before it is modified.
+class __attribute__((visibility("default"))) ShardMappedFile {
+ public:
+  ShardMappedFile() = default;
+
+  ~ShardMappedFile();
+
+  ShardMappedFile(const ShardMappedFile &) = delete;
+
+  ShardMappedFile &operator=(const ShardMappedFile &) = delete;
+
+  /// \brief map the whole file
+  /// \param[in] file_path the path of the mindrecord file
+  /// \param[out] mapped_file the mapped file, nullptr if the platform doesn't support mmap
+  /// \return Status the status of mapping
+  static Status Map(const std::string &file_path, std::shared_ptr<ShardMappedFile> *mapped_file);
+
+  /// \brief get a pointer to the given offset of the file
+  /// \param[in] offset offset in bytes from the start of the file
+  /// \param[in] len number of bytes which should be valid after the offset
+  /// \param[out] data the address of the offset
+  /// \return Status the status of the range check
+  Status GetData(uint64_t offset, uint64_t len, uint8_t **data) const;
+
+  /// \brief check whether the address belongs to this mapping
+  bool Contains(const void *p) const {
+    auto addr = reinterpret_cast<const uint8_t *>(p);
+    return base_ != nullptr && addr >= base_ && addr < base_ + size_;
+  }
+
+  /// \brief getter
+  uint64_t GetSize() const { return size_; }
+
+  /// \brief getter
+  const std::string &GetFilePath() const { return file_path_; }
+
+ private:
+  std::string file_path_;
+  uint8_t *base_ = nullptr;
+  uint64_t size_ = 0;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_MAPPED_FILE_H_
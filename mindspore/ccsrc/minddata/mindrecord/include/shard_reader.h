@@ -49,6 +49,7 @@
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_mapped_file.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
 #include "minddata/mindrecord/include/shard_reader.h"
@@ -62,6 +63,14 @@ namespace mindrecord {
 using ROW_GROUPS = std::pair<std::vector<std::vector<std::vector<uint64_t>>>, std::vector<std::vector<json>>>;
 using ROW_GROUP_BRIEF = std::tuple<std::string, int, uint64_t, std::vector<std::vector<uint64_t>>, std::vector<json>>;
 using TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>>;
+
+/// \brief a range of the blob data inside a memory mapped mindrecord file, it stays valid as long as `file` is held
+struct ShardBlobSlice {
+  std::shared_ptr<ShardMappedFile> file;
+  uint8_t *data = nullptr;
+  uint64_t size = 0;
+};
+using MAPPED_TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<ShardBlobSlice, json>>>;
 const int kNumBatchInMap = 1000;  // iterator buffer size in row-reader mode
 
 class API_PUBLIC ShardReader {
@@ -179,6 +188,21 @@ class API_PUBLIC ShardReader {
   /// \brief return a row by id
   /// \return a batch of images and image data
   TASK_CONTENT GetNextById(const int64_t &task_id, const int32_t &consumer_id);
+
+  /// \brief return a row by id without copying the blob data, only available in memory mapped read mode
+  /// \param[in] task_id the id of the task
+  /// \param[out] task_content_ptr slices of the mapped files and scalar fields
+  /// \return MSRStatus the status of MSRStatus
+  Status GetNextMappedById(const int64_t &task_id, std::shared_ptr<MAPPED_TASK_CONTENT> *task_content_ptr);
+
+  /// \brief enable memory mapped read mode, must be called before Open(). Falls back to stream read if any file
+  ///     can't be mapped
+  /// \return null
+  void SetMmapMode(bool use_mmap) { use_mmap_ = use_mmap; }
+
+  /// \brief check whether the files are actually read through memory mapping
+  /// \return true if all shard files are mapped
+  bool IsMmapEnabled() const { return use_mmap_ && !mapped_files_.empty(); }
   /// \brief  get blob filed list
   /// \return blob field list
   std::pair<ShardType, std::vector<std::string>> GetBlobFields();
@@ -286,6 +310,23 @@ class API_PUBLIC ShardReader {
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief find the location of the blob data and the scalar fields of one task
+  Status LocateTask(int64_t task_id, TaskType *task_type, uint32_t *shard_id, uint64_t *file_offset,
+                    uint64_t *blob_size, json *var_fields);
+
+  /// \brief find the blob fields which are not selected, so that they are not read
+  void SelectBlobFields();
+
+  /// \brief read the blob data of one row, the blob fields which are not selected are left out with a length of 0
+  Status ReadBlob(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t blob_size,
+                  std::vector<uint8_t> *blob);
+
+  /// \brief read a range of a shard file, from the mapped file if there is one
+  Status ReadShardFile(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t size, uint8_t *dst);
+
+  /// \brief map all shard files into memory, fall back to stream read if failed
+  void MapShardFiles();
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
@@ -317,6 +358,8 @@ class API_PUBLIC ShardReader {
  private:
   int n_consumer_;                                         // number of workers (threads)
   std::vector<std::string> selected_columns_;              // columns which will be read
+  // one flag per blob field in the order of the blob, true if the field is read, empty if all the fields are read
+  std::vector<bool> blob_fields_to_read_;
   std::map<string, uint64_t> column_schema_id_;            // column-schema map
   std::vector<std::shared_ptr<ShardOperator>> operators_;  // data operators, including shuffle, sample and category
   ShardTaskList tasks_;                                    // shard task list
@@ -345,6 +388,10 @@ class API_PUBLIC ShardReader {
   // all metadata in the index is not loaded during initialization
   bool lazy_load_;
 
+  // read the blob data through memory mapped files instead of file streams
+  bool use_mmap_ = false;
+  std::vector<std::shared_ptr<ShardMappedFile>> mapped_files_;  // mapped file list, one per shard
+
   // indicate shard_id : inc_count
   // 0 : 15  -  shard0 has 15 samples
   // 1 : 41  -  shard1 has 26 samples
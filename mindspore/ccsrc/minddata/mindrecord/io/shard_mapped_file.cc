@@ -0,0 +1,94 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_mapped_file.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cerrno>
+#include <cstring>
+
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+ShardMappedFile::~ShardMappedFile() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (base_ != nullptr) {
+    if (munmap(base_, size_) != 0) {
+      MS_LOG(WARNING) << "Failed to unmap mindrecord file: " << file_path_ << ", errno: " << errno;
+    }
+    base_ = nullptr;
+    size_ = 0;
+  }
+#endif
+}
+
+Status ShardMappedFile::Map(const std::string &file_path, std::shared_ptr<ShardMappedFile> *mapped_file) {
+  RETURN_UNEXPECTED_IF_NULL_MR(mapped_file);
+  *mapped_file = nullptr;
+#if defined(_WIN32) || defined(_WIN64)
+  MS_LOG(INFO) << "Memory mapped read is not supported on this platform, file: " << file_path;
+  return Status::OK();
+#else
+  auto realpath = FileUtils::GetRealPath(file_path.c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    realpath.has_value(),
+    "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file_path);
+
+  int fd = open(realpath.value().c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0, "Invalid file, failed to open mindrecord file for memory mapped read: " +
+                                             file_path + ", errno: " + std::to_string(errno));
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the size of mindrecord file: " + file_path);
+  }
+  auto size = static_cast<uint64_t>(file_stat.st_size);
+  // A read-only mapping, the pages are shared by all the rows which refer to them.
+  void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(addr != MAP_FAILED, "Failed to mmap mindrecord file: " + file_path +
+                                                        ", errno: " + std::to_string(errno));
+  // Samples are fetched in a random order most of the time.
+  (void)madvise(addr, size, MADV_RANDOM);
+
+  auto result = std::make_shared<ShardMappedFile>();
+  result->file_path_ = file_path;
+  result->base_ = reinterpret_cast<uint8_t *>(addr);
+  result->size_ = size;
+  *mapped_file = std::move(result);
+  MS_LOG(INFO) << "Succeed to mmap mindrecord file: " << file_path << ", size: " << size;
+  return Status::OK();
+#endif
+}
+
+Status ShardMappedFile::GetData(uint64_t offset, uint64_t len, uint8_t **data) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(data);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(base_ != nullptr, "[Internal ERROR] The mindrecord file is not mapped.");
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(offset <= size_ && len <= size_ - offset,
+                                  "Invalid data, the range [" + std::to_string(offset) + ", " +
+                                    std::to_string(offset + len) + ") is out of the size of mindrecord file: " +
+                                    file_path_ + ", size: " + std::to_string(size_));
+  *data = base_ + offset;
+  return Status::OK();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
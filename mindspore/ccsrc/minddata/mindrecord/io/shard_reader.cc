@@ -211,9 +211,29 @@ Status ShardReader::Open(int n_consumer) {
     }
     MS_LOG(INFO) << "Succeed to open file, path: " << file;
   }
+  if (use_mmap_) {
+    MapShardFiles();
+  }
   return Status::OK();
 }
 
+void ShardReader::MapShardFiles() {
+  mapped_files_.clear();
+  std::vector<std::shared_ptr<ShardMappedFile>> mapped_files;
+  for (const auto &file : file_paths_) {
+    std::shared_ptr<ShardMappedFile> mapped_file;
+    auto s = ShardMappedFile::Map(file, &mapped_file);
+    if (s.IsError() || mapped_file == nullptr) {
+      MS_LOG(WARNING) << "Failed to mmap mindrecord file: " << file << ", fall back to stream read. "
+                      << (s.IsError() ? s.GetErrDescription() : "");
+      return;
+    }
+    mapped_files.push_back(std::move(mapped_file));
+  }
+  mapped_files_ = std::move(mapped_files);
+  MS_LOG(INFO) << "Succeed to mmap " << mapped_files_.size() << " mindrecord files.";
+}
+
 Status ShardReader::ExtendRandomFileStreams(const int n_new_consumers) {
   CHECK_FAIL_RETURN_UNEXPECTED_MR(n_new_consumers > 0,
                                   "n_new_consumers must be a positive number. Got: " + std::to_string(n_new_consumers));
@@ -294,6 +314,8 @@ Status ShardReader::ShrinkRandomFileStreams(const int n_remove_consumers) {
 }
 
 void ShardReader::FileStreamsOperator() {
+  // Slices already handed out keep their own reference to the mapped file
+  mapped_files_.clear();
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; --i) {
     if (file_streams_[i] != nullptr) {
       file_streams_[i]->close();
@@ -806,6 +828,29 @@ Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std:
                                             std::shared_ptr<std::vector<json>> *labels_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
   std::string file_name = file_paths_[shard_id];
+  if (IsMmapEnabled()) {
+    for (const auto &labelOffset : label_offsets) {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(labelOffset.size() >= 3,
+                                      "[Internal ERROR] Failed to read the label from the memory mapped file: " +
+                                        file_name + ", 'labelOffset' should contain page id, start and end offset, "
+                                        "but got size: " + std::to_string(labelOffset.size()) + ".");
+      uint64_t label_start = std::stoull(labelOffset[1]) + kInt64Len;
+      uint64_t label_end = std::stoull(labelOffset[2]);
+      int raw_page_id = std::stoi(labelOffset[0]);
+      uint8_t *label_data = nullptr;
+      RETURN_IF_NOT_OK_MR(mapped_files_[shard_id]->GetData(page_size_ * raw_page_id + header_size_ + label_start,
+                                                           label_end - label_start, &label_data));
+      json label_json = json::from_msgpack(label_data, label_data + (label_end - label_start));
+      json tmp = label_json;
+      for (auto &col : columns) {
+        if (label_json.find(col) != label_json.end()) {
+          tmp[col] = label_json[col];
+        }
+      }
+      (*labels_ptr)->emplace_back(std::move(tmp));
+    }
+    return Status::OK();
+  }
   auto realpath = FileUtils::GetRealPath(file_name.c_str());
   CHECK_FAIL_RETURN_UNEXPECTED_MR(
     realpath.has_value(),
@@ -1085,6 +1130,7 @@ Status ShardReader::Open(const std::vector<std::string> &file_paths, bool load_d
 
   selected_columns_ = selected_columns;
   RETURN_IF_NOT_OK_MR(CheckColumnList(selected_columns_));
+  SelectBlobFields();
 
   // Initialize argument
   shard_count_ = static_cast<int>(file_paths_.size());
@@ -1324,35 +1370,35 @@ Status ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, uint
   return Status::OK();
 }
 
-Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
-                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+Status ShardReader::LocateTask(int64_t task_id, TaskType *task_type, uint32_t *shard_id, uint64_t *file_offset,
+                               uint64_t *blob_size, json *var_fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_type);
+  RETURN_UNEXPECTED_IF_NULL_MR(shard_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(file_offset);
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_size);
+  RETURN_UNEXPECTED_IF_NULL_MR(var_fields);
   // All tasks are done
   CHECK_FAIL_RETURN_UNEXPECTED_MR(task_id < tasks_.Size(), "[Internal ERROR] 'task_id': " + std::to_string(task_id) +
                                                              " is out of bound: " + std::to_string(tasks_.Size()));
-  uint32_t shard_id = 0;
   uint32_t group_id = 0;
   uint32_t blob_start = 0;
   uint32_t blob_end = 0;
-  json var_fields;
   // Pick up task from task list
   ShardTask task = tasks_.GetTaskByID(task_id);
 
   // check task type
-  auto task_type = std::get<0>(task);
-  if (task_type == TaskType::kPaddedTask) {
-    *task_content_ptr =
-      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+  *task_type = std::get<0>(task);
+  if (*task_type == TaskType::kPaddedTask) {
     return Status::OK();
   }
 
-  shard_id = std::get<0>(std::get<1>(task));  // shard id
+  *shard_id = std::get<0>(std::get<1>(task));  // shard id
 
   if (lazy_load_ == false) {
     group_id = std::get<1>(std::get<1>(task));  // group id
     blob_start = std::get<2>(task)[0];          // blob start
     blob_end = std::get<2>(task)[1];            // blob end
-    var_fields = std::get<3>(task);             // scalar variable field
+    *var_fields = std::get<3>(task);            // scalar variable field
   } else {
     // get scalar variable fields by sample id
     uint32_t sample_id_in_shard = std::get<1>(std::get<1>(task));
@@ -1360,36 +1406,128 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
     // read the meta from index
     std::shared_ptr<ROW_GROUPS> row_group_ptr;
     RETURN_IF_NOT_OK_MR(
-      ReadRowGroupByShardIDAndSampleID(selected_columns_, shard_id, sample_id_in_shard, &row_group_ptr));
+      ReadRowGroupByShardIDAndSampleID(selected_columns_, *shard_id, sample_id_in_shard, &row_group_ptr));
     auto &offsets = std::get<0>(*row_group_ptr);
     auto &local_columns = std::get<1>(*row_group_ptr);
 
-    group_id = offsets[shard_id][0][1];       // group_id
-    blob_start = offsets[shard_id][0][2];     // blob start
-    blob_end = offsets[shard_id][0][3];       // blob end
-    var_fields = local_columns[shard_id][0];  // scalar variable field
+    group_id = offsets[*shard_id][0][1];        // group_id
+    blob_start = offsets[*shard_id][0][2];      // blob start
+    blob_end = offsets[*shard_id][0][3];        // blob end
+    *var_fields = local_columns[*shard_id][0];  // scalar variable field
   }
 
   // read the blob from data file
   std::shared_ptr<Page> page_ptr;
-  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, shard_id, &page_ptr));
+  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, *shard_id, &page_ptr));
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
 
-  // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
-  auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *blob_size = blob_end - blob_start;
+  *file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  return Status::OK();
+}
+
+void ShardReader::SelectBlobFields() {
+  blob_fields_to_read_.clear();
+  if (selected_columns_.empty()) {
+    return;
+  }
+  auto blob_fields = GetBlobFields().second;
+  std::vector<bool> to_read(blob_fields.size(), false);
+  for (size_t i = 0; i < blob_fields.size(); ++i) {
+    to_read[i] = std::find(selected_columns_.begin(), selected_columns_.end(), blob_fields[i]) != selected_columns_.end();
+  }
+  if (std::find(to_read.begin(), to_read.end(), false) != to_read.end()) {
+    MS_LOG(INFO) << "Only " << std::count(to_read.begin(), to_read.end(), true) << " of the " << blob_fields.size()
+                 << " blob fields are selected, the other ones are not read.";
+    blob_fields_to_read_ = std::move(to_read);
+  }
+}
 
+Status ShardReader::ReadShardFile(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t size,
+                                  uint8_t *dst) {
+  if (size == 0) {
+    return Status::OK();
+  }
+  if (IsMmapEnabled()) {
+    // no system call is needed, the page cache is accessed directly
+    uint8_t *data = nullptr;
+    RETURN_IF_NOT_OK_MR(mapped_files_[shard_id]->GetData(file_offset, size, &data));
+    std::copy(data, data + size, dst);
+    return Status::OK();
+  }
   auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
   if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
     file_streams_random_[consumer_id][shard_id]->close();
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
   }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
+  auto &io_read = file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(dst), size);
   if (!io_read.good() || io_read.fail() || io_read.bad()) {
     file_streams_random_[consumer_id][shard_id]->close();
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
   }
+  return Status::OK();
+}
+
+Status ShardReader::ReadBlob(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t blob_size,
+                             std::vector<uint8_t> *blob) {
+  RETURN_UNEXPECTED_IF_NULL_MR(blob);
+  if (blob_fields_to_read_.empty()) {
+    blob->resize(blob_size);
+    return ReadShardFile(consumer_id, shard_id, file_offset, blob_size, blob->data());
+  }
+  blob->clear();
+  // A single blob field is stored without its length, and it is not selected here.
+  if (blob_fields_to_read_.size() == 1) {
+    return Status::OK();
+  }
+  // Every field is stored as its length followed by its data. ShardColumn walks the lengths to find a field, so the
+  // fields which are not read keep their length, set to 0, and the ones after the last field read are dropped.
+  auto last = std::find(blob_fields_to_read_.rbegin(), blob_fields_to_read_.rend(), true);
+  auto num_fields = static_cast<size_t>(std::distance(last, blob_fields_to_read_.rend()));
+  uint64_t pos = 0;
+  for (size_t i = 0; i < num_fields; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(pos + kInt64Len <= blob_size,
+                                    "Invalid data, the blob data is truncated, size: " + std::to_string(blob_size));
+    auto len_pos = blob->size();
+    blob->resize(len_pos + kInt64Len);
+    RETURN_IF_NOT_OK_MR(ReadShardFile(consumer_id, shard_id, file_offset + pos, kInt64Len, blob->data() + len_pos));
+    uint64_t num_bytes = 0;
+    for (uint64_t j = 0; j < kInt64Len; ++j) {
+      num_bytes = (num_bytes << kBitsOfByte) | (*blob)[len_pos + j];
+    }
+    pos += kInt64Len;
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(pos + num_bytes <= blob_size,
+                                    "Invalid data, the blob data is truncated, size: " + std::to_string(blob_size));
+    if (blob_fields_to_read_[i]) {
+      blob->resize(len_pos + kInt64Len + num_bytes);
+      RETURN_IF_NOT_OK_MR(
+        ReadShardFile(consumer_id, shard_id, file_offset + pos, num_bytes, blob->data() + len_pos + kInt64Len));
+    } else {
+      std::fill(blob->begin() + len_pos, blob->end(), 0);
+    }
+    pos += num_bytes;
+  }
+  return Status::OK();
+}
+
+Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
+                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(LocateTask(task_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr =
+      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+    return Status::OK();
+  }
+
+  // Pack image list
+  std::vector<uint8_t> images;
+  RETURN_IF_NOT_OK_MR(ReadBlob(consumer_id, shard_id, file_offset, blob_size, &images));
 
   // Deliver batch data to output map
   std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
@@ -1474,6 +1612,32 @@ TASK_CONTENT ShardReader::GetNextById(const int64_t &task_id, const int32_t &con
   return std::move(*task_content_ptr);
 }
 
+Status ShardReader::GetNextMappedById(const int64_t &task_id, std::shared_ptr<MAPPED_TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(IsMmapEnabled(), "[Internal ERROR] Memory mapped read mode is not enabled.");
+  *task_content_ptr = std::make_shared<MAPPED_TASK_CONTENT>(TaskType::kCommonTask,
+                                                            std::vector<std::tuple<ShardBlobSlice, json>>());
+  if (interrupt_) {
+    return Status::OK();
+  }
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(LocateTask(task_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  (*task_content_ptr)->first = task_type;
+  if (task_type == TaskType::kPaddedTask) {
+    return Status::OK();
+  }
+  ShardBlobSlice slice;
+  slice.file = mapped_files_[shard_id];
+  slice.size = blob_size;
+  RETURN_IF_NOT_OK_MR(slice.file->GetData(file_offset, blob_size, &slice.data));
+  (*task_content_ptr)->second.emplace_back(std::move(slice), std::move(var_fields));
+  return Status::OK();
+}
+
 Status ShardReader::UnCompressBlob(const std::vector<uint8_t> &raw_blob_data,
                                    std::shared_ptr<std::vector<std::vector<uint8_t>>> *blob_data_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(blob_data_ptr);
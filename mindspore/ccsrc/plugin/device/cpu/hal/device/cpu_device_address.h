@@ -17,6 +17,7 @@
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_CPU_CPU_DEVICE_ADDRESS_H_
 
 #include <string>
+#include <memory>
 #include <vector>
 #include "runtime/device/device_address.h"
 #include "utils/shape_utils.h"
@@ -49,6 +50,12 @@ class CPUDeviceAddress : public DeviceAddress {
                      TypeId host_type, bool trans_flag) const override;
   void ClearDeviceMemory() override;
   DeviceType GetDeviceType() const override { return DeviceType::kCPU; }
+
+  // Hold the memory block which the ptr points into, such as the memory planned for the whole graph.
+  void set_mem_block(const std::shared_ptr<uint8_t> &mem_block) { mem_block_ = mem_block; }
+
+ private:
+  std::shared_ptr<uint8_t> mem_block_{nullptr};
 };
 }  // namespace cpu
 }  // namespace device
@@ -64,6 +64,15 @@ uint8_t *CPUMemoryManager::MallocDynamicMem(size_t size, bool) {
   return new_ptr;
 }
 
+uint8_t *CPUMemoryManager::MallocSomasMem(size_t size) {
+  auto ptr = static_cast<uint8_t *>(CPUMemoryPool::GetInstance().AllocTensorMem(size, true));
+  if (ptr == nullptr) {
+    MS_LOG(EXCEPTION) << "Malloc SOMAS memory failed: size " << size;
+  }
+  somas_mem_ = std::shared_ptr<uint8_t>(ptr, [](uint8_t *p) { CPUMemoryPool::GetInstance().FreeTensorMem(p); });
+  return ptr;
+}
+
 void CPUMemoryManager::ResetDynamicMemory() {
   // don't free, for multi graph
   for (auto &&iter : dynamic_mem_) {
@@ -53,10 +53,14 @@ class CPUMemoryManager : public MemoryManager {
   std::vector<void *> MallocContinuousMemFromMemPool(const std::vector<size_t> &size_list) override {
     return CPUMemoryPool::GetInstance().AllocContinuousTensorMem(size_list);
   }
+  // Take over the memory of the last SOMAS plan, which returns to the memory pool when the block is released.
+  std::shared_ptr<uint8_t> TakeSomasMem() { return std::move(somas_mem_); }
 
  protected:
   uint8_t *MallocStaticMem(size_t size, bool communication_mem, uint32_t graph_id) override;
   uint8_t *MallocDynamicMem(size_t size, bool communication_mem) override;
+  uint8_t *MallocSomasMem(size_t size) override;
+  bool LaunchInDataflowOrder() const override { return true; }
 
  private:
   uint8_t *MemMalloc(size_t size);
@@ -70,6 +74,8 @@ class CPUMemoryManager : public MemoryManager {
   std::map<void *, size_t> static_mem_;
   std::map<void *, size_t> cached_mem_;
   std::map<void *, std::shared_ptr<std::vector<uint8_t>>> mem_block_map_;
+  // The memory of the last SOMAS plan, which belongs to the planned device addresses of graph instead of the manager.
+  std::shared_ptr<uint8_t> somas_mem_{nullptr};
 };
 }  // namespace cpu
 }  // namespace device
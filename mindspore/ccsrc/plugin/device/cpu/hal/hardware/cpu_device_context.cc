@@ -16,6 +16,8 @@
 
 #include "plugin/device/cpu/hal/hardware/cpu_device_context.h"
 #include <string>
+#include <set>
+#include <algorithm>
 #include "plugin/device/cpu/hal/device/cpu_device_address.h"
 #include "plugin/device/cpu/hal/device/cpu_memory_manager.h"
 #ifdef ENABLE_AKG
@@ -42,6 +44,7 @@
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "profiler/device/cpu/cpu_profiling.h"
+#include "runtime/device/ms_device_shape_transfer.h"
 #ifdef WITH_BACKEND
 #include "plugin/device/cpu/hal/hardware/ms_collective_comm_lib.h"
 #endif
@@ -112,6 +115,143 @@ DeviceAddressPtr CPUDeviceResManager::CreateDeviceAddress(void *const device_ptr
   return device_address;
 }
 
+namespace {
+constexpr char kCpuSomasEnableEnv[] = "MS_ENABLE_CPU_SOMAS";
+
+bool IsStaticMemoryPlanEnabled(const KernelGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  if (common::GetEnv(kCpuSomasEnableEnv) != "1") {
+    return false;
+  }
+  // The memory of single op and dynamic shape graphs can't be planned before running.
+  if (graph->is_from_single_op() || graph->is_dynamic_shape()) {
+    return false;
+  }
+  const auto &kernels = graph->execution_order();
+  if (std::any_of(kernels.begin(), kernels.end(),
+                  [](const CNodePtr &kernel) { return common::AnfAlgo::IsControlOpExecInBackend(kernel); })) {
+    return false;
+  }
+#ifndef ENABLE_SECURITY
+  // The dumped kernel outputs are read after the graph runs.
+  if (DumpJsonParser::GetInstance().e2e_dump_enabled()) {
+    MS_LOG(INFO) << "Disable the static memory plan when e2e dump is enabled.";
+    return false;
+  }
+#endif
+  return true;
+}
+
+// The kernels which share the memory between the inputs and outputs, or hold it beyond the kernel launch.
+bool IsSpecialMemoryKernel(const CNodePtr &kernel) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  if (common::AnfAlgo::IsCommunicationOp(kernel) || common::AnfAlgo::IsInplaceNode(kernel, "inplace_algo") ||
+      common::AnfAlgo::IsInplaceNode(kernel, "skip")) {
+    return true;
+  }
+  const auto &kernel_name = common::AnfAlgo::GetCNodeName(kernel);
+  if (kernel_name == kRpcSendOpName || kernel_name == kRpcRecvOpName) {
+    return true;
+  }
+  auto kernel_info = dynamic_cast<device::KernelInfo *>(kernel->kernel_info());
+  MS_EXCEPTION_IF_NULL(kernel_info);
+  return !kernel_info->out_in_ref_map().empty();
+}
+
+// Fetch the kernel outputs which keep the memory from the pool: the graph outputs, internal outputs and summary
+// outputs are used after the graph runs, and the special memory kernels may share or hold their inputs and outputs.
+std::set<KernelWithIndex> FetchUnplannedOutputs(const KernelGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  std::set<KernelWithIndex> unplanned_outputs;
+  for (const auto &output : common::AnfAlgo::GetAllOutputWithIndex(graph->output())) {
+    (void)unplanned_outputs.insert(output);
+  }
+  for (const auto &summary_node : graph->summary_nodes()) {
+    const auto &node_with_index = summary_node.second.first;
+    (void)unplanned_outputs.insert(
+      common::AnfAlgo::VisitKernelWithReturnType(node_with_index, IntToSize(summary_node.second.second), false));
+  }
+
+  for (const auto &kernel : graph->execution_order()) {
+    MS_EXCEPTION_IF_NULL(kernel);
+    bool is_special_kernel = IsSpecialMemoryKernel(kernel);
+    auto output_num = AnfAlgo::GetOutputAddressNum(kernel);
+    for (size_t i = 0; i < output_num; ++i) {
+      if (is_special_kernel || graph->IsInternalOutput(kernel, i)) {
+        (void)unplanned_outputs.emplace(kernel, i);
+      }
+    }
+    if (!is_special_kernel) {
+      continue;
+    }
+    auto input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+    for (size_t i = 0; i < input_num; ++i) {
+      (void)unplanned_outputs.insert(common::AnfAlgo::GetPrevNodeOutput(kernel, i, false));
+    }
+  }
+  return unplanned_outputs;
+}
+
+void PersistPlannedAddress(const DeviceAddressPtr &device_address, const std::shared_ptr<uint8_t> &somas_mem) {
+  MS_EXCEPTION_IF_NULL(device_address);
+  auto cpu_device_address = std::dynamic_pointer_cast<CPUDeviceAddress>(device_address);
+  MS_EXCEPTION_IF_NULL(cpu_device_address);
+  // The arena returns to the memory pool after the last planned device address of graph is released.
+  cpu_device_address->set_mem_block(somas_mem);
+  // The planned memory belongs to the arena of graph, so it is never freed by the reference count.
+  device_address->set_is_ptr_persisted(true);
+  device_address->set_original_ref_count(SIZE_MAX);
+  device_address->ResetRefCount();
+}
+}  // namespace
+
+void CPUDeviceResManager::AssignStaticMemory(const KernelGraphPtr &graph) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(mem_manager_);
+  // The kernel actors are launched by the data dependency, which is respected by the conflicts of SOMAS tensors.
+  mem_manager_->MallocSomasDynamicMem(*graph);
+  auto cpu_mem_manager = std::dynamic_pointer_cast<CPUMemoryManager>(mem_manager_);
+  MS_EXCEPTION_IF_NULL(cpu_mem_manager);
+  auto somas_mem = cpu_mem_manager->TakeSomasMem();
+  const auto &unplanned_outputs = FetchUnplannedOutputs(graph);
+
+  size_t planned_num = 0;
+  for (const auto &kernel : graph->execution_order()) {
+    MS_EXCEPTION_IF_NULL(kernel);
+    auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
+    MS_EXCEPTION_IF_NULL(kernel_mod);
+    const auto &output_sizes = kernel_mod->GetOutputSizeList();
+    for (size_t i = 0; i < output_sizes.size(); ++i) {
+      if ((output_sizes[i] == 0) || AnfAlgo::OutputAddrExist(kernel, i) ||
+          (unplanned_outputs.count(KernelWithIndex(kernel, i)) > 0)) {
+        continue;
+      }
+      auto device_address =
+        CreateDeviceAddress(nullptr, output_sizes[i], AnfAlgo::GetOutputFormat(kernel, i),
+                            AnfAlgo::GetOutputDeviceDataType(kernel, i), trans::GetRuntimePaddingShape(kernel, i));
+      (void)mem_manager_->MallocOutputMem(kernel, i, kSomasReuseDynamicMem, output_sizes[i], device_address, false);
+      PersistPlannedAddress(device_address, somas_mem);
+      AnfAlgo::SetOutputAddr(device_address, i, kernel.get());
+      ++planned_num;
+    }
+
+    // The workspaces are only used in the kernel launch, so all of them can be planned.
+    const auto &workspace_sizes = kernel_mod->GetWorkspaceSizeList();
+    for (size_t i = 0; i < workspace_sizes.size(); ++i) {
+      if (AnfAlgo::WorkspaceAddrExist(kernel, i)) {
+        break;
+      }
+      auto device_address = CreateDeviceAddress(nullptr, workspace_sizes[i], "", kTypeUnknown, ShapeVector());
+      device_address->set_ptr(mem_manager_->MallocWorkSpaceMem(kernel, i, kSomasReuseDynamicMem, workspace_sizes[i]));
+      PersistPlannedAddress(device_address, somas_mem);
+      AnfAlgo::SetWorkspaceAddr(device_address, i, kernel.get());
+      ++planned_num;
+    }
+  }
+  MS_LOG(INFO) << "Graph " << graph->graph_id() << " plans the static memory of " << planned_num
+               << " device addresses.";
+}
+
 void CPUKernelExecutor::OptimizeGraph(const FuncGraphPtr &graph) const {
   MS_EXCEPTION_IF_NULL(graph);
   auto kernel_graph = graph->cast<KernelGraphPtr>();
@@ -337,6 +477,13 @@ void CPUKernelExecutor::PreprocessBeforeRun(const FuncGraphPtr &graph) const {
     common::AnfAlgo::ReorderPosteriorExecList(NOT_NULL(&execution_order));
     kernel_graph->set_execution_order(execution_order);
   }
+
+  if (IsStaticMemoryPlanEnabled(kernel_graph)) {
+    MS_EXCEPTION_IF_NULL(device_context_);
+    auto res_manager = dynamic_cast<CPUDeviceResManager *>(device_context_->device_res_manager_.get());
+    MS_EXCEPTION_IF_NULL(res_manager);
+    res_manager->AssignStaticMemory(kernel_graph);
+  }
 }
 
 bool CPUKernelExecutor::LaunchKernel(const CNodePtr &kernel, const std::vector<AddressPtr> &inputs,
@@ -43,6 +43,10 @@ class CPUDeviceResManager : public DeviceResManager {
 
   bool LoadCollectiveCommLib() override;
 
+  // Plan the memory of the kernel outputs and workspaces inside the graph with SOMAS into one arena, the planned device
+  // addresses keep their memory and skip the allocation and release at runtime.
+  void AssignStaticMemory(const KernelGraphPtr &graph) const;
+
  protected:
   // Relevant function to allocate and free device memory of raw ptr.
   void *AllocateMemory(size_t size) const override;
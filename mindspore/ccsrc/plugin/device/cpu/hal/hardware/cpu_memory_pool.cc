@@ -25,6 +25,8 @@ namespace cpu {
 namespace {
 const size_t kKBToByte = 1024;
 const size_t kLineMaxSize = 1024;
+// Serve the small tensors by the thread cached size classes instead of the best fit search.
+constexpr char kSizeClassMemPoolEnv[] = "MS_ENABLE_SIZE_CLASS_MEM_POOL";
 
 size_t GetSystemMemorySize(const std::string &key) {
 #if defined(_WIN32) || defined(_WIN64) || defined(__APPLE__)
@@ -64,6 +66,12 @@ size_t GetSystemMemorySize(const std::string &key) {
 }
 }  // namespace
 
+CPUMemoryPool::CPUMemoryPool() {
+  if (common::GetEnv(kSizeClassMemPoolEnv) == "1") {
+    EnableSizeClassCache();
+  }
+}
+
 size_t CPUMemoryPool::AllocDeviceMem(size_t alloc_size, DeviceMemPtr *addr) {
   if (alloc_size == 0) {
     MS_LOG(EXCEPTION) << "The memory alloc size is 0.";
@@ -38,7 +38,7 @@ class CPUMemoryPool : public DynamicMemPoolBestFit {
   size_t free_mem_size() override;
 
  private:
-  CPUMemoryPool() = default;
+  CPUMemoryPool();
   DISABLE_COPY_AND_ASSIGN(CPUMemoryPool);
 
   size_t total_used_memory_{0};
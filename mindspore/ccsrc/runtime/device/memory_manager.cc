@@ -39,6 +39,7 @@ size_t MemoryManager::GetCommunicationAlignSize(size_t input_size) {
 void MemoryManager::MallocSomasDynamicMem(const session::KernelGraph &graph) {
   SomasPtr somas_reuse_util_ptr = std::make_shared<somas::Somas>();
   MS_EXCEPTION_IF_NULL(somas_reuse_util_ptr);
+  somas_reuse_util_ptr->set_dataflow_order(LaunchInDataflowOrder());
   somas_reuse_util_ptr_ = somas_reuse_util_ptr;
 
   if (!(somas_reuse_util_ptr->Allocate(&graph))) {
@@ -48,7 +49,7 @@ void MemoryManager::MallocSomasDynamicMem(const session::KernelGraph &graph) {
   size_t total_allocated_size = somas_reuse_util_ptr->GetTotalMemSize();
   MS_LOG(INFO) << "Graph " << graph.graph_id() << ": TotalSomasReuseDynamicSize [" << total_allocated_size << "]";
   if (total_allocated_size > 0) {
-    auto base_ptr = MallocDynamicMem(total_allocated_size, false);
+    auto base_ptr = MallocSomasMem(total_allocated_size);
     MS_LOG(INFO) << "Somas Reuse Memory Base Address [" << static_cast<void *>(base_ptr) << "], End Address ["
                  << static_cast<void *>(base_ptr + total_allocated_size) << "]";
     somas_reuse_util_ptr->set_mem_base_addr(base_ptr);
@@ -80,6 +80,10 @@ class MemoryManager {
     return MallocStaticMem(size, communication_mem, kInvalidGraphId);
   }
   virtual uint8_t *MallocDynamicMem(size_t size, bool communication_mem);
+  // Allocate the memory which is shared by the tensors planned by SOMAS.
+  virtual uint8_t *MallocSomasMem(size_t size) { return MallocDynamicMem(size, false); }
+  // Whether the kernels are launched as soon as their inputs are ready instead of in the execution order.
+  virtual bool LaunchInDataflowOrder() const { return false; }
   SomasPtr somas_reuse_util_ptr_{nullptr};
 };
 }  // namespace device
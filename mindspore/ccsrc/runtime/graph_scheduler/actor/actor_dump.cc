@@ -279,8 +279,30 @@ void DumpFusionActor(const FusionActor *actor, std::ofstream &ofs) {
   ofs << "\tactor_name:" << actor->GetAID().Name() << "\n";
   ofs << "\t\tsub actors:" << actor->sub_actors().size() << "\n";
   for (auto &sub_actor : actor->sub_actors()) {
+    MS_EXCEPTION_IF_NULL(sub_actor.second);
     ofs << "\t\t\tsub_actor_name:" << sub_actor.first << "\n";
+    // The layout of fusion actor: the sub actors which are called synchronously by this sub actor.
+    std::set<std::string> fused_output_actors;
+    for (const auto &data_arrow : sub_actor.second->output_data_arrows()) {
+      MS_EXCEPTION_IF_NULL(data_arrow);
+      if (TEST_FLAG(data_arrow->flag_, kOutputDataFlagBetweenFusion)) {
+        (void)fused_output_actors.insert(data_arrow->to_op_id_.Name());
+      }
+    }
+    for (const auto &control_arrow : sub_actor.second->output_control_arrows()) {
+      MS_EXCEPTION_IF_NULL(control_arrow);
+      if (TEST_FLAG(control_arrow->flag_, kOutputDataFlagBetweenFusion)) {
+        (void)fused_output_actors.insert(control_arrow->to_op_id_.Name());
+      }
+    }
+    for (auto &fused_output_actor : fused_output_actors) {
+      ofs << "\t\t\t\tfused_output_actor:" << fused_output_actor << "\n";
+    }
+  }
+  if (actor->estimated_cost() > 0) {
+    ofs << "\t\testimated_cost:" << actor->estimated_cost() << "\n";
   }
+  ofs << "\t\tsaved_messages_num_per_step:" << actor->FetchSavedMessagesNum() << "\n";
 
   DumpAbstractActor(actor, ofs);
 
@@ -630,6 +652,12 @@ void DumpCopyActors(const std::vector<CopyActorPtr> &actors, std::ofstream &ofs)
 
 void DumpFusionActors(const std::vector<FusionActorPtr> &actors, std::ofstream &ofs) {
   ofs << "\n\n[Fusion actors:" << actors.size() << "]\n";
+  size_t saved_messages_num = 0;
+  for (const auto &fusion_actor : actors) {
+    MS_EXCEPTION_IF_NULL(fusion_actor);
+    saved_messages_num += fusion_actor->FetchSavedMessagesNum();
+  }
+  ofs << "\tsaved_messages_num_per_step:" << saved_messages_num << "\n";
   for (const auto &fusion_actor : actors) {
     DumpFusionActor(fusion_actor.get(), ofs);
   }
@@ -21,6 +21,7 @@
 #include <string>
 #include <memory>
 #include <utility>
+#include <set>
 #include <fstream>
 #include "runtime/graph_scheduler/actor/abstract_actor.h"
 #include "runtime/graph_scheduler/actor/data_prepare_actor.h"
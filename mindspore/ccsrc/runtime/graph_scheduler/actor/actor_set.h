@@ -43,6 +43,7 @@
 #include "runtime/graph_scheduler/actor/control_flow/entrance_actor.h"
 #include "runtime/graph_scheduler/actor/control_flow/exit_actor.h"
 #include "runtime/graph_scheduler/actor/control_flow/stack_actor.h"
+#include "runtime/graph_scheduler/graph_capture.h"
 
 #ifdef ENABLE_RPC_ACTOR
 #include "runtime/graph_scheduler/actor/rpc/send_actor.h"
@@ -118,6 +119,8 @@ struct ActorSet {
   size_t execution_count_{0};
   double multi_thread_execution_time_{0};
   double single_thread_execution_time_{0};
+  // The graph capture records the kernel launch sequence and replays it in the later steps.
+  GraphCapturePtr graph_capture_{nullptr};
 };
 using ActorSetPtr = std::shared_ptr<ActorSet>;
 
@@ -34,6 +34,26 @@ void FusionActor::RunOpData(OpData<DeviceTensor> *const input_data, OpContext<De
   real_input_data.first->RunOpData(input_data, context);
 }
 
+size_t FusionActor::FetchSavedMessagesNum() const {
+  size_t saved_messages_num = 0;
+  for (const auto &sub_actor : sub_actors_) {
+    MS_EXCEPTION_IF_NULL(sub_actor.second);
+    for (const auto &data_arrow : sub_actor.second->output_data_arrows()) {
+      MS_EXCEPTION_IF_NULL(data_arrow);
+      if (TEST_FLAG(data_arrow->flag_, kOutputDataFlagBetweenFusion)) {
+        ++saved_messages_num;
+      }
+    }
+    for (const auto &control_arrow : sub_actor.second->output_control_arrows()) {
+      MS_EXCEPTION_IF_NULL(control_arrow);
+      if (TEST_FLAG(control_arrow->flag_, kOutputDataFlagBetweenFusion)) {
+        ++saved_messages_num;
+      }
+    }
+  }
+  return saved_messages_num;
+}
+
 void FusionActor::RunOpControl(AID *const input_control, OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(input_control);
   MS_EXCEPTION_IF_NULL(context);
@@ -45,9 +45,15 @@ class FusionActor : public AbstractActor {
   const mindspore::HashMap<std::string, std::vector<AbstractActor *>> &real_input_controls() const {
     return real_input_controls_;
   }
+  size_t estimated_cost() const { return estimated_cost_; }
+
+  // The messages between the sub actors are replaced by the synchronous calls, and return the saved messages number of
+  // one step.
+  size_t FetchSavedMessagesNum() const;
 
  private:
   friend class SchedulerHelper;
+  friend class CostDrivenActorFusion;
 
   // std::pair<actor, input_index> used to find the mapping between fusion actor inputs and real actors inputs.
   std::vector<std::pair<AbstractActor *, size_t>> real_input_data_;
@@ -57,6 +63,9 @@ class FusionActor : public AbstractActor {
   // Record the received input control info.
   std::unordered_set<std::string> recv_input_control_actors_;
   size_t recv_input_controls_num_;
+
+  // The estimated kernel cost sum of sub actors, which is only set in the cost driven actor fusion.
+  size_t estimated_cost_{0};
 };
 
 using FusionActorPtr = std::shared_ptr<FusionActor>;
@@ -15,6 +15,7 @@
  */
 
 #include "runtime/graph_scheduler/actor/kernel_actor.h"
+#include <algorithm>
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
@@ -79,6 +80,7 @@ void KernelActor::Init() {
     (void)memory_free_list_.emplace_back(workspace_address.get());
     (void)launch_info_.workspaces_.emplace_back(std::make_shared<Address>());
   }
+  InitMemorySkipFlags();
 
   // Init the output data.
   output_data_by_output_index_.resize(output_device_tensors_.size());
@@ -101,7 +103,47 @@ void KernelActor::Init() {
   }
 }
 
+void KernelActor::InitMemorySkipFlags() {
+  if (is_dynamic_shape_) {
+    return;
+  }
+  auto is_persisted = [](const DeviceTensor *device_tensor) {
+    MS_EXCEPTION_IF_NULL(device_tensor);
+    return device_tensor->is_ptr_persisted();
+  };
+  skip_memory_alloc_ = std::all_of(memory_alloc_list_.begin(), memory_alloc_list_.end(), is_persisted);
+  if ((!skip_memory_alloc_) || (!external_reference_tensors_.empty())) {
+    return;
+  }
+
+  // The input from the device tensor store is persistent and not freed by the reference count.
+  for (size_t i = 0; i < real_input_num_; ++i) {
+    if (std::any_of(device_tensor_store_keys_.begin(), device_tensor_store_keys_.end(),
+                    [i](const auto &device_tensor_store_key) { return device_tensor_store_key.first == i; })) {
+      continue;
+    }
+    if (!is_persisted(AnfAlgo::GetPrevNodeMutableOutputAddr(kernel_, i, false).get())) {
+      return;
+    }
+  }
+  skip_memory_free_ = true;
+}
+
 void KernelActor::Run(OpContext<DeviceTensor> *const context) {
+  // In the replay, the kernel runs after the kernels in the launch list which it depends on finish.
+  if ((graph_capture_ != nullptr) && graph_capture_->is_replaying()) {
+    graph_capture_->OnExternalInputReady(launch_index_, context);
+    return;
+  }
+  RunKernel(context);
+}
+
+void KernelActor::RunByGraphCapture(OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(graph_capture_);
+  graph_capture_->Launch(this, context);
+}
+
+void KernelActor::RunKernel(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
 
@@ -111,7 +153,7 @@ void KernelActor::Run(OpContext<DeviceTensor> *const context) {
     FetchWorkspaceDeviceTensor();
   }
 
-  if (memory_alloc_list_.size() > 0) {
+  if ((memory_alloc_list_.size() > 0) && (!skip_memory_alloc_)) {
     SendMemoryAllocReq(context);
   } else {
     OnMemoryAllocFinish(context);
@@ -236,6 +278,9 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
   if (IsRunningFailed(context)) {
     return;
   }
+  if ((graph_capture_ != nullptr) && graph_capture_->is_capturing()) {
+    graph_capture_->RecordLaunch(this);
+  }
   PreLaunchKernel(context);
 
   try {
@@ -295,6 +340,7 @@ void KernelActor::PushInputDeviceTensor(const std::vector<TensorPtr> *input_tens
     if (device_tensor != nullptr) {
       input_device_tensors_[input_index] = device_tensor.get();
       memory_free_list_[input_index] = device_tensor.get();
+      skip_memory_free_ = skip_memory_free_ && device_tensor->is_ptr_persisted();
     }
   }
 }
@@ -367,11 +413,27 @@ void KernelActor::FetchInputDeviceTensor(OpContext<DeviceTensor> *const context)
       if (input_device_tensors_[input_data->index_] != input_data->data_) {
         input_device_tensors_[input_data->index_] = input_data->data_;
         memory_free_list_[input_data->index_] = input_data->data_;
+        skip_memory_free_ = skip_memory_free_ && input_data->data_->is_ptr_persisted();
       }
       CopyInputDeviceTensor(input_data, context);
     }
   }
 
+  // In the replay, the input data from the kernels in the launch list are not sent and fetched directly.
+  if ((graph_capture_ != nullptr) && graph_capture_->is_replaying()) {
+    for (auto &input_data : graph_capture_->internal_input_data(launch_index_)) {
+      MS_EXCEPTION_IF_NULL(input_data);
+      if (IntToSize(input_data->index_) >= input_device_tensors_.size()) {
+        SET_OPCONTEXT_FAIL_RET_WITH_ERROR_BY_STRATEGY(strategy_, (*context), "The input index is out of range.");
+      }
+      if (input_device_tensors_[input_data->index_] != input_data->data_) {
+        input_device_tensors_[input_data->index_] = input_data->data_;
+        memory_free_list_[input_data->index_] = input_data->data_;
+        skip_memory_free_ = skip_memory_free_ && input_data->data_->is_ptr_persisted();
+      }
+    }
+  }
+
   for (auto &device_tensor_store_key : device_tensor_store_keys_) {
     auto device_tensor = DeviceTensorStore::GetInstance().Fetch(device_tensor_store_key.second.get(),
                                                                 device_contexts_[0]->GetDeviceType());
@@ -424,6 +486,8 @@ void KernelActor::FetchOutputDeviceTensor(OpContext<DeviceTensor> *const context
       output_device_tensors_[i] = output_address;
       memory_alloc_list_[i] = output_address;
       memory_free_list_[real_input_num_ + i] = output_address;
+      skip_memory_alloc_ = skip_memory_alloc_ && output_address->is_ptr_persisted();
+      skip_memory_free_ = skip_memory_free_ && output_address->is_ptr_persisted();
 
       // Update output data.
       for (auto &output_data : output_data_by_output_index_[i]) {
@@ -492,7 +556,7 @@ void KernelActor::PostLaunchKernel(OpContext<DeviceTensor> *const context) {
   // the next actor and the actor is asynchronous execution. So it is necessary to ensure that SendMemoryFreeReq of the
   // current actor is in front of SendMemoryAllocReq of the next actor.  One is to reuse the memory more fully, the
   // other is to ensure the execution order and avoid the illegal memory timing problem.
-  if (memory_free_list_.size() > 0) {
+  if ((memory_free_list_.size() > 0) && (!skip_memory_free_)) {
     SendMemoryFreeReq(context);
   }
 
@@ -501,6 +565,23 @@ void KernelActor::PostLaunchKernel(OpContext<DeviceTensor> *const context) {
   }
 }
 
+void KernelActor::SendOutput(OpContext<DeviceTensor> *const context) {
+  if ((graph_capture_ == nullptr) || (!graph_capture_->is_replaying())) {
+    AbstractActor::SendOutput(context);
+    return;
+  }
+
+  // The outputs to the kernels in the launch list are replaced by triggering the successors directly, so only send the
+  // external outputs, and the kernel without any output still ends the step as the actor running.
+  if ((output_data_arrows_.size() > 0) || (output_control_arrows_.size() > 0) ||
+      (!graph_capture_->has_successors(launch_index_))) {
+    AbstractActor::SendOutput(context);
+  } else {
+    SendRecorderInfo(context);
+  }
+  graph_capture_->OnKernelFinish(launch_index_, context);
+}
+
 void KernelActor::RefreshDeviceTensorCopyStore(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   for (auto &ref_input_index : modifiable_ref_input_indexes_) {
@@ -27,6 +27,7 @@
 #include "runtime/graph_scheduler/actor/debug_aware_actor.h"
 #include "runtime/hardware/device_context.h"
 #include "runtime/graph_scheduler/device_tensor_store.h"
+#include "runtime/graph_scheduler/graph_capture.h"
 #include "kernel/kernel.h"
 #include "ir/anf.h"
 #include "ir/tensor.h"
@@ -81,6 +82,9 @@ class KernelActor : public DebugAwareActor {
   // The callback after debug finished.
   void OnDebugFinish(OpContext<DeviceTensor> *const context) override;
 
+  // Run the kernel which is triggered by the graph capture in the replay.
+  void RunByGraphCapture(OpContext<DeviceTensor> *const context);
+
   const CNodePtr &kernel() const { return kernel_; }
   const std::set<size_t> &modifiable_ref_input_indexes() const { return modifiable_ref_input_indexes_; }
   const std::set<size_t> &modifiable_ref_output_indexes() const { return modifiable_ref_output_indexes_; }
@@ -90,6 +94,7 @@ class KernelActor : public DebugAwareActor {
   void Init() override;
   void Run(OpContext<DeviceTensor> *const context) override;
   void SendRecorderInfo(OpContext<DeviceTensor> *const context) const override;
+  void SendOutput(OpContext<DeviceTensor> *const context) override;
 
   // Do kernel launching in this method after 'PreLaunchKernel' and 'PostLaunchKernel'.
   virtual bool LaunchKernel();
@@ -104,7 +109,12 @@ class KernelActor : public DebugAwareActor {
  private:
   friend class GraphScheduler;
   friend class ControlNodeScheduler;
+  friend class GraphCapture;
 
+  // Fetch the device tensors, allocate memory and launch kernel.
+  void RunKernel(OpContext<DeviceTensor> *const context);
+  // Skip the memory requests of the kernel whose device tensors are all persisted.
+  void InitMemorySkipFlags();
   // Fetch the device tensor for launch.
   void FetchInputDeviceTensor(OpContext<DeviceTensor> *const context);
   void FetchOutputDeviceTensor(OpContext<DeviceTensor> *const context);
@@ -146,6 +156,10 @@ class KernelActor : public DebugAwareActor {
   std::vector<DeviceTensor *> memory_free_list_;
   // The device tensor of external reference is not the real data of this kernel, but need add to the memory_free_list_.
   std::vector<DeviceTensor *> external_reference_tensors_;
+  // The memory of the persisted device tensors is never allocated or freed in the running, such as the static memory
+  // planned by the device, so the memory request is skipped when all the device tensors of the list are persisted.
+  bool skip_memory_alloc_{false};
+  bool skip_memory_free_{false};
 
   // Record the modifiable ref indexes. Used to refresh the ref data which are modified in the running.
   std::set<size_t> modifiable_ref_input_indexes_;
@@ -153,6 +167,10 @@ class KernelActor : public DebugAwareActor {
 
   // Cache output data by output index to modify the output data effectively.
   std::vector<std::vector<OpData<DeviceTensor> *>> output_data_by_output_index_;
+
+  // The graph capture which records the kernel launch, or replays the kernel by the launch index in the launch list.
+  GraphCapture *graph_capture_{nullptr};
+  size_t launch_index_{0};
 };
 
 using KernelActorPtr = std::shared_ptr<KernelActor>;
@@ -0,0 +1,340 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/graph_capture.h"
+#include <set>
+#include <algorithm>
+#include "runtime/graph_scheduler/actor/kernel_actor.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+bool IsInputShapesConsistent(const std::vector<std::vector<TensorPtr>> &input_tensors,
+                             const std::vector<std::vector<ShapeVector>> &input_shapes) {
+  if (input_tensors.size() != input_shapes.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < input_tensors.size(); ++i) {
+    if (input_tensors[i].size() != input_shapes[i].size()) {
+      return false;
+    }
+    for (size_t j = 0; j < input_tensors[i].size(); ++j) {
+      const auto &input_tensor = input_tensors[i][j];
+      if ((input_tensor != nullptr) && (input_tensor->shape() != input_shapes[i][j])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace
+
+void GraphCapture::Prepare(const std::vector<std::vector<TensorPtr>> &input_tensors) {
+  if (status_ == GraphCaptureStatus::kUnsupported) {
+    return;
+  }
+
+  if (status_ == GraphCaptureStatus::kReplaying) {
+    if (IsInputShapesConsistent(input_tensors, input_shapes_)) {
+      ResetDependencyCounters();
+      return;
+    }
+    MS_LOG(INFO) << "The input shapes of actor set " << name_ << " are changed, invalidate the graph capture.";
+    Invalidate();
+  }
+
+  // Capture the kernel launch sequence in this step.
+  status_ = GraphCaptureStatus::kCapturing;
+  captured_kernel_actors_.clear();
+  captured_kernel_actors_.reserve(kernel_actors_.size());
+  input_shapes_.clear();
+  for (const auto &tensors : input_tensors) {
+    std::vector<ShapeVector> shapes;
+    for (const auto &tensor : tensors) {
+      (void)shapes.emplace_back((tensor != nullptr) ? tensor->shape() : ShapeVector());
+    }
+    (void)input_shapes_.emplace_back(std::move(shapes));
+  }
+  for (auto &kernel_actor : kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    kernel_actor->graph_capture_ = this;
+  }
+}
+
+void GraphCapture::Finish() {
+  if (status_ != GraphCaptureStatus::kCapturing) {
+    return;
+  }
+
+  if (!BuildLaunchList()) {
+    MS_LOG(INFO) << "The actor set " << name_ << " can't be captured and runs by the actor messages.";
+    for (auto &kernel_actor : kernel_actors_) {
+      kernel_actor->graph_capture_ = nullptr;
+    }
+    launch_list_.clear();
+    status_ = GraphCaptureStatus::kUnsupported;
+    return;
+  }
+  status_ = GraphCaptureStatus::kReplaying;
+  MS_LOG(INFO) << "Capture the actor set " << name_ << " with the kernel launch list size: " << launch_list_.size();
+}
+
+void GraphCapture::Invalidate() {
+  if (status_ == GraphCaptureStatus::kUnsupported) {
+    return;
+  }
+  // The running kernel actors access the outputs and the launch list, which are restored and cleared below.
+  WaitForRunningLaunches();
+
+  // Restore the dependent inputs number and the outputs of kernel actors.
+  for (auto &launch_info : launch_list_) {
+    auto kernel_actor = launch_info.kernel_actor_;
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    kernel_actor->input_datas_num_ = launch_info.input_datas_num_;
+    kernel_actor->input_controls_num_ = launch_info.input_controls_num_;
+    kernel_actor->running_dependent_msg_num_ =
+      SizeToInt(launch_info.input_datas_num_ + launch_info.input_controls_num_);
+
+    std::vector<std::pair<OpDataUniquePtr<DeviceTensor>, int>> output_data;
+    size_t external_index = 0;
+    size_t internal_index = 0;
+    for (bool is_internal : launch_info.is_internal_output_data_) {
+      if (is_internal) {
+        (void)output_data.emplace_back(std::move(launch_info.internal_output_data_[internal_index++]));
+      } else {
+        (void)output_data.emplace_back(std::move(kernel_actor->output_data_[external_index++]));
+      }
+    }
+    kernel_actor->output_data_ = std::move(output_data);
+    kernel_actor->output_data_arrows_ = launch_info.output_data_arrows_;
+    kernel_actor->output_data_nodes_ = launch_info.output_data_nodes_;
+    kernel_actor->output_control_arrows_ = launch_info.output_control_arrows_;
+  }
+  launch_list_.clear();
+  dependency_counters_.clear();
+
+  for (auto &kernel_actor : kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    kernel_actor->graph_capture_ = nullptr;
+  }
+  status_ = GraphCaptureStatus::kIdle;
+}
+
+void GraphCapture::RecordLaunch(KernelActor *const kernel_actor) {
+  std::lock_guard<std::mutex> lock(capture_mutex_);
+  (void)captured_kernel_actors_.emplace_back(kernel_actor);
+}
+
+bool GraphCapture::BuildLaunchList() {
+  if (captured_kernel_actors_.size() != kernel_actors_.size()) {
+    MS_LOG(INFO) << "The captured kernel launch number " << captured_kernel_actors_.size()
+                 << " is not equal to the kernel actor number " << kernel_actors_.size();
+    return false;
+  }
+
+  // The kernel actor is launched only once in the step and has no data copy between kernels.
+  mindspore::HashMap<std::string, size_t> actor_name_to_launch_index;
+  for (size_t i = 0; i < captured_kernel_actors_.size(); ++i) {
+    auto kernel_actor = captured_kernel_actors_[i];
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    if (!actor_name_to_launch_index.emplace(kernel_actor->GetAID().Name(), i).second) {
+      MS_LOG(INFO) << "The kernel actor " << kernel_actor->GetAID().Name() << " is launched repeatedly.";
+      return false;
+    }
+    if (std::any_of(kernel_actor->copy_input_device_tensors_.begin(), kernel_actor->copy_input_device_tensors_.end(),
+                    [](const DeviceTensorPtr &device_tensor) { return device_tensor != nullptr; })) {
+      MS_LOG(INFO) << "The kernel actor " << kernel_actor->GetAID().Name() << " has the input data copy.";
+      return false;
+    }
+  }
+
+  // Compute the dependencies in the launch list.
+  launch_list_.clear();
+  launch_list_.resize(captured_kernel_actors_.size());
+  std::vector<std::pair<size_t, size_t>> external_inputs_nums(launch_list_.size());
+  for (size_t i = 0; i < launch_list_.size(); ++i) {
+    auto kernel_actor = captured_kernel_actors_[i];
+    auto &launch_info = launch_list_[i];
+    launch_info.kernel_actor_ = kernel_actor;
+
+    std::set<size_t> predecessors;
+    auto &external_inputs_num = external_inputs_nums[i];
+    for (const auto &input_data_arrow_aid : kernel_actor->input_data_arrow_aids_) {
+      const auto &iter = actor_name_to_launch_index.find(input_data_arrow_aid.first.Name());
+      if (iter == actor_name_to_launch_index.end()) {
+        ++external_inputs_num.first;
+      } else {
+        (void)predecessors.insert(iter->second);
+      }
+    }
+    for (const auto &input_control_arrow_aid : kernel_actor->input_control_arrow_aids_) {
+      const auto &iter = actor_name_to_launch_index.find(input_control_arrow_aid.first.Name());
+      if (iter == actor_name_to_launch_index.end()) {
+        ++external_inputs_num.second;
+      } else {
+        (void)predecessors.insert(iter->second);
+      }
+    }
+    if ((external_inputs_num.first > kernel_actor->input_datas_num_) ||
+        (external_inputs_num.second > kernel_actor->input_controls_num_)) {
+      MS_LOG(INFO) << "The input arrows of kernel actor " << kernel_actor->GetAID().Name() << " are inconsistent.";
+      return false;
+    }
+
+    bool has_external_inputs = (external_inputs_num.first + external_inputs_num.second) > 0;
+    launch_info.dependency_num_ = predecessors.size() + (has_external_inputs ? 1 : 0);
+    if (launch_info.dependency_num_ == 0) {
+      MS_LOG(INFO) << "The kernel actor " << kernel_actor->GetAID().Name() << " has no dependency.";
+      return false;
+    }
+    for (auto predecessor : predecessors) {
+      (void)launch_list_[predecessor].successors_.emplace_back(i);
+      for (auto &output_data : captured_kernel_actors_[predecessor]->output_data_) {
+        MS_EXCEPTION_IF_NULL(output_data.first);
+        if (output_data.first->op_id_.Name() == kernel_actor->GetAID().Name()) {
+          (void)launch_info.internal_input_data_.emplace_back(output_data.first.get());
+        }
+      }
+    }
+  }
+
+  // Switch the kernel actors to the replay: only wait for the external inputs and only send the external outputs.
+  for (size_t i = 0; i < launch_list_.size(); ++i) {
+    auto kernel_actor = captured_kernel_actors_[i];
+    auto &launch_info = launch_list_[i];
+    launch_info.input_datas_num_ = kernel_actor->input_datas_num_;
+    launch_info.input_controls_num_ = kernel_actor->input_controls_num_;
+    kernel_actor->input_datas_num_ = external_inputs_nums[i].first;
+    kernel_actor->input_controls_num_ = external_inputs_nums[i].second;
+    kernel_actor->running_dependent_msg_num_ =
+      SizeToInt(external_inputs_nums[i].first + external_inputs_nums[i].second);
+
+    launch_info.output_data_arrows_ = kernel_actor->output_data_arrows_;
+    launch_info.output_data_nodes_ = kernel_actor->output_data_nodes_;
+    launch_info.output_control_arrows_ = kernel_actor->output_control_arrows_;
+    std::vector<DataArrowPtr> output_data_arrows;
+    std::vector<AnfNodePtr> output_data_nodes;
+    std::vector<std::pair<OpDataUniquePtr<DeviceTensor>, int>> output_data;
+    for (size_t j = 0; j < launch_info.output_data_arrows_.size(); ++j) {
+      const auto &data_arrow = launch_info.output_data_arrows_[j];
+      MS_EXCEPTION_IF_NULL(data_arrow);
+      bool is_internal = (actor_name_to_launch_index.count(data_arrow->to_op_id_.Name()) > 0);
+      (void)launch_info.is_internal_output_data_.emplace_back(is_internal);
+      if (is_internal) {
+        (void)launch_info.internal_output_data_.emplace_back(std::move(kernel_actor->output_data_[j]));
+      } else {
+        (void)output_data_arrows.emplace_back(data_arrow);
+        (void)output_data_nodes.emplace_back(launch_info.output_data_nodes_[j]);
+        (void)output_data.emplace_back(std::move(kernel_actor->output_data_[j]));
+      }
+    }
+    kernel_actor->output_data_arrows_ = std::move(output_data_arrows);
+    kernel_actor->output_data_nodes_ = std::move(output_data_nodes);
+    kernel_actor->output_data_ = std::move(output_data);
+
+    std::vector<ControlArrowPtr> output_control_arrows;
+    for (const auto &control_arrow : launch_info.output_control_arrows_) {
+      MS_EXCEPTION_IF_NULL(control_arrow);
+      if (actor_name_to_launch_index.count(control_arrow->to_op_id_.Name()) == 0) {
+        (void)output_control_arrows.emplace_back(control_arrow);
+      }
+    }
+    kernel_actor->output_control_arrows_ = std::move(output_control_arrows);
+    kernel_actor->launch_index_ = i;
+  }
+
+  dependency_counters_ = std::vector<std::atomic<size_t>>(launch_list_.size());
+  return true;
+}
+
+void GraphCapture::ResetDependencyCounters() {
+  for (size_t i = 0; i < launch_list_.size(); ++i) {
+    dependency_counters_[i].store(launch_list_[i].dependency_num_);
+  }
+}
+
+void GraphCapture::FinishLaunch(size_t launch_num) {
+  if (launch_num == 0) {
+    return;
+  }
+  if (running_launch_num_.fetch_sub(launch_num) == launch_num) {
+    std::lock_guard<std::mutex> lock(running_mutex_);
+    running_condition_.notify_all();
+  }
+}
+
+void GraphCapture::WaitForRunningLaunches() {
+  std::unique_lock<std::mutex> lock(running_mutex_);
+  running_condition_.wait(lock, [this]() { return running_launch_num_.load() == 0; });
+}
+
+void GraphCapture::OnExternalInputReady(size_t launch_index, OpContext<DeviceTensor> *const context) {
+  if (dependency_counters_[launch_index].fetch_sub(1) == 1) {
+    ++running_launch_num_;
+    Launch(launch_list_[launch_index].kernel_actor_, context);
+  }
+}
+
+void GraphCapture::OnKernelFinish(size_t launch_index, OpContext<DeviceTensor> *const context) {
+  // The first ready successor runs in the current thread, and the others are dispatched to the thread pool.
+  KernelActor *next_kernel_actor = nullptr;
+  for (auto successor : launch_list_[launch_index].successors_) {
+    if (dependency_counters_[successor].fetch_sub(1) != 1) {
+      continue;
+    }
+    ++running_launch_num_;
+    auto kernel_actor = launch_list_[successor].kernel_actor_;
+    if (next_kernel_actor == nullptr) {
+      next_kernel_actor = kernel_actor;
+    } else {
+      ActorDispatcher::Send(kernel_actor->GetAID(), &KernelActor::RunByGraphCapture, context);
+    }
+  }
+
+  if (next_kernel_actor != nullptr) {
+    Launch(next_kernel_actor, context);
+  }
+}
+
+void GraphCapture::Launch(KernelActor *const kernel_actor, OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  static thread_local std::vector<std::pair<KernelActor *, OpContext<DeviceTensor> *>> ready_kernel_actors;
+  static thread_local bool is_launching = false;
+  (void)ready_kernel_actors.emplace_back(kernel_actor, context);
+  if (is_launching) {
+    return;
+  }
+
+  is_launching = true;
+  try {
+    while (!ready_kernel_actors.empty()) {
+      auto ready_kernel_actor = ready_kernel_actors.back();
+      ready_kernel_actors.pop_back();
+      ready_kernel_actor.first->RunKernel(ready_kernel_actor.second);
+      FinishLaunch(1);
+    }
+  } catch (const std::exception &e) {
+    // The failed kernel actor and the ready ones which never run.
+    FinishLaunch(ready_kernel_actors.size() + 1);
+    ready_kernel_actors.clear();
+    is_launching = false;
+    throw;
+  }
+  is_launching = false;
+}
+}  // namespace runtime
+}  // namespace mindspore
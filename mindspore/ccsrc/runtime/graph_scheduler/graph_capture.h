@@ -0,0 +1,136 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_GRAPH_CAPTURE_H_
+#define MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_GRAPH_CAPTURE_H_
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include "runtime/graph_scheduler/actor/actor_common.h"
+
+namespace mindspore {
+namespace runtime {
+class KernelActor;
+using KernelActorPtr = std::shared_ptr<KernelActor>;
+
+// The capture status of graph:
+// kIdle: the next step captures the kernel launch sequence.
+// kCapturing: the step is running by the actor messages and records the kernel launch sequence.
+// kReplaying: the step replays the captured kernel launch sequence by the dependency counters.
+// kUnsupported: the graph can't be captured, such as the data copy between kernels.
+enum class GraphCaptureStatus { kIdle, kCapturing, kReplaying, kUnsupported };
+
+// The graph capture records the kernel launch sequence of static graph in the first step, and replays the kernel
+// actors by the flat launch list in the later steps. The kernel actors in the replay don't send messages to each
+// other, but decrease the dependency counters of the successors directly, and the ready successor runs in the current
+// thread or is dispatched to the thread pool when there are multiple ready successors. The boundary actors such as
+// data prepare actor, data source actor and output actor are not changed and still interact with kernel actors by the
+// messages. The capture is invalidated and falls back to the actor message path when the input shapes are changed.
+class GraphCapture {
+ public:
+  GraphCapture(const std::string &name, const std::vector<KernelActorPtr> &kernel_actors, bool is_supported)
+      : name_(name),
+        kernel_actors_(kernel_actors),
+        status_(is_supported ? GraphCaptureStatus::kIdle : GraphCaptureStatus::kUnsupported) {}
+  ~GraphCapture() = default;
+
+  // Called before the step running: begin capturing, or check whether the inputs are consistent with the captured
+  // graph and reset the dependency counters for the replay.
+  void Prepare(const std::vector<std::vector<TensorPtr>> &input_tensors);
+  // Called after the step running successfully: build the launch list by the captured kernel launch sequence.
+  void Finish();
+  // Restore the kernel actors to the actor message path and capture again in the next step. It waits for the kernel
+  // actors which are still running in the replay, such as the ones dispatched to the thread pool before a failure.
+  void Invalidate();
+
+  // Record the kernel actor launch in the capturing.
+  void RecordLaunch(KernelActor *const kernel_actor);
+
+  // The kernel actor receives all the inputs from the actors out of the launch list.
+  void OnExternalInputReady(size_t launch_index, OpContext<DeviceTensor> *const context);
+  // The kernel actor finishes launching and triggers the successors in the launch list.
+  void OnKernelFinish(size_t launch_index, OpContext<DeviceTensor> *const context);
+  // Run the ready kernel actor. The successors which are ready in the running are pushed into the ready list of
+  // current thread and run in turn, to avoid the deep recursion of long kernel chain.
+  void Launch(KernelActor *const kernel_actor, OpContext<DeviceTensor> *const context);
+
+  // The input data which come from the kernel actors in the launch list, and are fetched directly in the replay.
+  const std::vector<OpData<DeviceTensor> *> &internal_input_data(size_t launch_index) const {
+    return launch_list_[launch_index].internal_input_data_;
+  }
+  // Whether the kernel actor has the successors in the launch list.
+  bool has_successors(size_t launch_index) const { return !launch_list_[launch_index].successors_.empty(); }
+
+  bool is_capturing() const { return status_.load() == GraphCaptureStatus::kCapturing; }
+  bool is_replaying() const { return status_.load() == GraphCaptureStatus::kReplaying; }
+  GraphCaptureStatus status() const { return status_.load(); }
+  size_t launch_list_size() const { return launch_list_.size(); }
+
+ private:
+  struct LaunchInfo {
+    KernelActor *kernel_actor_{nullptr};
+    // The launch indexes of successors in ascending order.
+    std::vector<size_t> successors_;
+    // The number of predecessors in the launch list, add one if the actor depends on the external inputs.
+    size_t dependency_num_{0};
+    std::vector<OpData<DeviceTensor> *> internal_input_data_;
+
+    // The original dependent inputs number and outputs of kernel actor, which are restored in the invalidation.
+    size_t input_datas_num_{0};
+    size_t input_controls_num_{0};
+    std::vector<DataArrowPtr> output_data_arrows_;
+    std::vector<AnfNodePtr> output_data_nodes_;
+    std::vector<ControlArrowPtr> output_control_arrows_;
+    std::vector<bool> is_internal_output_data_;
+    // Hold the output data to the kernel actors in the launch list, which are not sent in the replay.
+    std::vector<std::pair<OpDataUniquePtr<DeviceTensor>, int>> internal_output_data_;
+  };
+
+  // Build the launch list and switch the outputs of kernel actors to the external outputs.
+  bool BuildLaunchList();
+  void ResetDependencyCounters();
+  // The ready kernel actors in the replay finish running.
+  void FinishLaunch(size_t launch_num);
+  void WaitForRunningLaunches();
+
+  std::string name_;
+  std::vector<KernelActorPtr> kernel_actors_;
+  std::atomic<GraphCaptureStatus> status_;
+
+  // The captured kernel launch sequence.
+  std::mutex capture_mutex_;
+  std::vector<KernelActor *> captured_kernel_actors_;
+  // The input shapes of captured graph, which are used to check whether the replay is valid.
+  std::vector<std::vector<ShapeVector>> input_shapes_;
+
+  std::vector<LaunchInfo> launch_list_;
+  std::vector<std::atomic<size_t>> dependency_counters_;
+
+  // The number of kernel actors which are ready in the replay and don't finish running.
+  std::atomic<size_t> running_launch_num_{0};
+  std::mutex running_mutex_;
+  std::condition_variable running_condition_;
+};
+using GraphCapturePtr = std::shared_ptr<GraphCapture>;
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_GRAPH_CAPTURE_H_
@@ -24,6 +24,7 @@
 #include "runtime/graph_scheduler/optimizer/invalid_data_arrow_elimination.h"
 #include "runtime/graph_scheduler/optimizer/batch_data_arrow_fusion.h"
 #include "runtime/graph_scheduler/optimizer/multi_actor_fusion.h"
+#include "runtime/graph_scheduler/optimizer/cost_driven_actor_fusion.h"
 #include "runtime/hardware/device_context_manager.h"
 #include "mindrt/src/actor/actormgr.h"
 #include "mindrt/include/async/async.h"
@@ -79,6 +80,12 @@ using distributed::recovery::RecoveryContext;
 namespace {
 constexpr char kNumaEnableEnv[] = "MS_ENABLE_NUMA";
 constexpr char kNumaEnableEnv2[] = "DATASET_ENABLE_NUMA";
+// Schedule the actors by the work stealing of actor threads instead of the global actor queue.
+constexpr char kActorWorkStealingEnv[] = "MS_ENABLE_ACTOR_WORK_STEALING";
+// Replay the captured kernel launch sequence of static graph instead of the messages between kernel actors.
+constexpr char kGraphCaptureEnv[] = "MS_ENABLE_GRAPH_CAPTURE";
+// Fuse the chains of cheap kernel actors by the estimated kernel cost.
+constexpr char kCostDrivenActorFusionEnv[] = "MS_ENABLE_COST_DRIVEN_ACTOR_FUSION";
 
 // For the transform state synchronization.
 constexpr char kTransformFinishPrefix[] = "TRANSFORM_FINISH_";
@@ -394,13 +401,17 @@ void GraphScheduler::Initialize() {
   ComputeThreadNums(&actor_thread_num, &actor_and_kernel_thread_num);
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
-  auto ret = actor_manager->Initialize(true, actor_thread_num, actor_and_kernel_thread_num);
+  bool enable_work_stealing = (common::GetEnv(kActorWorkStealingEnv) == "1");
+  auto ret = actor_manager->Initialize(true, actor_thread_num, actor_and_kernel_thread_num, enable_work_stealing);
   if (ret != MINDRT_OK) {
     MS_LOG(EXCEPTION) << "Actor manager init failed.";
   }
   common::SetOMPThreadNum();
   MS_LOG(INFO) << "The actor thread number: " << actor_thread_num
-               << ", the kernel thread number: " << (actor_and_kernel_thread_num - actor_thread_num);
+               << ", the kernel thread number: " << (actor_and_kernel_thread_num - actor_thread_num)
+               << ", enable work stealing: " << enable_work_stealing;
+  enable_graph_capture_ = (common::GetEnv(kGraphCaptureEnv) == "1");
+  enable_cost_driven_actor_fusion_ = (common::GetEnv(kCostDrivenActorFusionEnv) == "1");
 
 #ifdef ENABLE_RPC_ACTOR
   // Create and initialize RpcNodeScheduler.
@@ -599,6 +610,8 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<DeviceCont
   MS_EXCEPTION_IF_NULL(op_context_setter);
 #endif
 
+  PrepareGraphCapture(actor_set, input_tensors, strategy);
+
   // Trigger data prepare actor running.
   MS_EXCEPTION_IF_NULL(ActorMgr::GetActorMgrRef());
   auto thread_pool = ActorMgr::GetActorMgrRef()->GetActorThreadPool();
@@ -620,6 +633,10 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<DeviceCont
 #ifdef ENABLE_DUMP_IR
     mindspore::RDR::TriggerAll();
 #endif
+    // Restore the kernel actors after the kernels running in the replay finish.
+    if (actor_set->graph_capture_ != nullptr) {
+      actor_set->graph_capture_->Invalidate();
+    }
     // When temporary variable 'op_context' has beed set failed status, the main thread need wait other threads until
     // they finish respective task, otherwise segmentation fault will happen when these task access 'op_context',
     // because it has been destroyed.
@@ -632,6 +649,9 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<DeviceCont
     MsException::Instance().CheckException();
     MS_LOG(EXCEPTION) << op_context.error_info_;
   }
+  if (actor_set->graph_capture_ != nullptr) {
+    actor_set->graph_capture_->Finish();
+  }
 
   double end_time = GetTime();
   const size_t kSecondsToMilliseconds = 1000;
@@ -702,6 +722,53 @@ void GraphScheduler::SetActorExecutionStrategy(ActorSet *const actor_set, GraphE
   }
 }
 
+void GraphScheduler::PrepareGraphCapture(ActorSet *const actor_set,
+                                         const std::vector<std::vector<TensorPtr>> &input_tensors,
+                                         GraphExecutionStrategy strategy) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  if ((!enable_graph_capture_) || (strategy == GraphExecutionStrategy::kStep)) {
+    return;
+  }
+  if (actor_set->graph_capture_ == nullptr) {
+    actor_set->graph_capture_ =
+      std::make_shared<GraphCapture>(actor_set->name_, actor_set->kernel_actors_, IsGraphCapturable(actor_set));
+  }
+  actor_set->graph_capture_->Prepare(input_tensors);
+}
+
+bool GraphScheduler::IsGraphCapturable(ActorSet *const actor_set) const {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  MS_EXCEPTION_IF_NULL(actor_set->loop_count_actor_);
+  // The constraint condition of not supporting the graph capture: the control flow, the data copy between kernels and
+  // the kernels which are not launched by the kernel actors one by one.
+  if ((actor_set->kernel_actors_.empty()) || (actor_set->control_actors_ != nullptr) ||
+      (actor_set->copy_actors_.size() > 0) || (actor_set->super_kernel_actors_.size() > 0) ||
+      (actor_set->custom_actors_.size() > 0) || (actor_set->fusion_actors_.size() > 0) ||
+      (actor_set->loop_count_actor_->loop_count() > 1)) {
+    return false;
+  }
+#ifdef ENABLE_RPC_ACTOR
+  if (HaveRpcActors(actor_set)) {
+    return false;
+  }
+#endif
+
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    MS_EXCEPTION_IF_NULL(kernel_actor->device_contexts_[0]);
+    if ((kernel_actor->type_ != KernelTransformType::kKernelActor) || (kernel_actor->is_dynamic_shape()) ||
+        (kernel_actor->debug_aid_ != nullptr) || (kernel_actor->parent_fusion_actor_ != nullptr) ||
+        (kernel_actor->device_contexts_[0]->GetDeviceType() != device::DeviceType::kCPU) ||
+        (kernel_actor->input_data_arrow_aids_.size() != kernel_actor->input_datas_num_) ||
+        (kernel_actor->input_control_arrow_aids_.size() != kernel_actor->input_controls_num_)) {
+      MS_LOG(INFO) << "The actor set " << actor_set->name_ << " can't be captured by the kernel actor "
+                   << kernel_actor->GetAID().Name();
+      return false;
+    }
+  }
+  return true;
+}
+
 ActorSet *GraphScheduler::Fetch(const ActorInfo &actor_info) const {
   auto iter = actors_.find(actor_info);
   if (iter != actors_.end()) {
@@ -825,7 +892,14 @@ void GraphScheduler::Optimize(const ActorSetPtr &actor_set) {
   auto optimizer = std::make_shared<ActorSetOptimizer>();
   MS_EXCEPTION_IF_NULL(optimizer);
   optimizer->AddPass(std::make_shared<InvalidDataArrowElimination>());
-  optimizer->AddPass(std::make_shared<MultiActorFusion>());
+  // The graph capture replaces the messages between kernel actors by the launch list, and can't capture the kernel
+  // actors in the fusion actor.
+  if (!enable_graph_capture_) {
+    optimizer->AddPass(std::make_shared<MultiActorFusion>());
+    if (enable_cost_driven_actor_fusion_) {
+      optimizer->AddPass(std::make_shared<CostDrivenActorFusion>());
+    }
+  }
   optimizer->AddPass(std::make_shared<BatchDataArrowFusion>());
   optimizer->Optimize(actor_set);
 }
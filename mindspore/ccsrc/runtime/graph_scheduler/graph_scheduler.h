@@ -88,6 +88,10 @@ class BACKEND_EXPORT GraphScheduler {
   // Set using the multi thread or single thread to execute the actor set by the execution time compared.
   void SetActorExecutionStrategy(ActorSet *const actor_set, GraphExecutionStrategy strategy,
                                  double execution_time) const;
+  // Capture the kernel launch sequence of static graph in the first step and replay it in the later steps.
+  void PrepareGraphCapture(ActorSet *const actor_set, const std::vector<std::vector<TensorPtr>> &input_tensors,
+                           GraphExecutionStrategy strategy);
+  bool IsGraphCapturable(ActorSet *const actor_set) const;
 
   // The Global actors contain memory manager actor, recorder actor and debug actor.
   void BuildAndScheduleGlobalActor();
@@ -220,6 +224,10 @@ class BACKEND_EXPORT GraphScheduler {
 
   // Whether actor running by the persistent execution order.
   bool execution_order_running_{false};
+  // Whether replay the captured kernel launch sequence of static graph.
+  bool enable_graph_capture_{false};
+  // Whether fuse the chains of cheap kernel actors by the estimated kernel cost.
+  bool enable_cost_driven_actor_fusion_{false};
   // numa library handle
   std::shared_ptr<void> numa_handle_{};
 
@@ -0,0 +1,301 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/optimizer/cost_driven_actor_fusion.h"
+#include <set>
+#include <map>
+#include <numeric>
+#include "runtime/graph_scheduler/scheduler_helper.h"
+#include "include/common/utils/utils.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+// The kernel is cheap when the estimated cost is not greater than the threshold, which is about the memory traffic of a
+// few microseconds on CPU.
+constexpr size_t kCheapKernelCostThreshold = 64 * 1024;
+// Limit the fusion group to avoid serializing too many kernels which can execute concurrently.
+constexpr size_t kFusionGroupMaxCost = 1024 * 1024;
+constexpr size_t kFusionGroupMaxNum = 64;
+constexpr size_t kComputeBoundCostFactor = 16;
+const std::set<std::string> kComputeBoundKernels = {kMatMulOpName, kBatchMatMulOpName, kConv2DOpName, "Conv3D",
+                                                    "Conv2DBackpropInput", "Conv2DBackpropFilter", "LSTM"};
+
+bool SupportCostDrivenFusion(const KernelActorPtr &kernel_actor) {
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  if ((kernel_actor->type() != KernelTransformType::kKernelActor) || (kernel_actor->parent_fusion_actor() != nullptr) ||
+      kernel_actor->is_dynamic_shape()) {
+    return false;
+  }
+  const auto &device_context = kernel_actor->device_contexts()[0];
+  return (device_context != nullptr) && (device_context->GetDeviceType() == device::DeviceType::kCPU);
+}
+
+size_t SizeListSum(const std::vector<size_t> &size_list) {
+  return std::accumulate(size_list.begin(), size_list.end(), static_cast<size_t>(0));
+}
+
+std::set<std::string> FetchOutputActorNames(const AbstractActor *actor) {
+  std::set<std::string> output_actor_names;
+  for (const auto &data_arrow : actor->output_data_arrows()) {
+    MS_EXCEPTION_IF_NULL(data_arrow);
+    (void)output_actor_names.insert(data_arrow->to_op_id_.Name());
+  }
+  for (const auto &control_arrow : actor->output_control_arrows()) {
+    MS_EXCEPTION_IF_NULL(control_arrow);
+    (void)output_actor_names.insert(control_arrow->to_op_id_.Name());
+  }
+  return output_actor_names;
+}
+
+std::set<std::string> FetchInputActorNames(const AbstractActor *actor) {
+  std::set<std::string> input_actor_names;
+  for (const auto &input_data_arrow_aid : actor->input_data_arrow_aids()) {
+    (void)input_actor_names.insert(input_data_arrow_aid.first.Name());
+  }
+  for (const auto &input_control_arrow_aid : actor->input_control_arrow_aids()) {
+    (void)input_actor_names.insert(input_control_arrow_aid.first.Name());
+  }
+  return input_actor_names;
+}
+
+// Find the closed subgraph of the cheap actors from the entry actor to the nearest exit actor: the actors of subgraph
+// except the entry actor are only fed by the actors of subgraph, and the actors except the exit actor only feed the
+// actors of subgraph, so the subgraph runs inline as a whole. Return empty when there is no such subgraph under the
+// number limit.
+std::vector<size_t> FindClosedSubgraph(size_t entry, const std::vector<std::set<std::string>> &input_actor_names,
+                                       const std::vector<std::set<std::string>> &output_actor_names,
+                                       const mindspore::HashMap<std::string, size_t> &actor_name_to_index) {
+  auto fetch_index = [&actor_name_to_index](const std::string &actor_name) {
+    const auto &iter = actor_name_to_index.find(actor_name);
+    return (iter == actor_name_to_index.end()) ? SIZE_MAX : iter->second;
+  };
+
+  // The cheap actors reached from the entry actor in the breadth first order, which are the candidates of exit actor.
+  std::vector<size_t> reached_actors{entry};
+  std::set<size_t> reached_set{entry};
+  for (size_t i = 0; (i < reached_actors.size()) && (reached_actors.size() < kFusionGroupMaxNum); ++i) {
+    for (const auto &actor_name : output_actor_names[reached_actors[i]]) {
+      auto index = fetch_index(actor_name);
+      if ((index != SIZE_MAX) && reached_set.insert(index).second) {
+        (void)reached_actors.emplace_back(index);
+      }
+    }
+  }
+
+  for (size_t i = 1; i < reached_actors.size(); ++i) {
+    auto exit = reached_actors[i];
+    if (input_actor_names[exit].size() <= 1) {
+      continue;
+    }
+    // Collect the subgraph backward from the exit actor, all the inputs must be reached from the entry actor.
+    std::set<size_t> subgraph{exit};
+    std::vector<size_t> to_visit{exit};
+    bool is_closed = true;
+    while (is_closed && (!to_visit.empty())) {
+      auto index = to_visit.back();
+      to_visit.pop_back();
+      if (index == entry) {
+        continue;
+      }
+      for (const auto &actor_name : input_actor_names[index]) {
+        auto input_index = fetch_index(actor_name);
+        if (reached_set.count(input_index) == 0) {
+          is_closed = false;
+          break;
+        }
+        if (subgraph.insert(input_index).second) {
+          (void)to_visit.emplace_back(input_index);
+        }
+      }
+    }
+    if ((!is_closed) || (subgraph.count(entry) == 0) || (subgraph.size() > kFusionGroupMaxNum)) {
+      continue;
+    }
+    for (auto index : subgraph) {
+      if (index == exit) {
+        continue;
+      }
+      for (const auto &actor_name : output_actor_names[index]) {
+        if (subgraph.count(fetch_index(actor_name)) == 0) {
+          is_closed = false;
+          break;
+        }
+      }
+      if (!is_closed) {
+        break;
+      }
+    }
+    if (is_closed) {
+      return std::vector<size_t>(subgraph.begin(), subgraph.end());
+    }
+  }
+  return {};
+}
+}  // namespace
+
+size_t CostDrivenActorFusion::EstimateKernelCost(const KernelActor *kernel_actor) {
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  const auto &kernel = kernel_actor->kernel();
+  MS_EXCEPTION_IF_NULL(kernel);
+  auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
+  if (kernel_mod == nullptr) {
+    return SIZE_MAX;
+  }
+
+  size_t cost = SizeListSum(kernel_mod->GetInputSizeList()) + SizeListSum(kernel_mod->GetOutputSizeList()) +
+                SizeListSum(kernel_mod->GetWorkspaceSizeList());
+  if (kComputeBoundKernels.count(common::AnfAlgo::GetCNodeName(kernel)) > 0) {
+    cost = (cost > SIZE_MAX / kComputeBoundCostFactor) ? SIZE_MAX : cost * kComputeBoundCostFactor;
+  }
+  return cost;
+}
+
+void CostDrivenActorFusion::Process(ActorSet *const actor_set, AbstractActor *const) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  if ((!actor_set->custom_actors_.empty()) || (actor_set->control_actors_ != nullptr)) {
+    return;
+  }
+
+  // Collect the cheap kernel actors in the order of kernel actors.
+  std::vector<KernelActorPtr> cheap_actors;
+  std::vector<size_t> costs;
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    if (!SupportCostDrivenFusion(kernel_actor)) {
+      continue;
+    }
+    auto cost = EstimateKernelCost(kernel_actor.get());
+    if (cost <= kCheapKernelCostThreshold) {
+      (void)cheap_actors.emplace_back(kernel_actor);
+      (void)costs.emplace_back(cost);
+    }
+  }
+
+  size_t saved_messages_num = 0;
+  size_t fused_actors_num = 0;
+  auto groups = GroupCheapActors(cheap_actors, costs);
+  for (auto &group : groups) {
+    auto fusion_actor = SchedulerHelper::BuildFusionActor(group.first);
+    MS_EXCEPTION_IF_NULL(fusion_actor);
+    fusion_actor->estimated_cost_ = group.second;
+    SchedulerHelper::AddArrowForFusionActor(fusion_actor.get());
+    saved_messages_num += fusion_actor->FetchSavedMessagesNum();
+    fused_actors_num += group.first.size();
+    (void)actor_set->fusion_actors_.emplace_back(fusion_actor);
+  }
+  MS_LOG(INFO) << actor_set->name_ << " fuses " << fused_actors_num << " cheap kernel actors to " << groups.size()
+               << " fusion actors and saves " << saved_messages_num << " messages per step.";
+}
+
+std::vector<std::pair<std::vector<AbstractActorPtr>, size_t>> CostDrivenActorFusion::GroupCheapActors(
+  const std::vector<KernelActorPtr> &cheap_actors, const std::vector<size_t> &costs) {
+  if (cheap_actors.size() != costs.size()) {
+    MS_LOG(EXCEPTION) << "The cheap actors number " << cheap_actors.size() << " is not equal to the costs number "
+                      << costs.size();
+  }
+  mindspore::HashMap<std::string, size_t> actor_name_to_index;
+  std::vector<std::set<std::string>> input_actor_names(cheap_actors.size());
+  std::vector<std::set<std::string>> output_actor_names(cheap_actors.size());
+  for (size_t i = 0; i < cheap_actors.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(cheap_actors[i]);
+    actor_name_to_index[cheap_actors[i]->GetAID().Name()] = i;
+    input_actor_names[i] = FetchInputActorNames(cheap_actors[i].get());
+    output_actor_names[i] = FetchOutputActorNames(cheap_actors[i].get());
+  }
+
+  // Union the cheap actors along the single producer and single consumer links, and then the small closed subgraphs of
+  // fan-out and fan-in. The group is represented by the root index. The actor whose fan-out branches are not joined
+  // by one cheap actor ends the group, which keeps those branches running concurrently.
+  std::vector<size_t> group_ids(cheap_actors.size());
+  std::iota(group_ids.begin(), group_ids.end(), 0);
+  std::vector<size_t> group_costs(costs);
+  std::vector<size_t> group_nums(cheap_actors.size(), 1);
+  auto find_group = [&group_ids](size_t index) {
+    while (group_ids[index] != index) {
+      group_ids[index] = group_ids[group_ids[index]];
+      index = group_ids[index];
+    }
+    return index;
+  };
+  for (size_t i = 0; i < cheap_actors.size(); ++i) {
+    if (output_actor_names[i].size() != 1) {
+      continue;
+    }
+    const auto &iter = actor_name_to_index.find(*output_actor_names[i].begin());
+    if (iter == actor_name_to_index.end()) {
+      continue;
+    }
+    const auto &input_names = input_actor_names[iter->second];
+    if ((input_names.size() != 1) || (*input_names.begin() != cheap_actors[i]->GetAID().Name())) {
+      continue;
+    }
+
+    auto from_group = find_group(i);
+    auto to_group = find_group(iter->second);
+    if ((from_group == to_group) || (group_costs[from_group] + group_costs[to_group] > kFusionGroupMaxCost) ||
+        (group_nums[from_group] + group_nums[to_group] > kFusionGroupMaxNum)) {
+      continue;
+    }
+    group_ids[to_group] = from_group;
+    group_costs[from_group] += group_costs[to_group];
+    group_nums[from_group] += group_nums[to_group];
+  }
+
+  for (size_t i = 0; i < cheap_actors.size(); ++i) {
+    if (output_actor_names[i].size() <= 1) {
+      continue;
+    }
+    auto subgraph = FindClosedSubgraph(i, input_actor_names, output_actor_names, actor_name_to_index);
+    if (subgraph.empty()) {
+      continue;
+    }
+    // The subgraph joins the groups of its actors as a whole, or not at all.
+    std::set<size_t> subgraph_groups;
+    for (auto index : subgraph) {
+      (void)subgraph_groups.insert(find_group(index));
+    }
+    size_t merged_cost = 0;
+    size_t merged_num = 0;
+    for (auto group : subgraph_groups) {
+      merged_cost += group_costs[group];
+      merged_num += group_nums[group];
+    }
+    if ((subgraph_groups.size() == 1) || (merged_cost > kFusionGroupMaxCost) || (merged_num > kFusionGroupMaxNum)) {
+      continue;
+    }
+    auto root_group = find_group(i);
+    for (auto group : subgraph_groups) {
+      group_ids[group] = root_group;
+    }
+    group_costs[root_group] = merged_cost;
+    group_nums[root_group] = merged_num;
+  }
+
+  // Collect the groups which have multiple actors.
+  std::map<size_t, std::vector<AbstractActorPtr>> groups;
+  for (size_t i = 0; i < cheap_actors.size(); ++i) {
+    (void)groups[find_group(i)].emplace_back(cheap_actors[i]);
+  }
+  std::vector<std::pair<std::vector<AbstractActorPtr>, size_t>> fusion_groups;
+  for (auto &group : groups) {
+    if (group.second.size() > 1) {
+      (void)fusion_groups.emplace_back(std::move(group.second), group_costs[group.first]);
+    }
+  }
+  return fusion_groups;
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_OPTIMIZER_COST_DRIVEN_ACTOR_FUSION_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_OPTIMIZER_COST_DRIVEN_ACTOR_FUSION_H_
+
+#include <vector>
+#include <string>
+#include <utility>
+#include "runtime/graph_scheduler/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace runtime {
+// Fuse the chains of cheap kernel actors to the fusion actors by the estimated kernel cost. The kernel of cheap actor
+// finishes in a few microseconds on CPU, which is less than the overhead of message passing, so the cheap actors run
+// inline in the fusion actor. The single producer and single consumer links are fused, and so are the small closed
+// subgraphs of fan-out and fan-in, whose branches are joined by one cheap actor. The branches which are not joined keep
+// executing concurrently.
+class CostDrivenActorFusion : public ActorPass {
+ public:
+  CostDrivenActorFusion() : ActorPass("cost_driven_actor_fusion", false) {}
+  ~CostDrivenActorFusion() override = default;
+
+  // Estimate the kernel cost by the memory size of inputs, outputs and workspaces, because most of the CPU kernels are
+  // memory bound, and the compute bound kernels are weighted by the factor.
+  static size_t EstimateKernelCost(const KernelActor *kernel_actor);
+
+  // Group the cheap kernel actors along the single producer and single consumer chains and the closed subgraphs which
+  // have one entry actor and one exit actor, under the cost and number limits of group. The costs are the estimated
+  // kernel costs of the cheap actors and the second of pair is the estimated cost of group.
+  static std::vector<std::pair<std::vector<AbstractActorPtr>, size_t>> GroupCheapActors(
+    const std::vector<KernelActorPtr> &cheap_actors, const std::vector<size_t> &costs);
+
+ protected:
+  void Process(ActorSet *const actor_set, AbstractActor *const actor) override;
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_OPTIMIZER_COST_DRIVEN_ACTOR_FUSION_H_
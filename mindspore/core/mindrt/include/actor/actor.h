@@ -17,6 +17,8 @@
 #ifndef MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_ACTOR_H
 #define MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_ACTOR_H
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -155,6 +157,7 @@ class MS_CORE_API ActorBase {
  private:
   friend class ActorMgr;
   friend class ActorWorker;
+  friend class ActorThreadPool;
   friend class ParallelWorker;
 
   // KMSG Msg Handler
@@ -214,6 +217,8 @@ class MS_CORE_API ActorBase {
   uint32_t recordNextPoint = 0;
 
   ActorThreadPool *pool_{nullptr};
+  // The actor worker which ran the actor last time, the actor prefers to run on it again in the work stealing mode.
+  std::atomic<size_t> last_worker_id_{SIZE_MAX};
   std::shared_ptr<ActorMgr> actor_mgr_;
 };
 using ActorReference = std::shared_ptr<ActorBase>;
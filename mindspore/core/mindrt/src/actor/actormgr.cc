@@ -49,7 +49,8 @@ ActorMgr::~ActorMgr() {
   }
 }
 
-int ActorMgr::Initialize(bool use_inner_pool, size_t actor_thread_num, size_t max_thread_num) {
+int ActorMgr::Initialize(bool use_inner_pool, size_t actor_thread_num, size_t max_thread_num,
+                         bool enable_work_stealing) {
   bool expected = false;
   if (!initialized_.compare_exchange_strong(expected, true)) {
     MS_LOG(DEBUG) << "Actor Manager has been initialized before";
@@ -78,6 +79,10 @@ int ActorMgr::Initialize(bool use_inner_pool, size_t actor_thread_num, size_t ma
       inner_pool_->SetSpinCountMaxValue();
       inner_pool_->SetKernelThreadMaxSpinCount(kDefaultKernelSpinCount);
       inner_pool_->SetWorkerIdMap();
+      if (enable_work_stealing && inner_pool_->EnableWorkStealing() != THREAD_OK) {
+        MS_LOG(ERROR) << "ActorMgr enable the work stealing of thread pool failed";
+        return MINDRT_ERROR;
+      }
     }
   }
   return MINDRT_OK;
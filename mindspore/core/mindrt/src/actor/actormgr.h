@@ -52,8 +52,10 @@ class MS_CORE_API ActorMgr {
   ~ActorMgr();
 
   void Finalize();
-  // initialize actor manager resource, do not create inner thread pool by default
-  int Initialize(bool use_inner_pool = false, size_t actor_thread_num = 1, size_t max_thread_num = 1);
+  // initialize actor manager resource, do not create inner thread pool by default,
+  // the actor threads of inner thread pool schedule the actors by work stealing if enable_work_stealing is set
+  int Initialize(bool use_inner_pool = false, size_t actor_thread_num = 1, size_t max_thread_num = 1,
+                 bool enable_work_stealing = false);
 
   void RemoveActor(const std::string &name);
   ActorReference GetActor(const AID &id);
@@ -21,10 +21,52 @@
 #include "thread/core_affinity.h"
 
 namespace mindspore {
+namespace {
+// The pool and the worker id of the current actor worker thread.
+thread_local const ActorThreadPool *current_pool = nullptr;
+thread_local size_t current_worker_id = 0;
+}  // namespace
+
+void ActorWorkerQueue::Push(ActorBase *actor) {
+  std::lock_guard<std::mutex> _l(mutex_);
+  actors_.push_back(actor);
+  size_.store(actors_.size(), std::memory_order_release);
+}
+
+ActorBase *ActorWorkerQueue::Pop() {
+  if (Empty()) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> _l(mutex_);
+  if (actors_.empty()) {
+    return nullptr;
+  }
+  auto actor = actors_.front();
+  actors_.pop_front();
+  size_.store(actors_.size(), std::memory_order_release);
+  return actor;
+}
+
+ActorBase *ActorWorkerQueue::TrySteal() {
+  if (Empty()) {
+    return nullptr;
+  }
+  std::unique_lock<std::mutex> _l(mutex_, std::try_to_lock);
+  if (!_l.owns_lock() || actors_.empty()) {
+    return nullptr;
+  }
+  auto actor = actors_.back();
+  actors_.pop_back();
+  size_.store(actors_.size(), std::memory_order_release);
+  return actor;
+}
+
 void ActorWorker::CreateThread() { thread_ = std::thread(&ActorWorker::RunWithSpin, this); }
 
 void ActorWorker::RunWithSpin() {
   SetAffinity();
+  current_pool = reinterpret_cast<ActorThreadPool *>(pool_);
+  current_worker_id = worker_id_;
 #if !defined(__APPLE__) && !defined(SUPPORT_MSVC)
   static std::atomic_int index = {0};
   (void)pthread_setname_np(pthread_self(), ("ActorThread_" + std::to_string(index++)).c_str());
@@ -52,11 +94,12 @@ bool ActorWorker::RunQueueActorTask() {
   if (pool_ == nullptr) {
     return false;
   }
-  auto actor = reinterpret_cast<ActorThreadPool *>(pool_)->PopActorFromQueue();
+  auto actor = reinterpret_cast<ActorThreadPool *>(pool_)->PopActorFromQueue(worker_id_);
   if (actor == nullptr) {
     return false;
   }
 
+  actor->last_worker_id_.store(worker_id_, std::memory_order_relaxed);
   actor->Run();
   return true;
 }
@@ -79,14 +122,7 @@ ActorThreadPool::~ActorThreadPool() {
   bool terminate = false;
   int count = 0;
   do {
-    {
-#ifdef USE_HQUEUE
-      terminate = actor_queue_.Empty();
-#else
-      std::lock_guard<std::mutex> _l(actor_mutex_);
-      terminate = actor_queue_.empty();
-#endif
-    }
+    terminate = ActorQueueEmpty();
     if (!terminate) {
       for (auto &worker : workers_) {
         worker->Active();
@@ -118,10 +154,84 @@ ActorBase *ActorThreadPool::PopActorFromQueue() {
 #endif
 }
 
+bool ActorThreadPool::ActorQueueEmpty() {
+  for (const auto &queue : worker_queues_) {
+    if (!queue->Empty()) {
+      return false;
+    }
+  }
+#ifdef USE_HQUEUE
+  return actor_queue_.Empty();
+#else
+  std::lock_guard<std::mutex> _l(actor_mutex_);
+  return actor_queue_.empty();
+#endif
+}
+
+ActorBase *ActorThreadPool::PopActorFromQueue(size_t worker_id) {
+  if (!work_stealing() || worker_id >= worker_queues_.size()) {
+    return PopActorFromQueue();
+  }
+  auto actor = worker_queues_[worker_id]->Pop();
+  if (actor != nullptr) {
+    return actor;
+  }
+  actor = StealActor(worker_id);
+  if (actor != nullptr) {
+    return actor;
+  }
+  // The actors pushed before the work stealing is enabled.
+  return PopActorFromQueue();
+}
+
+ActorBase *ActorThreadPool::StealActor(size_t worker_id) {
+  size_t queue_num = worker_queues_.size();
+  for (size_t i = 1; i < queue_num; ++i) {
+    auto actor = worker_queues_[(worker_id + i) % queue_num]->TrySteal();
+    if (actor != nullptr) {
+      THREAD_DEBUG("actor[%s] is stolen by worker %zu", actor->GetAID().Name().c_str(), worker_id);
+      return actor;
+    }
+  }
+  return nullptr;
+}
+
+size_t ActorThreadPool::SelectWorkerQueue(const ActorBase *actor) {
+  size_t queue_num = worker_queues_.size();
+  auto last_worker_id = actor->last_worker_id_.load(std::memory_order_relaxed);
+  if (last_worker_id < queue_num) {
+    return last_worker_id;
+  }
+  if (current_pool == this && current_worker_id < queue_num) {
+    return current_worker_id;
+  }
+  return next_worker_queue_.fetch_add(1, std::memory_order_relaxed) % queue_num;
+}
+
+void ActorThreadPool::ActiveActorWorker(size_t worker_id) {
+  if (reinterpret_cast<ActorWorker *>(workers_[worker_id])->ActorActive()) {
+    return;
+  }
+  // The owner is busy, active one idle actor thread to steal the actor if exist.
+  for (size_t i = 0; i < worker_queues_.size(); ++i) {
+    auto worker = reinterpret_cast<ActorWorker *>(workers_[i]);
+    if (worker->ActorActive()) {
+      break;
+    }
+  }
+}
+
 void ActorThreadPool::PushActorToQueue(ActorBase *actor) {
   if (!actor) {
     return;
   }
+  if (work_stealing()) {
+    auto worker_id = SelectWorkerQueue(actor);
+    worker_queues_[worker_id]->Push(actor);
+    THREAD_DEBUG("actor[%s] enqueue to worker %zu success", actor->GetAID().Name().c_str(), worker_id);
+    ActiveActorWorker(worker_id);
+    return;
+  }
   {
 #ifdef USE_HQUEUE
     while (!actor_queue_.Enqueue(actor)) {
@@ -151,6 +261,26 @@ int ActorThreadPool::ActorQueueInit() {
   return THREAD_OK;
 }
 
+int ActorThreadPool::EnableWorkStealing() {
+  if (work_stealing()) {
+    return THREAD_OK;
+  }
+  size_t queue_num = actor_thread_num_ < workers_.size() ? actor_thread_num_ : workers_.size();
+  if (queue_num == 0) {
+    THREAD_ERROR("no actor thread to enable the work stealing.");
+    return THREAD_ERROR;
+  }
+  for (size_t i = 0; i < queue_num; ++i) {
+    auto queue = new (std::nothrow) ActorWorkerQueue();
+    THREAD_ERROR_IF_NULL(queue);
+    worker_queues_.emplace_back(queue);
+  }
+  // The actor workers read the queues after the flag is set.
+  work_stealing_.store(true, std::memory_order_release);
+  THREAD_INFO("enable the work stealing of actor threads: [%zu]", queue_num);
+  return THREAD_OK;
+}
+
 int ActorThreadPool::CreateThreads(size_t actor_thread_num, size_t all_thread_num, const std::vector<int> &core_list) {
   if (actor_thread_num > all_thread_num) {
     THREAD_ERROR("thread num is invalid");
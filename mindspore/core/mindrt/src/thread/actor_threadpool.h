@@ -18,6 +18,8 @@
 #define MINDSPORE_CORE_MINDRT_RUNTIME_ACTOR_THREADPOOL_H_
 
 #include <queue>
+#include <deque>
+#include <memory>
 #include <vector>
 #include <mutex>
 #include <atomic>
@@ -31,6 +33,23 @@
 #endif
 namespace mindspore {
 class ActorThreadPool;
+// The actor queue owned by one actor worker in the work stealing mode. The owner pops the actors in order from the
+// front, and the other workers steal the latest pushed actors from the back.
+class ActorWorkerQueue {
+ public:
+  void Push(ActorBase *actor);
+  ActorBase *Pop();
+  // Give up at once if the queue is being used by others, the thief will try the other queues.
+  ActorBase *TrySteal();
+  bool Empty() const { return size_.load(std::memory_order_acquire) == 0; }
+
+ private:
+  std::mutex mutex_;
+  std::deque<ActorBase *> actors_;
+  // Check the queue without lock, the idle workers look for the actors in all the queues when spinning.
+  std::atomic<size_t> size_{0};
+};
+
 class ActorWorker : public Worker {
  public:
   explicit ActorWorker(ThreadPool *pool, size_t index) : Worker(pool, index) {}
@@ -60,6 +79,14 @@ class ActorThreadPool : public ThreadPool {
   virtual int ActorQueueInit();
   virtual void PushActorToQueue(ActorBase *actor);
   virtual ActorBase *PopActorFromQueue();
+  // Pop the actor for the actor worker, from its own queue first and then steal from the others in the work stealing
+  // mode, or from the global queue otherwise.
+  ActorBase *PopActorFromQueue(size_t worker_id);
+
+  // Give every actor worker its own queue instead of the global queue, the actor is pushed to the worker which ran it
+  // last time to keep the cache locality, and the idle workers steal the actors from the busy ones.
+  int EnableWorkStealing();
+  bool work_stealing() const { return work_stealing_.load(std::memory_order_acquire); }
 
  protected:
   ActorThreadPool() = default;
@@ -73,7 +100,18 @@ class ActorThreadPool : public ThreadPool {
 #endif
 
  private:
+  // Choose the actor worker queue for the actor: the last worker running it, the current actor worker, or in turn.
+  size_t SelectWorkerQueue(const ActorBase *actor);
+  // Active the idle worker to run the actor, prefer the owner of the queue.
+  void ActiveActorWorker(size_t worker_id);
+  ActorBase *StealActor(size_t worker_id);
+  bool ActorQueueEmpty();
+
   int CreateThreads(size_t actor_thread_num, size_t all_thread_num, const std::vector<int> &core_list);
+
+  std::atomic_bool work_stealing_{false};
+  std::vector<std::unique_ptr<ActorWorkerQueue>> worker_queues_;
+  std::atomic<size_t> next_worker_queue_{0};
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_CORE_MINDRT_RUNTIME_ACTOR_THREADPOOL_H_
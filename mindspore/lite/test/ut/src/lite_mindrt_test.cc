@@ -14,6 +14,11 @@
  * limitations under the License.
  */
 // #include <sys/time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
 #include "actor/actor.h"
 #include "actor/op_actor.h"
 #include "async/uuid_base.h"
@@ -22,6 +27,7 @@
 #include "thread/hqueue.h"
 #include "thread/actor_threadpool.h"
 #include "common/common_test.h"
+#include "src/common/log_adapter.h"
 #include "schema/model_generated.h"
 
 namespace mindspore {
@@ -158,4 +164,161 @@ TEST_F(LiteMindRtTest, ActorThreadPoolTest) {
   }
 }
 
+class RelayActor : public ActorBase {
+ public:
+  RelayActor(const std::string &nm, ActorThreadPool *pool, std::atomic_int *processed, std::atomic_int *finished)
+      : ActorBase(nm, pool), processed_(processed), finished_(finished) {}
+  void set_next(const AID &next) { next_ = next; }
+  void Relay(int hops) {
+    (void)++(*processed_);
+    if (hops > 0) {
+      Async(next_, &RelayActor::Relay, hops - 1);
+    } else {
+      (void)++(*finished_);
+    }
+  }
+
+ private:
+  AID next_;
+  std::atomic_int *processed_;
+  std::atomic_int *finished_;
+};
+
+TEST_F(LiteMindRtTest, ActorThreadPoolWorkStealingTest) {
+  Initialize("", "", "", "", 1);
+  constexpr size_t kThreadNum = 4;
+  constexpr int kActorNum = 100;
+  constexpr int kHops = 50;
+  constexpr auto kTimeout = std::chrono::seconds(60);
+  auto pool = ActorThreadPool::CreateThreadPool(kThreadNum);
+  ASSERT_NE(pool, nullptr);
+  std::vector<AID> actors;
+  for (int i = 0; i < kActorNum; i++) {
+    actors.emplace_back(Spawn(ActorReference(new TestActor("stealing_" + std::to_string(i), pool, i))));
+  }
+
+  std::vector<std::unique_ptr<int>> vals;
+  std::vector<Future<int>> fv;
+  std::vector<int> expected;
+  auto send = [&](size_t round) {
+    for (int i = 0; i < kActorNum; i++) {
+      vals.emplace_back(std::make_unique<int>(round));
+      int *val = vals.back().get();
+      Future<int> ret;
+      ret = Async(actors[i], &TestActor::Fn1, val).Then(Defer(actors[i], &TestActor::Fn2, val), ret);
+      fv.emplace_back(ret);
+      expected.emplace_back(i + round + 1);
+    }
+  };
+  // The messages sent before the work stealing is enabled may still be in the global queue, which is drained after.
+  constexpr size_t kRounds = 20;
+  for (size_t round = 0; round < kRounds / 2; round++) {
+    send(round);
+  }
+  ASSERT_EQ(pool->EnableWorkStealing(), THREAD_OK);
+  ASSERT_TRUE(pool->work_stealing());
+  for (size_t round = kRounds / 2; round < kRounds; round++) {
+    send(round);
+  }
+  for (size_t i = 0; i < fv.size(); i++) {
+    ASSERT_EQ(fv[i].Get(), expected[i]);
+  }
+
+  // The actors of a ring push each other to the queue of their own worker, the idle workers have to steal them.
+  std::atomic_int processed{0};
+  std::atomic_int finished{0};
+  std::vector<std::shared_ptr<RelayActor>> relays;
+  std::vector<AID> relay_aids;
+  for (int i = 0; i < kActorNum; i++) {
+    auto relay = std::make_shared<RelayActor>("stealing_relay_" + std::to_string(i), pool, &processed, &finished);
+    relays.emplace_back(relay);
+    relay_aids.emplace_back(Spawn(relay));
+  }
+  for (int i = 0; i < kActorNum; i++) {
+    relays[i]->set_next(relay_aids[(i + 1) % kActorNum]);
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (const auto &aid : relay_aids) {
+    Async(aid, &RelayActor::Relay, kHops);
+  }
+  while (finished < kActorNum && std::chrono::steady_clock::now() - start < kTimeout) {
+    std::this_thread::yield();
+  }
+  ASSERT_EQ(finished.load(), kActorNum);
+  ASSERT_EQ(processed.load(), kActorNum * (kHops + 1));
+
+  for (const auto &aid : actors) {
+    Terminate(aid);
+  }
+  for (const auto &aid : relay_aids) {
+    Terminate(aid);
+  }
+  for (const auto &aid : actors) {
+    Await(aid);
+  }
+  for (const auto &aid : relay_aids) {
+    Await(aid);
+  }
+  delete pool;
+  Finalize();
+}
+
+// Measure the message throughput of the actor ring with the global actor queue and the work stealing, with 1, 2, 4 up
+// to all the cores threads, run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*ActorThreadPoolWorkStealingBenchmark
+TEST_F(LiteMindRtTest, DISABLED_ActorThreadPoolWorkStealingBenchmark) {
+  Initialize("", "", "", "", 1);
+  constexpr int kActorNum = 1000;
+  constexpr int kHops = 200;
+  constexpr auto kTimeout = std::chrono::seconds(60);
+  size_t max_thread_num = std::max(std::thread::hardware_concurrency(), 1U);
+  std::vector<size_t> thread_nums;
+  for (size_t thread_num = 1; thread_num < max_thread_num; thread_num *= 2) {
+    thread_nums.push_back(thread_num);
+  }
+  thread_nums.push_back(max_thread_num);
+  for (size_t thread_num : thread_nums) {
+    for (bool work_stealing : {false, true}) {
+      auto pool = ActorThreadPool::CreateThreadPool(thread_num);
+      ASSERT_NE(pool, nullptr);
+      if (work_stealing) {
+        ASSERT_EQ(pool->EnableWorkStealing(), THREAD_OK);
+      }
+      std::atomic_int processed{0};
+      std::atomic_int finished{0};
+      std::vector<std::shared_ptr<RelayActor>> actors;
+      std::vector<AID> aids;
+      for (int i = 0; i < kActorNum; i++) {
+        auto actor = std::make_shared<RelayActor>("relay_" + std::to_string(i), pool, &processed, &finished);
+        actors.emplace_back(actor);
+        aids.emplace_back(Spawn(actor));
+      }
+      for (int i = 0; i < kActorNum; i++) {
+        actors[i]->set_next(aids[(i + 1) % kActorNum]);
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      for (const auto &aid : aids) {
+        Async(aid, &RelayActor::Relay, kHops);
+      }
+      while (finished < kActorNum && std::chrono::steady_clock::now() - start < kTimeout) {
+        std::this_thread::yield();
+      }
+      auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      EXPECT_EQ(finished.load(), kActorNum);
+      EXPECT_EQ(processed.load(), kActorNum * (kHops + 1));
+      MS_LOG(INFO) << "thread num: " << thread_num << ", work stealing: " << work_stealing
+                   << ", messages per second: " << kActorNum * (kHops + 1) / cost;
+
+      for (const auto &aid : aids) {
+        Terminate(aid);
+      }
+      for (const auto &aid : aids) {
+        Await(aid);
+      }
+      delete pool;
+    }
+  }
+  Finalize();
+}
 }  // namespace mindspore
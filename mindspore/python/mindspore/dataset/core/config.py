@@ -797,3 +797,446 @@ def get_dynamic_shape():
         >>> is_dynamic_shape = ds.config.get_dynamic_shape()
     """
     return _config.get_dynamic_shape()
+
+
+def set_enable_mmap_read(enable):
+    """
+    Set the flag of reading dataset files through memory mapping. When enabled, MindRecordDataset maps each
+    MindRecord file once and decodes samples directly from the mapped pages instead of issuing a read system call and
+    copying every sample. If a file can not be mapped, the reading falls back to file streams.
+
+    Note:
+        `set_enable_mmap_read` is not supported on Windows platform yet.
+
+    Args:
+        enable (bool): Whether to read dataset files through memory mapping. Default: False.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> ds.config.set_enable_mmap_read(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_mmap_read(enable)
+
+
+def get_enable_mmap_read():
+    """
+    Get the flag of reading dataset files through memory mapping.
+
+    Returns:
+        bool, whether dataset files are read through memory mapping.
+
+    Examples:
+        >>> mmap_read = ds.config.get_enable_mmap_read()
+    """
+    return _config.get_enable_mmap_read()
+
+
+def set_enable_lock_free_queue(enable):
+    """
+    Set the flag of passing rows through lock free queues. When enabled, the queues between an operator and its
+    parallel workers, and the connectors between operators, are single-producer single-consumer ring buffers which
+    don't take a mutex for every row. A thread spins for a short while on a full or an empty queue before it goes to
+    sleep. The order of the rows is the same as with the default queues.
+
+    Args:
+        enable (bool): Whether to pass rows through lock free queues. Default: False.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> ds.config.set_enable_lock_free_queue(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_lock_free_queue(enable)
+
+
+def get_enable_lock_free_queue():
+    """
+    Get the flag of passing rows through lock free queues.
+
+    Returns:
+        bool, whether rows are passed through lock free queues.
+
+    Examples:
+        >>> lock_free_queue = ds.config.get_enable_lock_free_queue()
+    """
+    return _config.get_enable_lock_free_queue()
+
+
+def set_op_connector_chunk_size(chunk_size):
+    """
+    Set the initial number of rows moved through the connector of an operator in one operation. With a chunk size
+    larger than 1, an operator takes up to `chunk_size` ready rows from its child in one go, which saves most of the
+    synchronization when a pipeline produces many small rows. The order of the rows doesn't change. If AutoTune is
+    enabled, it may increase the chunk size of the operators at runtime.
+
+    Args:
+        chunk_size (int): The number of rows moved in one operation. Default: 1.
+
+    Raises:
+        TypeError: If `chunk_size` is not of type int.
+        ValueError: If `chunk_size` <= 0 or `chunk_size` > INT32_MAX(2147483647).
+
+    Examples:
+        >>> ds.config.set_op_connector_chunk_size(8)
+    """
+    if not isinstance(chunk_size, int) or isinstance(chunk_size, bool):
+        raise TypeError("chunk_size must be of type int.")
+    if chunk_size <= 0 or chunk_size > INT32_MAX:
+        raise ValueError("chunk_size exceeds the boundary between 0 and {}.".format(INT32_MAX))
+    _config.set_op_connector_chunk_size(chunk_size)
+
+
+def get_op_connector_chunk_size():
+    """
+    Get the initial number of rows moved through the connector of an operator in one operation.
+
+    Returns:
+        int, the chunk size.
+
+    Examples:
+        >>> chunk_size = ds.config.get_op_connector_chunk_size()
+    """
+    return _config.get_op_connector_chunk_size()
+
+
+def set_enable_tensor_mem_pool(enable):
+    """
+    Set the flag of allocating tensor memory from a per-pipeline memory pool. When enabled, each pipeline keeps the
+    buffers of the tensors it frees in size classes and reuses them for new tensors instead of going back to the
+    system allocator for every row. The memory held by the pool is capped by `set_tensor_mem_pool_limit`.
+
+    Args:
+        enable (bool): Whether to allocate tensor memory from a per-pipeline memory pool. Default: False.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> ds.config.set_enable_tensor_mem_pool(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_tensor_mem_pool(enable)
+
+
+def get_enable_tensor_mem_pool():
+    """
+    Get the flag of allocating tensor memory from a per-pipeline memory pool.
+
+    Returns:
+        bool, whether tensor memory is allocated from a per-pipeline memory pool.
+
+    Examples:
+        >>> tensor_mem_pool = ds.config.get_enable_tensor_mem_pool()
+    """
+    return _config.get_enable_tensor_mem_pool()
+
+
+def set_tensor_mem_pool_limit(limit):
+    """
+    Set the maximum size in MB of the memory held by the tensor memory pool of a pipeline, including the buffers in
+    use and the buffers kept for reuse. A buffer freed while the pool is above the limit is returned to the system.
+
+    Args:
+        limit (int): The maximum size in MB of the memory held by the pool. Default: 4096.
+
+    Raises:
+        TypeError: If `limit` is not of type int.
+        ValueError: If `limit` <= 0 or `limit` > INT32_MAX(2147483647).
+
+    Examples:
+        >>> ds.config.set_tensor_mem_pool_limit(1024)
+    """
+    if not isinstance(limit, int) or isinstance(limit, bool):
+        raise TypeError("limit must be of type int.")
+    if limit <= 0 or limit > INT32_MAX:
+        raise ValueError("limit exceeds the boundary between 0 and {}.".format(INT32_MAX))
+    _config.set_tensor_mem_pool_limit(limit)
+
+
+def get_tensor_mem_pool_limit():
+    """
+    Get the maximum size in MB of the memory held by the tensor memory pool of a pipeline.
+
+    Returns:
+        int, the limit in MB.
+
+    Examples:
+        >>> limit = ds.config.get_tensor_mem_pool_limit()
+    """
+    return _config.get_tensor_mem_pool_limit()
+
+
+def set_enable_inplace_batch(enable):
+    """
+    Set the flag of building batches in place. When enabled, and a `batch` operation with a fixed batch size and
+    without `per_batch_map` or padding follows right after a `map` operation, the map workers move each output row
+    straight into its slot of a preallocated batch, and the batch operation returns these buffers as the batch
+    instead of copying every row into a new one. The content and the order of the batches don't change.
+
+    Args:
+        enable (bool): Whether to build batches in place. Default: False.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> ds.config.set_enable_inplace_batch(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_inplace_batch(enable)
+
+
+def get_enable_inplace_batch():
+    """
+    Get the flag of building batches in place.
+
+    Returns:
+        bool, whether batches are built in place.
+
+    Examples:
+        >>> inplace_batch = ds.config.get_enable_inplace_batch()
+    """
+    return _config.get_enable_inplace_batch()
+
+
+_NUMA_POLICIES = {"none": 0, "device": 1, "balanced": 2}
+
+
+def set_numa_policy(policy):
+    """
+    Set the policy used to place the threads of the operations of a pipeline on the NUMA nodes of the host. Every
+    thread of an operation is restricted to the CPUs of the node of the operation, and allocates its memory from that
+    node first, so the data produced by an operation stays on the node it was computed on. It takes effect on Linux
+    only, for the pipelines launched after this call.
+
+    - 'none': the operating system places the threads.
+    - 'device': all the operations run on the NUMA node the training device is attached to. When it can't be found,
+      the node is chosen from the rank id, and nothing is bound if the rank id is not set either.
+    - 'balanced': the operations are spread over the nodes according to their number of workers, the ones closest to
+      the device run on the node of the device.
+
+    Args:
+        policy (str): The NUMA policy, one of 'none', 'device' and 'balanced'. Default: 'none'.
+
+    Raises:
+        TypeError: If `policy` is not of type str.
+        ValueError: If `policy` is not one of 'none', 'device' and 'balanced'.
+
+    Examples:
+        >>> ds.config.set_numa_policy('device')
+    """
+    if not isinstance(policy, str):
+        raise TypeError("policy must be of type str.")
+    if policy not in _NUMA_POLICIES:
+        raise ValueError("policy must be one of 'none', 'device' and 'balanced', but got {}.".format(policy))
+    _config.set_numa_policy(_NUMA_POLICIES[policy])
+
+
+def get_numa_policy():
+    """
+    Get the policy used to place the threads of the operations of a pipeline on the NUMA nodes of the host.
+
+    Returns:
+        str, the NUMA policy, one of 'none', 'device' and 'balanced'.
+
+    Examples:
+        >>> numa_policy = ds.config.get_numa_policy()
+    """
+    policy = _config.get_numa_policy()
+    for name, value in _NUMA_POLICIES.items():
+        if value == policy:
+            return name
+    raise RuntimeError("Unknown NUMA policy {} in the config.".format(policy))
+
+
+def set_enable_tfrecord_record_split(enable):
+    """
+    Set the flag of splitting TFRecord files at record boundaries. When enabled, every file read by a
+    `TFRecordDataset` is cut into up to `num_parallel_workers` blocks of consecutive records, each read by a different
+    worker, so that a few large files are read as fast as many small ones. The record offsets of a file are indexed
+    the first time it is read. The rows are the same, but they are interleaved in a different order than when each
+    worker reads whole files.
+
+    Args:
+        enable (bool): Whether to split TFRecord files into blocks of records. Default: False.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> ds.config.set_enable_tfrecord_record_split(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_tfrecord_record_split(enable)
+
+
+def get_enable_tfrecord_record_split():
+    """
+    Get the flag of splitting TFRecord files at record boundaries.
+
+    Returns:
+        bool, whether TFRecord files are split into blocks of records.
+
+    Examples:
+        >>> record_split = ds.config.get_enable_tfrecord_record_split()
+    """
+    return _config.get_enable_tfrecord_record_split()
+
+
+def set_enable_tfrecord_record_shuffle(enable):
+    """
+    Set the flag of shuffling TFRecord files by blocks of records. When enabled, a `TFRecordDataset` with
+    `shuffle=Shuffle.GLOBAL` indexes the record offsets of its files, cuts them into blocks of 64 consecutive records,
+    and reads the blocks of all the files in a random order, each one with its records in a random order. This gives
+    a shuffle close to a global one without the shuffle buffer, whose memory grows with the quality of the shuffle,
+    at the cost of reading the files at random places. The index keeps one offset every 64 records.
+
+    Args:
+        enable (bool): Whether to shuffle TFRecord files by blocks of records. Default: False.
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> ds.config.set_enable_tfrecord_record_shuffle(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_tfrecord_record_shuffle(enable)
+
+
+def get_enable_tfrecord_record_shuffle():
+    """
+    Get the flag of shuffling TFRecord files by blocks of records.
+
+    Returns:
+        bool, whether TFRecord files are shuffled by blocks of records.
+
+    Examples:
+        >>> record_shuffle = ds.config.get_enable_tfrecord_record_shuffle()
+    """
+    return _config.get_enable_tfrecord_record_shuffle()
+
+
+_MAX_ASYNC_READ_DEPTH = 256
+
+
+def set_async_read_depth(depth):
+    """
+    Set the number of files a dataset which reads one file per row keeps reading ahead of its workers, such as
+    `ImageFolderDataset` and `CocoDataset`. The files are read in the order the sampler gives the rows, by as many
+    threads as the depth, so that the latency of the storage is not paid by the workers. When AutoTune is enabled, it
+    raises the depth while the dataset can't keep its output queue full. It takes effect for the pipelines launched
+    after this call.
+
+    Args:
+        depth (int): The number of file reads kept in flight, 0 to read the files in the workers. Default: 0.
+
+    Raises:
+        TypeError: If `depth` is not of type int.
+        ValueError: If `depth` < 0 or `depth` > 256.
+
+    Examples:
+        >>> ds.config.set_async_read_depth(16)
+    """
+    if not isinstance(depth, int) or isinstance(depth, bool):
+        raise TypeError("depth must be of type int.")
+    if depth < 0 or depth > _MAX_ASYNC_READ_DEPTH:
+        raise ValueError("depth given is not within the required range [0, {}].".format(_MAX_ASYNC_READ_DEPTH))
+    _config.set_async_read_depth(depth)
+
+
+def get_async_read_depth():
+    """
+    Get the number of files a dataset which reads one file per row keeps reading ahead of its workers.
+
+    Returns:
+        int, the number of file reads kept in flight, 0 if the files are read in the workers.
+
+    Examples:
+        >>> read_depth = ds.config.get_async_read_depth()
+    """
+    return _config.get_async_read_depth()
+
+
+def set_read_ahead_window(window):
+    """
+    Set the number of rows past the one sent to the workers whose files a dataset keeps reading ahead, when
+    `set_async_read_depth` is enabled. The rows are taken from the sample ids the sampler has produced for the epoch,
+    so the reads of a random permutation are issued well before the workers get to them. The files read ahead are
+    bounded by `set_read_ahead_memory_limit`. It takes effect for the pipelines launched after this call.
+
+    Args:
+        window (int): The number of rows read ahead, 0 to read the file of a row when it is sent to a worker.
+            Default: 0.
+
+    Raises:
+        TypeError: If `window` is not of type int.
+        ValueError: If `window` < 0 or `window` > INT32_MAX(2147483647).
+
+    Examples:
+        >>> ds.config.set_read_ahead_window(256)
+    """
+    if not isinstance(window, int) or isinstance(window, bool):
+        raise TypeError("window must be of type int.")
+    if window < 0 or window > INT32_MAX:
+        raise ValueError("window exceeds the boundary between 0 and {}.".format(INT32_MAX))
+    _config.set_read_ahead_window(window)
+
+
+def get_read_ahead_window():
+    """
+    Get the number of rows past the one sent to the workers whose files a dataset keeps reading ahead.
+
+    Returns:
+        int, the number of rows read ahead.
+
+    Examples:
+        >>> window = ds.config.get_read_ahead_window()
+    """
+    return _config.get_read_ahead_window()
+
+
+def set_read_ahead_memory_limit(limit):
+    """
+    Set the maximum size in MB of the files a dataset holds after reading them ahead of its workers. No read is
+    started while the limit is reached, the workers then read the files of their rows themselves.
+
+    Args:
+        limit (int): The maximum size in MB of the files read ahead. Default: 512.
+
+    Raises:
+        TypeError: If `limit` is not of type int.
+        ValueError: If `limit` <= 0 or `limit` > INT32_MAX(2147483647).
+
+    Examples:
+        >>> ds.config.set_read_ahead_memory_limit(1024)
+    """
+    if not isinstance(limit, int) or isinstance(limit, bool):
+        raise TypeError("limit must be of type int.")
+    if limit <= 0 or limit > INT32_MAX:
+        raise ValueError("limit exceeds the boundary between 0 and {}.".format(INT32_MAX))
+    _config.set_read_ahead_memory_limit(limit)
+
+
+def get_read_ahead_memory_limit():
+    """
+    Get the maximum size in MB of the files a dataset holds after reading them ahead of its workers.
+
+    Returns:
+        int, the limit in MB.
+
+    Examples:
+        >>> limit = ds.config.get_read_ahead_memory_limit()
+    """
+    return _config.get_read_ahead_memory_limit()
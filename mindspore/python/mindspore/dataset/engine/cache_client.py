@@ -39,6 +39,9 @@ class DatasetCache:
         num_connections (int, optional): Number of tcp/ip connections (default=None, use default value 12).
         prefetch_size (int, optional): The size of the cache queue between operations
             (default=None, use default value 20).
+        compress (bool, optional): Whether or not to compress the rows in the cache (default=False). The rows are
+            compressed and decompressed by the client with a fast codec, which saves cache memory at the cost of
+            some CPU time. The compression ratio and time are reported by `get_stat`.
 
     Examples:
             >>> import mindspore.dataset as ds
@@ -52,7 +55,7 @@ class DatasetCache:
     """
 
     def __init__(self, session_id, size=0, spilling=False, hostname=None, port=None, num_connections=None,
-                 prefetch_size=None):
+                 prefetch_size=None, compress=False):
         check_pos_uint32(session_id, "session_id")
         type_check(size, (int,), "size")
         if size != 0:
@@ -68,6 +71,7 @@ class DatasetCache:
             check_pos_int32(num_connections, "num_connections")
         if prefetch_size is not None:
             check_pos_int32(prefetch_size, "prefetch_size")
+        type_check(compress, (bool,), "compress")
 
         self.session_id = session_id
         self.size = size
@@ -76,7 +80,9 @@ class DatasetCache:
         self.port = port
         self.prefetch_size = prefetch_size
         self.num_connections = num_connections
-        self.cache_client = CacheClient(session_id, size, spilling, hostname, port, num_connections, prefetch_size)
+        self.compress = compress
+        self.cache_client = CacheClient(session_id, size, spilling, hostname, port, num_connections, prefetch_size,
+                                        compress)
 
     def get_stat(self):
         """Get the statistics from a cache."""
@@ -95,5 +101,6 @@ class DatasetCache:
         new_cache.port = copy.deepcopy(self.port, memodict)
         new_cache.prefetch_size = copy.deepcopy(self.prefetch_size, memodict)
         new_cache.num_connections = copy.deepcopy(self.num_connections, memodict)
+        new_cache.compress = copy.deepcopy(self.compress, memodict)
         new_cache.cache_client = self.cache_client
         return new_cache
@@ -128,6 +128,41 @@ def _reset_training_dataset(step):
         raise RuntimeError("Training dataset is not set.")
 
 
+def _save_training_dataset_state(step):
+    """
+    Save the state of the training dataset after the given step number.
+
+    The state holds the seeds and the orders the operators had at the start of the epoch of the step. The rows in
+    flight, like the ones in the shuffle buffer, are not saved. _restore_training_dataset skips the rows of the epoch
+    before the step like _reset_training_dataset does. A pipeline with a shuffle operation still replays the epoch of
+    the step: its rows before the step are read and processed again, then dropped.
+
+    Args:
+        step (int): Global step number.
+
+    Returns:
+        str, the state to give to _restore_training_dataset.
+    """
+    dataset = _get_training_dataset()
+    if dataset is None:
+        raise RuntimeError("Training dataset is not set.")
+    return dataset._save_state(step)  # pylint: disable=W0212
+
+
+def _restore_training_dataset(state):
+    """
+    Restore the training dataset to a state saved by _save_training_dataset_state.
+
+    Args:
+        state (str): State of the training dataset.
+    """
+    dataset = _get_training_dataset()
+    if dataset is not None:
+        dataset._restore(state)  # pylint: disable=W0212
+    else:
+        raise RuntimeError("Training dataset is not set.")
+
+
 class Shuffle(str, Enum):
     """Specify the shuffle mode.
 
@@ -3690,6 +3725,12 @@ class _ToDevice:
     def _reset(self, step):
         self._to_device.Reset(step)
 
+    def _save_state(self, step):
+        return self._to_device.SaveState(step)
+
+    def _restore(self, state):
+        self._to_device.Restore(state)
+
     def stop_send(self):
         """
         send stop send signal to pipeline, it is used when end of sequence is sent at the epoch end.
@@ -3803,6 +3844,16 @@ class TransferDataset(Dataset):
             logger.info("Reset the dataset pipeline to step " + str(step))
             self._to_device._reset(step)  # pylint: disable=W0212
 
+    def _save_state(self, step):
+        if self._to_device is None:
+            raise RuntimeError("Calling _save_state with bad state.")
+        return self._to_device._save_state(step)  # pylint: disable=W0212
+
+    def _restore(self, state):
+        if self._to_device is not None:
+            logger.info("Restore the dataset pipeline to a saved state.")
+            self._to_device._restore(state)  # pylint: disable=W0212
+
     def get_data_info(self):
         """
         Get type and shape of current batch
@@ -29,7 +29,7 @@ from mindspore._c_dataengine import OutputFormat as Format
 from .validators import check_gnn_graphdata, check_gnn_get_all_nodes, check_gnn_get_all_edges, \
     check_gnn_get_nodes_from_edges, check_gnn_get_edges_from_nodes, check_gnn_get_all_neighbors, \
     check_gnn_get_sampled_neighbors, check_gnn_get_neg_sampled_neighbors, check_gnn_get_node_feature, \
-    check_gnn_get_edge_feature, check_gnn_random_walk
+    check_gnn_get_edge_feature, check_gnn_random_walk, check_gnn_save_graph
 
 
 class SamplingStrategy(IntEnum):
@@ -79,7 +79,8 @@ class GraphData:
     master/advanced/dataset/augment_graph_data.html>`_.
 
     Args:
-        dataset_file (str): One of file names in the dataset.
+        dataset_file (str): One of file names in the dataset, or a graph file written by `save_graph`,
+            which is loaded much faster.
         num_parallel_workers (int, optional): Number of workers to process the dataset in parallel
             (default=None).
         working_mode (str, optional): Set working mode, now supports 'local'/'client'/'server' (default='local').
@@ -521,3 +522,23 @@ class GraphData:
             raise Exception("This method is not supported when working mode is server.")
         return self._graph_data.random_walk(target_nodes, meta_path, step_home_param, step_away_param,
                                             default_node).as_array()
+
+    @check_gnn_save_graph
+    def save_graph(self, file_name):
+        """
+        Save the graph to a file in its in-memory layout. The file can then be given as `dataset_file`, the graph
+        is mapped into memory from it rather than loaded from the dataset.
+
+        Args:
+            file_name (str): Path of the graph file to write.
+
+        Examples:
+            >>> graph_dataset.save_graph("/path/to/graph_file")
+
+        Raises:
+            TypeError: If `file_name` is not of type str.
+            RuntimeError: If the working mode is not 'local', or the file can't be written.
+        """
+        if self._working_mode != 'local':
+            raise Exception("This method is only supported when working mode is local.")
+        self._graph_data.save_graph(file_name)
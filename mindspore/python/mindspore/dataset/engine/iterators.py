@@ -177,6 +177,30 @@ class Iterator:
         """
         self._iterator.Reset(step)
 
+    def _save_state(self, step):
+        """
+        Save the state of the pipeline after the given step number, to resume from it with _restore. The rows in
+        flight, like the ones in the shuffle buffer, are not saved, so a pipeline with a shuffle operation still
+        replays the epoch of the step: _restore reads and processes its rows before the step again, then drops them.
+
+        Args:
+            step (int): Global step number.
+
+        Returns:
+            str, the state of the pipeline.
+        """
+        return self._iterator.SaveState(step)
+
+    def _restore(self, state):
+        """
+        Reset the iterator to the state returned by _save_state. The epoch of the state is read in the same order,
+        and the rows before its step are dropped.
+
+        Args:
+            state (str): State of the pipeline.
+        """
+        self._iterator.Restore(state)
+
     def _transform_md_to_output(self, t):
         if self._output_numpy:
             return t.as_array()
@@ -1982,6 +1982,19 @@ def check_gnn_random_walk(method):
     return new_method
 
 
+def check_gnn_save_graph(method):
+    """A wrapper that wraps a parameter checker around the GNN `save_graph` function."""
+
+    @wraps(method)
+    def new_method(self, *args, **kwargs):
+        [file_name], _ = parse_user_args(method, *args, **kwargs)
+        type_check(file_name, (str,), "file_name")
+
+        return method(self, *args, **kwargs)
+
+    return new_method
+
+
 def check_aligned_list(param, param_name, member_type):
     """Check whether the structure of each member of the list is the same."""
 
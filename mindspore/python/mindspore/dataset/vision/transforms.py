@@ -62,13 +62,13 @@ from .py_transforms_util import is_pil
 from .utils import AutoAugmentPolicy, Border, ConvertMode, ImageBatchFormat, Inter, SliceMode, parse_padding
 from .validators import check_adjust_gamma, check_alpha, check_auto_augment, check_auto_contrast, \
     check_bounding_box_augment_cpp, check_center_crop, check_convert_color, check_crop, check_cut_mix_batch_c, \
-    check_cutout_new, check_decode, check_five_crop, check_gaussian_blur, check_hsv_to_rgb, check_linear_transform, \
-    check_mix_up, check_mix_up_batch_c, check_normalize, check_normalizepad, check_num_channels, check_pad, \
-    check_pad_to_size, check_positive_degrees, check_posterize, check_prob, check_random_adjust_sharpness, \
-    check_random_affine, check_random_auto_contrast, check_random_color_adjust, check_random_crop, \
-    check_random_erasing, check_random_perspective, check_random_resize_crop, check_random_rotation, \
-    check_random_select_subpolicy_op, check_random_solarize, check_range, check_rescale, check_resize, \
-    check_resize_interpolation, check_rgb_to_hsv, check_rotate, check_slice_patches, check_ten_crop, \
+    check_cutout_new, check_decode, check_five_crop, check_fused_normalize, check_gaussian_blur, check_hsv_to_rgb, \
+    check_linear_transform, check_mix_up, check_mix_up_batch_c, check_normalize, check_normalizepad, \
+    check_num_channels, check_pad, check_pad_to_size, check_positive_degrees, check_posterize, check_prob, \
+    check_random_adjust_sharpness, check_random_affine, check_random_auto_contrast, check_random_color_adjust, \
+    check_random_crop, check_random_erasing, check_random_perspective, check_random_resize_crop, \
+    check_random_rotation, check_random_select_subpolicy_op, check_random_solarize, check_range, check_rescale, \
+    check_resize, check_resize_interpolation, check_rgb_to_hsv, check_rotate, check_slice_patches, check_ten_crop, \
     check_uniform_augment, check_to_tensor, FLOAT_MAX_INTEGER
 from ..core.datatypes import mstype_to_detype, nptype_to_detype
 from ..transforms.py_transforms_util import Implementation
@@ -721,6 +721,68 @@ class FiveCrop(PyTensorOperation):
         return util.five_crop(img, self.size)
 
 
+class FusedNormalize(ImageTensorOperation):
+    """
+    Rescale and normalize the input image with respect to mean and standard deviation, cast it and convert it from
+    shape <H, W, C> to shape <C, H, W> in a single pass.
+
+    The output is the one of :class:`mindspore.dataset.vision.Rescale`, :class:`mindspore.dataset.vision.Normalize`,
+    :class:`mindspore.dataset.transforms.TypeCast` and :class:`mindspore.dataset.vision.HWC2CHW` applied one after
+    the other, up to the rounding of the rescale. A uint8 image is processed with the vector instructions the CPU
+    supports (AVX2, AVX-512 or NEON), which avoids building the intermediate images of the chain.
+
+    Args:
+        mean (sequence): List or tuple of mean values for each channel, with respect to channel order.
+            The mean values must be in range [0.0, 255.0].
+        std (sequence): List or tuple of standard deviations for each channel, with respect to channel order.
+            The standard deviation values must be in range (0.0, 255.0].
+        rescale (float, optional): Rescale factor applied before the normalization. Default: 1.0.
+        shift (float, optional): Shift factor applied before the normalization. Default: 0.0.
+        dtype (str, optional): Set the output data type of normalized image, "float32" or "float16".
+            Default: "float32".
+        hwc_to_chw (bool, optional): Whether to convert the output from <H, W, C> to <C, H, W>. Default: True.
+
+    Raises:
+        TypeError: If `mean` is not of type sequence.
+        TypeError: If `std` is not of type sequence.
+        TypeError: If `rescale` is not of type number.
+        TypeError: If `shift` is not of type number.
+        TypeError: If `dtype` is not of type string.
+        TypeError: If `hwc_to_chw` is not of type bool.
+        ValueError: If `mean` is not in range [0.0, 255.0].
+        ValueError: If `std` is not in range (0.0, 255.0].
+        ValueError: If `dtype` is not "float32" or "float16".
+        RuntimeError: If given tensor shape is not <H, W> or <H, W, C>.
+
+    Supported Platforms:
+        ``CPU``
+
+    Examples:
+        >>> decode_op = vision.Decode()
+        >>> fused_normalize_op = vision.FusedNormalize(mean=[0.485, 0.456, 0.406],
+        ...                                            std=[0.229, 0.224, 0.225],
+        ...                                            rescale=1.0 / 255.0)
+        >>> transforms_list = [decode_op, fused_normalize_op]
+        >>> image_folder_dataset = image_folder_dataset.map(operations=transforms_list,
+        ...                                                 input_columns=["image"])
+    """
+
+    @check_fused_normalize
+    def __init__(self, mean, std, rescale=1.0, shift=0.0, dtype="float32", hwc_to_chw=True):
+        super().__init__()
+        self.mean = mean
+        self.std = std
+        self.rescale = rescale
+        self.shift = shift
+        self.dtype = dtype
+        self.hwc_to_chw = hwc_to_chw
+        self.random = False
+        self.implementation = Implementation.C
+
+    def parse(self):
+        return cde.FusedNormalizeOperation(self.mean, self.std, self.rescale, self.shift, self.dtype, self.hwc_to_chw)
+
+
 class GaussianBlur(ImageTensorOperation):
     """
     Blur input image with the specified Gaussian kernel.
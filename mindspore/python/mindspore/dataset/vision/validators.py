@@ -485,6 +485,28 @@ def check_normalizepad_py(method):
     return new_method
 
 
+def check_fused_normalize(method):
+    """A wrapper that wraps a parameter checker around the original function(fused normalize)."""
+
+    @wraps(method)
+    def new_method(self, *args, **kwargs):
+        [mean, std, rescale, shift, dtype, hwc_to_chw], _ = parse_user_args(method, *args, **kwargs)
+        check_normalize_param(mean, std)
+        type_check(rescale, (numbers.Number,), "rescale")
+        type_check(shift, (numbers.Number,), "shift")
+        check_float32(rescale, "rescale")
+        check_float32(shift, "shift")
+        type_check(hwc_to_chw, (bool,), "hwc_to_chw")
+        if not isinstance(dtype, str):
+            raise TypeError("dtype should be string.")
+        if dtype not in ["float32", "float16"]:
+            raise ValueError("dtype only supports float32 or float16.")
+
+        return method(self, *args, **kwargs)
+
+    return new_method
+
+
 def check_random_crop(method):
     """Wrapper method to check the parameters of random crop."""
 
@@ -0,0 +1,214 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <functional>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/engine/datasetops/source/async_file_reader.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+constexpr int64_t kMemoryLimit = 1024 * 1024;
+}  // namespace
+
+class MindDataTestAsyncFileReader : public UT::Common {
+ public:
+  MindDataTestAsyncFileReader() {}
+
+  // Write num_files small files with distinct contents
+  std::vector<std::string> WriteFiles(int32_t num_files) {
+    std::vector<std::string> paths;
+    for (int32_t i = 0; i < num_files; ++i) {
+      std::string path = "./async_file_reader_test_" + std::to_string(i) + ".bin";
+      std::ofstream fs(path, std::ios::binary | std::ios::trunc);
+      fs << "file " << i;
+      paths.push_back(path);
+    }
+    return paths;
+  }
+
+  void RemoveFiles(const std::vector<std::string> &paths) {
+    for (const auto &path : paths) {
+      (void)remove(path.c_str());
+    }
+  }
+};
+
+/// Feature: AsyncFileReader
+/// Description: Test reading files ahead with 2 IO threads, one row submitted twice
+/// Expectation: Every row is taken with the content of its file, each time it was submitted
+TEST_F(MindDataTestAsyncFileReader, TestReadAhead) {
+  const int32_t num_files = 16;
+  auto paths = WriteFiles(num_files);
+  TaskGroup vg;
+  AsyncFileReader reader(2, kMemoryLimit);
+  EXPECT_OK(reader.Register(&vg));
+  for (int32_t i = 0; i < num_files; ++i) {
+    reader.Submit(i, paths[i]);
+  }
+  reader.Submit(0, paths[0]);
+  for (int32_t i = 0; i < 2; ++i) {
+    EXPECT_OK(vg.CreateAsyncTask("AsyncRead", std::bind(&AsyncFileReader::IoThread, &reader)));
+  }
+  for (int32_t i = 0; i <= num_files; ++i) {
+    int64_t row_id = i % num_files;
+    std::shared_ptr<Tensor> data;
+    bool found = false;
+    EXPECT_OK(reader.Take(row_id, &data, &found));
+    if (!found) {
+      EXPECT_OK(Tensor::CreateFromFile(paths[row_id], &data));
+    }
+    ASSERT_NE(data, nullptr);
+    std::string expected = "file " + std::to_string(row_id);
+    ASSERT_EQ(data->SizeInBytes(), expected.size());
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(data->GetBuffer()), data->SizeInBytes()), expected);
+  }
+  reader.Stop();
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  auto stats = reader.GetStats();
+  EXPECT_EQ(stats.num_ready + stats.num_waited + stats.num_missed, num_files + 1);
+  RemoveFiles(paths);
+}
+
+/// Feature: AsyncFileReader
+/// Description: Test taking rows which were not submitted, or whose reads have not started
+/// Expectation: The rows are not found and are left to the caller, a cancelled read is never done
+TEST_F(MindDataTestAsyncFileReader, TestMiss) {
+  auto paths = WriteFiles(1);
+  TaskGroup vg;
+  AsyncFileReader reader(1, kMemoryLimit);
+  EXPECT_OK(reader.Register(&vg));
+  std::shared_ptr<Tensor> data;
+  bool found = true;
+  EXPECT_OK(reader.Take(0, &data, &found));
+  EXPECT_FALSE(found);
+  // No IO thread is running yet, so the read is still queued.
+  reader.Submit(0, paths[0]);
+  EXPECT_OK(reader.Take(0, &data, &found));
+  EXPECT_FALSE(found);
+  EXPECT_EQ(data, nullptr);
+  EXPECT_OK(vg.CreateAsyncTask("AsyncRead", std::bind(&AsyncFileReader::IoThread, &reader)));
+  reader.Stop();
+  EXPECT_OK(vg.join_all());
+  auto stats = reader.GetStats();
+  EXPECT_EQ(stats.num_missed, 2);
+  EXPECT_EQ(stats.num_ready + stats.num_waited, 0);
+  RemoveFiles(paths);
+}
+
+/// Feature: AsyncFileReader
+/// Description: Test reading files ahead with a memory limit smaller than one file
+/// Expectation: No read is started while a file read ahead is not taken, the next one is read once it is
+TEST_F(MindDataTestAsyncFileReader, TestMemoryLimit) {
+  auto paths = WriteFiles(3);
+  TaskGroup vg;
+  AsyncFileReader reader(2, 1);
+  EXPECT_OK(reader.Register(&vg));
+  for (int32_t i = 0; i < 3; ++i) {
+    reader.Submit(i, paths[i]);
+  }
+  EXPECT_OK(vg.CreateAsyncTask("AsyncRead", std::bind(&AsyncFileReader::IoThread, &reader)));
+  const int64_t file_size = std::string("file 0").size();
+  EXPECT_OK(reader.WaitForReads(1));
+  EXPECT_EQ(reader.GetStats().peak_bytes, file_size);
+  // The first file fills the memory limit until it is taken, so the read of the second one has not started.
+  std::shared_ptr<Tensor> data;
+  bool found = true;
+  EXPECT_OK(reader.Take(1, &data, &found));
+  EXPECT_FALSE(found);
+  EXPECT_OK(reader.Take(0, &data, &found));
+  EXPECT_TRUE(found);
+  // Taking the first file lets the third one be read, or be left to the caller if it has not started yet.
+  EXPECT_OK(reader.Take(2, &data, &found));
+  if (!found) {
+    EXPECT_OK(Tensor::CreateFromFile(paths[2], &data));
+  }
+  EXPECT_EQ(data->SizeInBytes(), file_size);
+  reader.Stop();
+  EXPECT_OK(vg.join_all());
+  auto stats = reader.GetStats();
+  EXPECT_EQ(stats.peak_bytes, file_size);
+  RemoveFiles(paths);
+}
+
+/// Feature: AsyncFileReader
+/// Description: Test setting the read ahead memory limit of the config to a valid limit, then to limits not larger
+///     than 0
+/// Expectation: The valid limit is kept, the other ones are rejected and leave the limit unchanged
+TEST_F(MindDataTestAsyncFileReader, TestConfigMemoryLimit) {
+  auto config_manager = GlobalContext::config_manager();
+  int32_t original_limit = config_manager->read_ahead_memory_limit();
+  EXPECT_OK(config_manager->set_read_ahead_memory_limit(64));
+  EXPECT_ERROR(config_manager->set_read_ahead_memory_limit(0));
+  EXPECT_ERROR(config_manager->set_read_ahead_memory_limit(-1));
+  EXPECT_EQ(config_manager->read_ahead_memory_limit(), 64);
+  EXPECT_OK(config_manager->set_read_ahead_memory_limit(original_limit));
+}
+
+/// Feature: AsyncFileReader
+/// Description: Test resetting the reader with rows read ahead and rows still queued, then capping the depth by the
+///     memory limit
+/// Expectation: The rows are dropped and no longer found, the memory they held is released, and the depth is the
+///     number of files which fit in the memory limit
+TEST_F(MindDataTestAsyncFileReader, TestReset) {
+  const int32_t num_files = 4;
+  auto paths = WriteFiles(num_files);
+  const int64_t file_size = std::string("file 0").size();
+  TaskGroup vg;
+  AsyncFileReader reader(1, file_size);
+  EXPECT_OK(reader.Register(&vg));
+  EXPECT_EQ(reader.MaxDepthInMemory(8), 8);
+  for (int32_t i = 0; i < num_files; ++i) {
+    reader.Submit(i, paths[i]);
+  }
+  EXPECT_OK(vg.CreateAsyncTask("AsyncRead", std::bind(&AsyncFileReader::IoThread, &reader)));
+  // The memory limit holds one file, the IO thread reads the first one and waits for it to be taken.
+  std::shared_ptr<Tensor> data;
+  bool found = false;
+  EXPECT_OK(reader.Take(0, &data, &found));
+  if (!found) {
+    EXPECT_OK(Tensor::CreateFromFile(paths[0], &data));
+  }
+  reader.Reset();
+  for (int32_t i = 1; i < num_files; ++i) {
+    EXPECT_OK(reader.Take(i, &data, &found));
+    EXPECT_FALSE(found);
+  }
+  EXPECT_EQ(reader.GetStats().num_dropped, num_files - 1);
+  // Nothing is held once the rows are dropped, the next row submitted is read.
+  reader.Submit(0, paths[0]);
+  EXPECT_OK(reader.Take(0, &data, &found));
+  if (!found) {
+    EXPECT_OK(Tensor::CreateFromFile(paths[0], &data));
+  }
+  EXPECT_EQ(data->SizeInBytes(), file_size);
+  reader.Stop();
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  auto stats = reader.GetStats();
+  EXPECT_LE(stats.peak_bytes, file_size);
+  if (stats.num_read > 0) {
+    EXPECT_EQ(reader.MaxDepthInMemory(8), 1);
+  }
+  RemoveFiles(paths);
+}
@@ -16,6 +16,7 @@
 #include <memory>
 #include <string>
 #include "minddata/dataset/core/client.h"
+#include "minddata/dataset/engine/datasetops/batch_slots.h"
 // #include "minddata/dataset/core/pybind_support.h"
 // #include "minddata/dataset/core/tensor.h"
 // #include "minddata/dataset/core/tensor_shape.h"
@@ -136,3 +137,130 @@ TEST_F(MindDataTestBatchOp, DISABLED_TestSimpleBatchPadding) {
     EXPECT_TRUE(rc.IsOk());
   }
 }
+
+/// Feature: BatchSlots
+/// Description: Place rows into their slots and assemble the batch, with a row which doesn't match the first one
+/// Expectation: The batch refers to the slots of the rows, and the batch with a mismatching row is not assembled
+TEST_F(MindDataTestBatchOp, TestBatchSlots) {
+  const int32_t batch_size = 4;
+  BatchSlots slots(batch_size);
+  TensorQTable rows;
+  for (int32_t i = 0; i < batch_size - 1; i++) {
+    std::shared_ptr<Tensor> t;
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{i, i + 1, i + 2}, &t));
+    TensorRow row({t});
+    BatchSlot slot;
+    slot.batch_num = 1;
+    slot.index = i;
+    ASSERT_OK(slots.Place(slot, &row));
+    rows.emplace_back(std::move(row));
+  }
+  TensorRow batched;
+  bool done = false;
+  ASSERT_OK(slots.Assemble(0, 1, rows, &batched, &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(batched.size(), 1);
+  EXPECT_EQ(batched[0]->shape(), TensorShape({batch_size - 1, 3}));
+  EXPECT_EQ(batched[0]->GetBuffer(), rows[0][0]->GetBuffer());
+  for (int32_t i = 0; i < batch_size - 1; i++) {
+    for (int32_t j = 0; j < 3; j++) {
+      int32_t value = 0;
+      ASSERT_OK(batched[0]->GetItemAt(&value, {i, j}));
+      EXPECT_EQ(value, i + j);
+    }
+  }
+  EXPECT_EQ(slots.num_assembled(), 1);
+
+  // The second row of this batch has another shape, it stays where it is and the batch has to be copied.
+  rows.clear();
+  for (int32_t i = 0; i < 2; i++) {
+    std::shared_ptr<Tensor> t;
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>(i + 2, i), &t));
+    TensorRow row({t});
+    BatchSlot slot;
+    slot.batch_num = 2;
+    slot.index = i;
+    ASSERT_OK(slots.Place(slot, &row));
+    rows.emplace_back(std::move(row));
+  }
+  ASSERT_OK(slots.Assemble(0, 2, rows, &batched, &done));
+  EXPECT_FALSE(done);
+  EXPECT_EQ(slots.num_copied(), 1);
+}
+
+/// Feature: BatchSlots
+/// Description: Allocate the tensors of rows through the placement of their slots, and place a row whose tensor was
+///     allocated in the slot of another column
+/// Expectation: The tensors are written in their slots and placed without copy, the misplaced one is moved out of the
+///     slot before the slot is written, and the batch refers to the slots
+TEST_F(MindDataTestBatchOp, TestBatchSlotsPlacement) {
+  const int32_t batch_size = 2;
+  BatchSlots slots(batch_size);
+  // The first batch sets the layout of the next ones: 3 int32 and 2 float32.
+  for (int32_t i = 0; i < batch_size; i++) {
+    std::shared_ptr<Tensor> t0, t1;
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{i, i, i}, &t0));
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<float>{1.0, 2.0}, &t1));
+    TensorRow row({t0, t1});
+    BatchSlot slot;
+    slot.index = i;
+    ASSERT_OK(slots.Place(slot, &row));
+  }
+  slots.Discard(0, 0);
+
+  TensorQTable rows;
+  for (int32_t i = 0; i < batch_size; i++) {
+    BatchSlot slot;
+    slot.batch_num = 1;
+    slot.index = i;
+    BatchSlots::RowPlacement placement(&slots, slot);
+    ASSERT_EQ(Tensor::SetPlacement(&placement), nullptr);
+    std::shared_ptr<Tensor> t0, t1, other;
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{i, i + 1, i + 2}, &t0));
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<float>{0.5, 1.5}, &t1));
+    // The slot of a column is handed out once per row.
+    ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{7, 7, 7}, &other));
+    ASSERT_EQ(Tensor::SetPlacement(nullptr), &placement);
+    TensorRow row({t0, t1});
+    ASSERT_OK(slots.Place(slot, &row));
+    EXPECT_EQ(row[0], t0);
+    EXPECT_EQ(row[1], t1);
+    rows.emplace_back(std::move(row));
+  }
+  TensorRow batched;
+  bool done = false;
+  ASSERT_OK(slots.Assemble(0, 1, rows, &batched, &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(batched.size(), 2);
+  EXPECT_EQ(batched[0]->GetBuffer(), rows[0][0]->GetBuffer());
+  EXPECT_EQ(batched[1]->GetBuffer(), rows[0][1]->GetBuffer());
+  for (int32_t i = 0; i < batch_size; i++) {
+    for (int32_t j = 0; j < 3; j++) {
+      int32_t value = 0;
+      ASSERT_OK(batched[0]->GetItemAt(&value, {i, j}));
+      EXPECT_EQ(value, i + j);
+    }
+  }
+
+  // The tensor allocated in the slot of the first column ends up in the second one, where it doesn't fit.
+  BatchSlot slot;
+  slot.batch_num = 2;
+  BatchSlots::RowPlacement placement(&slots, slot);
+  (void)Tensor::SetPlacement(&placement);
+  std::shared_ptr<Tensor> t0;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{4, 5, 6}, &t0));
+  (void)Tensor::SetPlacement(nullptr);
+  std::shared_ptr<Tensor> other;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{7, 8, 9}, &other));
+  TensorRow row({other, t0});
+  ASSERT_OK(slots.Place(slot, &row));
+  EXPECT_NE(row[1], t0);
+  for (int32_t j = 0; j < 3; j++) {
+    int32_t value = 0;
+    ASSERT_OK(row[0]->GetItemAt(&value, {j}));
+    EXPECT_EQ(value, 7 + j);
+    ASSERT_OK(row[1]->GetItemAt(&value, {j}));
+    EXPECT_EQ(value, 4 + j);
+  }
+  EXPECT_EQ(row[0]->GetBuffer(), t0->GetBuffer());
+}
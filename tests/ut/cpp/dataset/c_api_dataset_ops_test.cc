@@ -2650,6 +2650,54 @@ TEST_F(MindDataTestPipeline, TestBatchDropRepeat) {
   TestBatchRepeat(false, 4, datasets_root_path_);
 }
 
+// Helper function to collect the image batches of ImageFolder + Map + Batch with or without in place batch assembly
+std::vector<std::vector<uint8_t>> CollectInPlaceBatches(bool inplace, bool drop, const std::string &dataset_root) {
+  auto cfg = GlobalContext::config_manager();
+  bool original_inplace = cfg->enable_inplace_batch();
+  cfg->set_enable_inplace_batch(inplace);
+
+  std::string folder_path = dataset_root + "/testPK/data/";
+  std::shared_ptr<Dataset> ds = ImageFolder(folder_path, false, std::make_shared<SequentialSampler>(0, 10));
+  EXPECT_NE(ds, nullptr);
+  ds = ds->Repeat(2);
+  EXPECT_NE(ds, nullptr);
+  auto decode_op = std::make_shared<vision::Decode>();
+  auto resize_op = std::make_shared<vision::Resize>(std::vector<int32_t>{32, 32});
+  ds = ds->Map({decode_op, resize_op}, {"image"});
+  EXPECT_NE(ds, nullptr);
+  ds = ds->Batch(4, drop);
+  EXPECT_NE(ds, nullptr);
+
+  std::vector<std::vector<uint8_t>> batches;
+  std::shared_ptr<Iterator> iter = ds->CreateIterator();
+  EXPECT_NE(iter, nullptr);
+  std::unordered_map<std::string, mindspore::MSTensor> row;
+  EXPECT_OK(iter->GetNextRow(&row));
+  while (row.size() != 0) {
+    auto image = row["image"];
+    auto data = reinterpret_cast<const uint8_t *>(image.Data().get());
+    batches.emplace_back(data, data + image.DataSize());
+    EXPECT_OK(iter->GetNextRow(&row));
+  }
+  iter->Stop();
+  cfg->set_enable_inplace_batch(original_inplace);
+  return batches;
+}
+
+/// Feature: Batch op built in place
+/// Description: Batch the output of Map with and without in place batch assembly, with and without drop remainder
+/// Expectation: The batches are the same in both modes
+TEST_F(MindDataTestPipeline, TestBatchInPlace) {
+  MS_LOG(INFO) << "Doing MindDataTestPipeline-TestBatchInPlace.";
+  for (bool drop : {false, true}) {
+    auto expected = CollectInPlaceBatches(false, drop, datasets_root_path_);
+    auto batches = CollectInPlaceBatches(true, drop, datasets_root_path_);
+    // 10 rows per epoch and 2 epochs, batches of 4 rows with a remainder of 2 rows in each epoch
+    EXPECT_EQ(expected.size(), drop ? 4 : 6);
+    EXPECT_EQ(batches, expected);
+  }
+}
+
 // Feature: Test Map on TFRecord
 // Description: Apply Map with a TensorOp that does noting but swaps input columns with output column
 // Expectation: "Image" column is replaced with "X"
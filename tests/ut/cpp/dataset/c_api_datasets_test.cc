@@ -15,6 +15,7 @@
  */
 #include "common/common.h"
 #include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/core/tensor.h"
 
 using namespace mindspore::dataset;
@@ -319,6 +320,47 @@ TEST_F(MindDataTestPipeline, TestImageFolderFailWithWrongExtensionFail) {
   iter->Stop();
 }
 
+/// Feature: ImageFolderDataset
+/// Description: Test ImageFolderDataset reading its images ahead of the workers, over 2 epochs, with and without a
+///     read ahead window
+/// Expectation: The rows are the same as when the workers read the images
+TEST_F(MindDataTestPipeline, TestImageFolderAsyncRead) {
+  MS_LOG(INFO) << "Doing MindDataTestPipeline-TestImageFolderAsyncRead.";
+
+  auto read_images = [this](int32_t depth, int32_t window, std::vector<std::string> *images) {
+    GlobalContext::config_manager()->set_async_read_depth(depth);
+    GlobalContext::config_manager()->set_read_ahead_window(window);
+    std::string folder_path = datasets_root_path_ + "/testPK/data/";
+    std::shared_ptr<Dataset> ds = ImageFolder(folder_path, false, std::make_shared<SequentialSampler>());
+    EXPECT_NE(ds, nullptr);
+    ds = ds->Repeat(2);
+    EXPECT_NE(ds, nullptr);
+    std::shared_ptr<Iterator> iter = ds->CreateIterator();
+    ASSERT_NE(iter, nullptr);
+    std::unordered_map<std::string, mindspore::MSTensor> row;
+    ASSERT_OK(iter->GetNextRow(&row));
+    while (row.size() != 0) {
+      auto image = row["image"];
+      images->emplace_back(static_cast<const char *>(image.Data().get()), image.DataSize());
+      ASSERT_OK(iter->GetNextRow(&row));
+    }
+    iter->Stop();
+  };
+
+  int32_t original_depth = GlobalContext::config_manager()->async_read_depth();
+  int32_t original_window = GlobalContext::config_manager()->read_ahead_window();
+  std::vector<std::string> expected, images, window_images;
+  read_images(0, 0, &expected);
+  read_images(4, 0, &images);
+  read_images(4, 16, &window_images);
+  GlobalContext::config_manager()->set_async_read_depth(original_depth);
+  GlobalContext::config_manager()->set_read_ahead_window(original_window);
+
+  EXPECT_EQ(expected.size(), 88);
+  EXPECT_EQ(images, expected);
+  EXPECT_EQ(window_images, expected);
+}
+
 /// Feature: ImageFolderDataset
 /// Description: Test ImageFolderDataset Getters method
 /// Expectation: Output is equal to the expected output
@@ -780,6 +780,70 @@ TEST_F(MindDataTestPipeline, TestDecode) {
   iter->Stop();
 }
 
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalize basic usage, with a rescale and a cast to float16
+/// Expectation: The images are normalized to float16 in CHW
+TEST_F(MindDataTestPipeline, TestFusedNormalize) {
+  MS_LOG(INFO) << "Doing MindDataTestPipeline-TestFusedNormalize.";
+
+  // Create an ImageFolder Dataset
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> ds = ImageFolder(folder_path, true, std::make_shared<RandomSampler>(false, 10));
+  EXPECT_NE(ds, nullptr);
+
+  // Create objects for the tensor ops
+  auto fused_normalize = std::make_shared<vision::FusedNormalize>(
+    std::vector<float>{0.485, 0.456, 0.406}, std::vector<float>{0.229, 0.224, 0.225}, 1.0 / 255, 0.0, "float16");
+  // Note: No need to check for output after calling API class constructor
+
+  // Create a Map operation on ds
+  ds = ds->Map({fused_normalize});
+  EXPECT_NE(ds, nullptr);
+
+  // Create an iterator over the result of the above dataset
+  // This will trigger the creation of the Execution Tree and launch it.
+  std::shared_ptr<Iterator> iter = ds->CreateIterator();
+  EXPECT_NE(iter, nullptr);
+
+  // Iterate the dataset and get each row
+  std::unordered_map<std::string, mindspore::MSTensor> row;
+  ASSERT_OK(iter->GetNextRow(&row));
+
+  uint64_t i = 0;
+  while (row.size() != 0) {
+    i++;
+    auto image = row["image"];
+    MS_LOG(INFO) << "Tensor image shape: " << image.Shape();
+    EXPECT_EQ(image.DataType(), mindspore::DataType::kNumberTypeFloat16);
+    EXPECT_EQ(image.Shape(), (std::vector<int64_t>{3, 2268, 4032}));
+    ASSERT_OK(iter->GetNextRow(&row));
+  }
+  EXPECT_EQ(i, 10);
+
+  // Manually terminate the pipeline
+  iter->Stop();
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalize with an output type other than float32 and float16
+/// Expectation: Creating the iterator fails
+TEST_F(MindDataTestPipeline, TestFusedNormalizeFail) {
+  MS_LOG(INFO) << "Doing MindDataTestPipeline-TestFusedNormalizeFail.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> ds = ImageFolder(folder_path, true, std::make_shared<RandomSampler>(false, 1));
+  EXPECT_NE(ds, nullptr);
+
+  auto fused_normalize = std::make_shared<vision::FusedNormalize>(
+    std::vector<float>{121.0, 115.0, 100.0}, std::vector<float>{70.0, 68.0, 71.0}, 1.0, 0.0, "int32");
+  ds = ds->Map({fused_normalize});
+  EXPECT_NE(ds, nullptr);
+
+  // Create an iterator over the result of the above dataset
+  // This will trigger the creation of the Execution Tree and launch it.
+  std::shared_ptr<Iterator> iter = ds->CreateIterator();
+  EXPECT_EQ(iter, nullptr);
+}
+
 /// Feature: HWC2CHW op
 /// Description: Test HWC2CHW basic usage
 /// Expectation: Output is equal to the expected output
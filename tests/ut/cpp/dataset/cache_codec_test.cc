@@ -0,0 +1,113 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/cache/cache_codec.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestCacheCodec : public UT::Common {
+ public:
+  MindDataTestCacheCodec() {}
+
+  // Compress a block and check that it decompresses back to the same bytes
+  void RoundTrip(const std::vector<uint8_t> &src, std::vector<uint8_t> *compressed) {
+    EXPECT_OK(CompressBlock(src.data(), src.size(), compressed));
+    ASSERT_FALSE(compressed->empty());
+    EXPECT_LT(compressed->size(), src.size());
+    std::vector<uint8_t> dest(src.size());
+    EXPECT_OK(DecompressBlock(compressed->data(), compressed->size(), dest.data(), dest.size()));
+    EXPECT_EQ(dest, src);
+  }
+};
+
+/// Feature: Cache codec
+/// Description: Test compressing blocks with runs of bytes, repeated patterns and some random bytes in between
+/// Expectation: The blocks shrink and decompress back to the same bytes
+TEST_F(MindDataTestCacheCodec, TestRoundTrip) {
+  std::vector<uint8_t> compressed;
+  std::vector<uint8_t> zeros(100000, 0);
+  RoundTrip(zeros, &compressed);
+  // A run of the same byte is a single match overlapping itself.
+  EXPECT_LT(compressed.size(), zeros.size() / 100);
+
+  std::vector<uint8_t> pattern(65536);
+  uint32_t seed = 1;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    seed = seed * 1103515245 + 12345;
+    // Half of each 1k block is random, the other half repeats with a period of 13.
+    pattern[i] = (i % 1024 < 512) ? static_cast<uint8_t>(seed >> 16) : static_cast<uint8_t>(i % 13);
+  }
+  RoundTrip(pattern, &compressed);
+}
+
+/// Feature: Cache codec
+/// Description: Test compressing random bytes and blocks too small to compress
+/// Expectation: Nothing is returned, which tells the caller to keep the block as it is
+TEST_F(MindDataTestCacheCodec, TestIncompressible) {
+  std::vector<uint8_t> random(4096);
+  uint32_t seed = 7;
+  for (auto &b : random) {
+    seed = seed * 1103515245 + 12345;
+    b = static_cast<uint8_t>(seed >> 16);
+  }
+  std::vector<uint8_t> compressed(1);
+  EXPECT_OK(CompressBlock(random.data(), random.size(), &compressed));
+  EXPECT_TRUE(compressed.empty());
+  std::vector<uint8_t> tiny(8, 0);
+  EXPECT_OK(CompressBlock(tiny.data(), tiny.size(), &compressed));
+  EXPECT_TRUE(compressed.empty());
+}
+
+/// Feature: Cache codec
+/// Description: Test decompressing a block into a wrong size, and a block cut short
+/// Expectation: Both are detected as corrupted data
+TEST_F(MindDataTestCacheCodec, TestCorrupted) {
+  std::vector<uint8_t> src(10000);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<uint8_t>(i % 7);
+  }
+  std::vector<uint8_t> compressed;
+  EXPECT_OK(CompressBlock(src.data(), src.size(), &compressed));
+  ASSERT_FALSE(compressed.empty());
+  std::vector<uint8_t> dest(src.size() + 1);
+  EXPECT_ERROR(DecompressBlock(compressed.data(), compressed.size(), dest.data(), dest.size()));
+  EXPECT_ERROR(DecompressBlock(compressed.data(), compressed.size() / 2, dest.data(), src.size()));
+}
+
+/// Feature: Cache codec
+/// Description: Test compressing the same block after blocks of other contents, on the thread which reuses its hash
+///     table for all of them
+/// Expectation: The matches left in the table by the blocks before are not used, the block compresses to the same
+///     bytes every time and decompresses back
+TEST_F(MindDataTestCacheCodec, TestReuseTable) {
+  std::vector<uint8_t> src(5000);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<uint8_t>(i % 11);
+  }
+  std::vector<uint8_t> first;
+  RoundTrip(src, &first);
+  for (uint8_t fill = 0; fill < 4; ++fill) {
+    std::vector<uint8_t> other(20000 + fill, fill);
+    std::vector<uint8_t> compressed;
+    RoundTrip(other, &compressed);
+    RoundTrip(src, &compressed);
+    EXPECT_EQ(compressed, first);
+  }
+}
@@ -0,0 +1,153 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/cache/cache_pool.h"
+#include "minddata/dataset/engine/cache/cache_server.h"
+#include "minddata/dataset/util/path.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+constexpr size_t kRowSize = 4096;
+constexpr int32_t kTestPort = 50099;
+}  // namespace
+
+class MindDataTestCachePool : public UT::Common {
+ public:
+  MindDataTestCachePool() : spill_root_("/tmp/cache_pool_test") {}
+
+  void SetUp() override {
+    UT::Common::SetUp();
+    CacheServer::Builder builder;
+    (void)builder.SetRootDirectory(spill_root_).SetPort(kTestPort).SetNumWorkers(1);
+    ASSERT_OK(builder.Build());
+    Path root(spill_root_);
+    ASSERT_OK(root.CreateDirectories());
+    auto &cs = CacheServer::GetInstance();
+    auto numa_pool = std::make_shared<NumaMemoryPool>(cs.GetHWControl(), cs.GetMemoryCapRatio());
+    cp_ = std::make_shared<CachePool>(numa_pool, spill_root_, CacheEvictionPolicy::kClock);
+    ASSERT_OK(cp_->ServiceStart());
+    ASSERT_TRUE(cp_->EvictionEnabled());
+    // Room for 4 rows in memory.
+    cp_->SetMemoryLimit(4 * kRowSize);
+  }
+
+  void TearDown() override {
+    if (cp_ != nullptr) {
+      EXPECT_OK(cp_->ServiceStop());
+      cp_.reset();
+    }
+    Path root(spill_root_);
+    (void)root.Remove();
+  }
+
+  // Every byte of a row is its key plus one
+  Status InsertRow(CachePool::key_type key) {
+    std::vector<uint8_t> row(kRowSize, static_cast<uint8_t>(key + 1));
+    return cp_->Insert(key, {ReadableSlice(row.data(), row.size())});
+  }
+
+  void CheckRow(CachePool::key_type key) {
+    std::vector<uint8_t> row(kRowSize, 0);
+    WritableSlice dest(row.data(), row.size());
+    size_t bytes_read = 0;
+    ASSERT_OK(cp_->Read(key, &dest, &bytes_read));
+    EXPECT_EQ(bytes_read, kRowSize);
+    EXPECT_EQ(row, std::vector<uint8_t>(kRowSize, static_cast<uint8_t>(key + 1)));
+  }
+
+  void CheckStat(int64_t num_mem_cached, int64_t num_disk_cached, int64_t num_evicted, int64_t num_promoted) {
+    auto stat = cp_->GetStat();
+    EXPECT_EQ(stat.num_mem_cached, num_mem_cached);
+    EXPECT_EQ(stat.num_disk_cached, num_disk_cached);
+    EXPECT_EQ(stat.num_evicted, num_evicted);
+    EXPECT_EQ(stat.num_promoted, num_promoted);
+  }
+
+  std::string spill_root_;
+  std::shared_ptr<CachePool> cp_;
+};
+
+/// Feature: CachePool
+/// Description: Test inserting more rows than fit in memory with the clock eviction policy, then reading them back
+/// Expectation: The rows not read since the clock hand last passed them are evicted first, the rows read from disk
+/// are promoted back to memory, and the rows and the counters are all correct
+TEST_F(MindDataTestCachePool, TestClockEviction) {
+  for (CachePool::key_type key = 0; key < 4; ++key) {
+    ASSERT_OK(InsertRow(key));
+  }
+  CheckStat(4, 0, 0, 0);
+
+  // All the rows are referenced when inserted, the hand clears them all and evicts row 0 on its second pass.
+  ASSERT_OK(InsertRow(4));
+  CheckStat(4, 1, 1, 0);
+
+  // Fetch row 1 so that it gets a second chance, and a key not in the cache.
+  auto fbb = std::make_shared<flatbuffers::FlatBufferBuilder>();
+  flatbuffers::Offset<DataLocatorMsg> offset;
+  ASSERT_OK(cp_->GetDataLocator(1, fbb, &offset));
+  ASSERT_OK(cp_->GetDataLocator(100, fbb, &offset));
+  auto stat = cp_->GetStat();
+  EXPECT_EQ(stat.num_hit, 1);
+  EXPECT_EQ(stat.num_miss, 1);
+
+  // Row 1 is skipped, row 2 is evicted.
+  ASSERT_OK(InsertRow(5));
+  CheckStat(4, 2, 2, 0);
+
+  // Row 1 is still in memory, reading it promotes nothing.
+  CheckRow(1);
+  CheckStat(4, 2, 2, 0);
+
+  // Row 0 is read from disk and promoted, evicting row 3 which is next to the hand.
+  CheckRow(0);
+  CheckStat(4, 2, 3, 1);
+
+  // Row 2 is read from disk too. Every row in memory was referenced since the last eviction, so the hand goes round
+  // once and evicts row 4 which it reaches first.
+  CheckRow(2);
+  CheckStat(4, 2, 4, 2);
+  CheckRow(3);
+  CheckRow(4);
+  CheckRow(5);
+
+  stat = cp_->GetStat();
+  EXPECT_EQ(stat.min_key, 0);
+  EXPECT_EQ(stat.max_key, 5);
+  EXPECT_EQ(stat.average_cache_sz, static_cast<int64_t>(kRowSize));
+}
+
+/// Feature: CachePool
+/// Description: Test that the memory of the evicted rows is reused within the memory limit
+/// Expectation: A row larger than all the rows in memory together goes to disk directly, the others stay in memory
+TEST_F(MindDataTestCachePool, TestEvictionMemoryLimit) {
+  for (CachePool::key_type key = 0; key < 8; ++key) {
+    ASSERT_OK(InsertRow(key));
+  }
+  CheckStat(4, 4, 4, 0);
+
+  std::vector<uint8_t> big_row(5 * kRowSize, 0);
+  ASSERT_OK(cp_->Insert(8, {ReadableSlice(big_row.data(), big_row.size())}));
+  CheckStat(4, 5, 4, 0);
+  for (CachePool::key_type key = 0; key < 8; ++key) {
+    CheckRow(key);
+  }
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/center_crop_resize_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestCenterCropResizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestCenterCropResizeOp() : CVOpCommon() {}
+
+  // Check the fused op against a CenterCropOp followed by a ResizeOp
+  void CheckSameAsSequential(int32_t crop_height, int32_t crop_width, int32_t size1, int32_t size2,
+                             InterpolationMode interpolation) {
+    std::shared_ptr<Tensor> crop;
+    std::shared_ptr<Tensor> expected;
+    ASSERT_OK(CenterCropOp(crop_height, crop_width).Compute(input_tensor_, &crop));
+    ASSERT_OK(ResizeOp(size1, size2, interpolation).Compute(crop, &expected));
+    std::shared_ptr<Tensor> output;
+    ASSERT_OK(CenterCropResizeOp(crop_height, crop_width, size1, size2, interpolation).Compute(input_tensor_, &output));
+    ASSERT_EQ(output->shape(), expected->shape());
+    EXPECT_TRUE(*output == *expected);
+  }
+};
+
+/// Feature: CenterCropResize op
+/// Description: Test CenterCropResizeOp with crops inside the image, resized with several interpolation modes
+/// Expectation: Output is equal to the output of CenterCropOp followed by ResizeOp
+TEST_F(MindDataTestCenterCropResizeOp, TestSameAsSequential) {
+  MS_LOG(INFO) << "Doing MindDataTestCenterCropResizeOp-TestSameAsSequential.";
+  int32_t height = static_cast<int32_t>(input_tensor_->shape()[0]);
+  int32_t width = static_cast<int32_t>(input_tensor_->shape()[1]);
+  CheckSameAsSequential(height / 2, width / 2, 64, 96, InterpolationMode::kLinear);
+  CheckSameAsSequential(height / 2, width / 3, 100, 0, InterpolationMode::kNearestNeighbour);
+  CheckSameAsSequential(height - 1, width - 1, 32, 32, InterpolationMode::kArea);
+  CheckSameAsSequential(height / 2, 0, 300, 0, InterpolationMode::kCubic);
+  // Resized to the size of the crop
+  CheckSameAsSequential(64, 64, 64, 64, InterpolationMode::kLinear);
+}
+
+/// Feature: CenterCropResize op
+/// Description: Test CenterCropResizeOp with a crop larger than the image and with the PIL bicubic interpolation
+/// Expectation: Output is equal to the output of CenterCropOp followed by ResizeOp
+TEST_F(MindDataTestCenterCropResizeOp, TestFallback) {
+  MS_LOG(INFO) << "Doing MindDataTestCenterCropResizeOp-TestFallback.";
+  int32_t height = static_cast<int32_t>(input_tensor_->shape()[0]);
+  int32_t width = static_cast<int32_t>(input_tensor_->shape()[1]);
+  CheckSameAsSequential(height + 10, width / 2, 64, 64, InterpolationMode::kLinear);
+  CheckSameAsSequential(height / 2, width / 2, 64, 64, InterpolationMode::kCubicPil);
+}
+
+/// Feature: CenterCropResize op
+/// Description: Test CenterCropResizeOp with a resize to a size of 0
+/// Expectation: The error of ResizeOp is returned
+TEST_F(MindDataTestCenterCropResizeOp, TestInvalidSize) {
+  MS_LOG(INFO) << "Doing MindDataTestCenterCropResizeOp-TestInvalidSize.";
+  std::shared_ptr<Tensor> output;
+  Status s = CenterCropResizeOp(64, 64, 0, 64, InterpolationMode::kLinear).Compute(input_tensor_, &output);
+  EXPECT_TRUE(s.IsError());
+}
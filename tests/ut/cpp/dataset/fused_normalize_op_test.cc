@@ -0,0 +1,229 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/data/type_cast_op.h"
+#include "minddata/dataset/kernels/image/center_crop_op.h"
+#include "minddata/dataset/kernels/image/fused_normalize_op.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/normalize_simd.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestFusedNormalizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestFusedNormalizeOp() : CVOpCommon() {}
+
+  void SetUp() override {
+    CVOpCommon::SetUp();
+    simd_level_ = GetSimdLevel();
+  }
+
+  // The tests lower the instruction set of the kernels, which is global
+  void TearDown() override {
+    SetSimdLevel(simd_level_);
+    CVOpCommon::TearDown();
+  }
+
+  // Check the fused op against CenterCropOp, Normalize, TypeCast and HwcToChw run one after the other
+  void CheckSameAsSequential(const std::shared_ptr<Tensor> &input, int32_t crop_height, int32_t crop_width,
+                             const std::vector<float> &mean, const std::vector<float> &std,
+                             const DataType &output_type, bool hwc_to_chw) {
+    std::shared_ptr<Tensor> expected = input;
+    if (crop_height != 0) {
+      ASSERT_OK(CenterCropOp(crop_height, crop_width).Compute(input, &expected));
+    }
+    std::shared_ptr<Tensor> normalized;
+    ASSERT_OK(Normalize(expected, &normalized, mean, std, true));
+    ASSERT_OK(TypeCast(normalized, &expected, output_type));
+    if (hwc_to_chw) {
+      std::shared_ptr<Tensor> transposed;
+      ASSERT_OK(HwcToChw(expected, &transposed));
+      expected = transposed;
+    }
+    std::shared_ptr<Tensor> output;
+    FusedNormalizeOp op(crop_height, crop_width, mean, std, 1.0, 0.0, output_type, hwc_to_chw);
+    ASSERT_OK(op.Compute(input, &output));
+    ASSERT_EQ(output->shape(), expected->shape());
+    ASSERT_EQ(output->type(), expected->type());
+    EXPECT_TRUE(*output == *expected);
+  }
+
+  // Check the fused op with a rescale against Rescale, Normalize and HwcToChw run one after the other, the rescale
+  // of OpenCV is not rounded the same way
+  void CheckRescaleSameAsSequential(const std::shared_ptr<Tensor> &input, float rescale, float shift,
+                                    const std::vector<float> &mean, const std::vector<float> &std) {
+    std::shared_ptr<Tensor> rescaled;
+    ASSERT_OK(Rescale(input, &rescaled, rescale, shift));
+    std::shared_ptr<Tensor> normalized;
+    ASSERT_OK(Normalize(rescaled, &normalized, mean, std, true));
+    std::shared_ptr<Tensor> expected;
+    ASSERT_OK(HwcToChw(normalized, &expected));
+    std::shared_ptr<Tensor> output;
+    FusedNormalizeOp op(0, 0, mean, std, rescale, shift, DataType(DataType::DE_FLOAT32), true);
+    ASSERT_OK(op.Compute(input, &output));
+    ASSERT_EQ(output->shape(), expected->shape());
+    auto expected_it = expected->begin<float>();
+    for (auto it = output->begin<float>(); it != output->end<float>(); ++it, ++expected_it) {
+      ASSERT_NEAR(*it, *expected_it, 1e-5);
+    }
+  }
+
+  // The instruction sets of the kernels to test, the scalar loops first
+  std::vector<SimdLevel> SimdLevels() {
+    std::vector<SimdLevel> levels = {SimdLevel::kNone};
+    for (auto level : {SimdLevel::kNeon, SimdLevel::kAvx2, SimdLevel::kAvx512}) {
+      SetSimdLevel(level);
+      if (GetSimdLevel() == level) {
+        levels.push_back(level);
+      }
+    }
+    SetSimdLevel(GetSupportedSimdLevel());
+    return levels;
+  }
+
+  std::vector<float> mean_ = {121.0, 115.0, 100.0};
+  std::vector<float> std_ = {70.0, 68.0, 71.0};
+  SimdLevel simd_level_ = SimdLevel::kNone;
+};
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp on a uint8 image, with and without crop, cast and transpose
+/// Expectation: Output is equal to the output of the ops run one after the other
+TEST_F(MindDataTestFusedNormalizeOp, TestSameAsSequential) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestSameAsSequential.";
+  CheckSameAsSequential(input_tensor_, 0, 0, mean_, std_, DataType(DataType::DE_FLOAT32), true);
+  CheckSameAsSequential(input_tensor_, 224, 0, mean_, std_, DataType(DataType::DE_FLOAT32), true);
+  CheckSameAsSequential(input_tensor_, 200, 100, mean_, std_, DataType(DataType::DE_FLOAT16), true);
+  CheckSameAsSequential(input_tensor_, 200, 100, mean_, std_, DataType(DataType::DE_FLOAT64), false);
+  CheckSameAsSequential(input_tensor_, 0, 0, {127.5}, {127.5}, DataType(DataType::DE_FLOAT16), false);
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp on a float32 image
+/// Expectation: Output is equal to the output of the ops run one after the other
+TEST_F(MindDataTestFusedNormalizeOp, TestFloatInput) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestFloatInput.";
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(TypeCast(input_tensor_, &input, DataType(DataType::DE_FLOAT32)));
+  CheckSameAsSequential(input, 128, 128, mean_, std_, DataType(DataType::DE_FLOAT32), true);
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp with a crop larger than the image, a cast to int and a 2-D image
+/// Expectation: Output is equal to the output of the ops run one after the other
+TEST_F(MindDataTestFusedNormalizeOp, TestFallback) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestFallback.";
+  int32_t height = static_cast<int32_t>(input_tensor_->shape()[0]);
+  CheckSameAsSequential(input_tensor_, height + 2, 64, mean_, std_, DataType(DataType::DE_FLOAT32), true);
+  CheckSameAsSequential(input_tensor_, 64, 64, mean_, std_, DataType(DataType::DE_INT32), true);
+  std::shared_ptr<Tensor> gray;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({32, 48}), DataType(DataType::DE_UINT8), &gray));
+  ASSERT_OK(gray->Fill<uint8_t>(100));
+  CheckSameAsSequential(gray, 16, 16, {50.0}, {2.0}, DataType(DataType::DE_FLOAT32), true);
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp with more mean values than the channels of the image
+/// Expectation: The error of Normalize is returned
+TEST_F(MindDataTestFusedNormalizeOp, TestInvalidMean) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestInvalidMean.";
+  std::shared_ptr<Tensor> output;
+  FusedNormalizeOp op(0, 0, {1.0, 2.0, 3.0, 4.0}, {1.0, 1.0, 1.0, 1.0}, 1.0, 0.0, DataType(DataType::DE_FLOAT32),
+                      true);
+  EXPECT_TRUE(op.Compute(input_tensor_, &output).IsError());
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test the vectorized kernels of FusedNormalizeOp of each instruction set the CPU supports, on crops
+///     whose width is not a multiple of the vectors, for 1 and 3 channels, HWC and CHW, float32 and float16
+/// Expectation: Output is equal to the output of the ops run one after the other
+TEST_F(MindDataTestFusedNormalizeOp, TestSimdLevels) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestSimdLevels.";
+  std::shared_ptr<Tensor> gray;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({40, 53}), DataType(DataType::DE_UINT8), &gray));
+  uint8_t value = 0;
+  for (auto it = gray->begin<uint8_t>(); it != gray->end<uint8_t>(); ++it) {
+    *it = value;
+    value += 37;
+  }
+  for (auto level : SimdLevels()) {
+    SetSimdLevel(level);
+    MS_LOG(INFO) << "Instruction set: " << SimdLevelName(GetSimdLevel());
+    for (bool hwc_to_chw : {true, false}) {
+      CheckSameAsSequential(input_tensor_, 0, 0, mean_, std_, DataType(DataType::DE_FLOAT32), hwc_to_chw);
+      CheckSameAsSequential(input_tensor_, 201, 97, mean_, std_, DataType(DataType::DE_FLOAT32), hwc_to_chw);
+      CheckSameAsSequential(input_tensor_, 201, 97, mean_, std_, DataType(DataType::DE_FLOAT16), hwc_to_chw);
+      CheckSameAsSequential(gray, 35, 51, {50.0}, {2.0}, DataType(DataType::DE_FLOAT32), hwc_to_chw);
+      CheckSameAsSequential(gray, 0, 0, {50.0}, {2.0}, DataType(DataType::DE_FLOAT16), hwc_to_chw);
+    }
+    CheckRescaleSameAsSequential(input_tensor_, 1.0 / 255, 0.0, {0.485, 0.456, 0.406}, {0.229, 0.224, 0.225});
+  }
+}
+
+/// Feature: FusedNormalize op
+/// Description: Test FusedNormalizeOp with a rescale, on a uint8 and on a float32 image
+/// Expectation: Output is close to the output of the ops run one after the other
+TEST_F(MindDataTestFusedNormalizeOp, TestRescale) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestRescale.";
+  CheckRescaleSameAsSequential(input_tensor_, 1.0 / 255, 0.0, {0.485, 0.456, 0.406}, {0.229, 0.224, 0.225});
+  CheckRescaleSameAsSequential(input_tensor_, 1.0 / 127.5, -1.0, {0.0}, {1.0});
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(TypeCast(input_tensor_, &input, DataType(DataType::DE_FLOAT32)));
+  CheckRescaleSameAsSequential(input, 0.5, 1.0, mean_, std_);
+}
+
+/// Feature: FusedNormalize op
+/// Description: Time NormalizeOp, TypeCastOp and HwcToChwOp run one after the other against FusedNormalizeOp, for
+///     each instruction set the CPU supports, run it with --gtest_also_run_disabled_tests
+///     --gtest_filter=*FusedNormalizeOp*TestBenchmark
+/// Expectation: The timings are logged
+TEST_F(MindDataTestFusedNormalizeOp, DISABLED_TestBenchmark) {
+  MS_LOG(INFO) << "Doing MindDataTestFusedNormalizeOp-TestBenchmark.";
+  const int32_t num_iterations = 20;
+  auto run = [&input = input_tensor_, num_iterations](const std::vector<std::shared_ptr<TensorOp>> &ops) {
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < num_iterations; i++) {
+      std::shared_ptr<Tensor> image = input;
+      for (const auto &op : ops) {
+        std::shared_ptr<Tensor> output;
+        EXPECT_OK(op->Compute(image, &output));
+        image = output;
+      }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / num_iterations;
+  };
+  for (auto type : {DataType::DE_FLOAT32, DataType::DE_FLOAT16}) {
+    std::vector<std::shared_ptr<TensorOp>> chain = {std::make_shared<NormalizeOp>(mean_, std_, true),
+                                                    std::make_shared<TypeCastOp>(DataType(type)),
+                                                    std::make_shared<HwcToChwOp>()};
+    MS_LOG(INFO) << "Normalize+TypeCast+HwcToChw to " << DataType(type).ToString() << ": " << run(chain) << " us";
+    std::vector<std::shared_ptr<TensorOp>> fused = {
+      std::make_shared<FusedNormalizeOp>(0, 0, mean_, std_, 1.0, 0.0, DataType(type), true)};
+    for (auto level : SimdLevels()) {
+      SetSimdLevel(level);
+      MS_LOG(INFO) << "FusedNormalize to " << DataType(type).ToString() << " with " << SimdLevelName(level) << ": "
+                   << run(fused) << " us";
+    }
+  }
+}
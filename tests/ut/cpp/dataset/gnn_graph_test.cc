@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
 #include <string>
 #include <map>
 #include <memory>
@@ -21,8 +24,11 @@
 
 #include "common/common.h"
 #include "gtest/gtest.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/engine/gnn/local_edge.h"
+#include "minddata/dataset/engine/gnn/local_node.h"
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
 #include "minddata/dataset/engine/gnn/graph_loader.h"
 
@@ -429,3 +435,204 @@ TEST_F(MindDataTestGNNGraph, TestRandomWalkDefaults) {
   EXPECT_TRUE(s.IsOk());
   EXPECT_TRUE(walk_path->shape().ToString() == "<33,60>");
 }
+
+/// Feature: GNNGraph
+/// Description: Test saving the storage of a graph to a graph file, and loading the graph from that file
+/// Expectation: The graph loaded from the graph file gives the same output as the one loaded from mindrecord
+TEST_F(MindDataTestGNNGraph, TestSaveAndLoadGraph) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  std::string graph_file = "./gnn_graph_test_testdata.graph";
+  GraphDataImpl graph(path, 2);
+  EXPECT_OK(graph.Init());
+  EXPECT_OK(graph.SaveGraph(graph_file));
+
+  GraphDataImpl loaded(graph_file, 1);
+  EXPECT_OK(loaded.Init());
+
+  MetaInfo meta_info, loaded_meta_info;
+  EXPECT_OK(graph.GetMetaInfo(&meta_info));
+  EXPECT_OK(loaded.GetMetaInfo(&loaded_meta_info));
+  EXPECT_EQ(meta_info.node_type, loaded_meta_info.node_type);
+  EXPECT_EQ(meta_info.edge_type, loaded_meta_info.edge_type);
+  EXPECT_EQ(meta_info.node_num, loaded_meta_info.node_num);
+  EXPECT_EQ(meta_info.edge_num, loaded_meta_info.edge_num);
+  EXPECT_EQ(meta_info.node_feature_type, loaded_meta_info.node_feature_type);
+  EXPECT_EQ(meta_info.edge_feature_type, loaded_meta_info.edge_feature_type);
+
+  std::shared_ptr<Tensor> nodes, loaded_nodes;
+  EXPECT_OK(graph.GetAllNodes(meta_info.node_type[0], &nodes));
+  EXPECT_OK(loaded.GetAllNodes(meta_info.node_type[0], &loaded_nodes));
+  EXPECT_EQ(nodes->ToString(), loaded_nodes->ToString());
+  std::vector<NodeIdType> node_list;
+  for (auto itr = nodes->begin<NodeIdType>(); itr != nodes->end<NodeIdType>(); ++itr) {
+    node_list.push_back(*itr);
+  }
+
+  std::shared_ptr<Tensor> neighbors, loaded_neighbors;
+  EXPECT_OK(graph.GetAllNeighbors(node_list, meta_info.node_type[1], OutputFormat::kCoo, &neighbors));
+  EXPECT_OK(loaded.GetAllNeighbors(node_list, meta_info.node_type[1], OutputFormat::kCoo, &loaded_neighbors));
+  EXPECT_EQ(neighbors->ToString(), loaded_neighbors->ToString());
+
+  TensorRow features, loaded_features;
+  EXPECT_OK(graph.GetNodeFeature(nodes, meta_info.node_feature_type, &features));
+  EXPECT_OK(loaded.GetNodeFeature(loaded_nodes, loaded_meta_info.node_feature_type, &loaded_features));
+  ASSERT_EQ(features.size(), loaded_features.size());
+  for (size_t i = 0; i < features.size(); ++i) {
+    EXPECT_EQ(features[i]->ToString(), loaded_features[i]->ToString());
+  }
+
+  std::shared_ptr<Tensor> edges;
+  EXPECT_OK(loaded.GetAllEdges(meta_info.edge_type[0], &edges));
+  TensorRow edge_features;
+  EXPECT_OK(loaded.GetEdgeFeature(edges, meta_info.edge_feature_type, &edge_features));
+  EXPECT_EQ(edge_features[1]->ToString(),
+            "Tensor (shape: <40>, Type: float32)\n"
+            "[0.1,0.2,0.3,0.4,0.5,0.6,0.7,0.8,0.9,1,1.1,1.2,1.3,1.4,1.5,1.6,1.7,1.8,1.9,2,2.1,2.2,2.3,2.4,2.5,2.6,2."
+            "7,2.8,2.9,3,3.1,3.2,3.3,3.4,3.5,3.6,3.7,3.8,3.9,4]");
+
+  std::vector<std::pair<NodeIdType, NodeIdType>> src_dst_list = {{101, 201}, {103, 207}, {108, 208},
+                                                                 {110, 201}, {204, 105}, {208, 108}};
+  std::shared_ptr<Tensor> edge_ids;
+  EXPECT_OK(loaded.GetEdgesFromNodes(src_dst_list, &edge_ids));
+  EXPECT_EQ(edge_ids->ToString(), "Tensor (shape: <6>, Type: int32)\n[1,9,17,19,31,37]");
+
+  std::shared_ptr<Tensor> sampled;
+  EXPECT_OK(loaded.GetSampledNeighbors(node_list, {3, 2}, {meta_info.node_type[1], meta_info.node_type[0]},
+                                       SamplingStrategy::kEdgeWeight, &sampled));
+  EXPECT_EQ(sampled->shape().ToString(), "<10,10>");
+  (void)remove(graph_file.c_str());
+}
+
+/// Feature: GNNGraph
+/// Description: Test GetSampledNeighbors and RandomWalk with a fixed seed and different numbers of workers
+/// Expectation: The output only depends on the seed, not on the number of workers
+TEST_F(MindDataTestGNNGraph, TestParallelSamplingDeterministic) {
+  std::string path = "data/mindrecord/testGraphData/sns";
+  uint32_t original_seed = GlobalContext::config_manager()->seed();
+  GlobalContext::config_manager()->set_seed(1234);
+  GraphDataImpl graph(path, 1);
+  GraphDataImpl parallel_graph(path, 4);
+  EXPECT_OK(graph.Init());
+  EXPECT_OK(parallel_graph.Init());
+
+  MetaInfo meta_info;
+  EXPECT_OK(graph.GetMetaInfo(&meta_info));
+  std::shared_ptr<Tensor> nodes;
+  EXPECT_OK(graph.GetAllNodes(meta_info.node_type[0], &nodes));
+  // Repeat the nodes so that they span several blocks of the workers
+  std::vector<NodeIdType> node_list;
+  for (int i = 0; i < 4; ++i) {
+    for (auto itr = nodes->begin<NodeIdType>(); itr != nodes->end<NodeIdType>(); ++itr) {
+      node_list.push_back(*itr);
+    }
+  }
+
+  std::shared_ptr<Tensor> sampled, parallel_sampled;
+  EXPECT_OK(graph.GetSampledNeighbors(node_list, {5, 3}, {1, 1}, SamplingStrategy::kRandom, &sampled));
+  EXPECT_OK(
+    parallel_graph.GetSampledNeighbors(node_list, {5, 3}, {1, 1}, SamplingStrategy::kRandom, &parallel_sampled));
+  EXPECT_EQ(sampled->shape().ToString(), "<132,21>");
+  EXPECT_EQ(sampled->ToString(), parallel_sampled->ToString());
+
+  std::vector<NodeType> meta_path(10, 1);
+  std::shared_ptr<Tensor> walk_path, parallel_walk_path;
+  EXPECT_OK(graph.RandomWalk(node_list, meta_path, 2.0, 0.5, -1, &walk_path));
+  EXPECT_OK(parallel_graph.RandomWalk(node_list, meta_path, 2.0, 0.5, -1, &parallel_walk_path));
+  EXPECT_EQ(walk_path->shape().ToString(), "<132,11>");
+  EXPECT_EQ(walk_path->ToString(), parallel_walk_path->ToString());
+  GlobalContext::config_manager()->set_seed(original_seed);
+}
+
+/// Feature: GNNGraph
+/// Description: Test loading a graph file whose neighbor index or byte order mark was overwritten
+/// Expectation: Loading the file fails instead of reading out of bounds later on
+TEST_F(MindDataTestGNNGraph, TestLoadCorruptedGraph) {
+  std::string graph_file = "./gnn_graph_test_corrupted.graph";
+  std::vector<std::shared_ptr<gnn::Node>> nodes;
+  std::vector<std::shared_ptr<gnn::Edge>> edges;
+  for (NodeIdType i = 0; i < 3; ++i) {
+    nodes.push_back(std::make_shared<LocalNode>(i, 1, 1));
+  }
+  edges.push_back(std::make_shared<LocalEdge>(0, 0, 1, nodes[0], nodes[1]));
+  edges.push_back(std::make_shared<LocalEdge>(1, 0, 1, nodes[1], nodes[2]));
+  GraphStorage storage;
+  ASSERT_OK(storage.Build(&nodes, &edges, {}, {}, "{}"));
+  EXPECT_TRUE(nodes.empty() && edges.empty());
+  ASSERT_OK(storage.Save(graph_file));
+  GraphStorage loaded;
+  ASSERT_OK(loaded.Load(graph_file));
+  EXPECT_EQ(loaded.num_nodes(), 3);
+  EXPECT_EQ(loaded.num_edges(), 2);
+
+  // Overwrite 4 bytes of the file at an offset, and check that loading it fails
+  auto expect_corrupted = [&graph_file](std::streamoff offset) {
+    std::fstream fs(graph_file, std::ios::in | std::ios::out | std::ios::binary);
+    int32_t value = 127;
+    (void)fs.seekp(offset);
+    (void)fs.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    fs.close();
+    GraphStorage corrupted;
+    EXPECT_ERROR(corrupted.Load(graph_file));
+  };
+  // The header is 48 bytes, followed by the schema, the node ids, types, index by id and row offsets, each padded to
+  // 8 bytes, then the neighbors.
+  const std::streamoff neighbors_offset = 48 + 8 + 16 + 8 + 16 + 32;
+  expect_corrupted(neighbors_offset);
+  ASSERT_OK(storage.Save(graph_file));
+  // The byte order mark follows the magic, the version and the number of features.
+  const std::streamoff byte_order_offset = 8 + 4 * 3;
+  expect_corrupted(byte_order_offset);
+  (void)remove(graph_file.c_str());
+}
+
+/// Feature: GNNGraph
+/// Description: Benchmark GetSampledNeighbors on a random graph of 100000 nodes with 1 to 8 workers, run it with
+///     --gtest_also_run_disabled_tests --gtest_filter=*BenchmarkSampledNeighbors
+/// Expectation: The number of sampled edges per second is logged for each number of workers
+TEST_F(MindDataTestGNNGraph, DISABLED_BenchmarkSampledNeighbors) {
+  const int64_t num_nodes = 100000;
+  const int64_t degree = 10;
+  const size_t num_seeds = 10000;
+  const std::vector<NodeIdType> neighbor_nums = {10, 10, 5};
+  std::string graph_file = "./gnn_sampling_benchmark.graph";
+
+  std::mt19937 rnd(1);
+  std::uniform_int_distribution<NodeIdType> node_dist(0, num_nodes - 1);
+  std::vector<std::shared_ptr<gnn::Node>> nodes;
+  std::vector<std::shared_ptr<gnn::Edge>> edges;
+  for (int64_t i = 0; i < num_nodes; ++i) {
+    nodes.push_back(std::make_shared<LocalNode>(i, 1, 1));
+  }
+  for (int64_t i = 0; i < num_nodes * degree; ++i) {
+    edges.push_back(std::make_shared<LocalEdge>(i, 0, 1, nodes[i / degree], nodes[node_dist(rnd)]));
+  }
+  GraphStorage storage;
+  ASSERT_OK(storage.Build(&nodes, &edges, {}, {}, "{}"));
+  ASSERT_OK(storage.Save(graph_file));
+
+  std::vector<NodeIdType> seeds(num_seeds);
+  std::generate(seeds.begin(), seeds.end(), [&]() { return node_dist(rnd); });
+  int64_t edges_per_call = 0;
+  int64_t hop_size = num_seeds;
+  for (auto num : neighbor_nums) {
+    hop_size *= num;
+    edges_per_call += hop_size;
+  }
+  const int num_calls = 5;
+  for (int32_t num_workers : {1, 2, 4, 8}) {
+    GraphDataImpl graph(graph_file, num_workers);
+    ASSERT_OK(graph.Init());
+    for (auto strategy : {SamplingStrategy::kRandom, SamplingStrategy::kEdgeWeight}) {
+      std::shared_ptr<Tensor> sampled;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < num_calls; ++i) {
+        ASSERT_OK(graph.GetSampledNeighbors(seeds, neighbor_nums, {1, 1, 1}, strategy, &sampled));
+      }
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      MS_LOG(INFO) << "num_workers: " << num_workers
+                   << ", strategy: " << (strategy == SamplingStrategy::kRandom ? "random" : "edge_weight")
+                   << ", sampled edges/s: " << static_cast<double>(edges_per_call * num_calls) / elapsed.count();
+    }
+  }
+  (void)remove(graph_file.c_str());
+}
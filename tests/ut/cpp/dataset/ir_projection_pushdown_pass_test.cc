@@ -0,0 +1,152 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common.h"
+#include "minddata/dataset/engine/ir/datasetops/dataset_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/tf_record_node.h"
+#include "minddata/dataset/engine/tree_adapter.h"
+#include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/include/dataset/transforms.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestProjectionPushdownPass : public UT::DatasetOpTesting {
+ protected:
+  MindDataTestProjectionPushdownPass() = default;
+
+  /// \brief Compile a dataset and find the reader at the bottom of the compiled tree
+  /// \param[in] ds The dataset to compile
+  /// \param[out] leaf The leaf node of the first branch
+  /// \return Status of the function
+  Status CompileAndGetLeaf(const std::shared_ptr<Dataset> &ds, std::shared_ptr<DatasetNode> *leaf) {
+    auto ir_tree = std::make_shared<TreeAdapter>();
+    RETURN_IF_NOT_OK(ir_tree->Compile(ds->IRNode(), 1));
+    std::shared_ptr<DatasetNode> node = ir_tree->RootIRNode();
+    while (!node->Children().empty()) {
+      node = node->Children()[0];
+    }
+    *leaf = node;
+    return Status::OK();
+  }
+
+  /// \brief Read the content of one column of all the rows of a dataset
+  /// \param[in] ds The dataset to read
+  /// \param[in] column The column to read
+  /// \param[out] cells The bytes of the column, one entry per row
+  /// \param[out] num_columns The number of columns of the rows
+  void ReadColumn(const std::shared_ptr<Dataset> &ds, const std::string &column,
+                  std::vector<std::vector<uint8_t>> *cells, size_t *num_columns) {
+    std::shared_ptr<Iterator> iter = ds->CreateIterator();
+    ASSERT_NE(iter, nullptr);
+    std::unordered_map<std::string, mindspore::MSTensor> row;
+    ASSERT_OK(iter->GetNextRow(&row));
+    *num_columns = row.size();
+    while (row.size() != 0) {
+      auto cell = row[column];
+      auto data = reinterpret_cast<const uint8_t *>(cell.Data().get());
+      cells->emplace_back(data, data + cell.DataSize());
+      ASSERT_OK(iter->GetNextRow(&row));
+    }
+    iter->Stop();
+  }
+};
+
+/// Feature: Projection pushdown pass
+/// Description: Test a project above a rename and a shuffle is pushed down into a TFRecordDataset
+/// Expectation: The reader loads only the projected columns, under their names before the rename
+TEST_F(MindDataTestProjectionPushdownPass, TFRecordRenameShuffle) {
+  MS_LOG(INFO) << "Doing MindDataTestProjectionPushdownPass-TFRecordRenameShuffle.";
+  std::string file_path = datasets_root_path_ + "/testTFTestAllTypes/test.data";
+  std::string schema_path = datasets_root_path_ + "/testTFTestAllTypes/datasetSchema.json";
+  std::shared_ptr<Dataset> ds = TFRecord({file_path}, schema_path, {}, 0, ShuffleMode::kFalse);
+  ds = ds->Rename({"col_sint32"}, {"a"});
+  ds = ds->Shuffle(4);
+  ds = ds->Project({"a", "col_float"});
+  EXPECT_NE(ds, nullptr);
+
+  std::shared_ptr<DatasetNode> leaf;
+  ASSERT_OK(CompileAndGetLeaf(ds, &leaf));
+  auto tf_node = std::dynamic_pointer_cast<TFRecordNode>(leaf);
+  ASSERT_NE(tf_node, nullptr);
+  EXPECT_EQ(tf_node->ColumnsList(), std::vector<std::string>({"col_sint32", "col_float"}));
+
+  std::vector<std::vector<uint8_t>> cells;
+  size_t num_columns = 0;
+  ReadColumn(ds, "a", &cells, &num_columns);
+  EXPECT_EQ(num_columns, 2);
+  EXPECT_EQ(cells.size(), 12);
+}
+
+/// Feature: Projection pushdown pass
+/// Description: Test a project keeping only the raw fields of a MindDataset, so that its blob field is not read
+/// Expectation: The reader loads only the projected columns and their content doesn't change
+TEST_F(MindDataTestProjectionPushdownPass, MindDataSkipBlob) {
+  MS_LOG(INFO) << "Doing MindDataTestProjectionPushdownPass-MindDataSkipBlob.";
+  std::string file_path = datasets_root_path_ + "/../mindrecord/testMindDataSet/testImageNetData/imagenet.mindrecord0";
+  std::shared_ptr<Dataset> all = MindData(file_path, {}, std::make_shared<SequentialSampler>());
+  std::shared_ptr<Dataset> ds = MindData(file_path, {}, std::make_shared<SequentialSampler>());
+  ds = ds->Project({"label", "file_name"});
+  EXPECT_NE(ds, nullptr);
+
+  std::shared_ptr<DatasetNode> leaf;
+  ASSERT_OK(CompileAndGetLeaf(ds, &leaf));
+  auto mind_node = std::dynamic_pointer_cast<MindDataNode>(leaf);
+  ASSERT_NE(mind_node, nullptr);
+  EXPECT_EQ(mind_node->ColumnsList(), std::vector<std::string>({"label", "file_name"}));
+
+  for (const std::string column : {"label", "file_name"}) {
+    std::vector<std::vector<uint8_t>> expected;
+    std::vector<std::vector<uint8_t>> projected;
+    size_t num_columns = 0;
+    ReadColumn(all, column, &expected, &num_columns);
+    EXPECT_EQ(num_columns, 3);
+    ReadColumn(ds, column, &projected, &num_columns);
+    EXPECT_EQ(num_columns, 2);
+    EXPECT_EQ(expected.size(), 20);
+    EXPECT_EQ(projected, expected);
+  }
+}
+
+/// Feature: Projection pushdown pass
+/// Description: Test a map keeps the columns it reads, and a map without input columns stops the pushdown
+/// Expectation: The reader loads the projected columns plus the inputs of the map, or all its columns
+TEST_F(MindDataTestProjectionPushdownPass, MapInputColumns) {
+  MS_LOG(INFO) << "Doing MindDataTestProjectionPushdownPass-MapInputColumns.";
+  std::string file_path = datasets_root_path_ + "/testTFTestAllTypes/test.data";
+  std::string schema_path = datasets_root_path_ + "/testTFTestAllTypes/datasetSchema.json";
+  auto type_cast = std::make_shared<transforms::TypeCast>(mindspore::DataType::kNumberTypeFloat32);
+
+  std::shared_ptr<Dataset> ds = TFRecord({file_path}, schema_path, {}, 0, ShuffleMode::kFalse);
+  ds = ds->Map({type_cast}, {"col_sint16"}, {"col_cast"});
+  ds = ds->Project({"col_cast", "col_sint64"});
+  std::shared_ptr<DatasetNode> leaf;
+  ASSERT_OK(CompileAndGetLeaf(ds, &leaf));
+  auto tf_node = std::dynamic_pointer_cast<TFRecordNode>(leaf);
+  ASSERT_NE(tf_node, nullptr);
+  EXPECT_EQ(tf_node->ColumnsList(), std::vector<std::string>({"col_sint64", "col_sint16"}));
+
+  std::shared_ptr<Dataset> ds2 = TFRecord({file_path}, schema_path, {}, 0, ShuffleMode::kFalse);
+  ds2 = ds2->Map({type_cast});
+  ds2 = ds2->Project({"col_sint64"});
+  ASSERT_OK(CompileAndGetLeaf(ds2, &leaf));
+  tf_node = std::dynamic_pointer_cast<TFRecordNode>(leaf);
+  ASSERT_NE(tf_node, nullptr);
+  EXPECT_TRUE(tf_node->ColumnsList().empty());
+}
@@ -0,0 +1,104 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sched.h>
+#include <algorithm>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/util/numa_placement.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestNumaPlacement : public UT::Common {
+ public:
+  MindDataTestNumaPlacement() {}
+};
+
+/// Feature: NumaPlacement
+/// Description: Test reading the NUMA topology of the host and assigning operators to its nodes
+/// Expectation: The host has at least one node, every cpu belongs to one node only
+TEST_F(MindDataTestNumaPlacement, TestTopology) {
+  std::shared_ptr<NumaPlacement> placement;
+  EXPECT_OK(NumaPlacement::CreateNumaPlacement(&placement));
+  ASSERT_NE(placement, nullptr);
+  ASSERT_GE(placement->num_nodes(), 1);
+  std::vector<int32_t> all_cpus;
+  for (int32_t node = 0; node < placement->num_nodes(); ++node) {
+    auto cpus = placement->GetCpus(node);
+    all_cpus.insert(all_cpus.end(), cpus.begin(), cpus.end());
+  }
+  std::sort(all_cpus.begin(), all_cpus.end());
+  EXPECT_EQ(std::adjacent_find(all_cpus.begin(), all_cpus.end()), all_cpus.end());
+  EXPECT_TRUE(placement->GetCpus(placement->num_nodes()).empty());
+
+  EXPECT_EQ(placement->GetOperatorNode(0), NumaPlacement::kNoNode);
+  placement->SetOperatorNode(0, placement->num_nodes() - 1);
+  EXPECT_EQ(placement->GetOperatorNode(0), placement->num_nodes() - 1);
+  EXPECT_EQ(NumaPlacement::GetPciDeviceNode("not-a-device"), NumaPlacement::kNoNode);
+}
+
+/// Feature: NumaPlacement
+/// Description: Test the tasks of a TaskGroup with a placement bind themselves to the node of their operator
+/// Expectation: The task of an operator with a node runs on the cpus of that node
+TEST_F(MindDataTestNumaPlacement, TestBindTask) {
+  std::shared_ptr<NumaPlacement> placement;
+  EXPECT_OK(NumaPlacement::CreateNumaPlacement(&placement));
+  const int32_t node = placement->num_nodes() - 1;
+  const int32_t kOperatorId = 3;
+  placement->SetOperatorNode(kOperatorId, node);
+  auto cpus = placement->GetCpus(node);
+  TaskGroup vg;
+  vg.SetNumaPlacement(placement);
+  int cpu = -1;
+  bool bound = false;
+  EXPECT_OK(vg.CreateAsyncTask(
+    "Bound",
+    [&cpu, &bound, &cpus]() -> Status {
+      TaskManager::FindMe()->Post();
+      cpu_set_t allowed;
+      CHECK_FAIL_RETURN_UNEXPECTED(sched_getaffinity(0, sizeof(allowed), &allowed) == 0, "sched_getaffinity failed.");
+      bound = !cpus.empty() && CPU_COUNT(&allowed) == static_cast<int>(cpus.size()) &&
+              std::all_of(cpus.begin(), cpus.end(), [&allowed](int32_t c) { return CPU_ISSET(c, &allowed); });
+      cpu = sched_getcpu();
+      return Status::OK();
+    },
+    nullptr, kOperatorId));
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  // Without NUMA information, or in a container forbidding the bind, the task runs anywhere.
+  MS_LOG(INFO) << "Task ran on cpu " << cpu << ", bound to node " << node << ": " << bound;
+  if (bound) {
+    EXPECT_NE(std::find(cpus.begin(), cpus.end(), cpu), cpus.end());
+  }
+}
+
+/// Feature: NumaPolicy
+/// Description: Test setting the NUMA policy of the config to each policy, then to values out of its range
+/// Expectation: The policies are kept, the values out of range are rejected and leave the policy unchanged
+TEST_F(MindDataTestNumaPlacement, TestConfigPolicy) {
+  auto config_manager = GlobalContext::config_manager();
+  NumaPolicy original_policy = config_manager->numa_policy();
+  for (auto policy : {NumaPolicy::kNone, NumaPolicy::kDeviceLocal, NumaPolicy::kBalanced}) {
+    EXPECT_OK(config_manager->set_numa_policy(static_cast<int32_t>(policy)));
+    EXPECT_EQ(config_manager->numa_policy(), policy);
+  }
+  EXPECT_ERROR(config_manager->set_numa_policy(-1));
+  EXPECT_ERROR(config_manager->set_numa_policy(static_cast<int32_t>(NumaPolicy::kBalanced) + 1));
+  EXPECT_EQ(config_manager->numa_policy(), NumaPolicy::kBalanced);
+  EXPECT_OK(config_manager->set_numa_policy(static_cast<int32_t>(original_policy)));
+}
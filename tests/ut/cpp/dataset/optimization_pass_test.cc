@@ -24,13 +24,19 @@
 #include "minddata/dataset/engine/ir/datasetops/map_node.h"
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/opt/post/auto_worker_pass.h"
+#include "minddata/dataset/include/dataset/text.h"
 #include "minddata/dataset/include/dataset/transforms.h"
 #include "minddata/dataset/include/dataset/vision.h"
 #include "minddata/dataset/include/dataset/vision_lite.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
+#include "minddata/dataset/kernels/ir/vision/center_crop_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/fused_normalize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/text/ir/kernels/text_ir.h"
 
 using namespace mindspore::dataset;
 
@@ -120,3 +126,120 @@ TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassPreBuiltTensorO
   ASSERT_EQ(fused_ops.size(), 1);
   ASSERT_EQ(fused_ops[0]->Name(), kRandomCropDecodeResizeOp);
 }
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass on CenterCrop followed by Resize, and on a chain CenterCrop, Normalize,
+///     TypeCast and HWC2CHW
+/// Expectation: The ops are fused into CenterCropResize and FusedNormalize, and the fusions are reported
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassPatterns) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassPatterns.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::vector<float> mean = {121.0, 115.0, 100.0};
+  std::vector<float> std = {70.0, 68.0, 71.0};
+  auto decode = std::make_shared<vision::Decode>();
+  auto center_crop = std::make_shared<vision::CenterCrop>(std::vector<int32_t>{256});
+  auto resize = std::make_shared<vision::Resize>(std::vector<int32_t>{224});
+  auto center_crop2 = std::make_shared<vision::CenterCrop>(std::vector<int32_t>{200});
+  auto normalize = std::make_shared<vision::Normalize>(mean, std);
+  auto type_cast = std::make_shared<transforms::TypeCast>(mindspore::DataType::kNumberTypeFloat16);
+  auto hwc_to_chw = std::make_shared<vision::HWC2CHW>();
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)
+                                    ->Map({decode, center_crop, resize, center_crop2, normalize, type_cast, hwc_to_chw},
+                                          {"image"});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 3);
+  EXPECT_EQ(fused_ops[0]->Name(), vision::kDecodeOperation);
+  EXPECT_EQ(fused_ops[1]->Name(), vision::kCenterCropResizeOperation);
+  EXPECT_EQ(fused_ops[2]->Name(), vision::kFusedNormalizeOperation);
+  std::vector<std::string> expected = {"CenterCrop+Resize -> CenterCropResize",
+                                       "CenterCrop+Normalize+TypeCast+HwcToChw -> FusedNormalize"};
+  EXPECT_EQ(fusion_pass.GetAppliedFusions(), expected);
+}
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass on Normalize of a CHW image followed by HWC2CHW, then by a second Normalize
+/// Expectation: The first Normalize is left as it is, the second one is fused with HWC2CHW
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassDeclined) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassDeclined.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::vector<float> mean = {121.0, 115.0, 100.0};
+  std::vector<float> std = {70.0, 68.0, 71.0};
+  std::vector<std::shared_ptr<TensorOperation>> op_list = {
+    std::make_shared<vision::NormalizeOperation>(mean, std, false), std::make_shared<vision::HwcToChwOperation>(),
+    std::make_shared<vision::NormalizeOperation>(mean, std, true), std::make_shared<vision::HwcToChwOperation>()};
+  std::shared_ptr<DatasetNode> root = ImageFolder(folder_path, false)->IRNode();
+  std::shared_ptr<MapNode> map_node = std::make_shared<MapNode>(root, op_list, std::vector<std::string>{"image"});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  ASSERT_OK(fusion_pass.Run(map_node, &modified));
+  EXPECT_EQ(modified, true);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 3);
+  EXPECT_EQ(fused_ops[0]->Name(), vision::kNormalizeOperation);
+  EXPECT_EQ(fused_ops[1]->Name(), vision::kHwcToChwOperation);
+  EXPECT_EQ(fused_ops[2]->Name(), vision::kFusedNormalizeOperation);
+  ASSERT_EQ(fusion_pass.GetAppliedFusions().size(), 1);
+}
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass on WhitespaceTokenizer and BertTokenizer followed by Lookup, with and without
+///     offsets
+/// Expectation: The ops are fused into TokenizerLookup when the tokenizer outputs only its tokens
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassTokenizerLookup) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassTokenizerLookup.";
+  std::string data_file = datasets_root_path_ + "/testVocab/words.txt";
+  std::shared_ptr<Vocab> vocab;
+  ASSERT_OK(Vocab::BuildFromVector({"home", "is", "behind", "the", "world", "ahead", "<unk>"}, {}, true, &vocab));
+  auto tokenizer = std::make_shared<text::WhitespaceTokenizer>();
+  auto lookup = std::make_shared<text::Lookup>(vocab, "<unk>", mindspore::DataType::kNumberTypeInt32);
+  auto tokenizer_with_offsets = std::make_shared<text::WhitespaceTokenizer>(true);
+  std::shared_ptr<Dataset> root = TextFile({data_file}, 0, ShuffleMode::kFalse)->Map({tokenizer, lookup});
+  std::shared_ptr<Dataset> root_with_offsets =
+    TextFile({data_file}, 0, ShuffleMode::kFalse)->Map({tokenizer_with_offsets, lookup});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  // The Lookup gets the id of its unknown token when the pipeline is validated, which is done before the pass
+  ASSERT_OK(map_node->ValidateParams());
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 1);
+  EXPECT_EQ(fused_ops[0]->Name(), text::kTokenizerLookupOperation);
+  std::vector<std::string> expected = {"WhitespaceTokenizer+Lookup -> TokenizerLookup"};
+  EXPECT_EQ(fusion_pass.GetAppliedFusions(), expected);
+
+  modified = false;
+  map_node = std::dynamic_pointer_cast<MapNode>(root_with_offsets->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  ASSERT_OK(map_node->ValidateParams());
+  ASSERT_OK(fusion_pass.Run(root_with_offsets->IRNode(), &modified));
+  EXPECT_EQ(modified, false);
+  EXPECT_EQ(map_node->operations().size(), 2);
+
+  // BertTokenizer outputs its wordpieces, which are looked up in the same way
+  auto bert_tokenizer = std::make_shared<text::BertTokenizer>(vocab);
+  std::shared_ptr<Dataset> root_bert = TextFile({data_file}, 0, ShuffleMode::kFalse)->Map({bert_tokenizer, lookup});
+  modified = false;
+  map_node = std::dynamic_pointer_cast<MapNode>(root_bert->IRNode());
+  ASSERT_NE(map_node, nullptr);
+  ASSERT_OK(map_node->ValidateParams());
+  TensorOpFusionPass bert_fusion_pass;
+  ASSERT_OK(bert_fusion_pass.Run(root_bert->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 1);
+  EXPECT_EQ(fused_ops[0]->Name(), text::kTokenizerLookupOperation);
+  expected = {"BertTokenizer+Lookup -> TokenizerLookup"};
+  EXPECT_EQ(bert_fusion_pass.GetAppliedFusions(), expected);
+}
@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 #include "minddata/dataset/util/task_manager.h"
 #include "minddata/dataset/util/queue.h"
+#include "minddata/dataset/engine/operator_connector.h"
 #include <atomic>
 #include <chrono>
 #include <random>
@@ -279,4 +280,148 @@ TEST_F(MindDataTestQueue, TestResize2) {
   ASSERT_EQ(1, queue.size());
   queue.Reset();
   ASSERT_EQ(0, queue.size());
-}
\ No newline at end of file
+}
+/// Feature: Lock free Queue
+/// Description: Test add/pop/emplace and resize of a Queue in lock free mode from a single thread
+/// Expectation: Elements come out in the same order as they are added, and resize only changes the capacity
+TEST_F(MindDataTestQueue, TestLockFree1) {
+  Queue<int> que(3, true);
+  ASSERT_TRUE(que.lock_free());
+  ASSERT_EQ(3, que.capacity());
+  for (int i = 0; i < 3; i++) {
+    EXPECT_OK(que.Add(i));
+  }
+  ASSERT_EQ(3, que.size());
+  // Shrink the queue while it is full, elements in the queue are kept.
+  EXPECT_OK(que.Resize(1));
+  ASSERT_EQ(1, que.capacity());
+  ASSERT_EQ(3, que.size());
+  int b;
+  EXPECT_OK(que.PopFront(&b));
+  ASSERT_EQ(b, 0);
+  // Grow the queue up to the reserved slots, but not beyond.
+  ASSERT_EQ(Queue<int>::kLockFreeReservedCapacity, que.max_capacity());
+  EXPECT_OK(que.Resize(Queue<int>::kLockFreeReservedCapacity));
+  EXPECT_ERROR(que.Resize(Queue<int>::kLockFreeReservedCapacity * 2));
+  EXPECT_OK(que.EmplaceBack(3));
+  for (int i = 1; i <= 3; i++) {
+    EXPECT_OK(que.PopFront(&b));
+    ASSERT_EQ(b, i);
+  }
+  ASSERT_TRUE(que.empty());
+  EXPECT_OK(que.Add(4));
+  que.Reset();
+  ASSERT_EQ(0, que.size());
+}
+
+/// Feature: Lock free Queue
+/// Description: Test a producer thread and a consumer thread passing rows through a small lock free Queue
+/// Expectation: All the rows are received in the order they are sent
+TEST_F(MindDataTestQueue, TestLockFree2) {
+  const int64_t num_rows = 100000;
+  TaskGroup vg;
+  Queue<int64_t> que(4, true);
+  EXPECT_OK(que.Register(&vg));
+  std::vector<int64_t> output;
+  output.reserve(num_rows);
+  EXPECT_OK(vg.CreateAsyncTask("Producer", [&que, num_rows]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int64_t i = 0; i < num_rows; i++) {
+      RETURN_IF_NOT_OK(que.Add(i));
+    }
+    return Status::OK();
+  }));
+  EXPECT_OK(vg.CreateAsyncTask("Consumer", [&que, &output, num_rows]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int64_t i = 0; i < num_rows; i++) {
+      int64_t v;
+      RETURN_IF_NOT_OK(que.PopFront(&v));
+      output.push_back(v);
+    }
+    return Status::OK();
+  }));
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  ASSERT_EQ(output.size(), num_rows);
+  for (int64_t i = 0; i < num_rows; i++) {
+    ASSERT_EQ(output[i], i);
+  }
+}
+
+/// Feature: Queue batch operations
+/// Description: Test a producer thread pushing vectors of elements and a consumer thread popping vectors of elements
+///     through a Queue smaller than the vectors, in both the default and the lock free mode
+/// Expectation: All the elements are received in the order they are sent
+TEST_F(MindDataTestQueue, TestBatch) {
+  const int64_t num_rows = 10000;
+  const size_t push_size = 7;
+  const size_t pop_size = 3;
+  for (bool lock_free : {false, true}) {
+    TaskGroup vg;
+    Queue<int64_t> que(4, lock_free);
+    EXPECT_OK(que.Register(&vg));
+    std::vector<int64_t> output;
+    EXPECT_OK(vg.CreateAsyncTask("Producer", [&que, num_rows, push_size]() -> Status {
+      TaskManager::FindMe()->Post();
+      std::vector<int64_t> rows;
+      for (int64_t i = 0; i < num_rows; i++) {
+        rows.push_back(i);
+        if (rows.size() == push_size || i == num_rows - 1) {
+          RETURN_IF_NOT_OK(que.AddBatch(&rows));
+          CHECK_FAIL_RETURN_UNEXPECTED(rows.empty(), "AddBatch should clear the vector.");
+        }
+      }
+      return Status::OK();
+    }));
+    EXPECT_OK(vg.CreateAsyncTask("Consumer", [&que, &output, num_rows, pop_size]() -> Status {
+      TaskManager::FindMe()->Post();
+      while (output.size() < num_rows) {
+        size_t prev_size = output.size();
+        RETURN_IF_NOT_OK(que.PopFrontBatch(&output, pop_size));
+        CHECK_FAIL_RETURN_UNEXPECTED(output.size() > prev_size && output.size() - prev_size <= pop_size,
+                                     "PopFrontBatch should pop between 1 and max_count elements.");
+      }
+      return Status::OK();
+    }));
+    EXPECT_OK(vg.join_all());
+    EXPECT_OK(vg.GetTaskErrorIfAny());
+    ASSERT_EQ(output.size(), num_rows);
+    for (int64_t i = 0; i < num_rows; i++) {
+      ASSERT_EQ(output[i], i);
+    }
+  }
+}
+
+/// Feature: OperatorConnector chunk size
+/// Description: Test popping rows from an OperatorConnector in chunks
+/// Expectation: Rows come out in order, and the rows popped in a chunk are counted in num_rows but not in size
+TEST_F(MindDataTestQueue, TestConnectorChunk) {
+  OperatorConnector connector(8);
+  connector.SetChunkSize(4);
+  ASSERT_EQ(4, connector.chunk_size());
+  std::vector<TensorRow> rows;
+  for (int64_t i = 0; i < 6; i++) {
+    TensorRow row;
+    row.setId(i);
+    rows.push_back(std::move(row));
+  }
+  EXPECT_OK(connector.AddRows(&rows));
+  EXPECT_OK(connector.SendEOE());
+  ASSERT_EQ(7, connector.size());
+  ASSERT_EQ(7, connector.num_rows());
+  TensorRow row;
+  EXPECT_OK(connector.PopFront(&row));
+  ASSERT_EQ(0, row.getId());
+  // The chunk has taken 4 rows out of the queue, 3 of them are not handed out yet.
+  ASSERT_EQ(3, connector.size());
+  ASSERT_EQ(6, connector.num_rows());
+  for (int64_t i = 1; i < 6; i++) {
+    EXPECT_OK(connector.PopFront(&row));
+    ASSERT_EQ(i, row.getId());
+  }
+  EXPECT_OK(connector.PopFront(&row));
+  ASSERT_TRUE(row.eoe());
+  ASSERT_EQ(0, connector.size());
+  ASSERT_EQ(0, connector.num_rows());
+  ASSERT_EQ(7, connector.out_rows_count());
+}
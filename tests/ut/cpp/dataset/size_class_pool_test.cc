@@ -0,0 +1,169 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/size_class_pool.h"
+#include "minddata/dataset/util/task_manager.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestSizeClassPool : public UT::Common {
+ public:
+  MindDataTestSizeClassPool() {}
+};
+
+/// Feature: SizeClassPool
+/// Description: Test a freed block is reused by the next allocation of the same size class
+/// Expectation: The second allocation is a cache hit and returns the same block
+TEST_F(MindDataTestSizeClassPool, TestReuse) {
+  SizeClassPool pool(1024 * 1024);
+  void *p = nullptr;
+  EXPECT_OK(pool.Allocate(1000, &p));
+  ASSERT_NE(p, nullptr);
+  pool.Deallocate(p);
+  void *q = nullptr;
+  EXPECT_OK(pool.Allocate(1020, &q));
+  EXPECT_EQ(p, q);
+  auto stats = pool.GetStats();
+  EXPECT_EQ(stats.num_allocs, 2);
+  EXPECT_EQ(stats.num_cache_hits, 1);
+  EXPECT_EQ(stats.num_system_allocs, 1);
+  EXPECT_EQ(stats.bytes_cached, 0);
+  pool.Deallocate(q);
+  EXPECT_EQ(pool.GetStats().bytes_in_use, 0);
+  pool.Trim();
+  stats = pool.GetStats();
+  EXPECT_EQ(stats.bytes_cached, 0);
+  EXPECT_EQ(stats.num_system_frees, 1);
+}
+
+/// Feature: SizeClassPool
+/// Description: Test blocks freed above the limit and blocks larger than kMaxPooledSize are not cached
+/// Expectation: These blocks are returned to the system
+TEST_F(MindDataTestSizeClassPool, TestLimit) {
+  SizeClassPool pool(4096);
+  void *p1 = nullptr;
+  void *p2 = nullptr;
+  EXPECT_OK(pool.Allocate(3000, &p1));
+  EXPECT_OK(pool.Allocate(3000, &p2));
+  pool.Deallocate(p1);
+  EXPECT_EQ(pool.GetStats().num_system_frees, 1);
+  pool.Deallocate(p2);
+  EXPECT_EQ(pool.GetStats().num_system_frees, 1);
+  EXPECT_GT(pool.GetStats().bytes_cached, 0);
+
+  SizeClassPool unlimited(UINT64_MAX);
+  void *large = nullptr;
+  EXPECT_OK(unlimited.Allocate(SizeClassPool::kMaxPooledSize + 1, &large));
+  unlimited.Deallocate(large);
+  auto stats = unlimited.GetStats();
+  EXPECT_EQ(stats.num_system_frees, 1);
+  EXPECT_EQ(stats.bytes_cached, 0);
+}
+
+/// Feature: SizeClassPool
+/// Description: Test Reallocate to a larger size class
+/// Expectation: The content of the block is preserved
+TEST_F(MindDataTestSizeClassPool, TestReallocate) {
+  SizeClassPool pool(1024 * 1024);
+  void *p = nullptr;
+  EXPECT_OK(pool.Allocate(300, &p));
+  memset(p, 'x', 300);
+  EXPECT_OK(pool.Reallocate(&p, 300, 5000));
+  auto data = reinterpret_cast<char *>(p);
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_EQ(data[i], 'x');
+  }
+  pool.Deallocate(p);
+  EXPECT_EQ(pool.GetStats().bytes_in_use, 0);
+}
+
+/// Feature: SizeClassPool
+/// Description: Test blocks allocated by one thread and freed by another, and tensors created inside a TaskGroup
+///     which has a pool
+/// Expectation: The consumer returns the blocks to its cache and the producer takes them back from there
+TEST_F(MindDataTestSizeClassPool, TestCrossThread) {
+  auto pool = std::make_shared<SizeClassPool>(64 * 1024 * 1024);
+  const int kNumRows = 1000;
+  Queue<std::shared_ptr<Tensor>> que(8);
+  TaskGroup vg;
+  vg.SetMemoryPool(pool);
+  EXPECT_OK(que.Register(&vg));
+  EXPECT_OK(vg.CreateAsyncTask("Producer", [&que, &pool]() -> Status {
+    TaskManager::FindMe()->Post();
+    CHECK_FAIL_RETURN_UNEXPECTED(GlobalContext::Instance()->tensor_mem_pool() == pool, "Wrong tensor pool.");
+    for (int i = 0; i < kNumRows; ++i) {
+      std::shared_ptr<Tensor> t;
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({32, 32}), DataType(DataType::DE_FLOAT32), &t));
+      RETURN_IF_NOT_OK(que.Add(std::move(t)));
+    }
+    return Status::OK();
+  }));
+  EXPECT_OK(vg.CreateAsyncTask("Consumer", [&que]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int i = 0; i < kNumRows; ++i) {
+      std::shared_ptr<Tensor> t;
+      RETURN_IF_NOT_OK(que.PopFront(&t));
+    }
+    return Status::OK();
+  }));
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  auto stats = pool->GetStats();
+  MS_LOG(INFO) << *pool;
+  EXPECT_EQ(stats.num_allocs, kNumRows);
+  EXPECT_GT(stats.num_cache_hits, 0);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+}
+
+/// Feature: SizeClassPool
+/// Description: Test threads allocating and freeing blocks of several size classes at the same time, each thread
+///     writing its own id into its blocks
+/// Expectation: No block is handed out twice at a time, all the blocks are back in the pool at the end
+TEST_F(MindDataTestSizeClassPool, TestConcurrent) {
+  auto pool = std::make_shared<SizeClassPool>(64 * 1024 * 1024);
+  const int kNumThreads = 8;
+  const int kNumRounds = 2000;
+  const size_t kSizes[] = {300, 1000, 5000};
+  TaskGroup vg;
+  for (int id = 0; id < kNumThreads; ++id) {
+    EXPECT_OK(vg.CreateAsyncTask("Worker", [&pool, &kSizes, id]() -> Status {
+      TaskManager::FindMe()->Post();
+      for (int i = 0; i < kNumRounds; ++i) {
+        size_t size = kSizes[i % 3];
+        void *p = nullptr;
+        RETURN_IF_NOT_OK(pool->Allocate(size, &p));
+        memset(p, id, size);
+        auto data = reinterpret_cast<unsigned char *>(p);
+        for (size_t j = 0; j < size; j += 64) {
+          CHECK_FAIL_RETURN_UNEXPECTED(data[j] == static_cast<unsigned char>(id), "Block shared by two threads.");
+        }
+        pool->Deallocate(p);
+      }
+      return Status::OK();
+    }));
+  }
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  auto stats = pool->GetStats();
+  EXPECT_EQ(stats.num_allocs, kNumThreads * kNumRounds);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+  EXPECT_EQ(stats.num_cache_hits + stats.num_system_allocs, stats.num_allocs);
+}
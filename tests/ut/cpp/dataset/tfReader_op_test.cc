@@ -13,13 +13,20 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/engine/data_schema.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_decoder.h"
 #include "minddata/dataset/engine/jagged_connector.h"
+#include "utils/system/crc32c.h"
 #include "common/common.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
@@ -378,3 +385,237 @@ TEST_F(MindDataTestTFReaderOp, TestTotalRowsBasic) {
   TFReaderOp::CountTotalRows(&total_rows, filenames, 729, true);
   ASSERT_EQ(total_rows, 60);
 }
+
+namespace {
+// Read all the rows of a TFReaderOp and print every row into a string
+std::vector<std::string> ReadRowsAsStrings(const std::vector<std::string> &files, const std::string &schema_path,
+                                           int32_t num_workers, int32_t num_devices, int32_t device_id,
+                                           bool shuffle_records = false, int64_t skip_rows = 0) {
+  auto my_tree = std::make_shared<ExecutionTree>();
+  std::unique_ptr<DataSchema> schema = std::make_unique<DataSchema>();
+  EXPECT_OK(schema->LoadSchemaFile(schema_path, {}));
+  std::shared_ptr<ConfigManager> config_manager = GlobalContext::config_manager();
+  std::shared_ptr<TFReaderOp> my_tfreader_op = std::make_shared<TFReaderOp>(
+    num_workers, config_manager->worker_connector_size(), 0, files, std::move(schema),
+    config_manager->op_connector_size(), std::vector<std::string>(), shuffle_records, num_devices, device_id, true,
+    shuffle_records);
+  EXPECT_OK(my_tfreader_op->Init());
+  my_tfreader_op->SetFirstEpochSkip(skip_rows);
+  EXPECT_OK(my_tree->AssociateNode(my_tfreader_op));
+  EXPECT_OK(my_tree->AssignRoot(my_tfreader_op));
+  EXPECT_OK(my_tree->Prepare());
+  EXPECT_OK(my_tree->Launch());
+
+  std::vector<std::string> rows;
+  DatasetIterator di(my_tree);
+  TensorRow tensor_list;
+  EXPECT_OK(di.FetchNextTensorRow(&tensor_list));
+  while (!tensor_list.empty()) {
+    std::ostringstream ss;
+    for (auto &tensor : tensor_list) {
+      ss << *tensor << ";";
+    }
+    rows.push_back(ss.str());
+    EXPECT_OK(di.FetchNextTensorRow(&tensor_list));
+  }
+  return rows;
+}
+}  // namespace
+
+/// Feature: TFReader op
+/// Description: Test TFReaderOp reading the shards of one file with equal_rows_per_shard and record split, every
+///     worker jumps to the first row of its block
+/// Expectation: The shards have the same number of rows and together they hold the rows of the whole file
+TEST_F(MindDataTestTFReaderOp, TestTFReaderRecordSplitShards) {
+  std::string dataset_path = datasets_root_path_ + "/testTFTestAllTypes/test.data";
+  std::string schema_path = datasets_root_path_ + "/testTFTestAllTypes/datasetSchema.json";
+  auto expected = ReadRowsAsStrings({dataset_path}, schema_path, 1, 1, 0);
+  ASSERT_EQ(expected.size(), 12);
+
+  std::shared_ptr<ConfigManager> config_manager = GlobalContext::config_manager();
+  config_manager->set_enable_tfrecord_record_split(true);
+  std::vector<std::string> rows;
+  const int32_t num_devices = 3;
+  for (int32_t device_id = 0; device_id < num_devices; ++device_id) {
+    auto shard = ReadRowsAsStrings({dataset_path}, schema_path, 2, num_devices, device_id);
+    EXPECT_EQ(shard.size(), 4);
+    rows.insert(rows.end(), shard.begin(), shard.end());
+  }
+  config_manager->set_enable_tfrecord_record_split(false);
+
+  std::sort(expected.begin(), expected.end());
+  std::sort(rows.begin(), rows.end());
+  EXPECT_EQ(rows, expected);
+}
+
+/// Feature: TFReader op
+/// Description: Test TFReaderOp shuffling the records of one file for one shard, then for 3 shards with
+///     equal_rows_per_shard
+/// Expectation: Every shard gets the same number of rows, and the rows of all the shards are the rows of the file
+TEST_F(MindDataTestTFReaderOp, TestTFReaderRecordShuffle) {
+  std::string dataset_path = datasets_root_path_ + "/testTFTestAllTypes/test.data";
+  std::string schema_path = datasets_root_path_ + "/testTFTestAllTypes/datasetSchema.json";
+  auto expected = ReadRowsAsStrings({dataset_path}, schema_path, 1, 1, 0);
+  ASSERT_EQ(expected.size(), 12);
+  std::sort(expected.begin(), expected.end());
+
+  auto rows = ReadRowsAsStrings({dataset_path}, schema_path, 2, 1, 0, true);
+  std::sort(rows.begin(), rows.end());
+  EXPECT_EQ(rows, expected);
+
+  rows.clear();
+  const int32_t num_devices = 3;
+  for (int32_t device_id = 0; device_id < num_devices; ++device_id) {
+    auto shard = ReadRowsAsStrings({dataset_path}, schema_path, 2, num_devices, device_id, true);
+    EXPECT_EQ(shard.size(), 4);
+    rows.insert(rows.end(), shard.begin(), shard.end());
+  }
+  std::sort(rows.begin(), rows.end());
+  EXPECT_EQ(rows, expected);
+}
+
+namespace {
+// Write a TFRecord file of num_rows Examples, each with one int64 feature "id" counting from first_id
+void WriteIdRecords(const std::string &path, int64_t first_id, int64_t num_rows) {
+  std::ofstream fs(path, std::ios::binary | std::ios::trunc);
+  for (int64_t id = first_id; id < first_id + num_rows; ++id) {
+    std::string varint;
+    for (uint64_t v = static_cast<uint64_t>(id); v != 0 || varint.empty(); v >>= 7) {
+      varint.push_back(static_cast<char>((v & 0x7F) | (v >= 0x80 ? 0x80 : 0)));
+    }
+    auto length_delimited = [](uint8_t tag, const std::string &payload) {
+      return std::string(1, static_cast<char>(tag)) + std::string(1, static_cast<char>(payload.size())) + payload;
+    };
+    std::string int_list = length_delimited(0x0A, length_delimited(0x0A, std::string(1, 0x08) + varint));
+    std::string entry = length_delimited(0x0A, "id") + length_delimited(0x12, int_list);
+    std::string record = length_delimited(0x0A, length_delimited(0x0A, entry));
+    uint64_t length = record.size();
+    uint32_t length_crc =
+      mindspore::system::Crc32c::GetMaskCrc32cValue(reinterpret_cast<const char *>(&length), sizeof(length));
+    uint32_t data_crc = mindspore::system::Crc32c::GetMaskCrc32cValue(record.data(), record.size());
+    (void)fs.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    (void)fs.write(reinterpret_cast<const char *>(&length_crc), sizeof(length_crc));
+    (void)fs.write(record.data(), static_cast<std::streamsize>(record.size()));
+    (void)fs.write(reinterpret_cast<const char *>(&data_crc), sizeof(data_crc));
+  }
+}
+}  // namespace
+
+/// Feature: TFReader op
+/// Description: Test TFReaderOp shuffling the records of two files of several blocks each, twice under the same seed
+/// Expectation: The order differs from the order of the files, is the same for both reads, and holds every row once
+TEST_F(MindDataTestTFReaderOp, TestTFReaderRecordShuffleBlocks) {
+  const int64_t rows_per_file = 200;
+  std::vector<std::string> files = {"./tf_reader_record_shuffle_0.data", "./tf_reader_record_shuffle_1.data"};
+  for (size_t i = 0; i < files.size(); ++i) {
+    WriteIdRecords(files[i], static_cast<int64_t>(i) * rows_per_file, rows_per_file);
+  }
+  std::string schema_path = "./tf_reader_record_shuffle_schema.json";
+  {
+    std::ofstream fs(schema_path, std::ios::trunc);
+    fs << R"({"datasetType": "TF", "columns": {"id": {"type": "int64", "rank": 1}}})";
+  }
+  std::shared_ptr<ConfigManager> config_manager = GlobalContext::config_manager();
+  uint32_t original_seed = config_manager->seed();
+  config_manager->set_seed(7);
+
+  auto expected = ReadRowsAsStrings(files, schema_path, 1, 1, 0);
+  ASSERT_EQ(expected.size(), files.size() * rows_per_file);
+  auto rows = ReadRowsAsStrings(files, schema_path, 2, 1, 0, true);
+  auto rows_again = ReadRowsAsStrings(files, schema_path, 2, 1, 0, true);
+  EXPECT_EQ(rows, rows_again);
+  EXPECT_NE(rows, expected);
+  std::sort(expected.begin(), expected.end());
+  std::sort(rows.begin(), rows.end());
+  EXPECT_EQ(rows, expected);
+
+  config_manager->set_seed(original_seed);
+  for (const auto &file : files) {
+    (void)remove(file.c_str());
+  }
+  (void)remove(schema_path.c_str());
+}
+
+/// Feature: TFReader op
+/// Description: Test TFReaderOp skipping the first rows of two files read by two workers, with the files in order
+///     and with the records shuffled
+/// Expectation: The rows are the ones read without a skip, less the skipped ones at the start
+TEST_F(MindDataTestTFReaderOp, TestTFReaderFirstEpochSkip) {
+  std::vector<std::string> files = {datasets_root_path_ + "/testTFTestAllTypes/test.data",
+                                    datasets_root_path_ + "/testTFTestAllTypes/test2.data"};
+  std::string schema_path = datasets_root_path_ + "/testTFTestAllTypes/datasetSchema.json";
+  std::shared_ptr<ConfigManager> config_manager = GlobalContext::config_manager();
+  uint32_t original_seed = config_manager->seed();
+  config_manager->set_seed(5);
+  for (bool shuffle_records : {false, true}) {
+    auto expected = ReadRowsAsStrings(files, schema_path, 2, 1, 0, shuffle_records);
+    ASSERT_GT(expected.size(), 12);
+    for (int64_t skip = 1; skip <= static_cast<int64_t>(expected.size()); ++skip) {
+      auto rows = ReadRowsAsStrings(files, schema_path, 2, 1, 0, shuffle_records, skip);
+      EXPECT_EQ(rows, std::vector<std::string>(expected.begin() + skip, expected.end()));
+    }
+  }
+  config_manager->set_seed(original_seed);
+}
+
+/// Feature: TFExampleDecoder
+/// Description: Test decoding a serialized Example with packed floats, unpacked int64s, bytes and an unknown field,
+///     then a truncated copy of it
+/// Expectation: The values are read as written, the truncated record is rejected
+TEST_F(MindDataTestTFReaderOp, TestTFExampleDecoder) {
+  auto length_delimited = [](uint8_t tag, const std::string &payload) {
+    return std::string(1, static_cast<char>(tag)) + std::string(1, static_cast<char>(payload.size())) + payload;
+  };
+  const uint8_t kTag1Len = 0x0A;  // field 1, length delimited
+  const uint8_t kTag2Len = 0x12;  // field 2, length delimited
+  const uint8_t kTag3Len = 0x1A;  // field 3, length delimited
+  const uint8_t kTag1Varint = 0x08;
+  float floats[] = {1.5, -2.25};
+  std::string packed_floats(reinterpret_cast<const char *>(floats), sizeof(floats));
+  std::string float_feature = length_delimited(kTag2Len, length_delimited(kTag1Len, packed_floats));
+  // 3 and 300 as varints, unpacked
+  std::string int_list = {static_cast<char>(kTag1Varint), 0x03, static_cast<char>(kTag1Varint),
+                          static_cast<char>(0xAC), 0x02};
+  std::string int_feature = length_delimited(kTag3Len, int_list);
+  std::string bytes_feature =
+    length_delimited(kTag1Len, length_delimited(kTag1Len, "xyz") + length_delimited(kTag1Len, "w"));
+  auto map_entry = [&length_delimited, kTag1Len, kTag2Len](const std::string &key, const std::string &feature) {
+    return length_delimited(kTag1Len, length_delimited(kTag1Len, key) + length_delimited(kTag2Len, feature));
+  };
+  std::string features = map_entry("f", float_feature) + map_entry("i", int_feature) + map_entry("b", bytes_feature) +
+                         map_entry("other", int_feature);
+  // An unknown varint field 5 before the features
+  std::string record = std::string({0x28, 0x01}) + length_delimited(kTag1Len, features);
+
+  TFExampleDecoder decoder({"i", "f", "b", "missing"});
+  std::vector<TFExampleDecoder::Feature> found;
+  auto data = reinterpret_cast<const uint8_t *>(record.data());
+  ASSERT_TRUE(decoder.FindFeatures(data, record.size(), &found));
+  ASSERT_EQ(found.size(), 4);
+  EXPECT_FALSE(found[3].found);
+
+  int64_t num_values = 0;
+  uint64_t max_size = 0;
+  ASSERT_TRUE(TFExampleDecoder::CountValues(found[0], &num_values, &max_size));
+  ASSERT_EQ(num_values, 2);
+  int32_t ints[2];
+  TFExampleDecoder::ReadInt64List(found[0], ints, num_values);
+  EXPECT_EQ(ints[0], 3);
+  EXPECT_EQ(ints[1], 300);
+
+  ASSERT_TRUE(TFExampleDecoder::CountValues(found[1], &num_values, &max_size));
+  ASSERT_EQ(num_values, 2);
+  float values[2];
+  TFExampleDecoder::ReadFloatList(found[1], values, num_values);
+  EXPECT_EQ(values[0], floats[0]);
+  EXPECT_EQ(values[1], floats[1]);
+
+  ASSERT_TRUE(TFExampleDecoder::CountValues(found[2], &num_values, &max_size));
+  ASSERT_EQ(num_values, 2);
+  ASSERT_EQ(max_size, 3);
+  uint8_t padded[6];
+  ASSERT_TRUE(TFExampleDecoder::ReadBytesList(found[2], padded, sizeof(padded), max_size));
+  EXPECT_EQ(std::string(reinterpret_cast<char *>(padded), sizeof(padded)), "xyzw  ");
+
+  EXPECT_FALSE(decoder.FindFeatures(data, record.size() - 1, &found));
+}
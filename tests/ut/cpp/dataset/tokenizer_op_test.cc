@@ -19,13 +19,17 @@
 
 #include "common/common.h"
 #include "minddata/dataset/text/kernels/basic_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/bert_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/case_fold_op.h"
+#include "minddata/dataset/text/kernels/lookup_op.h"
 #include "minddata/dataset/text/kernels/normalize_utf8_op.h"
 #include "minddata/dataset/text/kernels/regex_replace_op.h"
 #include "minddata/dataset/text/kernels/regex_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/tokenizer_lookup_op.h"
 #include "minddata/dataset/text/kernels/unicode_char_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/unicode_script_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/whitespace_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
 
@@ -382,4 +386,156 @@ std::shared_ptr<Tensor> input;
   TensorRow output;
   Status s = basic_tokenizer->Compute(TensorRow(0, {input}), &output);
   EXPECT_TRUE(s.IsOk());
-}
\ No newline at end of file
+}
+
+/// Feature: RegexReplace op
+/// Description: Test RegexReplaceOp with an invalid pattern
+/// Expectation: The error is reported by Compute
+TEST_F(MindDataTestTokenizerOp, TestRegexReplaceInvalidPattern) {
+  auto regex_replace_op = std::make_unique<RegexReplaceOp>("[", "_", true);
+  std::shared_ptr<Tensor> input;
+  Tensor::CreateScalar<std::string>("Welcome to China.", &input);
+  std::shared_ptr<Tensor> output;
+  Status s = regex_replace_op->Compute(input, &output);
+  EXPECT_FALSE(s.IsOk());
+  EXPECT_NE(s.ToString().find("create icu RegexMatcher failed"), std::string::npos);
+}
+
+/// Feature: WordpieceTokenizer op
+/// Description: Test WordpieceTokenizerOp with words split into the longest subwords of the vocab
+/// Expectation: Output is equal to the expected output, a word with a part out of the vocab is unknown
+TEST_F(MindDataTestTokenizerOp, TestWordpieceTokenizer) {
+  std::shared_ptr<Vocab> vocab;
+  std::vector<std::string> words = {"我", "喜", "欢", "我喜", "un", "want", "##want", "##ed", "##e", "##d", "runn",
+                                    "##ing", "[UNK]"};
+  ASSERT_OK(Vocab::BuildFromVector(words, {}, true, &vocab));
+  auto wordpiece_tokenizer = std::make_unique<WordpieceTokenizerOp>(vocab, "##", 100, "[UNK]", true);
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"unwanted", "我喜欢", "running", "unwantedX"}, &input));
+  TensorRow output;
+  ASSERT_OK(wordpiece_tokenizer->Compute(TensorRow(0, {input}), &output));
+  ASSERT_EQ(output.size(), 3);
+  std::vector<std::string> expected = {"un", "##want", "##ed", "[UNK]", "runn", "##ing", "[UNK]"};
+  ASSERT_EQ(output[0]->Size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    CheckEqual(output[0], {static_cast<dsize_t>(i)}, expected[i]);
+  }
+  uint32_t start = 0, limit = 0;
+  ASSERT_OK(output[1]->GetItemAt(&start, {3}));
+  ASSERT_OK(output[2]->GetItemAt(&limit, {3}));
+  EXPECT_EQ(start, 0);
+  EXPECT_EQ(limit, std::string("我喜欢").size());
+}
+
+/// Feature: BertTokenizer op
+/// Description: Test BertTokenizerOp against BasicTokenizerOp followed by WordpieceTokenizerOp
+/// Expectation: Both give the same tokens and offsets
+TEST_F(MindDataTestTokenizerOp, TestBertTokenizer) {
+  std::shared_ptr<Vocab> vocab;
+  std::vector<std::string> words = {"床", "前", "明", "月", "光", "疑", "是", "地", "上", "霜", "举", "头", "望", "低",
+                                    "思", "故", "乡", "繁", "體", "字", "嘿", "哈", "大", "笑", "嘻", "i", "am", "mak",
+                                    "make", "small", "mistake", "##s", "during", "work", "##ing", "hour", "😀", "😃",
+                                    "😄", "😁", "+", "/", "-", "=", "12", "28", "40", "16", " ", "I", "[CLS]", "[SEP]",
+                                    "[UNK]", "[PAD]", "[MASK]", "[unused1]", "[unused10]"};
+  ASSERT_OK(Vocab::BuildFromVector(words, {}, true, &vocab));
+  std::vector<std::string> texts = {"床前明月光 疑是地上霜", "I am making small mistakes during working hours",
+                                    "😀嘿嘿😃哈哈😄大笑😁嘻嘻", "[UNK] [CLS] [unused10] 12+/-28=40/-16", "",
+                                    "Café\tÜber  12"};
+  for (bool lower_case : {false, true}) {
+    for (bool with_offsets : {false, true}) {
+      auto bert_tokenizer = std::make_unique<BertTokenizerOp>(vocab, "##", 100, "[UNK]", lower_case, false,
+                                                              NormalizeForm::kNone, true, with_offsets);
+      auto basic_tokenizer =
+        std::make_unique<BasicTokenizerOp>(lower_case, false, NormalizeForm::kNone, true, with_offsets);
+      auto wordpiece_tokenizer = std::make_unique<WordpieceTokenizerOp>(vocab, "##", 100, "[UNK]", with_offsets);
+      for (const auto &text : texts) {
+        std::shared_ptr<Tensor> input;
+        ASSERT_OK(Tensor::CreateScalar<std::string>(text, &input));
+        TensorRow output, basic_output, expected;
+        ASSERT_OK(bert_tokenizer->Compute(TensorRow(0, {input}), &output));
+        ASSERT_OK(basic_tokenizer->Compute(TensorRow(0, {input}), &basic_output));
+        ASSERT_OK(wordpiece_tokenizer->Compute(basic_output, &expected));
+        ASSERT_EQ(output.size(), expected.size());
+        for (size_t i = 0; i < output.size(); ++i) {
+          EXPECT_EQ(output[i]->ToString(), expected[i]->ToString());
+        }
+      }
+    }
+  }
+}
+
+/// Feature: TokenizerLookup op
+/// Description: Test TokenizerLookupOp with BertTokenizerOp, which splits the basic tokens into wordpieces
+/// Expectation: The ids are the ones of BertTokenizerOp followed by LookupOp
+TEST_F(MindDataTestTokenizerOp, TestBertTokenizerLookup) {
+  std::shared_ptr<Vocab> vocab;
+  std::vector<std::string> words = {"i",  "am", "mak", "make", "small", "mistake", "##s", "during", "work", "##ing",
+                                    "hour", "床", "前", "明", "月", "光", "12", "+", "28", "=", "[CLS]", "[UNK]"};
+  ASSERT_OK(Vocab::BuildFromVector(words, {}, true, &vocab));
+  auto lookup = std::make_shared<LookupOp>(vocab, vocab->TokensToIds("[UNK]"), DataType(DataType::DE_INT32));
+  std::vector<std::string> texts = {"I am making small mistakes during working hours", "床前明月光 疑是", "",
+                                    "[CLS] 12+28=40", "Café\tÜber  12"};
+  for (bool lower_case : {false, true}) {
+    auto bert_tokenizer = std::make_shared<BertTokenizerOp>(vocab, "##", 100, "[UNK]", lower_case, false,
+                                                            NormalizeForm::kNone, true, false);
+    TokenizerLookupOp tokenizer_lookup(bert_tokenizer, lookup);
+    for (const auto &text : texts) {
+      std::shared_ptr<Tensor> input;
+      ASSERT_OK(Tensor::CreateScalar<std::string>(text, &input));
+      TensorRow output, tokens;
+      ASSERT_OK(tokenizer_lookup.Compute(TensorRow(0, {input}), &output));
+      ASSERT_OK(bert_tokenizer->Compute(TensorRow(0, {input}), &tokens));
+      std::shared_ptr<Tensor> expected;
+      ASSERT_OK(lookup->Compute(tokens[0], &expected));
+      ASSERT_EQ(output.size(), 1);
+      EXPECT_EQ(output[0]->ToString(), expected->ToString());
+    }
+  }
+}
+
+/// Feature: TokenizerLookup op
+/// Description: Test TokenizerLookupOp with tokenizers giving views of the input and tokenizers giving strings
+/// Expectation: The ids and offsets are the ones of the tokenizer followed by LookupOp, also for appended words
+TEST_F(MindDataTestTokenizerOp, TestTokenizerLookup) {
+  std::shared_ptr<Vocab> vocab;
+  ASSERT_OK(Vocab::BuildFromVector({"Welcome", "to", "Beijing", "!", "北", "京", "<unk>"}, {}, true, &vocab));
+  auto lookup = std::make_shared<LookupOp>(vocab, vocab->TokensToIds("<unk>"), DataType(DataType::DE_INT32));
+  std::vector<std::shared_ptr<TokenizerOp>> tokenizers = {
+    std::make_shared<WhitespaceTokenizerOp>(true), std::make_shared<UnicodeCharTokenizerOp>(true),
+    std::make_shared<UnicodeScriptTokenizerOp>(false, true), std::make_shared<RegexTokenizerOp>("\\s+", "", true)};
+  std::vector<std::string> texts = {"Welcome to Beijing!", "  Welcome   to \t 北京 ", "", "   "};
+  for (const auto &tokenizer : tokenizers) {
+    TokenizerLookupOp tokenizer_lookup(tokenizer, lookup);
+    for (const auto &text : texts) {
+      std::shared_ptr<Tensor> input;
+      ASSERT_OK(Tensor::CreateScalar<std::string>(text, &input));
+      TensorRow output, tokens;
+      ASSERT_OK(tokenizer_lookup.Compute(TensorRow(0, {input}), &output));
+      ASSERT_OK(tokenizer->Compute(TensorRow(0, {input}), &tokens));
+      std::shared_ptr<Tensor> expected;
+      ASSERT_OK(lookup->Compute(tokens[0], &expected));
+      ASSERT_EQ(output.size(), 3);
+      EXPECT_EQ(output[0]->ToString(), expected->ToString());
+      EXPECT_EQ(output[1]->ToString(), tokens[1]->ToString());
+      EXPECT_EQ(output[2]->ToString(), tokens[2]->ToString());
+    }
+  }
+
+  // Without an unknown token, a token out of the vocab is an error
+  auto strict_lookup = std::make_shared<LookupOp>(vocab, Vocab::kNoTokenExists, DataType(DataType::DE_INT32));
+  TokenizerLookupOp strict_tokenizer_lookup(std::make_shared<WhitespaceTokenizerOp>(), strict_lookup);
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateScalar<std::string>("Welcome to Shanghai", &input));
+  TensorRow output;
+  EXPECT_FALSE(strict_tokenizer_lookup.Compute(TensorRow(0, {input}), &output).IsOk());
+
+  // A word appended to the vocab after the first lookup is found
+  vocab->AppendWord("Shanghai");
+  output.clear();
+  ASSERT_OK(strict_tokenizer_lookup.Compute(TensorRow(0, {input}), &output));
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(Tensor::CreateFromVector(
+    std::vector<WordIdType>{vocab->TokensToIds("Welcome"), vocab->TokensToIds("to"), vocab->TokensToIds("Shanghai")},
+    &expected));
+  EXPECT_EQ(output[0]->ToString(), expected->ToString());
+}
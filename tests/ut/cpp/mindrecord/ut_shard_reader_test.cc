@@ -90,6 +90,46 @@ TEST_F(TestShardReader, TestShardReaderLazyLoad) {
   dataset.Close();
 }
 
+/// Feature: ShardReader memory mapped read mode
+/// Description: read imageNet with and without memory mapped files
+/// Expectation: the blob data and scalar fields of both modes are identical
+TEST_F(TestShardReader, TestShardReaderMmap) {
+  MS_LOG(INFO) << FormatInfo("Test read imageNet with mmap");
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "data"};
+
+  ShardReader stream_reader;
+  ASSERT_TRUE(stream_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(stream_reader.Launch(true).IsOk());
+  ASSERT_FALSE(stream_reader.IsMmapEnabled());
+
+  ShardReader mmap_reader;
+  mmap_reader.SetMmapMode(true);
+  ASSERT_TRUE(mmap_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(mmap_reader.Launch(true).IsOk());
+  ASSERT_TRUE(mmap_reader.IsMmapEnabled());
+
+  ASSERT_EQ(stream_reader.GetNumRows(), mmap_reader.GetNumRows());
+  for (int64_t i = 0; i < stream_reader.GetNumRows(); ++i) {
+    auto expected = stream_reader.GetNextById(i, 0);
+    std::shared_ptr<MAPPED_TASK_CONTENT> actual;
+    ASSERT_TRUE(mmap_reader.GetNextMappedById(i, &actual).IsOk());
+    ASSERT_EQ(expected.second.size(), actual->second.size());
+    for (size_t j = 0; j < expected.second.size(); ++j) {
+      const auto &blob = std::get<0>(expected.second[j]);
+      const auto &slice = std::get<0>(actual->second[j]);
+      ASSERT_EQ(blob.size(), slice.size);
+      ASSERT_EQ(std::memcmp(blob.data(), slice.data, slice.size), 0);
+      ASSERT_EQ(std::get<1>(expected.second[j]), std::get<1>(actual->second[j]));
+    }
+    // the copying interface reads from the mapped file as well
+    auto copied = mmap_reader.GetNextById(i, 0);
+    ASSERT_EQ(expected.second, copied.second);
+  }
+  stream_reader.Close();
+  mmap_reader.Close();
+}
+
 TEST_F(TestShardReader, TestShardReaderSample) {
   MS_LOG(INFO) << FormatInfo("Test read imageNet");
   std::string file_name = "./imagenet.shard01";
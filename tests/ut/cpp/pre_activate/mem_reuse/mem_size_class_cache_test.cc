@@ -0,0 +1,137 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/mem_reuse/mem_size_class_cache.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+namespace device {
+class TestMemSizeClassCache : public UT::Common {
+ public:
+  TestMemSizeClassCache() = default;
+  void SetUp() override {
+    segments_.clear();
+    cache_ = std::make_unique<DynamicMemSizeClassCache>([this](size_t size) -> DeviceMemPtr {
+      auto segment = malloc(size);
+      if (segment != nullptr) {
+        segments_.push_back(segment);
+      }
+      return segment;
+    });
+  }
+  void TearDown() override {
+    cache_ = nullptr;
+    for (auto segment : segments_) {
+      free(segment);
+    }
+    segments_.clear();
+  }
+
+ protected:
+  std::unique_ptr<DynamicMemSizeClassCache> cache_{nullptr};
+  std::vector<DeviceMemPtr> segments_;
+};
+
+/// Feature: Size class cache of the dynamic memory pool.
+/// Description: Round the sizes up to the size classes and alloc, free and realloc the memory.
+/// Expectation: The size is rounded to power of two class, and the freed memory is reused by the same thread.
+TEST_F(TestMemSizeClassCache, test_alloc_and_reuse) {
+  ASSERT_EQ(DynamicMemSizeClassCache::SizeClassIndex(1), 0);
+  ASSERT_EQ(DynamicMemSizeClassCache::SizeClassIndex(512), 0);
+  ASSERT_EQ(DynamicMemSizeClassCache::SizeClassIndex(1024), 1);
+  ASSERT_EQ(DynamicMemSizeClassCache::SizeClassIndex(1536), 2);
+  ASSERT_EQ(DynamicMemSizeClassCache::SizeClassIndex(DynamicMemSizeClassCache::kMaxSizeClassSize),
+            DynamicMemSizeClassCache::kSizeClassNum - 1);
+  ASSERT_FALSE(DynamicMemSizeClassCache::IsSizeClass(DynamicMemSizeClassCache::kMaxSizeClassSize + 1));
+  ASSERT_EQ(cache_->AllocTensorMem(DynamicMemSizeClassCache::kMaxSizeClassSize + 1), nullptr);
+
+  auto addr1 = cache_->AllocTensorMem(1024);
+  auto addr2 = cache_->AllocTensorMem(1024);
+  ASSERT_NE(addr1, nullptr);
+  ASSERT_NE(addr2, nullptr);
+  ASSERT_NE(addr1, addr2);
+  ASSERT_EQ(segments_.size(), 1);
+  ASSERT_TRUE(cache_->FreeTensorMem(addr1));
+  ASSERT_EQ(cache_->AllocTensorMem(1024), addr1);
+
+  // The memory out of the segments doesn't belong to the cache.
+  int value = 0;
+  ASSERT_FALSE(cache_->FreeTensorMem(&value));
+  ASSERT_TRUE(cache_->FreeTensorMem(addr1));
+  ASSERT_TRUE(cache_->FreeTensorMem(addr2));
+
+  auto state_info = cache_->StateInfo();
+  ASSERT_NE(state_info.find("used size:0B"), std::string::npos);
+  cache_->Clear();
+  ASSERT_FALSE(cache_->FreeTensorMem(addr1));
+}
+
+/// Feature: Size class cache of the dynamic memory pool.
+/// Description: Alloc and free the memory of different classes in multiple threads, and free by the other thread.
+/// Expectation: No address is handed out twice, and the memory freed by the exited threads can be realloced.
+TEST_F(TestMemSizeClassCache, test_multi_thread_alloc_and_free) {
+  constexpr size_t kThreadNum = 4;
+  constexpr size_t kAllocNum = 1000;
+  std::vector<std::vector<DeviceMemPtr>> thread_addrs(kThreadNum);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([this, i, &thread_addrs]() {
+      for (size_t j = 0; j < kAllocNum; ++j) {
+        auto addr = cache_->AllocTensorMem(DynamicMemSizeClassCache::SizeClassSize(j % 4));
+        if (addr != nullptr) {
+          thread_addrs[i].push_back(addr);
+        }
+        // Free the half of memory immediately.
+        if (j % 2 == 0) {
+          (void)cache_->FreeTensorMem(thread_addrs[i].back());
+          thread_addrs[i].pop_back();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::set<DeviceMemPtr> addrs;
+  for (const auto &addr_list : thread_addrs) {
+    ASSERT_EQ(addr_list.size(), kAllocNum / 2);
+    addrs.insert(addr_list.begin(), addr_list.end());
+  }
+  ASSERT_EQ(addrs.size(), kThreadNum * kAllocNum / 2);
+
+  // Free the memory in another thread, the thread cache is given back to the central free lists when the thread exits.
+  std::thread free_thread([this, &addrs]() {
+    for (auto addr : addrs) {
+      ASSERT_TRUE(cache_->FreeTensorMem(addr));
+    }
+  });
+  free_thread.join();
+  auto segment_num = segments_.size();
+  for (size_t i = 0; i < kThreadNum * kAllocNum / 2; ++i) {
+    ASSERT_NE(cache_->AllocTensorMem(DynamicMemSizeClassCache::SizeClassSize(i % 4)), nullptr);
+  }
+  ASSERT_EQ(segments_.size(), segment_num);
+}
+}  // namespace device
+}  // namespace mindspore
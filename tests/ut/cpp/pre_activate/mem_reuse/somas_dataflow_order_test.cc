@@ -0,0 +1,122 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <vector>
+#include "backend/common/somas/somas.h"
+#include "backend/common/session/kernel_graph.h"
+#include "runtime/device/kernel_info.h"
+#include "frontend/operator/ops.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+namespace somas {
+using KernelBuildInfoBuilder = kernel::KernelBuildInfo::KernelBuildInfoBuilder;
+namespace {
+// SOMAS aligns the size to 512 bytes and keeps a gap of 32 bytes at least.
+constexpr size_t kOutputSize = 992;
+constexpr size_t kAlignedOutputSize = 1024;
+
+class PlannedKernelMod : public kernel::KernelMod {
+ public:
+  PlannedKernelMod() { output_size_list_ = {kOutputSize}; }
+  ~PlannedKernelMod() override = default;
+
+  bool Launch(const std::vector<kernel::AddressPtr> &, const std::vector<kernel::AddressPtr> &,
+              const std::vector<kernel::AddressPtr> &, void *) override {
+    return true;
+  }
+};
+}  // namespace
+
+class TestSomasDataflowOrder : public UT::Common {
+ public:
+  TestSomasDataflowOrder() {}
+
+  void SetUp() override {
+    graph_ = std::make_shared<session::KernelGraph>();
+    abstract_ = std::make_shared<abstract::AbstractTensor>(kFloat32, ShapeVector{16, 16});
+    auto x = graph_->add_parameter();
+    x->set_abstract(abstract_);
+    x->set_kernel_info(std::make_shared<device::KernelInfo>());
+    graph_->MutableInputs()->push_back(x);
+    // The chain: x -> k1 -> k2 -> k3 -> k4, and the branch: k1 -> k5.
+    auto k1 = NewKernel(x);
+    auto k2 = NewKernel(k1);
+    auto k3 = NewKernel(k2);
+    auto k4 = NewKernel(k3);
+    auto k5 = NewKernel(k1);
+    kernels_ = {k1, k2, k3, k4, k5};
+    graph_->set_execution_order(kernels_);
+  }
+
+  CNodePtr NewKernel(const AnfNodePtr &input) {
+    auto kernel = graph_->NewCNode({NewValueNode(prim::kPrimRelu), input});
+    kernel->set_abstract(abstract_);
+    auto kernel_info = std::make_shared<device::KernelInfo>();
+    kernel_info->set_kernel_mod(std::make_shared<PlannedKernelMod>());
+    kernel->set_kernel_info(kernel_info);
+    KernelBuildInfoBuilder builder;
+    builder.SetInputsFormat({kOpFormat_DEFAULT});
+    builder.SetInputsDeviceType({kNumberTypeFloat32});
+    builder.SetOutputsFormat({kOpFormat_DEFAULT});
+    builder.SetOutputsDeviceType({kNumberTypeFloat32});
+    builder.SetKernelType(KernelType::CPU_KERNEL);
+    AnfAlgo::SetSelectKernelBuildInfo(builder.Build(), kernel.get());
+    return kernel;
+  }
+
+  std::shared_ptr<session::KernelGraph> graph_;
+  AbstractBasePtr abstract_;
+  std::vector<CNodePtr> kernels_;
+};
+
+/// Feature: Plan the memory of static CPU graph with SOMAS.
+/// Description: Plan a chain with a branch by the data dependency only, as the kernel actors launch the kernels.
+/// Expectation: The offsets are in the planned memory, the outputs of chain are reused and the branch which may run
+/// concurrently with the chain doesn't share memory with it.
+TEST_F(TestSomasDataflowOrder, PlanStaticGraph) {
+  auto somas = std::make_shared<Somas>();
+  somas->set_dataflow_order(true);
+  ASSERT_TRUE(somas->Allocate(graph_.get()));
+  auto total_size = somas->GetTotalMemSize();
+  // The outputs of k1, k2, k3 and k5 may be alive at the same time, and k4 reuses the output of k2.
+  ASSERT_LT(total_size, kernels_.size() * kAlignedOutputSize);
+  ASSERT_GE(total_size, 4 * kAlignedOutputSize);
+
+  std::vector<uint8_t> memory(total_size);
+  somas->set_mem_base_addr(memory.data());
+  std::vector<size_t> offsets;
+  for (const auto &kernel : kernels_) {
+    auto ptr = somas->GetNodeOutputPtr(kernel, 0);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_GE(ptr, memory.data());
+    auto offset = static_cast<size_t>(ptr - memory.data());
+    ASSERT_LE(offset + kOutputSize, total_size);
+    offsets.push_back(offset);
+  }
+  auto is_overlapped = [&offsets](size_t i, size_t j) {
+    return (offsets[i] < offsets[j] + kOutputSize) && (offsets[j] < offsets[i] + kOutputSize);
+  };
+  // The input and output of the same kernel are alive at the same time.
+  ASSERT_FALSE(is_overlapped(0, 1));
+  ASSERT_FALSE(is_overlapped(1, 2));
+  ASSERT_FALSE(is_overlapped(2, 3));
+  ASSERT_FALSE(is_overlapped(0, 4));
+  // k5 only depends on k1, so it may run with k3 although it is after k4 in the execution order.
+  ASSERT_FALSE(is_overlapped(2, 4));
+}
+}  // namespace somas
+}  // namespace mindspore
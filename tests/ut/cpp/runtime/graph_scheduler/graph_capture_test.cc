@@ -0,0 +1,115 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/common_test.h"
+#include "abstract/abstract_function.h"
+#include "runtime/graph_scheduler/scheduler_helper.h"
+#include "runtime/graph_scheduler/graph_capture.h"
+
+namespace mindspore {
+namespace runtime {
+class GraphCaptureTest : public UT::Common {
+ public:
+  GraphCaptureTest() {}
+
+  void SetUp() override {
+    memory_manager_actor_ = std::make_shared<MemoryManagerActor>();
+    kernel_graph_ = std::make_shared<KernelGraph>();
+    // The source actor is out of the captured graph: source -> a, a -> b, a -> c, b -> c.
+    source_actor_ = NewKernelActor("capture_source_actor");
+    for (const auto &name : {"capture_a_actor", "capture_b_actor", "capture_c_actor"}) {
+      (void)kernel_actors_.emplace_back(NewKernelActor(name));
+    }
+    SchedulerHelper::AddControlArrow(source_actor_.get(), kernel_actors_[0].get());
+    SchedulerHelper::AddControlArrow(kernel_actors_[0].get(), kernel_actors_[1].get());
+    SchedulerHelper::AddControlArrow(kernel_actors_[0].get(), kernel_actors_[2].get());
+    SchedulerHelper::AddControlArrow(kernel_actors_[1].get(), kernel_actors_[2].get());
+  }
+
+  KernelActorPtr NewKernelActor(const std::string &name) {
+    std::vector<AnfNodePtr> inputs{NewValueNode(prim::kPrimLess)};
+    auto backend_node = kernel_graph_->NewCNode(inputs);
+    MS_EXCEPTION_IF_NULL(backend_node);
+    std::set<size_t> ref_input_indexes;
+    std::set<size_t> ref_output_indexes;
+    return std::make_shared<KernelActor>(name, backend_node, nullptr, memory_manager_actor_->GetAID(), nullptr,
+                                         nullptr, GraphExecutionStrategy::kPipeline, ref_input_indexes,
+                                         ref_output_indexes);
+  }
+
+  std::vector<std::vector<TensorPtr>> NewInputTensors(int64_t dim) {
+    auto tensor = std::make_shared<tensor::Tensor>(kNumberTypeFloat32, ShapeVector{dim});
+    return {{tensor}};
+  }
+
+  std::shared_ptr<MemoryManagerActor> memory_manager_actor_;
+  KernelGraphPtr kernel_graph_;
+  KernelActorPtr source_actor_;
+  std::vector<KernelActorPtr> kernel_actors_;
+};
+
+/// Feature: Graph capture.
+/// Description: Capture the kernel launch sequence in the first step and prepare the later steps with the same inputs.
+/// Expectation: The later steps replay the launch list, and the arrows between captured actors are not sent.
+TEST_F(GraphCaptureTest, ReplayCapturedGraph) {
+  GraphCapture graph_capture("capture_actor_set", kernel_actors_, true);
+  ASSERT_EQ(GraphCaptureStatus::kIdle, graph_capture.status());
+
+  graph_capture.Prepare(NewInputTensors(2));
+  ASSERT_TRUE(graph_capture.is_capturing());
+  for (auto &kernel_actor : kernel_actors_) {
+    graph_capture.RecordLaunch(kernel_actor.get());
+  }
+  graph_capture.Finish();
+  ASSERT_TRUE(graph_capture.is_replaying());
+  ASSERT_EQ(3, graph_capture.launch_list_size());
+  ASSERT_TRUE(graph_capture.has_successors(0));
+  ASSERT_TRUE(graph_capture.has_successors(1));
+  ASSERT_FALSE(graph_capture.has_successors(2));
+  // The arrows in the launch list are replaced by the dependency counters, the external arrow is kept.
+  ASSERT_EQ(0, kernel_actors_[0]->output_control_arrows().size());
+  ASSERT_EQ(0, kernel_actors_[1]->output_control_arrows().size());
+  ASSERT_EQ(1, source_actor_->output_control_arrows().size());
+
+  // The same input shapes keep replaying.
+  graph_capture.Prepare(NewInputTensors(2));
+  ASSERT_TRUE(graph_capture.is_replaying());
+
+  // The changed input shapes restore the arrows and capture again.
+  graph_capture.Prepare(NewInputTensors(3));
+  ASSERT_TRUE(graph_capture.is_capturing());
+  ASSERT_EQ(0, graph_capture.launch_list_size());
+  ASSERT_EQ(2, kernel_actors_[0]->output_control_arrows().size());
+  ASSERT_EQ(1, kernel_actors_[1]->output_control_arrows().size());
+}
+
+/// Feature: Graph capture.
+/// Description: Only part of the kernel actors are launched in the capturing step.
+/// Expectation: The graph is not supported and the arrows are not changed.
+TEST_F(GraphCaptureTest, IncompleteCapture) {
+  GraphCapture graph_capture("capture_actor_set", kernel_actors_, true);
+  graph_capture.Prepare(NewInputTensors(2));
+  graph_capture.RecordLaunch(kernel_actors_[0].get());
+  graph_capture.RecordLaunch(kernel_actors_[1].get());
+  graph_capture.Finish();
+  ASSERT_EQ(GraphCaptureStatus::kUnsupported, graph_capture.status());
+  ASSERT_EQ(2, kernel_actors_[0]->output_control_arrows().size());
+
+  graph_capture.Prepare(NewInputTensors(2));
+  ASSERT_EQ(GraphCaptureStatus::kUnsupported, graph_capture.status());
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -17,6 +17,7 @@
 #include "common/common_test.h"
 #include "abstract/abstract_function.h"
 #include "runtime/graph_scheduler/scheduler_helper.h"
+#include "runtime/graph_scheduler/optimizer/cost_driven_actor_fusion.h"
 
 namespace mindspore {
 namespace runtime {
@@ -59,5 +60,99 @@ TEST_F(SchedulerHelperTest, AddDependency) {
   SchedulerHelper::FuseDataArrowsToBatchDataArrow(fusion_actor.get());
   ASSERT_EQ(0, fusion_actor->batch_output_data_arrows().size());
 }
+
+/// Feature: Cost driven actor fusion.
+/// Description: Test the saved messages of fusion actor and the cost estimation of kernel actor.
+/// Expectation: The arrow between sub actors is a saved message and the kernel without kernel mod is not cheap.
+TEST_F(SchedulerHelperTest, FusionSavedMessages) {
+  auto memory_manager_actor = std::make_shared<MemoryManagerActor>();
+  MS_EXCEPTION_IF_NULL(memory_manager_actor);
+  auto kernel_graph = std::make_shared<KernelGraph>();
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  std::vector<AnfNodePtr> inputs{NewValueNode(prim::kPrimLess)};
+  auto backend_node1 = kernel_graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(backend_node1);
+  auto backend_node2 = kernel_graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(backend_node2);
+  std::set<size_t> ref_input_indexes;
+  std::set<size_t> ref_output_indexes;
+
+  auto from_actor =
+    std::make_shared<KernelActor>("cost_from_actor", backend_node1, nullptr, memory_manager_actor->GetAID(), nullptr,
+                                  nullptr, GraphExecutionStrategy::kPipeline, ref_input_indexes, ref_output_indexes);
+  auto to_actor =
+    std::make_shared<KernelActor>("cost_to_actor", backend_node2, nullptr, memory_manager_actor->GetAID(), nullptr,
+                                  nullptr, GraphExecutionStrategy::kPipeline, ref_input_indexes, ref_output_indexes);
+  ASSERT_EQ(SIZE_MAX, CostDrivenActorFusion::EstimateKernelCost(from_actor.get()));
+
+  SchedulerHelper::AddControlArrow(from_actor.get(), to_actor.get());
+  auto fusion_actor = SchedulerHelper::BuildFusionActor({from_actor, to_actor});
+  SchedulerHelper::AddArrowForFusionActor(fusion_actor.get());
+  ASSERT_EQ(0, fusion_actor->input_control_arrow_aids().size());
+  ASSERT_EQ(1, fusion_actor->FetchSavedMessagesNum());
+  ASSERT_EQ(0, fusion_actor->estimated_cost());
+}
+
+/// Feature: Cost driven actor fusion.
+/// Description: Group the cheap kernel actors of a chain, of a closed fan-out and fan-in and of an open fan-out.
+/// Expectation: The chain and the closed subgraph are fused, the branches of the open fan-out are not merged.
+TEST_F(SchedulerHelperTest, GroupCheapActors) {
+  auto memory_manager_actor = std::make_shared<MemoryManagerActor>();
+  MS_EXCEPTION_IF_NULL(memory_manager_actor);
+  auto kernel_graph = std::make_shared<KernelGraph>();
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  std::set<size_t> ref_input_indexes;
+  std::set<size_t> ref_output_indexes;
+  std::vector<KernelActorPtr> actors;
+  for (size_t i = 0; i < 11; ++i) {
+    std::vector<AnfNodePtr> inputs{NewValueNode(prim::kPrimLess)};
+    auto backend_node = kernel_graph->NewCNode(inputs);
+    MS_EXCEPTION_IF_NULL(backend_node);
+    (void)actors.emplace_back(std::make_shared<KernelActor>(
+      "cheap_actor" + std::to_string(i), backend_node, nullptr, memory_manager_actor->GetAID(), nullptr, nullptr,
+      GraphExecutionStrategy::kPipeline, ref_input_indexes, ref_output_indexes));
+  }
+
+  // The chain: 0 -> 1 -> 2, and the closed fan-out and fan-in: 2 -> 3, 2 -> 4, 3 -> 5, 4 -> 5.
+  SchedulerHelper::AddControlArrow(actors[0].get(), actors[1].get());
+  SchedulerHelper::AddControlArrow(actors[1].get(), actors[2].get());
+  SchedulerHelper::AddControlArrow(actors[2].get(), actors[3].get());
+  SchedulerHelper::AddControlArrow(actors[2].get(), actors[4].get());
+  SchedulerHelper::AddControlArrow(actors[3].get(), actors[5].get());
+  SchedulerHelper::AddControlArrow(actors[4].get(), actors[5].get());
+  // The open fan-out: 6 -> 7, 6 -> 8, 7 -> 9, 8 -> 9, and 8 also feeds the actor 10 which is not cheap.
+  SchedulerHelper::AddControlArrow(actors[6].get(), actors[7].get());
+  SchedulerHelper::AddControlArrow(actors[6].get(), actors[8].get());
+  SchedulerHelper::AddControlArrow(actors[7].get(), actors[9].get());
+  SchedulerHelper::AddControlArrow(actors[8].get(), actors[9].get());
+  SchedulerHelper::AddControlArrow(actors[8].get(), actors[10].get());
+  std::vector<KernelActorPtr> cheap_actors(actors.begin(), actors.begin() + 10);
+  std::vector<size_t> costs{100, 200, 300, 400, 500, 600, 1, 1, 1, 1};
+  auto groups = CostDrivenActorFusion::GroupCheapActors(cheap_actors, costs);
+  ASSERT_EQ(1, groups.size());
+  ASSERT_EQ(6, groups[0].first.size());
+  ASSERT_EQ(2100, groups[0].second);
+  std::set<std::string> group_actor_names;
+  for (const auto &actor : groups[0].first) {
+    (void)group_actor_names.insert(actor->GetAID().Name());
+  }
+  std::set<std::string> expect_actor_names{"cheap_actor0", "cheap_actor1", "cheap_actor2",
+                                           "cheap_actor3", "cheap_actor4", "cheap_actor5"};
+  ASSERT_EQ(expect_actor_names, group_actor_names);
+
+  // The chain is not fused beyond the cost limit of group, the closed subgraph still joins the rest of chain.
+  std::vector<size_t> large_costs{1024 * 1024, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+  groups = CostDrivenActorFusion::GroupCheapActors(cheap_actors, large_costs);
+  ASSERT_EQ(1, groups.size());
+  ASSERT_EQ(5, groups[0].first.size());
+  ASSERT_EQ(5, groups[0].second);
+
+  // The closed subgraph is not fused beyond the cost limit of group.
+  std::vector<size_t> subgraph_large_costs{1, 1, 1, 1024 * 1024, 1, 1, 1, 1, 1, 1};
+  groups = CostDrivenActorFusion::GroupCheapActors(cheap_actors, subgraph_large_costs);
+  ASSERT_EQ(1, groups.size());
+  ASSERT_EQ(3, groups[0].first.size());
+  ASSERT_EQ(3, groups[0].second);
+}
 }  // namespace runtime
 }  // namespace mindspore
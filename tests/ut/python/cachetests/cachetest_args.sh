@@ -55,6 +55,16 @@ cmd="${CACHE_ADMIN} --start --spilldir /path_that_does_not_exist"
 CacheAdminCmd "${cmd}" 1
 HandleRcExit $? 0 0
 
+# unknown eviction policy
+cmd="${CACHE_ADMIN} --start --spilldir /tmp --eviction_policy lfu"
+CacheAdminCmd "${cmd}" 1
+HandleRcExit $? 0 0
+
+# eviction policy without spill directory
+cmd="${CACHE_ADMIN} --start --eviction_policy clock"
+CacheAdminCmd "${cmd}" 1
+HandleRcExit $? 0 0
+
 # clean up cache server first to test start
 ServerCleanup
 # start cache server
@@ -97,6 +97,9 @@ HandleRcExit $? 0 0
 PytestCmd "test_cache_map.py" "test_cache_map_prefetch_size" 1
 HandleRcExit $? 0 0
 
+PytestCmd "test_cache_map.py" "test_cache_map_compress"
+HandleRcExit $? 0 0
+
 PytestCmd "test_cache_map.py" "test_cache_map_to_device"
 HandleRcExit $? 0 0
 
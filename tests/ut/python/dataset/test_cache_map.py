@@ -2481,6 +2481,55 @@ def test_cache_map_dataset_size2():
     logger.info("test_cache_map_dataset_size2 Ended.\n")
 
 
+@pytest.mark.skipif(os.environ.get('RUN_CACHE_TEST') != 'TRUE', reason="Require to bring up cache server")
+def test_cache_map_compress():
+    """
+    Feature: DatasetCache op
+    Description: Test a cache which compresses the rows, written by the first repeat and read back by the second
+
+       Repeat
+         |
+       Cache
+         |
+       Mnist
+
+    Expectation: Both repeats return the rows of Mnist without a cache, the rows are cached compressed and the
+        statistics of the client count the bytes saved
+    """
+    logger.info("Test cache map compress")
+    if "SESSION_ID" in os.environ:
+        session_id = int(os.environ['SESSION_ID'])
+    else:
+        raise RuntimeError("Testcase requires SESSION_ID environment variable")
+
+    num_samples = 10
+    expected = []
+    ds0 = ds.MnistDataset(MNIST_DATA_DIR, num_samples=num_samples, shuffle=False)
+    for row in ds0.create_dict_iterator(num_epochs=1, output_numpy=True):
+        expected.append(row)
+    assert len(expected) == num_samples
+
+    some_cache = ds.DatasetCache(session_id=session_id, size=0, compress=True)
+    ds1 = ds.MnistDataset(MNIST_DATA_DIR, num_samples=num_samples, shuffle=False, cache=some_cache)
+    ds1 = ds1.repeat(2)
+
+    num_iter = 0
+    for row in ds1.create_dict_iterator(num_epochs=1, output_numpy=True):
+        expected_row = expected[num_iter % num_samples]
+        np.testing.assert_array_equal(row["image"], expected_row["image"])
+        np.testing.assert_array_equal(row["label"], expected_row["label"])
+        num_iter += 1
+    assert num_iter == 2 * num_samples
+
+    stat = some_cache.get_stat()
+    logger.info("Bytes before compression: {}, after: {}, compress time: {} us, decompress time: {} us".format(
+        stat.raw_bytes, stat.compressed_bytes, stat.compress_us, stat.decompress_us))
+    assert stat.num_mem_cached == num_samples
+    # The digits are mostly black, so they shrink.
+    assert stat.raw_bytes > 0
+    assert 0 < stat.compressed_bytes < stat.raw_bytes
+    logger.info("test_cache_map_compress Ended.\n")
+
 if __name__ == '__main__':
     # This is just a list of tests, don't try to run these tests with 'python test_cache_map.py'
     # since cache server is required to be brought up first
@@ -2516,6 +2565,7 @@ if __name__ == '__main__':
     test_cache_map_num_connections_100()
     test_cache_map_prefetch_size_1()
     test_cache_map_prefetch_size_100()
+    test_cache_map_compress()
     test_cache_map_to_device()
     test_cache_map_epoch_ctrl1()
     test_cache_map_epoch_ctrl2()
@@ -490,6 +490,36 @@ def test_config_bool_type_error():
     config_error_func(ds.config.set_multiprocessing_timeout_interval, True, TypeError, "interval isn't of type int")
 
 
+def test_numa_policy():
+    """
+    Feature: Config
+    Description: Test set_numa_policy with each policy, then with values which are not policies
+    Expectation: The policies are kept, the other values raise an error and leave the policy unchanged
+    """
+    saved_policy = ds.config.get_numa_policy()
+    for policy in ["none", "device", "balanced"]:
+        ds.config.set_numa_policy(policy)
+        assert ds.config.get_numa_policy() == policy
+    config_error_func(ds.config.set_numa_policy, 1, TypeError, "policy must be of type str")
+    config_error_func(ds.config.set_numa_policy, "local", ValueError, "policy must be one of")
+    assert ds.config.get_numa_policy() == "balanced"
+    ds.config.set_numa_policy(saved_policy)
+
+def test_read_ahead_memory_limit():
+    """
+    Feature: Config
+    Description: Test set_read_ahead_memory_limit with a valid limit, then with limits which are not larger than 0
+    Expectation: The valid limit is kept, the other ones raise an error and leave the limit unchanged
+    """
+    saved_limit = ds.config.get_read_ahead_memory_limit()
+    ds.config.set_read_ahead_memory_limit(64)
+    assert ds.config.get_read_ahead_memory_limit() == 64
+    config_error_func(ds.config.set_read_ahead_memory_limit, 0, ValueError, "limit exceeds the boundary")
+    config_error_func(ds.config.set_read_ahead_memory_limit, -1, ValueError, "limit exceeds the boundary")
+    config_error_func(ds.config.set_read_ahead_memory_limit, True, TypeError, "limit must be of type int")
+    assert ds.config.get_read_ahead_memory_limit() == 64
+    ds.config.set_read_ahead_memory_limit(saved_limit)
+
 if __name__ == '__main__':
     test_basic()
     test_get_seed()
@@ -505,3 +535,5 @@ if __name__ == '__main__':
     test_enable_watchdog()
     test_multiprocessing_timeout_interval()
     test_config_bool_type_error()
+    test_numa_policy()
+    test_read_ahead_memory_limit()
@@ -0,0 +1,102 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ==============================================================================
+"""
+Testing FusedNormalize op in DE
+"""
+import numpy as np
+import pytest
+
+import mindspore.dataset as ds
+import mindspore.dataset.transforms as transforms
+import mindspore.dataset.vision as vision
+from mindspore import log as logger
+
+DATA_DIR = ["../data/dataset/test_tf_file_3_images/train-0000-of-0001.data"]
+SCHEMA_DIR = "../data/dataset/test_tf_file_3_images/datasetSchema.json"
+
+
+def check_same_as_sequential(fused_op, sequential_ops, atol):
+    """
+    Compare the images of a pipeline mapping the fused op with the ones of a pipeline mapping the op chain
+    """
+    data1 = ds.TFRecordDataset(DATA_DIR, SCHEMA_DIR, columns_list=["image"], shuffle=False)
+    data1 = data1.map(operations=[vision.Decode(), fused_op], input_columns=["image"])
+    data2 = ds.TFRecordDataset(DATA_DIR, SCHEMA_DIR, columns_list=["image"], shuffle=False)
+    data2 = data2.map(operations=[vision.Decode()] + sequential_ops, input_columns=["image"])
+
+    num_iter = 0
+    for item1, item2 in zip(data1.create_dict_iterator(num_epochs=1, output_numpy=True),
+                            data2.create_dict_iterator(num_epochs=1, output_numpy=True)):
+        assert item1["image"].dtype == item2["image"].dtype
+        assert item1["image"].shape == item2["image"].shape
+        np.testing.assert_allclose(item1["image"].astype(np.float32), item2["image"].astype(np.float32), atol=atol)
+        num_iter += 1
+    assert num_iter == 3
+
+
+def test_fused_normalize_op():
+    """
+    Feature: FusedNormalize
+    Description: Test FusedNormalize against Normalize and HWC2CHW, and against Normalize, TypeCast and HWC2CHW
+    Expectation: The outputs are equal
+    """
+    logger.info("Test FusedNormalize")
+    mean = [121.0, 115.0, 100.0]
+    std = [70.0, 68.0, 71.0]
+    check_same_as_sequential(vision.FusedNormalize(mean, std),
+                             [vision.Normalize(mean, std), vision.HWC2CHW()], 0)
+    check_same_as_sequential(vision.FusedNormalize(mean, std, dtype="float16"),
+                             [vision.Normalize(mean, std), transforms.TypeCast(np.float16), vision.HWC2CHW()], 0)
+    check_same_as_sequential(vision.FusedNormalize(mean, std, hwc_to_chw=False), [vision.Normalize(mean, std)], 0)
+
+
+def test_fused_normalize_op_rescale():
+    """
+    Feature: FusedNormalize
+    Description: Test FusedNormalize with a rescale against Rescale, Normalize and HWC2CHW
+    Expectation: The outputs are equal up to the rounding of the rescale
+    """
+    logger.info("Test FusedNormalize with rescale")
+    mean = [0.485, 0.456, 0.406]
+    std = [0.229, 0.224, 0.225]
+    check_same_as_sequential(vision.FusedNormalize(mean, std, rescale=1.0 / 255.0),
+                             [vision.Rescale(1.0 / 255.0, 0.0), vision.Normalize(mean, std), vision.HWC2CHW()], 1e-5)
+
+
+def test_fused_normalize_op_invalid_param():
+    """
+    Feature: FusedNormalize
+    Description: Test FusedNormalize with invalid parameters
+    Expectation: Errors are raised
+    """
+    logger.info("Test FusedNormalize with invalid parameters")
+    with pytest.raises(ValueError) as error_info:
+        vision.FusedNormalize([121.0, 115.0, 100.0], [70.0, 68.0, 71.0], dtype="int32")
+    assert "dtype only supports float32 or float16" in str(error_info.value)
+    with pytest.raises(TypeError) as error_info:
+        vision.FusedNormalize([121.0, 115.0, 100.0], [70.0, 68.0, 71.0], rescale="1.0")
+    assert "rescale" in str(error_info.value)
+    with pytest.raises(TypeError) as error_info:
+        vision.FusedNormalize([121.0, 115.0, 100.0], [70.0, 68.0, 71.0], hwc_to_chw=1)
+    assert "hwc_to_chw" in str(error_info.value)
+    with pytest.raises(ValueError) as error_info:
+        vision.FusedNormalize([121.0, 115.0, 100.0], [0.0, 68.0, 71.0])
+    assert "std[0]" in str(error_info.value)
+
+
+if __name__ == "__main__":
+    test_fused_normalize_op()
+    test_fused_normalize_op_rescale()
+    test_fused_normalize_op_invalid_param()
@@ -12,6 +12,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 # ==============================================================================
+import os
 import random
 import pytest
 import numpy as np
@@ -333,6 +334,34 @@ def test_graphdata_getedgesfromnodes():
     assert edges.tolist() == [1, 9, 31, 17, 20, 40]
 
 
+def test_graphdata_save_graph():
+    """
+    Feature: GraphData
+    Description: Test GraphData save_graph, then loading the graph from the graph file
+    Expectation: The graph loaded from the graph file gives the same output as the one loaded from mindrecord
+    """
+    logger.info('test save_graph\n')
+    graph_file = "./test_graphdata_save_graph.graph"
+    g = ds.GraphData(DATASET_FILE, 2)
+    g.save_graph(graph_file)
+    loaded = ds.GraphData(graph_file)
+    try:
+        assert g.graph_info() == loaded.graph_info()
+        nodes = g.get_all_nodes(1)
+        assert nodes.tolist() == loaded.get_all_nodes(1).tolist()
+        assert g.get_all_neighbors(nodes, 2).tolist() == loaded.get_all_neighbors(nodes, 2).tolist()
+        features = g.get_node_feature(nodes, [1, 2, 3])
+        loaded_features = loaded.get_node_feature(nodes, [1, 2, 3])
+        for feature, loaded_feature in zip(features, loaded_features):
+            np.testing.assert_array_equal(feature, loaded_feature)
+        edges = g.get_all_edges(0)
+        np.testing.assert_array_equal(g.get_nodes_from_edges(edges), loaded.get_nodes_from_edges(edges))
+        neighbors = loaded.get_sampled_neighbors(nodes, [2, 3], [2, 1], SamplingStrategy.EDGE_WEIGHT)
+        assert neighbors.shape == (10, 9)
+    finally:
+        os.remove(graph_file)
+
+
 if __name__ == '__main__':
     test_graphdata_getfullneighbor()
     test_graphdata_getnodefeature_input_check()
@@ -346,3 +375,4 @@ if __name__ == '__main__':
     test_graphdata_getedgesfromnodes()
     test_graphdata_getnodefeature_invalidcase()
     test_graphdata_getedgefeature_invalidcase()
+    test_graphdata_save_graph()
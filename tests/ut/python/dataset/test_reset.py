@@ -134,6 +134,96 @@ def run_reset_error(data, num_epochs: int, failure_point: int):
         assert "Cannot reset the pipeline, reset step must be >= 0." in str(err.value)
 
 
+def run_save_restore(create_dataset, num_epochs, save_step, check_next_epochs=True):
+    """
+    Save the state of a pipeline after a step, restore it into a new pipeline created with another seed, and check
+    that the new pipeline returns the rows the first one returned after the step.
+    """
+    original_seed = ds.config.get_seed()
+    ds.config.set_seed(1)
+    itr = create_dataset().create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    expected = []
+    state = None
+    for _ in range(num_epochs):
+        for d in itr:
+            expected.append(d)
+            if len(expected) == save_step:
+                state = itr._save_state(save_step)  # pylint: disable=W0212
+    assert state is not None
+    size = len(expected) // num_epochs
+
+    ds.config.set_seed(2)
+    restored = create_dataset().create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    restored._restore(state)  # pylint: disable=W0212
+    actual = []
+    for _ in range(save_step // size, num_epochs):
+        for d in restored:
+            actual.append(d)
+    ds.config.set_seed(original_seed)
+
+    assert len(actual) == len(expected) - save_step
+    # Without a fixed seed, only the epoch of the step is replayed the same by the ops which draw a seed every epoch.
+    end = len(expected) if check_next_epochs else (save_step // size + 1) * size
+    for x, y in zip(expected[save_step:end], actual):
+        np.testing.assert_array_equal(x, y)
+
+
+def test_save_restore_random_sampler():
+    """
+    Feature: Dataset recovery
+    Description: Save the state of a pipeline with a mappable leaf node and a random sampler, with and without
+        replacement, then restore it into a new pipeline
+    Expectation: The new pipeline returns the same rows after the step
+    """
+    dataset_size = 20
+    num_epochs = 3
+
+    for replacement in (False, True):
+        def create_dataset(replacement=replacement):
+            data = ds.Cifar100Dataset("../data/dataset/testCifar100Data",
+                                      sampler=ds.RandomSampler(replacement=replacement, num_samples=dataset_size))
+            return data.project(["image"])
+
+        for save_step in range(1, dataset_size * num_epochs, 7):
+            run_save_restore(create_dataset, num_epochs=num_epochs, save_step=save_step)
+
+
+def test_save_restore_shuffle():
+    """
+    Feature: Dataset recovery
+    Description: Save the state of a pipeline with a shuffle op, then restore it into a new pipeline
+    Expectation: The new pipeline returns the same rows after the step
+    """
+    dataset_size = 30
+    num_epochs = 3
+    np_data = np.random.random((dataset_size, 4, 3))
+
+    def create_dataset():
+        data = ds.NumpySlicesDataset(np_data, shuffle=False)
+        return data.shuffle(buffer_size=10)
+
+    for save_step in range(1, dataset_size * num_epochs, 7):
+        run_save_restore(create_dataset, num_epochs=num_epochs, save_step=save_step)
+
+
+def test_save_restore_tfrecord_shuffle_files():
+    """
+    Feature: Dataset recovery
+    Description: Save the state of a pipeline with a TFRecordDataset shuffling its files, then restore it into a new
+        pipeline
+    Expectation: The new pipeline returns the same rows after the step in the epoch of the step
+    """
+    files = ["../data/dataset/tf_file_dataset/test{}.data".format(i) for i in range(1, 6)]
+    num_epochs = 2
+
+    def create_dataset():
+        return ds.TFRecordDataset(files, shuffle=ds.Shuffle.FILES)
+
+    dataset_size = create_dataset().get_dataset_size()
+    for save_step in range(1, dataset_size * num_epochs, 9):
+        run_save_restore(create_dataset, num_epochs=num_epochs, save_step=save_step, check_next_epochs=False)
+
+
 def test_reset_np():
     """
     Feature: Dataset recovery
@@ -230,3 +320,6 @@ if __name__ == "__main__":
     test_reset_imagenet()
     test_reset_mindrecord(add_and_remove_cv_file)
     test_reset_np_error()
+    test_save_restore_random_sampler()
+    test_save_restore_shuffle()
+    test_save_restore_tfrecord_shuffle_files()